@@ -0,0 +1,73 @@
+#include "Benchmarks.hpp"
+#include <chrono>
+#include <stdio.h>
+
+namespace wfe {
+	/// @brief The maximum possible number of benchmark callbacks.
+	static const size_t MAX_BENCHMARK_CALLBACK_COUNT = 256;
+
+	/// @brief The number of benchmark callbacks.
+	static size_t benchmarkCallbackCount = 0;
+	/// @brief An array of every benchmark callback.
+	static BenchmarkCallback benchmarkCallbacks[MAX_BENCHMARK_CALLBACK_COUNT];
+
+	/// @brief Gets the current time of a monotonic clock.
+	/// @return The current time, in nanoseconds.
+	static uint64_t GetTimeNanoseconds() {
+		return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+	}
+
+	void Benchmark::Start() {
+		// Save the current time
+		startTime = GetTimeNanoseconds();
+	}
+	void Benchmark::Stop(size_t operations) {
+		// Calculate the elapsed time and save the operation count
+		elapsedTime = (float64_t)(GetTimeNanoseconds() - startTime) * 1e-9;
+		operationCount = operations;
+	}
+
+	void AddBenchmarkCallback(BenchmarkCallback callback) {
+		// Only add the callback to the list if the size doesn't surpass the max size
+		if(benchmarkCallbackCount < MAX_BENCHMARK_CALLBACK_COUNT) {
+			benchmarkCallbacks[benchmarkCallbackCount++] = callback;
+		} else {
+			++benchmarkCallbackCount; // For debug purposes
+		}
+	}
+	void RunBenchmarks() {
+		// Check if there are any benchmark callbacks that weren't included
+		if(benchmarkCallbackCount > MAX_BENCHMARK_CALLBACK_COUNT) {
+			// Output a warning and set the count to the max value
+			printf("WARNING: %llu benchmark callbacks couldn't be included in the list! Increase the MAX_BENCHMARK_CALLBACK_COUNT in bench/Benchmarks.cpp.", (unsigned long long)(benchmarkCallbackCount - MAX_BENCHMARK_CALLBACK_COUNT));
+			benchmarkCallbackCount = MAX_BENCHMARK_CALLBACK_COUNT;
+		}
+
+		BenchmarkList benchmarkList;
+		benchmarkList.benchmarkCount = 0;
+
+		// Run every benchmark callback
+		for(size_t i = 0; i != benchmarkCallbackCount; ++i) {
+			// Run the callback
+			benchmarkCallbacks[i](benchmarkList);
+
+			printf("%s benchmarks:\n", benchmarkList.name);
+
+			// Output every benchmark's time and throughput
+			for(size_t j = 0; j != benchmarkList.benchmarkCount; ++j) {
+				Benchmark& benchmark = benchmarkList.benchmarks[j];
+
+				float64_t operationsPerSecond = 0.0;
+				if(benchmark.elapsedTime > 0.0)
+					operationsPerSecond = (float64_t)benchmark.operationCount / benchmark.elapsedTime;
+
+				printf("  %-48s %12.3f ms %16.0f ops/s\n", benchmark.name, benchmark.elapsedTime * 1e3, operationsPerSecond);
+			}
+
+			printf("\n");
+
+			// Reset the benchmark list
+			benchmarkList.benchmarkCount = 0;
+		}
+	}
+}
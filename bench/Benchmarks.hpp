@@ -0,0 +1,55 @@
+#pragma once
+
+#include "Core.hpp"
+
+namespace wfe {
+	/// @brief The maximum possible number of benchmarks for every list.
+	const size_t MAX_BENCHMARK_COUNT_LIST = 128;
+
+	/// @brief Stores a single benchmark's info and its measured time.
+	struct Benchmark {
+		/// @brief The benchmark's name.
+		const char_t* name;
+		/// @brief The number of operations executed by the benchmark.
+		size_t operationCount;
+		/// @brief The time, in seconds, taken by the benchmark.
+		float64_t elapsedTime;
+		/// @brief The time point, in nanoseconds, at which the benchmark was started.
+		uint64_t startTime;
+
+		/// @brief Starts measuring the benchmark's time.
+		void Start();
+		/// @brief Stops measuring the benchmark's time.
+		/// @param operations The number of operations executed since the benchmark was started.
+		void Stop(size_t operations);
+	};
+
+	/// @brief Stores a list of benchmarks which fall under a larger category.
+	struct BenchmarkList {
+		/// @brief The benchmark list's name.
+		const char_t* name;
+		/// @brief The number of benchmarks in the list.
+		size_t benchmarkCount;
+		/// @brief An array of every benchmark in the list.
+		Benchmark benchmarks[MAX_BENCHMARK_COUNT_LIST];
+	};
+
+	/// @brief Called when benchmarks are run.
+	typedef void(*BenchmarkCallback)(BenchmarkList&);
+
+	/// @brief Adds the given benchmark callback to the list of callbacks to be run when benchmarks are run.
+	void AddBenchmarkCallback(BenchmarkCallback callback);
+	/// @brief Runs all benchmarks.
+	void RunBenchmarks();
+}
+
+/// @brief Adds the given benchmark callback to the list of callbacks to be run when benchmarks are run.
+#define WFE_ADD_BENCHMARK_CALLBACK(callback) \
+namespace { \
+	struct BenchmarkCallbackAdder { \
+		BenchmarkCallbackAdder() { \
+			wfe::AddBenchmarkCallback(callback); \
+		} \
+	}; \
+	BenchmarkCallbackAdder callbackAdder; \
+}
@@ -0,0 +1,181 @@
+#include "Benchmarks.hpp"
+
+namespace wfe {
+	static const size_t ALLOCATOR_BENCHMARK_ALLOCATION_COUNT = 1048576;
+	static const size_t ALLOCATOR_BENCHMARK_BATCH_SIZE = 64;
+	static const size_t ALLOCATOR_BENCHMARK_VECTOR_COUNT = 65536;
+	static const size_t ALLOCATOR_BENCHMARK_MAP_COUNT = 16384;
+	static const size_t ALLOCATOR_BENCHMARK_LARGE_VECTOR_SIZE = 33554432;
+
+	struct AllocatorBenchmarkArgs {
+		size_t minSize;
+		size_t maxSize;
+		size_t allocationCount;
+	};
+
+	static void* AllocatorBenchmarkThread(void* args) {
+		AllocatorBenchmarkArgs* benchmarkArgs = (AllocatorBenchmarkArgs*)args;
+		void* blocks[ALLOCATOR_BENCHMARK_BATCH_SIZE];
+		size_t sizeRange = benchmarkArgs->maxSize - benchmarkArgs->minSize + 1;
+		size_t seed = 1;
+
+		// Allocate and free batches of blocks with pseudo-random sizes in the given range
+		for(size_t i = 0; i != benchmarkArgs->allocationCount; i += ALLOCATOR_BENCHMARK_BATCH_SIZE) {
+			for(size_t j = 0; j != ALLOCATOR_BENCHMARK_BATCH_SIZE; ++j) {
+				seed = seed * 6364136223846793005ull + 1442695040888963407ull;
+				blocks[j] = AllocMemory(benchmarkArgs->minSize + (seed >> 33) % sizeRange);
+			}
+			for(size_t j = 0; j != ALLOCATOR_BENCHMARK_BATCH_SIZE; ++j)
+				FreeMemory(blocks[j]);
+		}
+
+		return nullptr;
+	}
+
+	static void RunAllocatorBenchmark(Benchmark& benchmark, size_t minSize, size_t maxSize, size_t threadCount) {
+		AllocatorBenchmarkArgs args { minSize, maxSize, ALLOCATOR_BENCHMARK_ALLOCATION_COUNT / threadCount };
+		Thread* threads = NewArray<Thread>(threadCount);
+
+		// Split the allocation count between all threads and wait for them to finish
+		benchmark.Start();
+
+		for(size_t i = 0; i != threadCount; ++i)
+			threads[i].Begin(AllocatorBenchmarkThread, &args);
+		for(size_t i = 0; i != threadCount; ++i)
+			threads[i].Join();
+
+		benchmark.Stop(args.allocationCount * threadCount);
+
+		DestroyArray(threads, threadCount);
+	}
+
+	void AllocatorBenchmarkCallback(BenchmarkList& benchmarkList) {
+		benchmarkList.name = "Allocator";
+
+		/* Benchmark AllocMemory and FreeMemory with different block sizes and thread counts */ {
+			const size_t minSizes[] { 16, 16, 16, 1024 };
+			const size_t maxSizes[] { 64, 1024, 1024, 4096 };
+			const size_t threadCounts[] { 1, 1, 4, 1 };
+			const char_t* names[] { "AllocMemory 16-64 B 1 thread", "AllocMemory 16-1024 B 1 thread", "AllocMemory 16-1024 B 4 threads", "AllocMemory 1024-4096 B 1 thread" };
+
+			for(size_t i = 0; i != sizeof(threadCounts) / sizeof(size_t); ++i) {
+				Benchmark& benchmark = benchmarkList.benchmarks[benchmarkList.benchmarkCount++];
+
+				benchmark.name = names[i];
+				RunAllocatorBenchmark(benchmark, minSizes[i], maxSizes[i], threadCounts[i]);
+			}
+		}
+		/* Benchmark AllocMemory and FreeMemory with the allocation profiler enabled at its default sample interval */ {
+			Benchmark& benchmark = benchmarkList.benchmarks[benchmarkList.benchmarkCount++];
+
+			SetAllocationProfilerEnabled(true);
+
+			benchmark.name = "AllocMemory 16-1024 B 1 thread, profiled";
+			RunAllocatorBenchmark(benchmark, 16, 1024, 1);
+
+			SetAllocationProfilerEnabled(false);
+		}
+		/* Benchmark short-lived vector churn */ {
+			Benchmark& benchmark = benchmarkList.benchmarks[benchmarkList.benchmarkCount++];
+
+			benchmark.name = "vector<uint32_t> 64 push_back churn";
+			benchmark.Start();
+
+			for(size_t i = 0; i != ALLOCATOR_BENCHMARK_VECTOR_COUNT; ++i) {
+				vector<uint32_t> values;
+				for(uint32_t j = 0; j != 64; ++j)
+					values.push_back(j);
+			}
+
+			benchmark.Stop(ALLOCATOR_BENCHMARK_VECTOR_COUNT);
+		}
+		/* Benchmark short-lived map churn, which grows its storage through ReallocMemory */ {
+			Benchmark& benchmark = benchmarkList.benchmarks[benchmarkList.benchmarkCount++];
+
+			benchmark.name = "map<uint32_t, uint32_t> 64 insert churn";
+			benchmark.Start();
+
+			for(size_t i = 0; i != ALLOCATOR_BENCHMARK_MAP_COUNT; ++i) {
+				map<uint32_t, uint32_t> values;
+				for(uint32_t j = 0; j != 64; ++j)
+					values[j] = j;
+			}
+
+			benchmark.Stop(ALLOCATOR_BENCHMARK_MAP_COUNT);
+		}
+		/* Benchmark growing a large vector, with and without the large allocation path */ {
+			const size_t thresholds[] { SIZE_T_MAX, DEFAULT_LARGE_ALLOCATION_THRESHOLD };
+			const char_t* names[] { "vector<float32_t> 32M push_back, heap", "vector<float32_t> 32M push_back, large path" };
+
+			size_t oldThreshold = GetLargeAllocationThreshold();
+
+			for(size_t i = 0; i != sizeof(thresholds) / sizeof(size_t); ++i) {
+				Benchmark& benchmark = benchmarkList.benchmarks[benchmarkList.benchmarkCount++];
+
+				SetLargeAllocationThreshold(thresholds[i]);
+
+				benchmark.name = names[i];
+				benchmark.Start();
+
+				{
+					vector<float32_t> values;
+					for(size_t j = 0; j != ALLOCATOR_BENCHMARK_LARGE_VECTOR_SIZE; ++j)
+						values.push_back((float32_t)j);
+				}
+
+				benchmark.Stop(ALLOCATOR_BENCHMARK_LARGE_VECTOR_SIZE);
+			}
+
+			SetLargeAllocationThreshold(oldThreshold);
+		}
+		/* Benchmark short-lived vector churn in the command arena, reset every 64 vectors like a frame */ {
+			Benchmark& benchmark = benchmarkList.benchmarks[benchmarkList.benchmarkCount++];
+
+			SetCommandArenaEnabled(true);
+			PushMemoryUsageType(MEMORY_USAGE_TYPE_COMMAND);
+
+			benchmark.name = "vector<uint32_t> 64 push_back churn, arena";
+			benchmark.Start();
+
+			for(size_t i = 0; i != ALLOCATOR_BENCHMARK_VECTOR_COUNT; ++i) {
+				{
+					vector<uint32_t> values;
+					for(uint32_t j = 0; j != 64; ++j)
+						values.push_back(j);
+				}
+
+				if(!(i & 63))
+					ResetCommandArena();
+			}
+
+			benchmark.Stop(ALLOCATOR_BENCHMARK_VECTOR_COUNT);
+
+			PopMemoryUsageType();
+			ResetCommandArena();
+			SetCommandArenaEnabled(false);
+		}
+		/* Benchmark short-lived vector churn in an arena memory resource, reset every 64 vectors like a frame */ {
+			Benchmark& benchmark = benchmarkList.benchmarks[benchmarkList.benchmarkCount++];
+
+			ArenaAllocator arena;
+
+			benchmark.name = "vector<uint32_t> 64 push_back churn, memory resource";
+			benchmark.Start();
+
+			for(size_t i = 0; i != ALLOCATOR_BENCHMARK_VECTOR_COUNT; ++i) {
+				{
+					vector<uint32_t> values(arena);
+					for(uint32_t j = 0; j != 64; ++j)
+						values.push_back(j);
+				}
+
+				if(!(i & 63))
+					arena.Reset();
+			}
+
+			benchmark.Stop(ALLOCATOR_BENCHMARK_VECTOR_COUNT);
+		}
+	}
+
+	WFE_ADD_BENCHMARK_CALLBACK(AllocatorBenchmarkCallback)
+}
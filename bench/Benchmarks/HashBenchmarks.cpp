@@ -0,0 +1,137 @@
+#include "Benchmarks.hpp"
+#include <stdio.h>
+
+namespace wfe {
+	static const size_t HASH_BENCHMARK_TOTAL_SIZE = 268435456;
+	static const size_t HASH_BENCHMARK_MAX_ITERATION_COUNT = 16777216;
+	static const size_t HASH_BENCHMARK_MAX_NAME_LENGTH = 48;
+	static const size_t HASH_BENCHMARK_KEY_COUNT = 65536;
+	static const size_t HASH_BENCHMARK_LOOKUP_COUNT = 4194304;
+
+	typedef uint64_t(*HashBenchmarkFunction)(const void* data, size_t size, uint64_t seed);
+
+	static uint64_t HashBenchmarkFNV1a(const void* data, size_t size, uint64_t seed) {
+		// Hash the block one byte at a time, like the previous string hash
+		const uint8_t* ptr = (const uint8_t*)data;
+		uint64_t hash = 0x811c9dc5 ^ seed;
+		for(size_t i = 0; i != size; ++i) {
+			hash ^= ptr[i];
+			hash *= 0x9ddfea08eb382d69;
+		}
+
+		return hash;
+	}
+
+	static void RunHashBenchmark(Benchmark& benchmark, HashBenchmarkFunction func, const char_t* data, size_t size) {
+		// Call the function through a volatile pointer, so that repeated hashes can't be optimized away
+		HashBenchmarkFunction volatile hashFunc = func;
+
+		size_t iterationCount = HASH_BENCHMARK_TOTAL_SIZE / size;
+		if(iterationCount > HASH_BENCHMARK_MAX_ITERATION_COUNT)
+			iterationCount = HASH_BENCHMARK_MAX_ITERATION_COUNT;
+
+		// Feed every hash into the next one's seed, which measures the latency of short keys as seen by hash table lookups
+		uint64_t hash = 0;
+
+		benchmark.Start();
+
+		for(size_t i = 0; i != iterationCount; ++i)
+			hash = hashFunc(data, size, hash);
+
+		benchmark.Stop(iterationCount * size);
+
+		volatile uint64_t result = hash;
+		(void)result;
+	}
+	template<class Map, class Key>
+	static void RunHashMapBenchmark(Benchmark& benchmark, const Map& map, const Key* keys) {
+		// Look up the keys in a pseudo-random order
+		size_t sum = 0;
+		uint32_t seed = 1;
+
+		benchmark.Start();
+
+		for(size_t i = 0; i != HASH_BENCHMARK_LOOKUP_COUNT; ++i) {
+			seed = seed * 1664525u + 1013904223u;
+			sum += map.find(keys[seed % HASH_BENCHMARK_KEY_COUNT])->second;
+		}
+
+		benchmark.Stop(HASH_BENCHMARK_LOOKUP_COUNT);
+
+		volatile size_t result = sum;
+		(void)result;
+	}
+
+	void HashBenchmarkCallback(BenchmarkList& benchmarkList) {
+		benchmarkList.name = "Hash (ops/s are bytes/s, lookups/s for maps)";
+
+		const size_t sizes[] { 4, 8, 16, 32, 64, 256, 4096, 1048576 };
+		const char_t* sizeNames[] { "4 B", "8 B", "16 B", "32 B", "64 B", "256 B", "4 KiB", "1 MiB" };
+		const size_t sizeCount = sizeof(sizes) / sizeof(size_t);
+
+		static char_t names[sizeCount * 2][HASH_BENCHMARK_MAX_NAME_LENGTH];
+		size_t nameCount = 0;
+
+		/* Benchmark HashMemory against FNV-1a */ {
+			char_t* data = (char_t*)AllocMemory(sizes[sizeCount - 1]);
+			for(size_t i = 0; i != sizes[sizeCount - 1]; ++i)
+				data[i] = (char_t)(i * 7 + 3);
+
+			const char_t* implNames[] { "HashMemory", "FNV-1a" };
+			HashBenchmarkFunction funcs[] { HashMemory, HashBenchmarkFNV1a };
+
+			for(size_t i = 0; i != sizeCount; ++i) {
+				for(size_t j = 0; j != 2; ++j) {
+					Benchmark& hashBenchmark = benchmarkList.benchmarks[benchmarkList.benchmarkCount++];
+
+					snprintf(names[nameCount], HASH_BENCHMARK_MAX_NAME_LENGTH, "%s %s", implNames[j], sizeNames[i]);
+					hashBenchmark.name = names[nameCount++];
+					RunHashBenchmark(hashBenchmark, funcs[j], data, sizes[i]);
+				}
+			}
+
+			FreeMemory(data);
+		}
+		/* Benchmark string lookups in the unordered maps */ {
+			// Generate asset-like paths as keys, creating enough buckets up front that the maps never rehash
+			string* keys = NewArray<string>(HASH_BENCHMARK_KEY_COUNT);
+			unordered_map<string, size_t> map(HASH_BENCHMARK_KEY_COUNT << 1);
+			flat_unordered_map<string, size_t> flatMap;
+			flatMap.reserve(HASH_BENCHMARK_KEY_COUNT);
+			char_t key[64];
+
+			for(size_t i = 0; i != HASH_BENCHMARK_KEY_COUNT; ++i) {
+				snprintf(key, sizeof(key), "assets/textures/material_%zu/albedo_%zu.png", i % 97, i);
+				keys[i] = key;
+				map.insert({ keys[i], i });
+				flatMap.insert({ keys[i], i });
+			}
+
+			Benchmark& mapBenchmark = benchmarkList.benchmarks[benchmarkList.benchmarkCount++];
+			mapBenchmark.name = "unordered_map<string> find, 64Ki keys";
+			RunHashMapBenchmark(mapBenchmark, map, keys);
+
+			Benchmark& flatMapBenchmark = benchmarkList.benchmarks[benchmarkList.benchmarkCount++];
+			flatMapBenchmark.name = "flat_unordered_map<string> find, 64Ki keys";
+			RunHashMapBenchmark(flatMapBenchmark, flatMap, keys);
+
+			// Look up the same keys given as C strings, which both maps hash and compare in place
+			const char_t** cKeys = (const char_t**)AllocMemory(HASH_BENCHMARK_KEY_COUNT * sizeof(const char_t*));
+			for(size_t i = 0; i != HASH_BENCHMARK_KEY_COUNT; ++i)
+				cKeys[i] = keys[i].c_str();
+
+			Benchmark& mapCStrBenchmark = benchmarkList.benchmarks[benchmarkList.benchmarkCount++];
+			mapCStrBenchmark.name = "unordered_map<string> find(const char_t*), 64Ki keys";
+			RunHashMapBenchmark(mapCStrBenchmark, map, cKeys);
+
+			Benchmark& flatMapCStrBenchmark = benchmarkList.benchmarks[benchmarkList.benchmarkCount++];
+			flatMapCStrBenchmark.name = "flat_unordered_map<string> find(const char_t*), 64Ki keys";
+			RunHashMapBenchmark(flatMapCStrBenchmark, flatMap, cKeys);
+
+			FreeMemory(cKeys);
+			DestroyArray(keys, HASH_BENCHMARK_KEY_COUNT);
+		}
+	}
+
+	WFE_ADD_BENCHMARK_CALLBACK(HashBenchmarkCallback)
+}
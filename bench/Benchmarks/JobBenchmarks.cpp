@@ -0,0 +1,101 @@
+#include "Benchmarks.hpp"
+
+namespace wfe {
+	static const size_t JOB_BENCHMARK_JOB_COUNT = 16384;
+	static const size_t JOB_BENCHMARK_JOB_WORK = 2048;
+
+	static atomic_size_t jobBenchmarkSink;
+
+	static void* JobBenchmarkFunction(void* args) {
+		// Run a small amount of work to simulate a real job
+		size_t val = (size_t)args;
+		for(size_t i = 0; i != JOB_BENCHMARK_JOB_WORK; ++i)
+			val = val * 6364136223846793005ULL + 1442695040888963407ULL;
+
+		jobBenchmarkSink.fetch_add(val & 1, std::memory_order_relaxed);
+
+		return nullptr;
+	}
+
+	static void* JobBenchmarkEmptyFunction(void* args) {
+		return args;
+	}
+
+	static void RunSubmitBenchmark(Benchmark& benchmark, size_t threadCount, bool8_t batched) {
+		// Create the job manager and the job arrays
+		JobManager jobManager(threadCount);
+		JobManager::Result* results = NewArray<JobManager::Result>(JOB_BENCHMARK_JOB_COUNT);
+		JobManager::JobFunction* funcs = NewArray<JobManager::JobFunction>(JOB_BENCHMARK_JOB_COUNT);
+		void** args = NewArray<void*>(JOB_BENCHMARK_JOB_COUNT);
+
+		for(size_t i = 0; i != JOB_BENCHMARK_JOB_COUNT; ++i) {
+			funcs[i] = JobBenchmarkEmptyFunction;
+			args[i] = (void*)i;
+		}
+
+		// Submit every empty job and wait for all of them to finish
+		benchmark.Start();
+
+		if(batched) {
+			jobManager.SubmitJobs(JOB_BENCHMARK_JOB_COUNT, funcs, args, results);
+		} else {
+			for(size_t i = 0; i != JOB_BENCHMARK_JOB_COUNT; ++i)
+				jobManager.SubmitJob(funcs[i], args[i], results[i]);
+		}
+		for(size_t i = 0; i != JOB_BENCHMARK_JOB_COUNT; ++i)
+			results[i].WaitForResult();
+
+		benchmark.Stop(JOB_BENCHMARK_JOB_COUNT);
+
+		DestroyArray(args, JOB_BENCHMARK_JOB_COUNT);
+		DestroyArray(funcs, JOB_BENCHMARK_JOB_COUNT);
+		DestroyArray(results, JOB_BENCHMARK_JOB_COUNT);
+	}
+
+	static void RunJobBenchmark(Benchmark& benchmark, size_t threadCount) {
+		// Create the job manager and a result for every job
+		JobManager jobManager(threadCount);
+		JobManager::Result* results = NewArray<JobManager::Result>(JOB_BENCHMARK_JOB_COUNT);
+
+		// Submit every job and wait for all of them to finish
+		benchmark.Start();
+
+		for(size_t i = 0; i != JOB_BENCHMARK_JOB_COUNT; ++i)
+			jobManager.SubmitJob(JobBenchmarkFunction, (void*)i, results[i]);
+		for(size_t i = 0; i != JOB_BENCHMARK_JOB_COUNT; ++i)
+			results[i].WaitForResult();
+
+		benchmark.Stop(JOB_BENCHMARK_JOB_COUNT);
+
+		DestroyArray(results, JOB_BENCHMARK_JOB_COUNT);
+	}
+
+	void JobBenchmarkCallback(BenchmarkList& benchmarkList) {
+		benchmarkList.name = "Job";
+
+		/* Benchmark job throughput with different worker counts */ {
+			const size_t threadCounts[] { 1, 2, 4, 8, 16 };
+			const char_t* names[] { "SubmitJob 1 worker", "SubmitJob 2 workers", "SubmitJob 4 workers", "SubmitJob 8 workers", "SubmitJob 16 workers" };
+
+			for(size_t i = 0; i != sizeof(threadCounts) / sizeof(size_t); ++i) {
+				Benchmark& benchmark = benchmarkList.benchmarks[benchmarkList.benchmarkCount++];
+
+				benchmark.name = names[i];
+				RunJobBenchmark(benchmark, threadCounts[i]);
+			}
+		}
+		/* Benchmark one-at-a-time submission against batched submission */ {
+			Benchmark& benchmark1 = benchmarkList.benchmarks[benchmarkList.benchmarkCount++];
+
+			benchmark1.name = "SubmitJob empty jobs";
+			RunSubmitBenchmark(benchmark1, 4, false);
+
+			Benchmark& benchmark2 = benchmarkList.benchmarks[benchmarkList.benchmarkCount++];
+
+			benchmark2.name = "SubmitJobs empty jobs";
+			RunSubmitBenchmark(benchmark2, 4, true);
+		}
+	}
+
+	WFE_ADD_BENCHMARK_CALLBACK(JobBenchmarkCallback)
+}
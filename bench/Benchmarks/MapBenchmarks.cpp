@@ -0,0 +1,106 @@
+#include "Benchmarks.hpp"
+#include <stdio.h>
+#include <map>
+
+namespace wfe {
+	static const size_t MAP_BENCHMARK_MAX_NAME_LENGTH = 64;
+	static const size_t MAP_BENCHMARK_OPERATION_COUNT = 4;
+
+	static void GenerateMapBenchmarkKeys(uint64_t* keys, size_t keyCount, uint64_t seed) {
+		// Generate pseudo-random keys, which are unique with overwhelming probability
+		for(size_t i = 0; i != keyCount; ++i) {
+			seed = seed * 6364136223846793005ull + 1442695040888963407ull;
+			keys[i] = seed ^ (seed >> 29);
+		}
+	}
+
+	template<class Map>
+	static void RunMapBenchmark(Benchmark* benchmarks, Map& map, const uint64_t* keys, const uint64_t* missingKeys, size_t keyCount) {
+		size_t sum = 0;
+
+		// Insert every key in a random order
+		benchmarks[0].Start();
+
+		for(size_t i = 0; i != keyCount; ++i)
+			map.insert({ keys[i], i });
+
+		benchmarks[0].Stop(keyCount);
+
+		// Find every key, in a different order than they were inserted in
+		benchmarks[1].Start();
+
+		for(size_t i = keyCount; i; --i)
+			sum += map.find(keys[i - 1])->second;
+
+		benchmarks[1].Stop(keyCount);
+
+		// Find the lower bounds of keys that were never inserted
+		benchmarks[2].Start();
+
+		for(size_t i = 0; i != keyCount; ++i)
+			sum += map.lower_bound(missingKeys[i]) == map.end();
+
+		benchmarks[2].Stop(keyCount);
+
+		// Erase every key
+		benchmarks[3].Start();
+
+		for(size_t i = 0; i != keyCount; ++i)
+			sum += map.erase(keys[i]);
+
+		benchmarks[3].Stop(keyCount);
+
+		volatile size_t result = sum;
+		(void)result;
+	}
+
+	void MapBenchmarkCallback(BenchmarkList& benchmarkList) {
+		benchmarkList.name = "Map (ops/s are keys/s)";
+
+		// Keep the key counts low enough that the sorted array map's quadratic inserts and erases finish quickly
+		const size_t keyCounts[] { 1024, 16384, 131072 };
+		const char_t* keyCountNames[] { "1Ki keys", "16Ki keys", "128Ki keys" };
+		const size_t keyCountCount = sizeof(keyCounts) / sizeof(size_t);
+
+		const char_t* implNames[] { "btree_map", "map", "std::map" };
+		const size_t implCount = sizeof(implNames) / sizeof(const char_t*);
+		const char_t* operationNames[MAP_BENCHMARK_OPERATION_COUNT] { "insert", "find", "lower_bound", "erase" };
+
+		static char_t names[keyCountCount * implCount * MAP_BENCHMARK_OPERATION_COUNT][MAP_BENCHMARK_MAX_NAME_LENGTH];
+		size_t nameCount = 0;
+
+		for(size_t i = 0; i != keyCountCount; ++i) {
+			size_t keyCount = keyCounts[i];
+			uint64_t* keys = (uint64_t*)AllocMemory(keyCount * sizeof(uint64_t));
+			uint64_t* missingKeys = (uint64_t*)AllocMemory(keyCount * sizeof(uint64_t));
+			GenerateMapBenchmarkKeys(keys, keyCount, 1);
+			GenerateMapBenchmarkKeys(missingKeys, keyCount, 2);
+
+			for(size_t j = 0; j != implCount; ++j) {
+				// Name the benchmarks of every operation
+				Benchmark* benchmarks = benchmarkList.benchmarks + benchmarkList.benchmarkCount;
+				for(size_t k = 0; k != MAP_BENCHMARK_OPERATION_COUNT; ++k) {
+					snprintf(names[nameCount], MAP_BENCHMARK_MAX_NAME_LENGTH, "%s %s, %s", implNames[j], operationNames[k], keyCountNames[i]);
+					benchmarks[k].name = names[nameCount++];
+				}
+				benchmarkList.benchmarkCount += MAP_BENCHMARK_OPERATION_COUNT;
+
+				if(j == 0) {
+					btree_map<uint64_t, size_t> map;
+					RunMapBenchmark(benchmarks, map, keys, missingKeys, keyCount);
+				} else if(j == 1) {
+					map<uint64_t, size_t> map;
+					RunMapBenchmark(benchmarks, map, keys, missingKeys, keyCount);
+				} else {
+					std::map<uint64_t, size_t> map;
+					RunMapBenchmark(benchmarks, map, keys, missingKeys, keyCount);
+				}
+			}
+
+			FreeMemory(missingKeys);
+			FreeMemory(keys);
+		}
+	}
+
+	WFE_ADD_BENCHMARK_CALLBACK(MapBenchmarkCallback)
+}
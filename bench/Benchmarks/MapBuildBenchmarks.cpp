@@ -0,0 +1,103 @@
+#include "Benchmarks.hpp"
+#include <stdio.h>
+#include <map>
+
+namespace wfe {
+	static const size_t MAP_BUILD_BENCHMARK_MAX_NAME_LENGTH = 64;
+	static const size_t MAP_BUILD_BENCHMARK_MAX_INSERT_LOOP_COUNT = 65536;
+	static const size_t MAP_BUILD_BENCHMARK_THREAD_COUNT = 4;
+
+	void MapBuildBenchmarkCallback(BenchmarkList& benchmarkList) {
+		benchmarkList.name = "Map building (ops/s are pairs/s)";
+
+		const size_t pairCounts[] { 16384, 65536, 262144 };
+		const char_t* pairCountNames[] { "16Ki pairs", "64Ki pairs", "256Ki pairs" };
+		const size_t pairCountCount = sizeof(pairCounts) / sizeof(size_t);
+
+		const char_t* implNames[] { "map insert loop", "map assign_unsorted", "map assign_unsorted, 4 threads", "map insert_range into half", "btree_map insert loop", "std::map insert loop" };
+		const size_t implCount = sizeof(implNames) / sizeof(const char_t*);
+
+		static char_t names[pairCountCount * implCount][MAP_BUILD_BENCHMARK_MAX_NAME_LENGTH];
+		size_t nameCount = 0;
+
+		JobManager jobManager(MAP_BUILD_BENCHMARK_THREAD_COUNT);
+
+		for(size_t i = 0; i != pairCountCount; ++i) {
+			size_t pairCount = pairCounts[i];
+
+			// Generate pseudo-random pairs, with a few repeated keys
+			pair<uint64_t, size_t>* pairs = (pair<uint64_t, size_t>*)AllocMemory(pairCount * sizeof(pair<uint64_t, size_t>));
+			uint64_t seed = 1;
+			for(size_t j = 0; j != pairCount; ++j) {
+				seed = seed * 6364136223846793005ull + 1442695040888963407ull;
+				new(pairs + j) pair<uint64_t, size_t>((seed >> 16) % (pairCount << 3), j);
+			}
+
+			for(size_t j = 0; j != implCount; ++j) {
+				// Skip the sorted array map's quadratic insert loop for large maps
+				if(j == 0 && pairCount > MAP_BUILD_BENCHMARK_MAX_INSERT_LOOP_COUNT)
+					continue;
+
+				// Name the benchmark
+				Benchmark& benchmark = benchmarkList.benchmarks[benchmarkList.benchmarkCount++];
+				snprintf(names[nameCount], MAP_BUILD_BENCHMARK_MAX_NAME_LENGTH, "%s, %s", implNames[j], pairCountNames[i]);
+				benchmark.name = names[nameCount++];
+
+				size_t size;
+				if(j == 0) {
+					map<uint64_t, size_t> map;
+
+					benchmark.Start();
+					for(size_t k = 0; k != pairCount; ++k)
+						map.insert(pairs[k]);
+					benchmark.Stop(pairCount);
+
+					size = map.size();
+				} else if(j < 3) {
+					map<uint64_t, size_t> map;
+
+					benchmark.Start();
+					map.assign_unsorted(pairs, pairs + pairCount, j == 2 ? &jobManager : nullptr);
+					benchmark.Stop(pairCount);
+
+					size = map.size();
+				} else if(j == 3) {
+					// Insert the second half of the pairs into a map built from the first half
+					map<uint64_t, size_t> map;
+					map.assign_unsorted(pairs, pairs + (pairCount >> 1));
+
+					benchmark.Start();
+					map.insert_range(pairs + (pairCount >> 1), pairs + pairCount);
+					benchmark.Stop(pairCount - (pairCount >> 1));
+
+					size = map.size();
+				} else if(j == 4) {
+					btree_map<uint64_t, size_t> map;
+
+					benchmark.Start();
+					for(size_t k = 0; k != pairCount; ++k)
+						map.insert({ pairs[k].first, pairs[k].second });
+					benchmark.Stop(pairCount);
+
+					size = map.size();
+				} else {
+					std::map<uint64_t, size_t> map;
+
+					benchmark.Start();
+					for(size_t k = 0; k != pairCount; ++k)
+						map.insert({ pairs[k].first, pairs[k].second });
+					benchmark.Stop(pairCount);
+
+					size = map.size();
+				}
+
+				volatile size_t result = size;
+				(void)result;
+			}
+
+			FreeMemory(pairs);
+		}
+	}
+
+	WFE_ADD_BENCHMARK_CALLBACK(MapBuildBenchmarkCallback)
+}
@@ -0,0 +1,103 @@
+#include "Benchmarks.hpp"
+#include <stdio.h>
+#include <map>
+
+namespace wfe {
+	static const size_t MAP_LOOKUP_BENCHMARK_MAX_NAME_LENGTH = 64;
+	static const size_t MAP_LOOKUP_BENCHMARK_OPERATION_COUNT = 2;
+	static const size_t MAP_LOOKUP_BENCHMARK_QUERY_COUNT = 1048576;
+
+	static uint64_t GetMapLookupBenchmarkKey(size_t index) {
+		// Spread the keys out, leaving room for missing keys between every two keys
+		return (index * 2 + 1) * 40503;
+	}
+
+	template<class Map>
+	static void RunMapLookupBenchmark(Benchmark* benchmarks, const Map& map, const size_t* queries) {
+		size_t sum = 0;
+
+		// Find keys at random positions in the map
+		benchmarks[0].Start();
+
+		for(size_t i = 0; i != MAP_LOOKUP_BENCHMARK_QUERY_COUNT; ++i)
+			sum += map.find(GetMapLookupBenchmarkKey(queries[i]))->second;
+
+		benchmarks[0].Stop(MAP_LOOKUP_BENCHMARK_QUERY_COUNT);
+
+		// Find the lower bounds of keys right before the existing ones
+		benchmarks[1].Start();
+
+		for(size_t i = 0; i != MAP_LOOKUP_BENCHMARK_QUERY_COUNT; ++i)
+			sum += map.lower_bound(GetMapLookupBenchmarkKey(queries[i]) - 1)->second;
+
+		benchmarks[1].Stop(MAP_LOOKUP_BENCHMARK_QUERY_COUNT);
+
+		volatile size_t result = sum;
+		(void)result;
+	}
+
+	void MapLookupBenchmarkCallback(BenchmarkList& benchmarkList) {
+		benchmarkList.name = "Map lookups (ops/s are lookups/s)";
+
+		const size_t keyCounts[] { 4096, 65536, 1048576, 4194304 };
+		const char_t* keyCountNames[] { "4Ki keys", "64Ki keys", "1Mi keys", "4Mi keys" };
+		const size_t keyCountCount = sizeof(keyCounts) / sizeof(size_t);
+
+		const char_t* implNames[] { "map", "frozen map", "btree_map", "std::map" };
+		const size_t implCount = sizeof(implNames) / sizeof(const char_t*);
+		const char_t* operationNames[MAP_LOOKUP_BENCHMARK_OPERATION_COUNT] { "find", "lower_bound" };
+
+		static char_t names[keyCountCount * implCount * MAP_LOOKUP_BENCHMARK_OPERATION_COUNT][MAP_LOOKUP_BENCHMARK_MAX_NAME_LENGTH];
+		size_t nameCount = 0;
+
+		size_t* queries = (size_t*)AllocMemory(MAP_LOOKUP_BENCHMARK_QUERY_COUNT * sizeof(size_t));
+
+		for(size_t i = 0; i != keyCountCount; ++i) {
+			size_t keyCount = keyCounts[i];
+
+			// Generate pseudo-random key positions to look up
+			uint64_t seed = 1;
+			for(size_t j = 0; j != MAP_LOOKUP_BENCHMARK_QUERY_COUNT; ++j) {
+				seed = seed * 6364136223846793005ull + 1442695040888963407ull;
+				queries[j] = (size_t)((seed >> 32) % keyCount);
+			}
+
+			for(size_t j = 0; j != implCount; ++j) {
+				// Name the benchmarks of every operation
+				Benchmark* benchmarks = benchmarkList.benchmarks + benchmarkList.benchmarkCount;
+				for(size_t k = 0; k != MAP_LOOKUP_BENCHMARK_OPERATION_COUNT; ++k) {
+					snprintf(names[nameCount], MAP_LOOKUP_BENCHMARK_MAX_NAME_LENGTH, "%s %s, %s", implNames[j], operationNames[k], keyCountNames[i]);
+					benchmarks[k].name = names[nameCount++];
+				}
+				benchmarkList.benchmarkCount += MAP_LOOKUP_BENCHMARK_OPERATION_COUNT;
+
+				// Insert the keys in order, which only appends to the sorted array map
+				if(j < 2) {
+					map<uint64_t, size_t> map;
+					for(size_t k = 0; k != keyCount; ++k)
+						map.insert({ GetMapLookupBenchmarkKey(k), k });
+					if(j == 1)
+						map.freeze();
+
+					RunMapLookupBenchmark(benchmarks, map, queries);
+				} else if(j == 2) {
+					btree_map<uint64_t, size_t> map;
+					for(size_t k = 0; k != keyCount; ++k)
+						map.insert({ GetMapLookupBenchmarkKey(k), k });
+
+					RunMapLookupBenchmark(benchmarks, map, queries);
+				} else {
+					std::map<uint64_t, size_t> map;
+					for(size_t k = 0; k != keyCount; ++k)
+						map.insert({ GetMapLookupBenchmarkKey(k), k });
+
+					RunMapLookupBenchmark(benchmarks, map, queries);
+				}
+			}
+		}
+
+		FreeMemory(queries);
+	}
+
+	WFE_ADD_BENCHMARK_CALLBACK(MapLookupBenchmarkCallback)
+}
@@ -0,0 +1,204 @@
+#include "Benchmarks.hpp"
+#include <stdio.h>
+#include <string.h>
+
+namespace wfe {
+	static const size_t MEMORY_BENCHMARK_TOTAL_SIZE = 268435456;
+	static const size_t MEMORY_BENCHMARK_MAX_ITERATION_COUNT = 4194304;
+	static const size_t MEMORY_BENCHMARK_MAX_NAME_LENGTH = 48;
+	static const size_t MEMORY_BENCHMARK_TEXT_SIZE = 1048576;
+
+	typedef void*(*MemoryBenchmarkCopyFunction)(void* dest, const void* src, size_t size);
+	typedef void*(*MemoryBenchmarkSetFunction)(void* ptr, int32_t c, size_t size);
+	typedef size_t(*MemoryBenchmarkScanFunction)(const char_t* text, int32_t implementation);
+
+	static void* MemoryBenchmarkLibcMemset(void* ptr, int32_t c, size_t size) {
+		return ::memset(ptr, c, size);
+	}
+
+	static size_t MemoryBenchmarkStrlen(const char_t* text, int32_t implementation) {
+		return implementation ? ::strlen(text) : wfe::strlen(text);
+	}
+	static size_t MemoryBenchmarkMemchr(const char_t* text, int32_t implementation) {
+		// Look for a character missing from the text
+		return (size_t)(implementation ? ::memchr(text, '#', MEMORY_BENCHMARK_TEXT_SIZE) : wfe::memchr(text, '#', MEMORY_BENCHMARK_TEXT_SIZE));
+	}
+	static size_t MemoryBenchmarkStrchr(const char_t* text, int32_t implementation) {
+		// Look for a character missing from the text
+		return (size_t)(implementation ? ::strchr(text, '#') : wfe::strchr(text, '#'));
+	}
+	static size_t MemoryBenchmarkStrcspnLines(const char_t* text, int32_t implementation) {
+		// Split the text into lines
+		size_t lineCount = 0;
+		while(*text) {
+			text += implementation ? ::strcspn(text, "\n") : wfe::strcspn(text, "\n");
+			text += *text != 0;
+			++lineCount;
+		}
+
+		return lineCount;
+	}
+	static size_t MemoryBenchmarkStrcspnWords(const char_t* text, int32_t implementation) {
+		// Split the text into words, separated by any whitespace
+		size_t wordCount = 0;
+		while(*text) {
+			text += implementation ? ::strcspn(text, " \t\r\n") : wfe::strcspn(text, " \t\r\n");
+			text += *text != 0;
+			++wordCount;
+		}
+
+		return wordCount;
+	}
+	static size_t MemoryBenchmarkStrspnLines(const char_t* text, int32_t implementation) {
+		// Skip every run of letters and spaces, which ends at the next line
+		size_t lineCount = 0;
+		while(*text) {
+			text += implementation ? ::strspn(text, "abcdefghijklmnopqrstuvwxyz ") : wfe::strspn(text, "abcdefghijklmnopqrstuvwxyz ");
+			text += *text != 0;
+			++lineCount;
+		}
+
+		return lineCount;
+	}
+	static size_t MemoryBenchmarkStrstr(const char_t* text, int32_t implementation) {
+		// Look for a word missing from the text
+		return (size_t)(implementation ? ::strstr(text, "benchmark") : wfe::strstr(text, "benchmark"));
+	}
+
+	static void RunMemoryCopyBenchmark(Benchmark& benchmark, MemoryBenchmarkCopyFunction func, size_t size, size_t destOffset) {
+		// Call the function through a volatile pointer, so that repeated copies can't be optimized away
+		MemoryBenchmarkCopyFunction volatile copyFunc = func;
+
+		size_t iterationCount = MEMORY_BENCHMARK_TOTAL_SIZE / size;
+		if(iterationCount > MEMORY_BENCHMARK_MAX_ITERATION_COUNT)
+			iterationCount = MEMORY_BENCHMARK_MAX_ITERATION_COUNT;
+
+		// Use a single buffer for overlapping moves and two buffers otherwise
+		char_t* src = (char_t*)AllocMemory(size + 64);
+		char_t* dest = destOffset ? src + destOffset : (char_t*)AllocMemory(size + 64);
+		::memset(src, 1, size + 64);
+		::memset(dest, 2, size);
+
+		benchmark.Start();
+
+		for(size_t i = 0; i != iterationCount; ++i)
+			copyFunc(dest, src, size);
+
+		benchmark.Stop(iterationCount * size);
+
+		if(!destOffset)
+			FreeMemory(dest);
+		FreeMemory(src);
+	}
+	static void RunMemorySetBenchmark(Benchmark& benchmark, MemoryBenchmarkSetFunction func, size_t size) {
+		// Call the function through a volatile pointer, so that repeated sets can't be optimized away
+		MemoryBenchmarkSetFunction volatile setFunc = func;
+
+		size_t iterationCount = MEMORY_BENCHMARK_TOTAL_SIZE / size;
+		if(iterationCount > MEMORY_BENCHMARK_MAX_ITERATION_COUNT)
+			iterationCount = MEMORY_BENCHMARK_MAX_ITERATION_COUNT;
+
+		char_t* dest = (char_t*)AllocMemory(size);
+		::memset(dest, 2, size);
+
+		benchmark.Start();
+
+		for(size_t i = 0; i != iterationCount; ++i)
+			setFunc(dest, (int32_t)i, size);
+
+		benchmark.Stop(iterationCount * size);
+
+		FreeMemory(dest);
+	}
+
+	static void RunMemoryScanBenchmark(Benchmark& benchmark, MemoryBenchmarkScanFunction func, const char_t* text, int32_t implementation) {
+		// Call the function through a volatile pointer, so that repeated scans can't be optimized away
+		MemoryBenchmarkScanFunction volatile scanFunc = func;
+		size_t iterationCount = MEMORY_BENCHMARK_TOTAL_SIZE / MEMORY_BENCHMARK_TEXT_SIZE;
+
+		benchmark.Start();
+
+		for(size_t i = 0; i != iterationCount; ++i)
+			scanFunc(text, implementation);
+
+		benchmark.Stop(iterationCount * MEMORY_BENCHMARK_TEXT_SIZE);
+	}
+
+	void MemoryBenchmarkCallback(BenchmarkList& benchmarkList) {
+		benchmarkList.name = "Memory (ops/s are bytes/s)";
+
+		const size_t sizes[] { 1, 16, 64, 256, 4096, 65536, 1048576, 67108864 };
+		const char_t* sizeNames[] { "1 B", "16 B", "64 B", "256 B", "4 KiB", "64 KiB", "1 MiB", "64 MiB" };
+		const size_t sizeCount = sizeof(sizes) / sizeof(size_t);
+
+		static char_t names[sizeCount * 6 + 16][MEMORY_BENCHMARK_MAX_NAME_LENGTH];
+		size_t nameCount = 0;
+
+		/* Benchmark memcpy, memmove and memset against the C library */ {
+			for(size_t i = 0; i != sizeCount; ++i) {
+				const char_t* implNames[] { "wfe", "libc" };
+				MemoryBenchmarkCopyFunction copyFuncs[] { wfe::memcpy, ::memcpy };
+				MemoryBenchmarkCopyFunction moveFuncs[] { wfe::memmove, ::memmove };
+				MemoryBenchmarkSetFunction setFuncs[] { wfe::memset, MemoryBenchmarkLibcMemset };
+
+				for(size_t j = 0; j != 2; ++j) {
+					Benchmark& copyBenchmark = benchmarkList.benchmarks[benchmarkList.benchmarkCount++];
+
+					snprintf(names[nameCount], MEMORY_BENCHMARK_MAX_NAME_LENGTH, "memcpy %s, %s", sizeNames[i], implNames[j]);
+					copyBenchmark.name = names[nameCount++];
+					RunMemoryCopyBenchmark(copyBenchmark, copyFuncs[j], sizes[i], 0);
+				}
+				for(size_t j = 0; j != 2; ++j) {
+					Benchmark& moveBenchmark = benchmarkList.benchmarks[benchmarkList.benchmarkCount++];
+
+					snprintf(names[nameCount], MEMORY_BENCHMARK_MAX_NAME_LENGTH, "memmove %s overlapping, %s", sizeNames[i], implNames[j]);
+					moveBenchmark.name = names[nameCount++];
+					RunMemoryCopyBenchmark(moveBenchmark, moveFuncs[j], sizes[i], 7);
+				}
+				for(size_t j = 0; j != 2; ++j) {
+					Benchmark& setBenchmark = benchmarkList.benchmarks[benchmarkList.benchmarkCount++];
+
+					snprintf(names[nameCount], MEMORY_BENCHMARK_MAX_NAME_LENGTH, "memset %s, %s", sizeNames[i], implNames[j]);
+					setBenchmark.name = names[nameCount++];
+					RunMemorySetBenchmark(setBenchmark, setFuncs[j], sizes[i]);
+				}
+			}
+		}
+		/* Benchmark the string scanning functions against the C library on a large text */ {
+			// Generate a text of pseudo-random words, with a line break every few dozen characters
+			char_t* text = (char_t*)AllocMemory(MEMORY_BENCHMARK_TEXT_SIZE + 1);
+			uint32_t seed = 1;
+			size_t lineLength = 0;
+			for(size_t i = 0; i != MEMORY_BENCHMARK_TEXT_SIZE; ++i) {
+				seed = seed * 1664525u + 1013904223u;
+				uint32_t value = seed >> 24;
+				if(lineLength > 40 && value < 8) {
+					text[i] = '\n';
+					lineLength = 0;
+				} else {
+					text[i] = value < 48 ? ' ' : (char_t)('a' + value % 26);
+					++lineLength;
+				}
+			}
+			text[MEMORY_BENCHMARK_TEXT_SIZE] = 0;
+
+			const char_t* scanNames[] { "strlen", "memchr missing", "strchr missing", "strcspn lines", "strcspn words", "strspn lines", "strstr missing" };
+			MemoryBenchmarkScanFunction scanFuncs[] { MemoryBenchmarkStrlen, MemoryBenchmarkMemchr, MemoryBenchmarkStrchr, MemoryBenchmarkStrcspnLines, MemoryBenchmarkStrcspnWords, MemoryBenchmarkStrspnLines, MemoryBenchmarkStrstr };
+			const char_t* implNames[] { "wfe", "libc" };
+
+			for(size_t i = 0; i != sizeof(scanFuncs) / sizeof(MemoryBenchmarkScanFunction); ++i) {
+				for(int32_t j = 0; j != 2; ++j) {
+					Benchmark& scanBenchmark = benchmarkList.benchmarks[benchmarkList.benchmarkCount++];
+
+					snprintf(names[nameCount], MEMORY_BENCHMARK_MAX_NAME_LENGTH, "%s 1 MiB text, %s", scanNames[i], implNames[j]);
+					scanBenchmark.name = names[nameCount++];
+					RunMemoryScanBenchmark(scanBenchmark, scanFuncs[i], text, j);
+				}
+			}
+
+			FreeMemory(text);
+		}
+	}
+
+	WFE_ADD_BENCHMARK_CALLBACK(MemoryBenchmarkCallback)
+}
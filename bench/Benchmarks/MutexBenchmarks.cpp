@@ -0,0 +1,80 @@
+#include "Benchmarks.hpp"
+
+namespace wfe {
+	static const size_t MUTEX_BENCHMARK_LOCK_COUNT = 262144;
+	static const size_t MUTEX_BENCHMARK_CRITICAL_WORK = 16;
+
+	template<class MutexType>
+	struct MutexBenchmarkArgs {
+		MutexType* mutex;
+		size_t* counter;
+		size_t lockCount;
+	};
+
+	template<class MutexType>
+	static void* MutexBenchmarkThread(void* args) {
+		MutexBenchmarkArgs<MutexType>* benchmarkArgs = (MutexBenchmarkArgs<MutexType>*)args;
+
+		// Lock the mutex and run a short critical section the given number of times
+		for(size_t i = 0; i != benchmarkArgs->lockCount; ++i) {
+			benchmarkArgs->mutex->Lock();
+
+			volatile size_t* counter = benchmarkArgs->counter;
+			for(size_t j = 0; j != MUTEX_BENCHMARK_CRITICAL_WORK; ++j)
+				*counter = *counter + j;
+
+			benchmarkArgs->mutex->Unlock();
+		}
+
+		return nullptr;
+	}
+
+	template<class MutexType>
+	static void RunMutexBenchmark(Benchmark& benchmark, size_t threadCount) {
+		MutexType mutex;
+		size_t counter = 0;
+		MutexBenchmarkArgs<MutexType> args { &mutex, &counter, MUTEX_BENCHMARK_LOCK_COUNT / threadCount };
+		Thread* threads = NewArray<Thread>(threadCount);
+
+		// Split the lock count between all threads and wait for them to finish
+		benchmark.Start();
+
+		for(size_t i = 0; i != threadCount; ++i)
+			threads[i].Begin(MutexBenchmarkThread<MutexType>, &args);
+		for(size_t i = 0; i != threadCount; ++i)
+			threads[i].Join();
+
+		benchmark.Stop(args.lockCount * threadCount);
+
+		DestroyArray(threads, threadCount);
+	}
+
+	void MutexBenchmarkCallback(BenchmarkList& benchmarkList) {
+		benchmarkList.name = "Mutex";
+
+		const size_t threadCounts[] { 1, 2, 4, 8, 16 };
+
+		/* Benchmark AtomicMutex with different contention levels */ {
+			const char_t* names[] { "AtomicMutex 1 thread", "AtomicMutex 2 threads", "AtomicMutex 4 threads", "AtomicMutex 8 threads", "AtomicMutex 16 threads" };
+
+			for(size_t i = 0; i != sizeof(threadCounts) / sizeof(size_t); ++i) {
+				Benchmark& benchmark = benchmarkList.benchmarks[benchmarkList.benchmarkCount++];
+
+				benchmark.name = names[i];
+				RunMutexBenchmark<AtomicMutex>(benchmark, threadCounts[i]);
+			}
+		}
+		/* Benchmark Mutex with different contention levels */ {
+			const char_t* names[] { "Mutex 1 thread", "Mutex 2 threads", "Mutex 4 threads", "Mutex 8 threads", "Mutex 16 threads" };
+
+			for(size_t i = 0; i != sizeof(threadCounts) / sizeof(size_t); ++i) {
+				Benchmark& benchmark = benchmarkList.benchmarks[benchmarkList.benchmarkCount++];
+
+				benchmark.name = names[i];
+				RunMutexBenchmark<Mutex>(benchmark, threadCounts[i]);
+			}
+		}
+	}
+
+	WFE_ADD_BENCHMARK_CALLBACK(MutexBenchmarkCallback)
+}
@@ -0,0 +1,92 @@
+#include "Benchmarks.hpp"
+
+namespace wfe {
+	static const size_t POOL_ALLOCATOR_BENCHMARK_OBJECT_COUNT = 1048576;
+	static const size_t POOL_ALLOCATOR_BENCHMARK_BATCH_SIZE = 64;
+
+	struct PoolAllocatorBenchmarkObject {
+		uint64_t values[6];
+
+		PoolAllocatorBenchmarkObject(uint64_t value) {
+			for(size_t i = 0; i != 6; ++i)
+				values[i] = value;
+		}
+	};
+
+	struct PoolAllocatorBenchmarkArgs {
+		PoolAllocator<PoolAllocatorBenchmarkObject>* pool;
+		size_t objectCount;
+	};
+
+	static void* PoolAllocatorBenchmarkPoolThread(void* args) {
+		PoolAllocatorBenchmarkArgs* benchmarkArgs = (PoolAllocatorBenchmarkArgs*)args;
+		PoolAllocatorBenchmarkObject* objects[POOL_ALLOCATOR_BENCHMARK_BATCH_SIZE];
+
+		// Create and destroy batches of objects from the pool
+		for(size_t i = 0; i != benchmarkArgs->objectCount; i += POOL_ALLOCATOR_BENCHMARK_BATCH_SIZE) {
+			for(size_t j = 0; j != POOL_ALLOCATOR_BENCHMARK_BATCH_SIZE; ++j)
+				objects[j] = benchmarkArgs->pool->New(i + j);
+			for(size_t j = 0; j != POOL_ALLOCATOR_BENCHMARK_BATCH_SIZE; ++j)
+				benchmarkArgs->pool->Delete(objects[j]);
+		}
+
+		return nullptr;
+	}
+	static void* PoolAllocatorBenchmarkNewObjectThread(void* args) {
+		PoolAllocatorBenchmarkArgs* benchmarkArgs = (PoolAllocatorBenchmarkArgs*)args;
+		PoolAllocatorBenchmarkObject* objects[POOL_ALLOCATOR_BENCHMARK_BATCH_SIZE];
+
+		// Create and destroy batches of objects from the heap
+		for(size_t i = 0; i != benchmarkArgs->objectCount; i += POOL_ALLOCATOR_BENCHMARK_BATCH_SIZE) {
+			for(size_t j = 0; j != POOL_ALLOCATOR_BENCHMARK_BATCH_SIZE; ++j)
+				objects[j] = NewObject<PoolAllocatorBenchmarkObject>(i + j);
+			for(size_t j = 0; j != POOL_ALLOCATOR_BENCHMARK_BATCH_SIZE; ++j)
+				DestroyObject(objects[j]);
+		}
+
+		return nullptr;
+	}
+
+	static void RunPoolAllocatorBenchmark(Benchmark& benchmark, Thread::ThreadFunction func, size_t threadCount) {
+		PoolAllocator<PoolAllocatorBenchmarkObject> pool;
+		PoolAllocatorBenchmarkArgs args { &pool, POOL_ALLOCATOR_BENCHMARK_OBJECT_COUNT / threadCount };
+		Thread* threads = NewArray<Thread>(threadCount);
+
+		// Split the object count between all threads and wait for them to finish
+		benchmark.Start();
+
+		for(size_t i = 0; i != threadCount; ++i)
+			threads[i].Begin(func, &args);
+		for(size_t i = 0; i != threadCount; ++i)
+			threads[i].Join();
+
+		benchmark.Stop(args.objectCount * threadCount);
+
+		DestroyArray(threads, threadCount);
+	}
+
+	void PoolAllocatorBenchmarkCallback(BenchmarkList& benchmarkList) {
+		benchmarkList.name = "Pool allocator";
+
+		const size_t threadCounts[] { 1, 4 };
+
+		/* Benchmark PoolAllocator against NewObject and DestroyObject */ {
+			const char_t* poolNames[] { "PoolAllocator::New 1 thread", "PoolAllocator::New 4 threads" };
+			const char_t* newObjectNames[] { "NewObject 1 thread", "NewObject 4 threads" };
+
+			for(size_t i = 0; i != sizeof(threadCounts) / sizeof(size_t); ++i) {
+				Benchmark& poolBenchmark = benchmarkList.benchmarks[benchmarkList.benchmarkCount++];
+
+				poolBenchmark.name = poolNames[i];
+				RunPoolAllocatorBenchmark(poolBenchmark, PoolAllocatorBenchmarkPoolThread, threadCounts[i]);
+
+				Benchmark& newObjectBenchmark = benchmarkList.benchmarks[benchmarkList.benchmarkCount++];
+
+				newObjectBenchmark.name = newObjectNames[i];
+				RunPoolAllocatorBenchmark(newObjectBenchmark, PoolAllocatorBenchmarkNewObjectThread, threadCounts[i]);
+			}
+		}
+	}
+
+	WFE_ADD_BENCHMARK_CALLBACK(PoolAllocatorBenchmarkCallback)
+}
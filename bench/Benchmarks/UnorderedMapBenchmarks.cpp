@@ -0,0 +1,108 @@
+#include "Benchmarks.hpp"
+#include <stdio.h>
+#include <unordered_map>
+
+namespace wfe {
+	static const size_t UNORDERED_MAP_BENCHMARK_MAX_NAME_LENGTH = 64;
+	static const size_t UNORDERED_MAP_BENCHMARK_OPERATION_COUNT = 4;
+
+	static void GenerateUnorderedMapBenchmarkKeys(uint64_t* keys, size_t keyCount, uint64_t seed) {
+		// Generate pseudo-random keys, which are unique with overwhelming probability
+		for(size_t i = 0; i != keyCount; ++i) {
+			seed = seed * 6364136223846793005ull + 1442695040888963407ull;
+			keys[i] = seed ^ (seed >> 29);
+		}
+	}
+
+	template<class Map>
+	static void RunUnorderedMapBenchmark(Benchmark* benchmarks, Map& map, const uint64_t* keys, const uint64_t* missingKeys, size_t keyCount) {
+		size_t sum = 0;
+
+		// Insert every key into the presized map
+		benchmarks[0].Start();
+
+		for(size_t i = 0; i != keyCount; ++i)
+			map.insert({ keys[i], i });
+
+		benchmarks[0].Stop(keyCount);
+
+		// Find every key, in a different order than they were inserted in
+		benchmarks[1].Start();
+
+		for(size_t i = keyCount; i; --i)
+			sum += map.find(keys[i - 1])->second;
+
+		benchmarks[1].Stop(keyCount);
+
+		// Look for keys that were never inserted
+		benchmarks[2].Start();
+
+		for(size_t i = 0; i != keyCount; ++i)
+			sum += map.find(missingKeys[i]) == map.end();
+
+		benchmarks[2].Stop(keyCount);
+
+		// Erase every key
+		benchmarks[3].Start();
+
+		for(size_t i = 0; i != keyCount; ++i)
+			sum += map.erase(keys[i]);
+
+		benchmarks[3].Stop(keyCount);
+
+		volatile size_t result = sum;
+		(void)result;
+	}
+
+	void UnorderedMapBenchmarkCallback(BenchmarkList& benchmarkList) {
+		benchmarkList.name = "Unordered map (ops/s are keys/s)";
+
+		const size_t keyCounts[] { 65536, 1048576 };
+		const char_t* keyCountNames[] { "64Ki keys", "1Mi keys" };
+		const size_t keyCountCount = sizeof(keyCounts) / sizeof(size_t);
+
+		const char_t* implNames[] { "flat_unordered_map", "unordered_map", "std::unordered_map" };
+		const size_t implCount = sizeof(implNames) / sizeof(const char_t*);
+		const char_t* operationNames[UNORDERED_MAP_BENCHMARK_OPERATION_COUNT] { "insert", "find hit", "find miss", "erase" };
+
+		static char_t names[keyCountCount * implCount * UNORDERED_MAP_BENCHMARK_OPERATION_COUNT][UNORDERED_MAP_BENCHMARK_MAX_NAME_LENGTH];
+		size_t nameCount = 0;
+
+		for(size_t i = 0; i != keyCountCount; ++i) {
+			size_t keyCount = keyCounts[i];
+			uint64_t* keys = (uint64_t*)AllocMemory(keyCount * sizeof(uint64_t));
+			uint64_t* missingKeys = (uint64_t*)AllocMemory(keyCount * sizeof(uint64_t));
+			GenerateUnorderedMapBenchmarkKeys(keys, keyCount, 1);
+			GenerateUnorderedMapBenchmarkKeys(missingKeys, keyCount, 2);
+
+			for(size_t j = 0; j != implCount; ++j) {
+				// Name the benchmarks of every operation
+				Benchmark* benchmarks = benchmarkList.benchmarks + benchmarkList.benchmarkCount;
+				for(size_t k = 0; k != UNORDERED_MAP_BENCHMARK_OPERATION_COUNT; ++k) {
+					snprintf(names[nameCount], UNORDERED_MAP_BENCHMARK_MAX_NAME_LENGTH, "%s %s, %s", implNames[j], operationNames[k], keyCountNames[i]);
+					benchmarks[k].name = names[nameCount++];
+				}
+				benchmarkList.benchmarkCount += UNORDERED_MAP_BENCHMARK_OPERATION_COUNT;
+
+				// Presize every map, so that only the inserts themselves are measured, giving the chained map one bucket per key
+				if(j == 0) {
+					flat_unordered_map<uint64_t, size_t> map;
+					map.reserve(keyCount);
+					RunUnorderedMapBenchmark(benchmarks, map, keys, missingKeys, keyCount);
+				} else if(j == 1) {
+					unordered_map<uint64_t, size_t> map(keyCount);
+					RunUnorderedMapBenchmark(benchmarks, map, keys, missingKeys, keyCount);
+				} else {
+					std::unordered_map<uint64_t, size_t> map;
+					map.reserve(keyCount);
+					RunUnorderedMapBenchmark(benchmarks, map, keys, missingKeys, keyCount);
+				}
+			}
+
+			FreeMemory(missingKeys);
+			FreeMemory(keys);
+		}
+	}
+
+	WFE_ADD_BENCHMARK_CALLBACK(UnorderedMapBenchmarkCallback)
+}
@@ -0,0 +1,7 @@
+#include "Benchmarks.hpp"
+
+int main() {
+	wfe::RunBenchmarks();
+
+	return 0;
+}
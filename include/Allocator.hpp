@@ -1,6 +1,8 @@
 #pragma once
 
 #include "Defines.hpp"
+#include "ArenaAllocator.hpp"
+#include "MemoryResource.hpp"
 
 namespace wfe {
 	/// @brief Specifies what a block of memory is used for.
@@ -19,23 +21,68 @@ namespace wfe {
 		MEMORY_USAGE_TYPE_COUNT
 	} MemoryUsageType;
 
+	/// @brief The alignment of every memory block allocated without an explicit alignment.
+	const size_t DEFAULT_MEMORY_ALIGNMENT = 16;
+
 	/// @brief Allocates a memory block.
 	/// @param size The size of the memory block.
 	/// @return A pointer to the resulting memory block, or a nullptr if the block couldn't be allocated.
 	void* AllocMemory(size_t size);
-	/// @brief Reallocates the given memory block.
+	/// @brief Reallocates the given memory block. Blocks allocated with AllocAlignedMemory keep their alignment.
 	/// @param mem The memory block to reallocate.
 	/// @param newSize The new size of the memory block.
 	/// @return A pointer to the reallocated memory block.
 	void* ReallocMemory(void* mem, size_t newSize);
-	/// @brief Frees the given memory block.
+	/// @brief Frees the given memory block, which may have been allocated with either AllocMemory or AllocAlignedMemory.
 	/// @param mem The memory block to free.
 	void FreeMemory(void* mem);
+	/// @brief Allocates a memory block with the given alignment. The block is freed with FreeMemory.
+	/// @param size The size of the memory block.
+	/// @param alignment The alignment of the memory block. Must be a power of two.
+	/// @return A pointer to the resulting memory block, or a nullptr if the block couldn't be allocated.
+	void* AllocAlignedMemory(size_t size, size_t alignment);
+	/// @brief Reallocates the given memory block, aligning the reallocated block to the given alignment.
+	/// @param mem The memory block to reallocate.
+	/// @param newSize The new size of the memory block.
+	/// @param alignment The alignment of the reallocated memory block. Must be a power of two.
+	/// @return A pointer to the reallocated memory block, or a nullptr if the block couldn't be reallocated.
+	void* ReallocAlignedMemory(void* mem, size_t newSize, size_t alignment);
 	/// @brief Gets the size of the given heap memory block.
 	/// @param mem The memory block whose size to get.
 	/// @return The size, in bytes, of the memory block.
 	size_t GetMemorySize(void* mem);
 
+	/// @brief Allocates a memory block from the given resource.
+	/// @param resource The resource to allocate from, or a nullptr to allocate from the heap.
+	/// @param size The size of the memory block.
+	/// @param alignment The alignment of the memory block, which must be a power of two.
+	/// @return A pointer to the resulting memory block, or a nullptr if the block couldn't be allocated.
+	inline void* AllocMemory(MemoryResource* resource, size_t size, size_t alignment = DEFAULT_MEMORY_ALIGNMENT) {
+		if(resource)
+			return resource->Alloc(size, alignment);
+		return alignment > DEFAULT_MEMORY_ALIGNMENT ? AllocAlignedMemory(size, alignment) : AllocMemory(size);
+	}
+	/// @brief Reallocates the given memory block from the given resource.
+	/// @param resource The resource the block was allocated from, or a nullptr if it was allocated from the heap.
+	/// @param mem The memory block to reallocate.
+	/// @param newSize The new size of the memory block.
+	/// @param alignment The alignment of the memory block, which must be a power of two.
+	/// @return A pointer to the reallocated memory block.
+	inline void* ReallocMemory(MemoryResource* resource, void* mem, size_t newSize, size_t alignment = DEFAULT_MEMORY_ALIGNMENT) {
+		if(resource)
+			return resource->Realloc(mem, newSize, alignment);
+		return alignment > DEFAULT_MEMORY_ALIGNMENT ? ReallocAlignedMemory(mem, newSize, alignment) : ReallocMemory(mem, newSize);
+	}
+	/// @brief Frees the given memory block from the given resource.
+	/// @param resource The resource the block was allocated from, or a nullptr if it was allocated from the heap.
+	/// @param mem The memory block to free.
+	inline void FreeMemory(MemoryResource* resource, void* mem) {
+		if(resource)
+			resource->Free(mem);
+		else
+			FreeMemory(mem);
+	}
+
 	/// @brief Pushes the memory usage type to the stack to be used by every following allocation.
 	/// @param memoryUsageType The memory usage type to push.
 	void PushMemoryUsageType(MemoryUsageType memoryUsageType);
@@ -44,6 +91,51 @@ namespace wfe {
 	/// @brief Gets the current memory usage type.
 	/// @return The memory usage type at the top of the stack.
 	MemoryUsageType GetMemoryUsageType();
+	/// @brief Enables or disables the current thread's command arena. While it is enabled, allocations made with the MEMORY_USAGE_TYPE_COMMAND usage type are bumped from a per-thread arena instead of the heap. Arena blocks may be freed on any thread, where freeing them does nothing, and they are all released at once by ResetCommandArena on the thread that allocated them.
+	/// @param enabled True to enable the command arena, or false to disable it.
+	void SetCommandArenaEnabled(bool8_t enabled);
+	/// @brief Checks if the current thread's command arena is enabled.
+	/// @return True if the command arena is enabled, otherwise false.
+	bool8_t IsCommandArenaEnabled();
+	/// @brief Releases every allocation made from the current thread's command arena, usually at the end of a frame. Every block allocated from the arena becomes invalid.
+	void ResetCommandArena();
+	/// @brief Gets the current thread's command arena.
+	/// @return A pointer to the current thread's command arena, or a nullptr if it was never enabled.
+	ArenaAllocator* GetCommandArena();
+
+	/// @brief The default size from which allocations are mapped straight from the platform's virtual memory manager.
+	const size_t DEFAULT_LARGE_ALLOCATION_THRESHOLD = 1048576;
+
+	/// @brief Sets the size from which allocations are mapped straight from the platform's virtual memory manager. Large blocks are backed by huge pages when the platform supports them, grow by remapping their pages instead of copying them and are returned to the platform as soon as they are freed.
+	/// @param threshold The new large allocation threshold, in bytes. Use SIZE_T_MAX to disable the large allocation path.
+	void SetLargeAllocationThreshold(size_t threshold);
+	/// @brief Gets the size from which allocations are mapped straight from the platform's virtual memory manager.
+	/// @return The large allocation threshold, in bytes.
+	size_t GetLargeAllocationThreshold();
+
+	/// @brief The default average number of bytes allocated between two allocations sampled by the allocation profiler.
+	const size_t DEFAULT_ALLOCATION_SAMPLE_INTERVAL = 524288;
+
+	/// @brief Enables or disables the allocation profiler. While it is enabled, roughly one allocation is sampled for every sample interval's worth of allocated bytes, recording its size, usage type and call stack until it is freed. Allocations sampled before the profiler was disabled are still tracked until they are freed.
+	/// @param enabled True to enable the allocation profiler, or false to disable it.
+	void SetAllocationProfilerEnabled(bool8_t enabled);
+	/// @brief Checks if the allocation profiler is enabled.
+	/// @return True if the allocation profiler is enabled, otherwise false.
+	bool8_t IsAllocationProfilerEnabled();
+	/// @brief Sets the average number of bytes allocated between two sampled allocations. Lower intervals give more precise results at a higher cost.
+	/// @param sampleInterval The new sample interval, in bytes. An interval of 1 samples every allocation.
+	void SetAllocationSampleInterval(size_t sampleInterval);
+	/// @brief Gets the average number of bytes allocated between two sampled allocations.
+	/// @return The sample interval, in bytes.
+	size_t GetAllocationSampleInterval();
+	/// @brief Gets the number of sampled allocations that haven't been freed yet.
+	/// @return The number of live sampled allocations.
+	size_t GetSampledAllocationCount();
+	/// @brief Writes a snapshot of every live sampled allocation to the given file. Allocations are grouped by call stack and usage type, with one line per group sorted by the estimated number of live bytes, so that snapshots taken at different points can be diffed.
+	/// @param filePath The path of the snapshot file.
+	/// @return True if the snapshot was written successfully, otherwise false.
+	bool8_t DumpHeapSnapshot(const char_t* filePath);
+
 	/// @brief Gets the memory usage of the entire application.
 	/// @return A pointer to a size_t array of size MEMORY_USAGE_COUNT, specifying the memory usage for every single type.
 	volatile atomic_size_t* GetMemoryUsage();
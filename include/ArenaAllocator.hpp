@@ -0,0 +1,76 @@
+#pragma once
+
+#include "Defines.hpp"
+#include "MemoryResource.hpp"
+
+namespace wfe {
+	/// @brief A linear allocator, which hands out memory from large chunks by bumping a pointer. Single allocations can't be freed; instead, all of the arena's memory is released at once when it is reset. Not thread-safe.
+	class ArenaAllocator : public MemoryResource {
+	public:
+		/// @brief The default size of every chunk allocated by an arena.
+		static const size_t DEFAULT_CHUNK_SIZE = 262144;
+		/// @brief The default alignment of allocations made from an arena.
+		static const size_t ALIGNMENT = 16;
+		/// @brief The flag stored in the last two bytes before every arena allocation, where heap blocks keep their header's flags. It lets FreeMemory, ReallocMemory and GetMemorySize recognize arena allocations on any thread.
+		static const uint16_t BLOCK_FLAG = 0x08;
+
+		/// @brief Creates an arena allocator. No memory is allocated until the first allocation is made.
+		/// @param chunkSize The size of every chunk allocated by the arena. Larger allocations get their own chunks.
+		ArenaAllocator(size_t chunkSize = DEFAULT_CHUNK_SIZE);
+		ArenaAllocator(const ArenaAllocator&) = delete;
+		ArenaAllocator(ArenaAllocator&&) noexcept = delete;
+
+		ArenaAllocator& operator=(const ArenaAllocator&) = delete;
+		ArenaAllocator& operator=(ArenaAllocator&&) = delete;
+
+		/// @brief Allocates a memory block from the arena.
+		/// @param size The size of the memory block.
+		/// @param alignment The alignment of the memory block, which must be a power of two.
+		/// @return A pointer to the resulting memory block, or a nullptr if the block couldn't be allocated.
+		void* Alloc(size_t size, size_t alignment = ALIGNMENT) override;
+		/// @brief Reallocates the given memory block. The block grows in place if it was the arena's last allocation and fits in its chunk.
+		/// @param mem The memory block to reallocate, which must have been allocated from the arena.
+		/// @param newSize The new size of the memory block.
+		/// @param alignment The alignment of the memory block, which must be a power of two.
+		/// @return A pointer to the reallocated memory block, or a nullptr if the block couldn't be reallocated.
+		void* Realloc(void* mem, size_t newSize, size_t alignment = ALIGNMENT) override;
+		/// @brief Does nothing, since single arena allocations can't be freed; their memory is released when the arena is reset.
+		/// @param mem The memory block to free, which must have been allocated from the arena.
+		void Free(void* mem) override;
+		/// @brief Gets the size of the given memory block.
+		/// @param mem The memory block whose size to get, which must have been allocated from the arena.
+		/// @return The size, in bytes, of the memory block.
+		size_t GetSize(const void* mem) const;
+		/// @brief Checks if the given memory block was allocated from the arena.
+		/// @param mem The memory block to check.
+		/// @return True if the block lies in one of the arena's chunks, otherwise false.
+		bool8_t Contains(const void* mem) const;
+
+		/// @brief Releases every allocation made from the arena at once. The arena's chunks are kept and reused by later allocations.
+		void Reset();
+		/// @brief Frees every chunk allocated by the arena, releasing all of its memory.
+		void Release();
+
+		/// @brief Gets the number of bytes used by allocations since the arena was last reset.
+		/// @return The number of bytes used by allocations.
+		size_t GetUsedSize() const;
+		/// @brief Gets the total size of the arena's chunks.
+		/// @return The total size of the arena's chunks.
+		size_t GetCapacity() const;
+
+		/// @brief Destroys the arena allocator, freeing all of its chunks.
+		~ArenaAllocator() override;
+	private:
+		struct Chunk;
+
+		Chunk* AllocChunk(size_t minSize);
+
+		size_t chunkSize;
+		Chunk* firstChunk = nullptr;
+		Chunk* currentChunk = nullptr;
+		char_t* pos = nullptr;
+		char_t* end = nullptr;
+		void* lastAlloc = nullptr;
+		size_t usedSize = 0;
+	};
+}
@@ -0,0 +1,163 @@
+#pragma once
+
+#include "Defines.hpp"
+#include "Allocator.hpp"
+#include "Exception.hpp"
+
+namespace wfe {
+	/// @brief A bounded lock-free queue that can be used by multiple producer and consumer threads at once. Every cell holds a sequence number, which tells producers and consumers whether the cell is ready for them.
+	/// @tparam T The type of the queue's values.
+	template<class T>
+	class AtomicQueue {
+	public:
+		/// @brief Creates an atomic queue.
+		/// @param capacity The maximum number of values in the queue, which will be rounded up to the nearest power of 2, and to at least 2.
+		AtomicQueue(size_t capacity) : queueCapacity(2) {
+			// Set the capacity to the lowest power of 2 higher than or equal to the given capacity, starting from 2, as a single cell's full and next lap empty sequence numbers would be equal
+			while(queueCapacity < capacity)
+				queueCapacity <<= 1;
+
+			// Allocate the queue's cells
+			cells = (Cell*)AllocMemory(queueCapacity * sizeof(Cell));
+			if(!cells)
+				throw BadAllocException("Failed to allocate atomic queue cells!");
+
+			// Set every cell's sequence number to its index, marking it as ready to be pushed to
+			for(size_t i = 0; i != queueCapacity; ++i)
+				new(&cells[i].sequence) atomic_size_t(i);
+
+			enqueuePos.store(0, std::memory_order_relaxed);
+			dequeuePos.store(0, std::memory_order_relaxed);
+		}
+		AtomicQueue(const AtomicQueue&) = delete;
+		AtomicQueue(AtomicQueue&&) noexcept = delete;
+
+		AtomicQueue& operator=(const AtomicQueue&) = delete;
+		AtomicQueue& operator=(AtomicQueue&&) = delete;
+
+		/// @brief Tries to push the given value to the back of the queue.
+		/// @param val The value to push.
+		/// @return True if the value was pushed, or false if the queue is full.
+		bool8_t TryPush(const T& val) {
+			// Claim a cell, exiting the function if the queue is full
+			size_t pos;
+			Cell* cell = ClaimPushCell(pos);
+			if(!cell)
+				return false;
+
+			// Construct the value and publish the cell to the consumers
+			new(cell->data) T(val);
+			cell->sequence.store(pos + 1, std::memory_order_release);
+
+			return true;
+		}
+		/// @brief Tries to move the given value to the back of the queue.
+		/// @param val The value to move.
+		/// @return True if the value was pushed, or false if the queue is full.
+		bool8_t TryPush(T&& val) {
+			// Claim a cell, exiting the function if the queue is full
+			size_t pos;
+			Cell* cell = ClaimPushCell(pos);
+			if(!cell)
+				return false;
+
+			// Construct the value and publish the cell to the consumers
+			new(cell->data) T((T&&)val);
+			cell->sequence.store(pos + 1, std::memory_order_release);
+
+			return true;
+		}
+		/// @brief Tries to pop the value at the front of the queue.
+		/// @param val A reference to the variable which will be set to the popped value.
+		/// @return True if a value was popped, or false if the queue is empty.
+		bool8_t TryPop(T& val) {
+			size_t pos = dequeuePos.load(std::memory_order_relaxed);
+			Cell* cell;
+
+			while(true) {
+				cell = cells + (pos & (queueCapacity - 1));
+				size_t sequence = cell->sequence.load(std::memory_order_acquire);
+				intptr_t diff = (intptr_t)sequence - (intptr_t)(pos + 1);
+
+				if(!diff) {
+					// The cell holds a value; try to claim it
+					if(dequeuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+						break;
+				} else if(diff < 0) {
+					// The cell hasn't been pushed to yet, so the queue is empty
+					return false;
+				} else {
+					// Another consumer claimed the cell; reload the position
+					pos = dequeuePos.load(std::memory_order_relaxed);
+				}
+			}
+
+			// Move the value out of the cell and mark the cell as ready for the next lap's producer
+			T* data = (T*)cell->data;
+			val = (T&&)*data;
+			data->~T();
+
+			cell->sequence.store(pos + queueCapacity, std::memory_order_release);
+
+			return true;
+		}
+
+		/// @brief Gets the maximum number of values in the queue.
+		/// @return The maximum number of values in the queue.
+		size_t GetCapacity() const {
+			return queueCapacity;
+		}
+		/// @brief Checks if the queue is empty. The result may be outdated by the time it is returned if other threads use the queue.
+		/// @return True if the queue is empty, otherwise false.
+		bool8_t IsEmpty() const {
+			return dequeuePos.load(std::memory_order_relaxed) >= enqueuePos.load(std::memory_order_relaxed);
+		}
+
+		/// @brief Destroys the atomic queue and every value left in it.
+		~AtomicQueue() {
+			// Destroy the values left in the queue
+			size_t end = enqueuePos.load(std::memory_order_relaxed);
+			for(size_t pos = dequeuePos.load(std::memory_order_relaxed); pos != end; ++pos)
+				((T*)cells[pos & (queueCapacity - 1)].data)->~T();
+
+			FreeMemory(cells);
+		}
+	private:
+		static const size_t CACHE_LINE_SIZE = 64;
+
+		struct Cell {
+			atomic_size_t sequence;
+			alignas(T) char_t data[sizeof(T)];
+		};
+
+		Cell* ClaimPushCell(size_t& pos) {
+			pos = enqueuePos.load(std::memory_order_relaxed);
+
+			while(true) {
+				Cell* cell = cells + (pos & (queueCapacity - 1));
+				size_t sequence = cell->sequence.load(std::memory_order_acquire);
+				intptr_t diff = (intptr_t)sequence - (intptr_t)pos;
+
+				if(!diff) {
+					// The cell is free; try to claim it
+					if(enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+						return cell;
+				} else if(diff < 0) {
+					// The cell still holds a value from the previous lap, so the queue is full
+					return nullptr;
+				} else {
+					// Another producer claimed the cell; reload the position
+					pos = enqueuePos.load(std::memory_order_relaxed);
+				}
+			}
+		}
+
+		Cell* cells;
+		size_t queueCapacity;
+		char_t padding1[CACHE_LINE_SIZE];
+		atomic_size_t enqueuePos;
+		char_t padding2[CACHE_LINE_SIZE];
+		atomic_size_t dequeuePos;
+		char_t padding3[CACHE_LINE_SIZE];
+	};
+}
@@ -0,0 +1,1190 @@
+#pragma once
+
+#include "Allocator.hpp"
+#include "Compare.hpp"
+#include "Defines.hpp"
+#include "Exception.hpp"
+#include "Memory.hpp"
+#include "Pair.hpp"
+#include <initializer_list>
+#include <type_traits>
+#include <map>
+
+namespace wfe {
+	/// @brief Holds values with unique keys in a B-tree, sorted by their keys. Every node holds a few cache lines worth of sorted values, so lookups touch a few nodes and updates only shift the values of a single node, unlike map, which shifts its whole tail on every insert and erase. Inserting and erasing may move any value to another node.
+	/// @tparam Key The type for the value's keys.
+	/// @tparam T The type of the B-tree map's values.
+	/// @tparam Lower The function struct used to check if one key should be before another.
+	/// @tparam Equal The function struct used to check if two keys are equal.
+	template<class Key, class T, class Lower = LowerComp<Key>, class Equal = EqualComp<Key>>
+	class btree_map {
+	public:
+		/// @brief The B-tree map's key.
+		typedef Key key_type;
+		/// @brief The B-tree map's values.
+		typedef T mapped_type;
+		/// @brief A pair that holds the key and its corresponding value.
+		typedef pair<const key_type, mapped_type> value_type;
+		/// @brief A reference to the B-tree map's value.
+		typedef value_type& reference;
+		/// @brief A const reference to the B-tree map's value.
+		typedef const value_type& const_reference;
+		/// @brief A pointer to the B-tree map's value.
+		typedef value_type* pointer;
+		/// @brief A const pointer to the B-tree map's value.
+		typedef const value_type* const_pointer;
+		/// @brief Used for holding differences.
+		typedef ptrdiff_t difference_type;
+		/// @brief Used for holding sizes.
+		typedef size_t size_type;
+	private:
+		struct Node;
+	public:
+		struct const_iterator;
+
+		/// @brief An iterator to the B-tree map's values, in order.
+		struct iterator {
+			/// @brief Copies the given iterator.
+			/// @param other The iterator to copy.
+			iterator(const iterator& other) = default;
+			/// @brief Moves the given iterator's contents.
+			/// @param other The iterator to move from.
+			iterator(iterator&& other) noexcept = default;
+
+			/// @brief Copies the given iterator's contents into this iterator.
+			/// @param other The iterator to copy from.
+			/// @return A reference to this iterator.
+			iterator& operator=(const iterator& other) = default;
+			/// @brief Moves the given iterator's contents into this iterator.
+			/// @param other The iterator to move from.
+			/// @return A reference to this iterator.
+			iterator& operator=(iterator&& other) noexcept = default;
+
+			/// @brief Compares the two iterators.
+			/// @param other The iterator to compare with.
+			/// @return True if the iterators are equal, otherwise false.
+			bool8_t operator==(const iterator& other) const {
+				return node == other.node && position == other.position;
+			}
+			/// @brief Compares the two iterators.
+			/// @param other The iterator to compare with.
+			/// @return True if the iterators are different, otherwise false.
+			bool8_t operator!=(const iterator& other) const {
+				return node != other.node || position != other.position;
+			}
+
+			/// @brief Increments this iterator.
+			/// @return A reference to this iterator.
+			iterator& operator++() {
+				Increment(node, position);
+				return *this;
+			}
+			/// @brief Increments this iterator.
+			/// @return This iterator's previous state.
+			iterator operator++(int) {
+				// Save the current state of the iterator
+				iterator currentIter = *this;
+				Increment(node, position);
+
+				return currentIter;
+			}
+			/// @brief Decrements this iterator.
+			/// @return A reference to this iterator.
+			iterator& operator--() {
+				Decrement(node, position);
+				return *this;
+			}
+			/// @brief Decrements this iterator.
+			/// @return This iterator's previous state.
+			iterator operator--(int) {
+				// Save the current state of the iterator
+				iterator currentIter = *this;
+				Decrement(node, position);
+
+				return currentIter;
+			}
+
+			/// @brief Accesses the iterator value's members.
+			/// @return The iterator's pointer.
+			pointer operator->() const {
+				return node->GetValues() + position;
+			}
+			/// @brief Accesses the iterator's value.
+			/// @return A reference to the iterator's value.
+			reference operator*() const {
+				return node->GetValues()[position];
+			}
+
+			/// @brief Destruct this iterator.
+			~iterator() = default;
+		private:
+			iterator(Node* node, size_type position) : node(node), position(position) { }
+
+			Node* node;
+			size_type position;
+
+			friend btree_map;
+			friend const_iterator;
+		};
+		/// @brief A const iterator to the B-tree map's values, in order.
+		struct const_iterator {
+			/// @brief Copies the given iterator.
+			/// @param other The iterator to copy.
+			const_iterator(const const_iterator& other) = default;
+			/// @brief Moves the given iterator's contents.
+			/// @param other The iterator to move from.
+			const_iterator(const_iterator&& other) noexcept = default;
+			/// @brief Copies the given iterator.
+			/// @param other The iterator to copy.
+			const_iterator(const iterator& other) : node(other.node), position(other.position) { }
+
+			/// @brief Copies the given iterator's contents into this iterator.
+			/// @param other The iterator to copy from.
+			/// @return A reference to this iterator.
+			const_iterator& operator=(const const_iterator& other) = default;
+			/// @brief Moves the given iterator's contents into this iterator.
+			/// @param other The iterator to move from.
+			/// @return A reference to this iterator.
+			const_iterator& operator=(const_iterator&& other) noexcept = default;
+
+			/// @brief Compares the two iterators.
+			/// @param other The iterator to compare with.
+			/// @return True if the iterators are equal, otherwise false.
+			bool8_t operator==(const const_iterator& other) const {
+				return node == other.node && position == other.position;
+			}
+			/// @brief Compares the two iterators.
+			/// @param other The iterator to compare with.
+			/// @return True if the iterators are different, otherwise false.
+			bool8_t operator!=(const const_iterator& other) const {
+				return node != other.node || position != other.position;
+			}
+
+			/// @brief Increments this iterator.
+			/// @return A reference to this iterator.
+			const_iterator& operator++() {
+				Increment(node, position);
+				return *this;
+			}
+			/// @brief Increments this iterator.
+			/// @return This iterator's previous state.
+			const_iterator operator++(int) {
+				// Save the current state of the iterator
+				const_iterator currentIter = *this;
+				Increment(node, position);
+
+				return currentIter;
+			}
+			/// @brief Decrements this iterator.
+			/// @return A reference to this iterator.
+			const_iterator& operator--() {
+				Decrement(node, position);
+				return *this;
+			}
+			/// @brief Decrements this iterator.
+			/// @return This iterator's previous state.
+			const_iterator operator--(int) {
+				// Save the current state of the iterator
+				const_iterator currentIter = *this;
+				Decrement(node, position);
+
+				return currentIter;
+			}
+
+			/// @brief Accesses the iterator value's members.
+			/// @return The iterator's pointer.
+			const_pointer operator->() const {
+				return node->GetValues() + position;
+			}
+			/// @brief Accesses the iterator's value.
+			/// @return A reference to the iterator's value.
+			const_reference operator*() const {
+				return node->GetValues()[position];
+			}
+
+			/// @brief Destruct this iterator.
+			~const_iterator() = default;
+		private:
+			const_iterator(Node* node, size_type position) : node(node), position(position) { }
+
+			Node* node;
+			size_type position;
+
+			friend btree_map;
+		};
+
+		/// @brief Creates an empty B-tree map. No memory is allocated until the first value is inserted.
+		constexpr btree_map() = default;
+		/// @brief Creates an empty B-tree map that allocates its memory from the given resource.
+		/// @param resource The memory resource to allocate from. It must outlive the B-tree map.
+		explicit btree_map(MemoryResource& resource) : memoryResource(&resource) { }
+		/// @brief Copies the given B-tree map.
+		/// @param other The B-tree map to copy.
+		btree_map(const btree_map& other) {
+			// Copy the other B-tree map's nodes
+			CopyTree(other);
+		}
+		/// @brief Moves the given B-tree map's contents.
+		/// @param other The B-tree map whose contents to move.
+		btree_map(btree_map&& other) noexcept : memoryResource(other.memoryResource), mapRoot(other.mapRoot), mapLeftmost(other.mapLeftmost), mapRightmost(other.mapRightmost), mapSize(other.mapSize) {
+			// Unlink all nodes from the other B-tree map
+			other.mapRoot = nullptr;
+			other.mapLeftmost = nullptr;
+			other.mapRightmost = nullptr;
+			other.mapSize = 0;
+		}
+		/// @brief Constructs a B-tree map with all the values in the list.
+		/// @param list The list to copy from.
+		btree_map(std::initializer_list<value_type> list) {
+			insert(list);
+		}
+		/// @brief Copies the given std library map.
+		/// @param other The std library map to copy from.
+		btree_map(const std::map<key_type, mapped_type>& other) {
+			// Insert every value, which are already sorted and are therefore all appended to the rightmost leaf
+			for(const auto& val : other)
+				insert({ val.first, val.second });
+		}
+
+		/// @brief Copies the given B-tree map's contents into this map.
+		/// @param other The B-tree map to copy from.
+		/// @return A reference to this B-tree map.
+		btree_map& operator=(const btree_map& other) {
+			// Check if the two maps are the same
+			if(&other == this)
+				return *this;
+
+			// Free the B-tree map's previous nodes, then copy the other B-tree map's nodes
+			clear();
+			CopyTree(other);
+
+			return *this;
+		}
+		/// @brief Moves the given B-tree map's contents into this map.
+		/// @param other The B-tree map to move from.
+		/// @return A reference to this B-tree map.
+		btree_map& operator=(btree_map&& other) {
+			// Check if the two maps are the same
+			if(&other == this)
+				return *this;
+
+			// Free the B-tree map's previous nodes
+			clear();
+
+			// Set the B-tree map's new values
+			memoryResource = other.memoryResource;
+			mapRoot = other.mapRoot;
+			mapLeftmost = other.mapLeftmost;
+			mapRightmost = other.mapRightmost;
+			mapSize = other.mapSize;
+
+			// Unlink all nodes from the other B-tree map
+			other.mapRoot = nullptr;
+			other.mapLeftmost = nullptr;
+			other.mapRightmost = nullptr;
+			other.mapSize = 0;
+
+			return *this;
+		}
+		/// @brief Copies the given list's values into this B-tree map.
+		/// @param list The list to copy from.
+		/// @return A reference to this B-tree map.
+		btree_map& operator=(std::initializer_list<value_type> list) {
+			// Remove the previous values, then insert every value from the list
+			clear();
+			insert(list);
+
+			return *this;
+		}
+
+		/// @brief Converts the B-tree map to a std library map.
+		operator std::map<key_type, mapped_type>() const {
+			std::map<key_type, mapped_type> map;
+
+			const_iterator endIter = end();
+			for(const_iterator iter = begin(); iter != endIter; ++iter)
+				map.insert({ iter->first, iter->second });
+
+			return map;
+		}
+
+		/// @brief Accesses or inserts a value with the given key.
+		/// @param key The key to look for.
+		/// @return A reference to the value with the given key.
+		mapped_type& operator[](const key_type& key) {
+			// Look for the key, preparing a slot for it if it doesn't exist
+			pair<iterator, bool8_t> result = PrepareInsert(key);
+			if(result.second)
+				new(result.first.operator->()) value_type(key, {});
+
+			return result.first->second;
+		}
+		/// @brief Accesses or inserts a value with the given key.
+		/// @param key The key to look for.
+		/// @return A reference to the value with the given key.
+		mapped_type& operator[](key_type&& key) {
+			// Look for the key, preparing a slot for it if it doesn't exist
+			pair<iterator, bool8_t> result = PrepareInsert(key);
+			if(result.second)
+				new(result.first.operator->()) value_type(key, {});
+
+			return result.first->second;
+		}
+		/// @brief Accesses the value with the given key.
+		/// @param key The key to look for.
+		/// @return A reference to the value with the given key.
+		mapped_type& at(const key_type& key) {
+			// Look for the key
+			iterator iter = FindKey(key);
+
+			// The value wasn't found; throw an error
+			if(iter == end())
+				throw OutOfRangeException("Failed to find the wanted key in a B-tree map!");
+
+			return iter->second;
+		}
+		/// @brief Accesses the value with the given key.
+		/// @param key The key to look for.
+		/// @return A const reference to the value with the given key.
+		const mapped_type& at(const key_type& key) const {
+			// Look for the key
+			const_iterator iter = FindKey(key);
+
+			// The value wasn't found; throw an error
+			if(iter == end())
+				throw OutOfRangeException("Failed to find the wanted key in a B-tree map!");
+
+			return iter->second;
+		}
+
+		/// @brief Finds the value with the given key.
+		/// @param key The key to look for.
+		/// @return An iterator to the wanted value if it exists, otherwise btree_map::end().
+		iterator find(const key_type& key) {
+			return FindKey(key);
+		}
+		/// @brief Finds the value with the given key.
+		/// @param key The key to look for.
+		/// @return A const iterator to the wanted value if it exists, otherwise btree_map::end().
+		const_iterator find(const key_type& key) const {
+			return FindKey(key);
+		}
+		/// @brief Gets the number of values with the given key.
+		/// @param key The key to look for.
+		/// @return The number of values with the given key.
+		size_type count(const key_type& key) const {
+			const_iterator iter = FindKey(key);
+			return iter != end();
+		}
+		/// @brief Finds the first value whose key isn't lower than the given key.
+		/// @param key The key to compare with.
+		/// @return An iterator to the wanted value, or btree_map::end() if it doesn't exist.
+		iterator lower_bound(const key_type& key) {
+			return LowerBound(key);
+		}
+		/// @brief Finds the first value whose key isn't lower than the given key.
+		/// @param key The key to compare with.
+		/// @return A const iterator to the wanted value, or btree_map::end() if it doesn't exist.
+		const_iterator lower_bound(const key_type& key) const {
+			return LowerBound(key);
+		}
+		/// @brief Finds the first value whose key is higher than the given key.
+		/// @param key The key to compare with.
+		/// @return An iterator to the wanted value, or btree_map::end() if it doesn't exist.
+		iterator upper_bound(const key_type& key) {
+			return UpperBound(key);
+		}
+		/// @brief Finds the first value whose key is higher than the given key.
+		/// @param key The key to compare with.
+		/// @return A const iterator to the wanted value, or btree_map::end() if it doesn't exist.
+		const_iterator upper_bound(const key_type& key) const {
+			return UpperBound(key);
+		}
+		/// @brief Finds the range of values with the given key.
+		/// @param key The key to look for.
+		/// @return The bounds of the wanted range.
+		pair<iterator, iterator> equal_range(const key_type& key) {
+			// Find the range's lower bound, which is also its upper bound if the key doesn't exist
+			iterator first = LowerBound(key);
+			if(first == end() || !Equal()(first->first, key))
+				return { first, first };
+
+			iterator last = first;
+			++last;
+
+			return { first, last };
+		}
+		/// @brief Finds the range of values with the given key.
+		/// @param key The key to look for.
+		/// @return The bounds of the wanted range.
+		pair<const_iterator, const_iterator> equal_range(const key_type& key) const {
+			// Find the range's lower bound, which is also its upper bound if the key doesn't exist
+			const_iterator first = LowerBound(key);
+			if(first == end() || !Equal()(first->first, key))
+				return { first, first };
+
+			const_iterator last = first;
+			++last;
+
+			return { first, last };
+		}
+
+		/// @brief Emplaces the constructed value into the B-tree map.
+		/// @tparam ...Args The arg types to construct the value with.
+		/// @param ...args The args to construct the value with.
+		/// @return A pair containing an iterator to the emplaced value or a value with the same key and a bool that is true if a new value was inserted, otherwise false.
+		template<class... Args>
+		pair<iterator, bool8_t> emplace(Args&&... args) {
+			// Construct the value
+			value_type val(args...);
+
+			// Insert the value into the B-tree map
+			return insert(val);
+		}
+		/// @brief Emplaces the constructed value into the B-tree map using the given hint.
+		/// @tparam ...Args The arg types to construct the value with.
+		/// @param pos A hint for the position of the emplaced value.
+		/// @param ...args The args to construct the value with.
+		/// @return An iterator to the emplaced value or a value with the same key.
+		template<class... Args>
+		iterator emplace_hint(const_iterator pos, Args&&... args) {
+			// Construct the value
+			value_type val(args...);
+
+			// Insert the value into the B-tree map using the given hint
+			return insert(pos, val);
+		}
+		/// @brief Inserts the given value into the B-tree map.
+		/// @param val The value to insert.
+		/// @return A pair containing an iterator to the inserted value or a value with the same key and a bool that is true if a new value was inserted, otherwise false.
+		pair<iterator, bool8_t> insert(const_reference val) {
+			// Look for the value's key, preparing a slot for it if it doesn't exist
+			pair<iterator, bool8_t> result = PrepareInsert(val.first);
+			if(result.second)
+				new(result.first.operator->()) value_type(val);
+
+			return result;
+		}
+		/// @brief Inserts the given value into the B-tree map using the given hint.
+		/// @param pos A hint for the position of the inserted value.
+		/// @param val The value to insert.
+		/// @return An iterator the the inserted value or a value with the same key.
+		iterator insert(const_iterator pos, const_reference val) {
+			// Simply insert the value without using the given hint
+			(void)pos;
+			return insert(val).first;
+		}
+		/// @brief Inserts all values from the given list into the B-tree map.
+		/// @param list The list to insert from.
+		void insert(std::initializer_list<value_type> list) {
+			// Insert every value from the given list
+			const_pointer end = list.end();
+			for(const_pointer ptr = list.begin(); ptr != end; ++ptr)
+				insert(*ptr);
+		}
+		/// @brief Erases the value at the given position from the B-tree map. Iterators to other values may be invalidated.
+		/// @param pos The position to erase from.
+		/// @return An iterator to the value after the erased value.
+		iterator erase(const_iterator pos) {
+			// Destruct the erased value
+			Node* node = pos.node;
+			size_type position = pos.position;
+			pointer values = node->GetValues();
+			values[position].~value_type();
+
+			bool8_t internal = !node->leaf;
+			if(internal) {
+				// Replace the erased value with its predecessor, which is the last value of the rightmost leaf of its left subtree
+				Node* leaf = GetChildren(node)[position];
+				while(!leaf->leaf)
+					leaf = GetChildren(leaf)[leaf->count];
+
+				--leaf->count;
+				wfe::memcpy(values + position, leaf->GetValues() + leaf->count, sizeof(value_type));
+
+				// Continue from right after the moved predecessor, which is the end of its old leaf
+				node = leaf;
+				position = leaf->count;
+			} else {
+				// Move the following values back to fill the erased value's slot
+				--node->count;
+				wfe::memmove(values + position, values + position + 1, (node->count - position) * sizeof(value_type));
+			}
+
+			--mapSize;
+
+			// Free the root if the B-tree map is now empty
+			if(!mapSize) {
+				FreeNode(mapRoot);
+				mapRoot = nullptr;
+				mapLeftmost = nullptr;
+				mapRightmost = nullptr;
+
+				return end();
+			}
+
+			// Rebalance the B-tree, keeping track of the position after the erased value
+			RebalanceAfterErase(node, position);
+			iterator iter = GetNextValid(node, position);
+
+			// Move past the predecessor if the erased value was replaced by it
+			if(internal)
+				++iter;
+
+			return iter;
+		}
+		/// @brief Erases the value with the given key from the B-tree map.
+		/// @param key The key to look for.
+		/// @return The number of erased values.
+		size_type erase(const key_type& key) {
+			// Look for the key, exiting the function if it wasn't found
+			iterator iter = FindKey(key);
+			if(iter == end())
+				return 0;
+
+			// Erase the value
+			erase(iter);
+
+			return 1;
+		}
+		/// @brief Erases all values from the given range.
+		/// @param first The first value to erase.
+		/// @param last The value after the last value to erase.
+		/// @return An iterator to the value after the last erased value.
+		iterator erase(const_iterator first, const_iterator last) {
+			// Count the values in the range, since erasing may invalidate the last iterator
+			size_type eraseCount = 0;
+			for(const_iterator iter = first; iter != last; ++iter)
+				++eraseCount;
+
+			// Erase the values one at a time
+			iterator iter(first.node, first.position);
+			for(; eraseCount; --eraseCount)
+				iter = erase(iter);
+
+			return iter;
+		}
+		/// @brief Erases all values from the B-tree map.
+		void clear() {
+			// Destruct every value and free every node
+			if(mapRoot)
+				DestroyNode(mapRoot);
+
+			mapRoot = nullptr;
+			mapLeftmost = nullptr;
+			mapRightmost = nullptr;
+			mapSize = 0;
+		}
+		/// @brief Swaps the two B-tree maps' contents.
+		/// @param other The B-tree map to swap with.
+		void swap(btree_map& other) {
+			// Check if the two maps are the same
+			if(&other == this)
+				return;
+
+			// Save this B-tree map's values
+			MemoryResource* auxMemoryResource = memoryResource;
+			Node* auxRoot = mapRoot;
+			Node* auxLeftmost = mapLeftmost;
+			Node* auxRightmost = mapRightmost;
+			size_type auxSize = mapSize;
+
+			// Set this B-tree map's new values
+			memoryResource = other.memoryResource;
+			mapRoot = other.mapRoot;
+			mapLeftmost = other.mapLeftmost;
+			mapRightmost = other.mapRightmost;
+			mapSize = other.mapSize;
+
+			// Set the other B-tree map's new values
+			other.memoryResource = auxMemoryResource;
+			other.mapRoot = auxRoot;
+			other.mapLeftmost = auxLeftmost;
+			other.mapRightmost = auxRightmost;
+			other.mapSize = auxSize;
+		}
+
+		/// @brief Returns an iterator to the beginning of the B-tree map.
+		/// @return An iterator to the beginning of the B-tree map.
+		iterator begin() {
+			return iterator(mapLeftmost, 0);
+		}
+		/// @brief Returns a const iterator to the beginning of the B-tree map.
+		/// @return A const iterator to the beginning of the B-tree map.
+		const_iterator begin() const {
+			return const_iterator(mapLeftmost, 0);
+		}
+		/// @brief Returns an iterator to the end of the B-tree map.
+		/// @return An iterator to the end of the B-tree map.
+		iterator end() {
+			return iterator(mapRightmost, mapRightmost ? mapRightmost->count : 0);
+		}
+		/// @brief Returns a const iterator to the end of the B-tree map.
+		/// @return A const iterator to the end of the B-tree map.
+		const_iterator end() const {
+			return const_iterator(mapRightmost, mapRightmost ? mapRightmost->count : 0);
+		}
+		/// @brief Returns a const iterator to the beginning of the B-tree map.
+		/// @return A const iterator to the beginning of the B-tree map.
+		const_iterator cbegin() const {
+			return begin();
+		}
+		/// @brief Returns a const iterator to the end of the B-tree map.
+		/// @return A const iterator to the end of the B-tree map.
+		const_iterator cend() const {
+			return end();
+		}
+
+		/// @brief Checks if the B-tree map is empty.
+		/// @return True if the B-tree map is empty, otherwise false.
+		bool8_t empty() const {
+			return !mapSize;
+		}
+		/// @brief Gets the number of values in the B-tree map.
+		/// @return The B-tree map's size.
+		size_type size() const {
+			return mapSize;
+		}
+		/// @brief Gets the maximum number of values the B-tree map can hold.
+		/// @return The B-tree map's max size.
+		size_type max_size() const {
+			return SIZE_T_MAX / sizeof(value_type);
+		}
+
+		/// @brief Gets the memory resource the B-tree map allocates its memory from.
+		/// @return A pointer to the B-tree map's memory resource, or a nullptr if it allocates from the heap.
+		MemoryResource* get_memory_resource() const {
+			return memoryResource;
+		}
+
+		/// @brief Destroys the B-tree map.
+		~btree_map() {
+			// Destruct every value and free every node
+			if(mapRoot)
+				DestroyNode(mapRoot);
+		}
+	private:
+		/// @brief The size every node is fitted to, which holds a few cache lines.
+		static const size_type NODE_SIZE = 256;
+		/// @brief The size of every node's header.
+		static const size_type NODE_HEADER_SIZE = sizeof(void*) + 2 * sizeof(uint16_t) + sizeof(bool8_t);
+		/// @brief The maximum number of values in every node. At least 3 are needed for splitting nodes.
+		static const size_type NODE_CAPACITY = (NODE_SIZE - NODE_HEADER_SIZE) / sizeof(value_type) > 3 ? (NODE_SIZE - NODE_HEADER_SIZE) / sizeof(value_type) : 3;
+		/// @brief The number of values below which nodes are merged with or refilled from their siblings after an erase.
+		static const size_type NODE_MIN_COUNT = NODE_CAPACITY >> 1;
+
+		struct Node {
+			pointer GetValues() {
+				return (pointer)valueData;
+			}
+
+			Node* parent;
+			uint16_t position;
+			uint16_t count;
+			bool8_t leaf;
+			alignas(value_type) uint8_t valueData[NODE_CAPACITY * sizeof(value_type)];
+		};
+		struct InternalNode : Node {
+			Node* children[NODE_CAPACITY + 1];
+		};
+
+		static Node** GetChildren(Node* node) {
+			return ((InternalNode*)node)->children;
+		}
+		static void Increment(Node*& node, size_type& position) {
+			if(!node->leaf) {
+				// Move onto the leftmost value of the right subtree
+				node = GetChildren(node)[position + 1];
+				while(!node->leaf)
+					node = GetChildren(node)[0];
+				position = 0;
+
+				return;
+			}
+
+			// Move onto the next value of the leaf, if it exists
+			if(++position != node->count)
+				return;
+
+			// Climb up until a value after the leaf is found, staying at the end if there isn't one
+			Node* leaf = node;
+			while(position == node->count && node->parent) {
+				position = node->position;
+				node = node->parent;
+			}
+
+			if(position == node->count) {
+				node = leaf;
+				position = leaf->count;
+			}
+		}
+		static void Decrement(Node*& node, size_type& position) {
+			if(!node->leaf) {
+				// Move onto the rightmost value of the left subtree
+				node = GetChildren(node)[position];
+				while(!node->leaf)
+					node = GetChildren(node)[node->count];
+				position = node->count - 1;
+
+				return;
+			}
+
+			// Move onto the previous value of the leaf, if it exists
+			if(position) {
+				--position;
+				return;
+			}
+
+			// Climb up until a value before the leaf is found
+			while(!position && node->parent) {
+				position = node->position;
+				node = node->parent;
+			}
+
+			--position;
+		}
+
+		template<class K>
+		static size_type SearchLowerBound(Node* node, const K& key) {
+			pointer values = node->GetValues();
+			size_type length = node->count;
+
+			// Count the values with lower keys if the keys are numbers, since the comparisons are cheap and independent of each other
+			if constexpr(std::is_arithmetic_v<key_type>) {
+				size_type position = 0;
+				for(size_type i = 0; i != length; ++i)
+					position += Lower()(values[i].first, key);
+
+				return position;
+			}
+
+			// Exit the function if the node has no values
+			if(!length)
+				return 0;
+
+			// Binary search for the first value whose key isn't lower than the given key, halving the range without branching
+			pointer base = values;
+			while(length > 1) {
+				size_type half = length >> 1;
+				base = Lower()(base[half - 1].first, key) ? base + half : base;
+				length -= half;
+			}
+
+			return (size_type)(base - values) + Lower()(base[0].first, key);
+		}
+		template<class K>
+		static size_type SearchUpperBound(Node* node, const K& key) {
+			pointer values = node->GetValues();
+			size_type length = node->count;
+
+			// Count the values with keys that aren't higher if the keys are numbers, since the comparisons are cheap and independent of each other
+			if constexpr(std::is_arithmetic_v<key_type>) {
+				size_type position = 0;
+				for(size_type i = 0; i != length; ++i)
+					position += !Lower()(key, values[i].first);
+
+				return position;
+			}
+
+			// Exit the function if the node has no values
+			if(!length)
+				return 0;
+
+			// Binary search for the first value whose key is higher than the given key, halving the range without branching
+			pointer base = values;
+			while(length > 1) {
+				size_type half = length >> 1;
+				base = Lower()(key, base[half - 1].first) ? base : base + half;
+				length -= half;
+			}
+
+			return (size_type)(base - values) + !Lower()(key, base[0].first);
+		}
+		iterator GetNextValid(Node* node, size_type position) const {
+			// Climb up while the position is past the end of its node, since the next value is then in an ancestor
+			while(position == node->count && node->parent) {
+				position = node->position;
+				node = node->parent;
+			}
+
+			if(position == node->count)
+				return iterator(mapRightmost, mapRightmost->count);
+
+			return iterator(node, position);
+		}
+		iterator FindKey(const key_type& key) const {
+			// Exit the function if the B-tree map has no nodes
+			if(!mapRoot)
+				return iterator(nullptr, 0);
+
+			// Descend the B-tree, stopping at the first node holding the key
+			Node* node = mapRoot;
+			while(true) {
+				size_type position = SearchLowerBound(node, key);
+				if(position != node->count && Equal()(node->GetValues()[position].first, key))
+					return iterator(node, position);
+
+				if(node->leaf)
+					return iterator(mapRightmost, mapRightmost->count);
+
+				node = GetChildren(node)[position];
+			}
+		}
+		iterator LowerBound(const key_type& key) const {
+			// Exit the function if the B-tree map has no nodes
+			if(!mapRoot)
+				return iterator(nullptr, 0);
+
+			// Descend to the leaf the key would be in
+			Node* node = mapRoot;
+			size_type position = SearchLowerBound(node, key);
+			while(!node->leaf) {
+				node = GetChildren(node)[position];
+				position = SearchLowerBound(node, key);
+			}
+
+			return GetNextValid(node, position);
+		}
+		iterator UpperBound(const key_type& key) const {
+			// Exit the function if the B-tree map has no nodes
+			if(!mapRoot)
+				return iterator(nullptr, 0);
+
+			// Descend to the leaf right after the key's position
+			Node* node = mapRoot;
+			size_type position = SearchUpperBound(node, key);
+			while(!node->leaf) {
+				node = GetChildren(node)[position];
+				position = SearchUpperBound(node, key);
+			}
+
+			return GetNextValid(node, position);
+		}
+
+		Node* AllocNode(bool8_t leaf) {
+			// Allocate the node, which only has children if it isn't a leaf
+			Node* node = (Node*)AllocMemory(memoryResource, leaf ? sizeof(Node) : sizeof(InternalNode));
+			if(!node)
+				throw BadAllocException("Failed to allocate B-tree map node!");
+
+			node->parent = nullptr;
+			node->position = 0;
+			node->count = 0;
+			node->leaf = leaf;
+
+			return node;
+		}
+		void FreeNode(Node* node) {
+			FreeMemory(memoryResource, node);
+		}
+		void DestroyNode(Node* node) {
+			// Destruct the node's values
+			pointer values = node->GetValues();
+			for(size_type i = 0; i != node->count; ++i)
+				values[i].~value_type();
+
+			// Destroy the node's children
+			if(!node->leaf) {
+				Node** children = GetChildren(node);
+				for(size_type i = 0; i <= node->count; ++i)
+					DestroyNode(children[i]);
+			}
+
+			FreeNode(node);
+		}
+		Node* CopyNode(Node* other, Node* parent, size_type position) {
+			// Allocate the node and copy the other node's values
+			Node* node = AllocNode(other->leaf);
+			node->parent = parent;
+			node->position = (uint16_t)position;
+
+			pointer values = node->GetValues();
+			pointer otherValues = other->GetValues();
+			for(; node->count != other->count; ++node->count)
+				new(values + node->count) value_type(otherValues[node->count]);
+
+			// Copy the node's children
+			if(!node->leaf) {
+				Node** children = GetChildren(node);
+				Node** otherChildren = GetChildren(other);
+				for(size_type i = 0; i <= node->count; ++i)
+					children[i] = CopyNode(otherChildren[i], node, i);
+			}
+
+			return node;
+		}
+		void CopyTree(const btree_map& other) {
+			// Exit the function if the other B-tree map has no nodes
+			if(!other.mapRoot)
+				return;
+
+			// Copy every node, then find the leftmost and rightmost leaves
+			mapRoot = CopyNode(other.mapRoot, nullptr, 0);
+			mapSize = other.mapSize;
+
+			mapLeftmost = mapRoot;
+			while(!mapLeftmost->leaf)
+				mapLeftmost = GetChildren(mapLeftmost)[0];
+
+			mapRightmost = mapRoot;
+			while(!mapRightmost->leaf)
+				mapRightmost = GetChildren(mapRightmost)[mapRightmost->count];
+		}
+
+		pair<iterator, bool8_t> PrepareInsert(const key_type& key) {
+			// Create the root leaf if the B-tree map has no nodes
+			if(!mapRoot) {
+				mapRoot = AllocNode(true);
+				mapLeftmost = mapRoot;
+				mapRightmost = mapRoot;
+			}
+
+			// Descend to the leaf the key belongs in, exiting the function if the key is found on the way
+			Node* node = mapRoot;
+			size_type position;
+			while(true) {
+				position = SearchLowerBound(node, key);
+				if(position != node->count && Equal()(node->GetValues()[position].first, key))
+					return { iterator(node, position), false };
+
+				if(node->leaf)
+					break;
+
+				node = GetChildren(node)[position];
+			}
+
+			// Split the leaf if it's full
+			if(node->count == NODE_CAPACITY)
+				SplitNode(node, position);
+
+			// Move the following values forward to make room for the new value
+			pointer values = node->GetValues();
+			wfe::memmove(values + position + 1, values + position, (node->count - position) * sizeof(value_type));
+			++node->count;
+			++mapSize;
+
+			return { iterator(node, position), true };
+		}
+		void SplitNode(Node*& node, size_type& position) {
+			// Make sure the node's parent has room for the node's middle value, creating a new root or splitting the parent if needed
+			if(!node->parent) {
+				Node* root = AllocNode(false);
+				GetChildren(root)[0] = node;
+				node->parent = root;
+				node->position = 0;
+				mapRoot = root;
+			} else if(node->parent->count == NODE_CAPACITY) {
+				Node* parent = node->parent;
+				size_type parentPosition = node->position;
+				SplitNode(parent, parentPosition);
+			}
+
+			// Split the node in half, unless the new value is inserted at either end, in which case the other half is kept full; this way, sorted inserts fill every node
+			size_type leftCount;
+			if(position == NODE_CAPACITY) {
+				leftCount = NODE_CAPACITY - 1;
+			} else if(!position) {
+				leftCount = 0;
+			} else {
+				leftCount = NODE_CAPACITY >> 1;
+			}
+			size_type rightCount = NODE_CAPACITY - leftCount - 1;
+
+			// Move the values after the middle value into a new right sibling
+			Node* right = AllocNode(node->leaf);
+			pointer values = node->GetValues();
+			wfe::memcpy(right->GetValues(), values + leftCount + 1, rightCount * sizeof(value_type));
+
+			if(!node->leaf) {
+				Node** children = GetChildren(node);
+				Node** rightChildren = GetChildren(right);
+				for(size_type i = 0; i <= rightCount; ++i) {
+					rightChildren[i] = children[leftCount + 1 + i];
+					rightChildren[i]->parent = right;
+					rightChildren[i]->position = (uint16_t)i;
+				}
+			}
+
+			node->count = (uint16_t)leftCount;
+			right->count = (uint16_t)rightCount;
+
+			// Move the middle value into the parent, right before the new sibling
+			Node* parent = node->parent;
+			size_type parentPosition = node->position;
+			pointer parentValues = parent->GetValues();
+			Node** parentChildren = GetChildren(parent);
+
+			wfe::memmove(parentValues + parentPosition + 1, parentValues + parentPosition, (parent->count - parentPosition) * sizeof(value_type));
+			wfe::memcpy(parentValues + parentPosition, values + leftCount, sizeof(value_type));
+
+			for(size_type i = parent->count; i != parentPosition; --i) {
+				parentChildren[i + 1] = parentChildren[i];
+				parentChildren[i + 1]->position = (uint16_t)(i + 1);
+			}
+			parentChildren[parentPosition + 1] = right;
+			right->parent = parent;
+			right->position = (uint16_t)(parentPosition + 1);
+			++parent->count;
+
+			if(node == mapRightmost)
+				mapRightmost = right;
+
+			// Continue in the half the new value belongs in
+			if(position > leftCount) {
+				node = right;
+				position -= leftCount + 1;
+			}
+		}
+
+		void MergeNodes(Node* left, Node* right) {
+			// Move the separating value and every value of the right node to the end of the left node
+			Node* parent = left->parent;
+			size_type separator = left->position;
+			pointer leftValues = left->GetValues();
+			pointer parentValues = parent->GetValues();
+
+			wfe::memcpy(leftValues + left->count, parentValues + separator, sizeof(value_type));
+			wfe::memcpy(leftValues + left->count + 1, right->GetValues(), right->count * sizeof(value_type));
+
+			if(!left->leaf) {
+				Node** leftChildren = GetChildren(left);
+				Node** rightChildren = GetChildren(right);
+				for(size_type i = 0; i <= right->count; ++i) {
+					size_type position = left->count + 1 + i;
+					leftChildren[position] = rightChildren[i];
+					leftChildren[position]->parent = left;
+					leftChildren[position]->position = (uint16_t)position;
+				}
+			}
+
+			left->count += right->count + 1;
+
+			// Remove the separating value and the right node from the parent
+			Node** parentChildren = GetChildren(parent);
+			wfe::memmove(parentValues + separator, parentValues + separator + 1, (parent->count - separator - 1) * sizeof(value_type));
+			for(size_type i = separator + 1; i != parent->count; ++i) {
+				parentChildren[i] = parentChildren[i + 1];
+				parentChildren[i]->position = (uint16_t)i;
+			}
+			--parent->count;
+
+			if(right == mapRightmost)
+				mapRightmost = left;
+
+			FreeNode(right);
+		}
+		void RotateFromLeft(Node* left, Node* node) {
+			// Move the node's values forward, then move the separating value into the node and the left sibling's last value into the parent
+			Node* parent = node->parent;
+			size_type separator = node->position - 1;
+			pointer values = node->GetValues();
+			pointer parentValues = parent->GetValues();
+
+			wfe::memmove(values + 1, values, node->count * sizeof(value_type));
+			wfe::memcpy(values, parentValues + separator, sizeof(value_type));
+			wfe::memcpy(parentValues + separator, left->GetValues() + left->count - 1, sizeof(value_type));
+
+			// Move the left sibling's last child to the start of the node
+			if(!node->leaf) {
+				Node** children = GetChildren(node);
+				for(size_type i = node->count + 1; i; --i) {
+					children[i] = children[i - 1];
+					children[i]->position = (uint16_t)i;
+				}
+
+				children[0] = GetChildren(left)[left->count];
+				children[0]->parent = node;
+				children[0]->position = 0;
+			}
+
+			--left->count;
+			++node->count;
+		}
+		void RotateFromRight(Node* node, Node* right) {
+			// Move the separating value to the end of the node and the right sibling's first value into the parent
+			Node* parent = node->parent;
+			size_type separator = node->position;
+			pointer rightValues = right->GetValues();
+			pointer parentValues = parent->GetValues();
+
+			wfe::memcpy(node->GetValues() + node->count, parentValues + separator, sizeof(value_type));
+			wfe::memcpy(parentValues + separator, rightValues, sizeof(value_type));
+			wfe::memmove(rightValues, rightValues + 1, (right->count - 1) * sizeof(value_type));
+
+			// Move the right sibling's first child to the end of the node
+			if(!node->leaf) {
+				Node** children = GetChildren(node);
+				Node** rightChildren = GetChildren(right);
+
+				children[node->count + 1] = rightChildren[0];
+				children[node->count + 1]->parent = node;
+				children[node->count + 1]->position = (uint16_t)(node->count + 1);
+
+				for(size_type i = 0; i != right->count; ++i) {
+					rightChildren[i] = rightChildren[i + 1];
+					rightChildren[i]->position = (uint16_t)i;
+				}
+			}
+
+			++node->count;
+			--right->count;
+		}
+		void RebalanceAfterErase(Node*& iterNode, size_type& iterPosition) {
+			// Fix every underfull node from the leaf up, keeping the given position pointing at the same place in the sorted order
+			Node* node = iterNode;
+			while(node != mapRoot) {
+				// Exit the function if the node has enough values
+				if(node->count >= NODE_MIN_COUNT)
+					return;
+
+				Node* parent = node->parent;
+				size_type position = node->position;
+				Node* left = position ? GetChildren(parent)[position - 1] : nullptr;
+				Node* right = position != parent->count ? GetChildren(parent)[position + 1] : nullptr;
+
+				if(left && left->count + node->count < NODE_CAPACITY) {
+					// Merge the node into its left sibling
+					if(iterNode == node) {
+						iterNode = left;
+						iterPosition += left->count + 1;
+					}
+
+					MergeNodes(left, node);
+				} else if(right && node->count + right->count < NODE_CAPACITY) {
+					// Merge the right sibling into the node
+					MergeNodes(node, right);
+				} else if(left) {
+					// Move a value from the left sibling into the node
+					RotateFromLeft(left, node);
+					if(iterNode == node)
+						++iterPosition;
+
+					return;
+				} else {
+					// Move a value from the right sibling into the node
+					RotateFromRight(node, right);
+					return;
+				}
+
+				// Continue with the parent, which lost a value
+				node = parent;
+			}
+
+			// Replace the root with its only child if it has no values left
+			if(!mapRoot->leaf && !mapRoot->count) {
+				Node* root = mapRoot;
+				mapRoot = GetChildren(root)[0];
+				mapRoot->parent = nullptr;
+				mapRoot->position = 0;
+
+				FreeNode(root);
+			}
+		}
+
+		MemoryResource* memoryResource = nullptr;
+		Node* mapRoot = nullptr;
+		Node* mapLeftmost = nullptr;
+		Node* mapRightmost = nullptr;
+		size_type mapSize = 0;
+	};
+}
\ No newline at end of file
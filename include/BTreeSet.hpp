@@ -0,0 +1,1158 @@
+#pragma once
+
+#include "Allocator.hpp"
+#include "Compare.hpp"
+#include "Defines.hpp"
+#include "Exception.hpp"
+#include "Memory.hpp"
+#include "Pair.hpp"
+#include <initializer_list>
+#include <type_traits>
+#include <set>
+
+namespace wfe {
+	/// @brief Holds unique values in a B-tree, in sorted order. Every node holds a few cache lines worth of sorted values, so lookups touch a few nodes and updates only shift the values of a single node, unlike set, which shifts its whole tail on every insert and erase. Inserting and erasing may move any value to another node.
+	/// @tparam T The type of the B-tree set's values.
+	/// @tparam Lower The function struct used to check if one value should be before another.
+	/// @tparam Equal The function struct used to check if two values are equal.
+	template<class T, class Lower = LowerComp<T>, class Equal = EqualComp<T>>
+	class btree_set {
+	public:
+		/// @brief The B-tree set's key, which is its value.
+		typedef T key_type;
+		/// @brief The B-tree set's values.
+		typedef T value_type;
+		/// @brief A reference to the B-tree set's value.
+		typedef value_type& reference;
+		/// @brief A const reference to the B-tree set's value.
+		typedef const value_type& const_reference;
+		/// @brief A pointer to the B-tree set's value.
+		typedef value_type* pointer;
+		/// @brief A const pointer to the B-tree set's value.
+		typedef const value_type* const_pointer;
+		/// @brief Used for holding differences.
+		typedef ptrdiff_t difference_type;
+		/// @brief Used for holding sizes.
+		typedef size_t size_type;
+	private:
+		struct Node;
+	public:
+		struct const_iterator;
+
+		/// @brief An iterator to the B-tree set's values, in order.
+		struct iterator {
+			/// @brief Copies the given iterator.
+			/// @param other The iterator to copy.
+			iterator(const iterator& other) = default;
+			/// @brief Moves the given iterator's contents.
+			/// @param other The iterator to move from.
+			iterator(iterator&& other) noexcept = default;
+
+			/// @brief Copies the given iterator's contents into this iterator.
+			/// @param other The iterator to copy from.
+			/// @return A reference to this iterator.
+			iterator& operator=(const iterator& other) = default;
+			/// @brief Moves the given iterator's contents into this iterator.
+			/// @param other The iterator to move from.
+			/// @return A reference to this iterator.
+			iterator& operator=(iterator&& other) noexcept = default;
+
+			/// @brief Compares the two iterators.
+			/// @param other The iterator to compare with.
+			/// @return True if the iterators are equal, otherwise false.
+			bool8_t operator==(const iterator& other) const {
+				return node == other.node && position == other.position;
+			}
+			/// @brief Compares the two iterators.
+			/// @param other The iterator to compare with.
+			/// @return True if the iterators are different, otherwise false.
+			bool8_t operator!=(const iterator& other) const {
+				return node != other.node || position != other.position;
+			}
+
+			/// @brief Increments this iterator.
+			/// @return A reference to this iterator.
+			iterator& operator++() {
+				Increment(node, position);
+				return *this;
+			}
+			/// @brief Increments this iterator.
+			/// @return This iterator's previous state.
+			iterator operator++(int) {
+				// Save the current state of the iterator
+				iterator currentIter = *this;
+				Increment(node, position);
+
+				return currentIter;
+			}
+			/// @brief Decrements this iterator.
+			/// @return A reference to this iterator.
+			iterator& operator--() {
+				Decrement(node, position);
+				return *this;
+			}
+			/// @brief Decrements this iterator.
+			/// @return This iterator's previous state.
+			iterator operator--(int) {
+				// Save the current state of the iterator
+				iterator currentIter = *this;
+				Decrement(node, position);
+
+				return currentIter;
+			}
+
+			/// @brief Accesses the iterator value's members.
+			/// @return The iterator's pointer.
+			pointer operator->() const {
+				return node->GetValues() + position;
+			}
+			/// @brief Accesses the iterator's value.
+			/// @return A reference to the iterator's value.
+			reference operator*() const {
+				return node->GetValues()[position];
+			}
+
+			/// @brief Destruct this iterator.
+			~iterator() = default;
+		private:
+			iterator(Node* node, size_type position) : node(node), position(position) { }
+
+			Node* node;
+			size_type position;
+
+			friend btree_set;
+			friend const_iterator;
+		};
+		/// @brief A const iterator to the B-tree set's values, in order.
+		struct const_iterator {
+			/// @brief Copies the given iterator.
+			/// @param other The iterator to copy.
+			const_iterator(const const_iterator& other) = default;
+			/// @brief Moves the given iterator's contents.
+			/// @param other The iterator to move from.
+			const_iterator(const_iterator&& other) noexcept = default;
+			/// @brief Copies the given iterator.
+			/// @param other The iterator to copy.
+			const_iterator(const iterator& other) : node(other.node), position(other.position) { }
+
+			/// @brief Copies the given iterator's contents into this iterator.
+			/// @param other The iterator to copy from.
+			/// @return A reference to this iterator.
+			const_iterator& operator=(const const_iterator& other) = default;
+			/// @brief Moves the given iterator's contents into this iterator.
+			/// @param other The iterator to move from.
+			/// @return A reference to this iterator.
+			const_iterator& operator=(const_iterator&& other) noexcept = default;
+
+			/// @brief Compares the two iterators.
+			/// @param other The iterator to compare with.
+			/// @return True if the iterators are equal, otherwise false.
+			bool8_t operator==(const const_iterator& other) const {
+				return node == other.node && position == other.position;
+			}
+			/// @brief Compares the two iterators.
+			/// @param other The iterator to compare with.
+			/// @return True if the iterators are different, otherwise false.
+			bool8_t operator!=(const const_iterator& other) const {
+				return node != other.node || position != other.position;
+			}
+
+			/// @brief Increments this iterator.
+			/// @return A reference to this iterator.
+			const_iterator& operator++() {
+				Increment(node, position);
+				return *this;
+			}
+			/// @brief Increments this iterator.
+			/// @return This iterator's previous state.
+			const_iterator operator++(int) {
+				// Save the current state of the iterator
+				const_iterator currentIter = *this;
+				Increment(node, position);
+
+				return currentIter;
+			}
+			/// @brief Decrements this iterator.
+			/// @return A reference to this iterator.
+			const_iterator& operator--() {
+				Decrement(node, position);
+				return *this;
+			}
+			/// @brief Decrements this iterator.
+			/// @return This iterator's previous state.
+			const_iterator operator--(int) {
+				// Save the current state of the iterator
+				const_iterator currentIter = *this;
+				Decrement(node, position);
+
+				return currentIter;
+			}
+
+			/// @brief Accesses the iterator value's members.
+			/// @return The iterator's pointer.
+			const_pointer operator->() const {
+				return node->GetValues() + position;
+			}
+			/// @brief Accesses the iterator's value.
+			/// @return A reference to the iterator's value.
+			const_reference operator*() const {
+				return node->GetValues()[position];
+			}
+
+			/// @brief Destruct this iterator.
+			~const_iterator() = default;
+		private:
+			const_iterator(Node* node, size_type position) : node(node), position(position) { }
+
+			Node* node;
+			size_type position;
+
+			friend btree_set;
+		};
+
+		/// @brief Creates an empty B-tree set. No memory is allocated until the first value is inserted.
+		constexpr btree_set() = default;
+		/// @brief Creates an empty B-tree set that allocates its memory from the given resource.
+		/// @param resource The memory resource to allocate from. It must outlive the B-tree set.
+		explicit btree_set(MemoryResource& resource) : memoryResource(&resource) { }
+		/// @brief Copies the given B-tree set.
+		/// @param other The B-tree set to copy.
+		btree_set(const btree_set& other) {
+			// Copy the other B-tree set's nodes
+			CopyTree(other);
+		}
+		/// @brief Moves the given B-tree set's contents.
+		/// @param other The B-tree set whose contents to move.
+		btree_set(btree_set&& other) noexcept : memoryResource(other.memoryResource), setRoot(other.setRoot), setLeftmost(other.setLeftmost), setRightmost(other.setRightmost), setSize(other.setSize) {
+			// Unlink all nodes from the other B-tree set
+			other.setRoot = nullptr;
+			other.setLeftmost = nullptr;
+			other.setRightmost = nullptr;
+			other.setSize = 0;
+		}
+		/// @brief Constructs a B-tree set with all the values in the list.
+		/// @param list The list to copy from.
+		btree_set(std::initializer_list<value_type> list) {
+			insert(list);
+		}
+		/// @brief Copies the given std library set.
+		/// @param other The std library set to copy from.
+		btree_set(const std::set<value_type>& other) {
+			// Insert every value, which are already sorted and are therefore all appended to the rightmost leaf
+			for(const auto& val : other)
+				insert(val);
+		}
+
+		/// @brief Copies the given B-tree set's contents into this set.
+		/// @param other The B-tree set to copy from.
+		/// @return A reference to this B-tree set.
+		btree_set& operator=(const btree_set& other) {
+			// Check if the two maps are the same
+			if(&other == this)
+				return *this;
+
+			// Free the B-tree set's previous nodes, then copy the other B-tree set's nodes
+			clear();
+			CopyTree(other);
+
+			return *this;
+		}
+		/// @brief Moves the given B-tree set's contents into this set.
+		/// @param other The B-tree set to move from.
+		/// @return A reference to this B-tree set.
+		btree_set& operator=(btree_set&& other) {
+			// Check if the two maps are the same
+			if(&other == this)
+				return *this;
+
+			// Free the B-tree set's previous nodes
+			clear();
+
+			// Set the B-tree set's new values
+			memoryResource = other.memoryResource;
+			setRoot = other.setRoot;
+			setLeftmost = other.setLeftmost;
+			setRightmost = other.setRightmost;
+			setSize = other.setSize;
+
+			// Unlink all nodes from the other B-tree set
+			other.setRoot = nullptr;
+			other.setLeftmost = nullptr;
+			other.setRightmost = nullptr;
+			other.setSize = 0;
+
+			return *this;
+		}
+		/// @brief Copies the given list's values into this B-tree set.
+		/// @param list The list to copy from.
+		/// @return A reference to this B-tree set.
+		btree_set& operator=(std::initializer_list<value_type> list) {
+			// Remove the previous values, then insert every value from the list
+			clear();
+			insert(list);
+
+			return *this;
+		}
+
+		/// @brief Converts the B-tree set to a std library set.
+		operator std::set<value_type>() const {
+			std::set<value_type> set;
+
+			const_iterator endIter = end();
+			for(const_iterator iter = begin(); iter != endIter; ++iter)
+				set.insert(*iter);
+
+			return set;
+		}
+
+		/// @brief Finds the wanted value in the B-tree set.
+		/// @param val The value to find.
+		/// @return An iterator to the wanted value if it exists, otherwise btree_set::end().
+		iterator find(const_reference val) {
+			return FindKey(val);
+		}
+		/// @brief Finds the wanted value in the B-tree set.
+		/// @param val The value to find.
+		/// @return A const iterator to the wanted value if it exists, otherwise btree_set::end().
+		const_iterator find(const_reference val) const {
+			return FindKey(val);
+		}
+		/// @brief Gets the number of values equal to the given value.
+		/// @param val The value to look for.
+		/// @return The number of values equal to the given value.
+		size_type count(const_reference val) const {
+			const_iterator iter = FindKey(val);
+			return iter != end();
+		}
+		/// @brief Finds the first value that isn't lower than the given value.
+		/// @param val The value to compare with.
+		/// @return An iterator to the wanted value, or btree_set::end() if it doesn't exist.
+		iterator lower_bound(const_reference val) {
+			return LowerBound(val);
+		}
+		/// @brief Finds the first value that isn't lower than the given value.
+		/// @param val The value to compare with.
+		/// @return A const iterator to the wanted value, or btree_set::end() if it doesn't exist.
+		const_iterator lower_bound(const_reference val) const {
+			return LowerBound(val);
+		}
+		/// @brief Finds the first value that is higher than the given value.
+		/// @param val The value to compare with.
+		/// @return An iterator to the wanted value, or btree_set::end() if it doesn't exist.
+		iterator upper_bound(const_reference val) {
+			return UpperBound(val);
+		}
+		/// @brief Finds the first value that is higher than the given value.
+		/// @param val The value to compare with.
+		/// @return A const iterator to the wanted value, or btree_set::end() if it doesn't exist.
+		const_iterator upper_bound(const_reference val) const {
+			return UpperBound(val);
+		}
+		/// @brief Finds the range of values equal to the given value.
+		/// @param val The value to look for.
+		/// @return The bounds of the wanted range.
+		pair<iterator, iterator> equal_range(const_reference val) {
+			// Find the range's lower bound, which is also its upper bound if the value doesn't exist
+			iterator first = LowerBound(val);
+			if(first == end() || !Equal()(*first, val))
+				return { first, first };
+
+			iterator last = first;
+			++last;
+
+			return { first, last };
+		}
+		/// @brief Finds the range of values equal to the given value.
+		/// @param val The value to look for.
+		/// @return The bounds of the wanted range.
+		pair<const_iterator, const_iterator> equal_range(const_reference val) const {
+			// Find the range's lower bound, which is also its upper bound if the value doesn't exist
+			const_iterator first = LowerBound(val);
+			if(first == end() || !Equal()(*first, val))
+				return { first, first };
+
+			const_iterator last = first;
+			++last;
+
+			return { first, last };
+		}
+
+		/// @brief Emplaces the constructed value into the B-tree set.
+		/// @tparam ...Args The arg types to construct the value with.
+		/// @param ...args The args to construct the value with.
+		/// @return A pair containing an iterator to the emplaced value or an identical value and a bool that is true if a new value was inserted, otherwise false.
+		template<class... Args>
+		pair<iterator, bool8_t> emplace(Args&&... args) {
+			// Construct the value
+			value_type val(args...);
+
+			// Insert the value into the B-tree set
+			return insert(val);
+		}
+		/// @brief Emplaces the constructed value into the B-tree set using the given hint.
+		/// @tparam ...Args The arg types to construct the value with.
+		/// @param pos A hint for the position of the emplaced value.
+		/// @param ...args The args to construct the value with.
+		/// @return An iterator to the emplaced value or an identical value.
+		template<class... Args>
+		iterator emplace_hint(const_iterator pos, Args&&... args) {
+			// Construct the value
+			value_type val(args...);
+
+			// Insert the value into the B-tree set using the given hint
+			return insert(pos, val);
+		}
+		/// @brief Inserts the given value into the B-tree set.
+		/// @param val The value to insert.
+		/// @return A pair containing an iterator to the inserted value or an identical value and a bool that is true if a new value was inserted, otherwise false.
+		pair<iterator, bool8_t> insert(const_reference val) {
+			// Look for the value, preparing a slot for it if it doesn't exist
+			pair<iterator, bool8_t> result = PrepareInsert(val);
+			if(result.second)
+				new(result.first.operator->()) value_type(val);
+
+			return result;
+		}
+		/// @brief Inserts the given value into the B-tree set.
+		/// @param val The value to insert.
+		/// @return A pair containing an iterator to the inserted value or an identical value and a bool that is true if a new value was inserted, otherwise false.
+		pair<iterator, bool8_t> insert(value_type&& val) {
+			// Look for the value, preparing a slot for it if it doesn't exist
+			pair<iterator, bool8_t> result = PrepareInsert(val);
+			if(result.second)
+				new(result.first.operator->()) value_type(val);
+
+			return result;
+		}
+		/// @brief Inserts the given value into the B-tree set using the given hint.
+		/// @param pos A hint for the position of the inserted value.
+		/// @param val The value to insert.
+		/// @return An iterator the the inserted value or an identical value.
+		iterator insert(const_iterator pos, const_reference val) {
+			// Simply insert the value without using the given hint
+			(void)pos;
+			return insert(val).first;
+		}
+		/// @brief Inserts the given value into the B-tree set using the given hint.
+		/// @param pos A hint for the position of the inserted value.
+		/// @param val The value to insert.
+		/// @return An iterator the the inserted value or an identical value.
+		iterator insert(const_iterator pos, value_type&& val) {
+			// Simply insert the value without using the given hint
+			(void)pos;
+			return insert(val).first;
+		}
+		/// @brief Inserts all values from the given list into the B-tree set.
+		/// @param list The list to insert from.
+		void insert(std::initializer_list<value_type> list) {
+			// Insert every value from the given list
+			const_pointer end = list.end();
+			for(const_pointer ptr = list.begin(); ptr != end; ++ptr)
+				insert(*ptr);
+		}
+		/// @brief Erases the value at the given position from the B-tree set. Iterators to other values may be invalidated.
+		/// @param pos The position to erase from.
+		/// @return An iterator to the value after the erased value.
+		iterator erase(const_iterator pos) {
+			// Destruct the erased value
+			Node* node = pos.node;
+			size_type position = pos.position;
+			pointer values = node->GetValues();
+			values[position].~value_type();
+
+			bool8_t internal = !node->leaf;
+			if(internal) {
+				// Replace the erased value with its predecessor, which is the last value of the rightmost leaf of its left subtree
+				Node* leaf = GetChildren(node)[position];
+				while(!leaf->leaf)
+					leaf = GetChildren(leaf)[leaf->count];
+
+				--leaf->count;
+				wfe::memcpy(values + position, leaf->GetValues() + leaf->count, sizeof(value_type));
+
+				// Continue from right after the moved predecessor, which is the end of its old leaf
+				node = leaf;
+				position = leaf->count;
+			} else {
+				// Move the following values back to fill the erased value's slot
+				--node->count;
+				wfe::memmove(values + position, values + position + 1, (node->count - position) * sizeof(value_type));
+			}
+
+			--setSize;
+
+			// Free the root if the B-tree set is now empty
+			if(!setSize) {
+				FreeNode(setRoot);
+				setRoot = nullptr;
+				setLeftmost = nullptr;
+				setRightmost = nullptr;
+
+				return end();
+			}
+
+			// Rebalance the B-tree, keeping track of the position after the erased value
+			RebalanceAfterErase(node, position);
+			iterator iter = GetNextValid(node, position);
+
+			// Move past the predecessor if the erased value was replaced by it
+			if(internal)
+				++iter;
+
+			return iter;
+		}
+		/// @brief Erases the given value from the B-tree set.
+		/// @param val The value to erase.
+		/// @return The number of erased values.
+		size_type erase(const_reference val) {
+			// Look for the value, exiting the function if it wasn't found
+			iterator iter = FindKey(val);
+			if(iter == end())
+				return 0;
+
+			// Erase the value
+			erase(iter);
+
+			return 1;
+		}
+		/// @brief Erases all values from the given range.
+		/// @param first The first value to erase.
+		/// @param last The value after the last value to erase.
+		/// @return An iterator to the value after the last erased value.
+		iterator erase(const_iterator first, const_iterator last) {
+			// Count the values in the range, since erasing may invalidate the last iterator
+			size_type eraseCount = 0;
+			for(const_iterator iter = first; iter != last; ++iter)
+				++eraseCount;
+
+			// Erase the values one at a time
+			iterator iter(first.node, first.position);
+			for(; eraseCount; --eraseCount)
+				iter = erase(iter);
+
+			return iter;
+		}
+		/// @brief Erases all values from the B-tree set.
+		void clear() {
+			// Destruct every value and free every node
+			if(setRoot)
+				DestroyNode(setRoot);
+
+			setRoot = nullptr;
+			setLeftmost = nullptr;
+			setRightmost = nullptr;
+			setSize = 0;
+		}
+		/// @brief Swaps the two B-tree sets' contents.
+		/// @param other The B-tree set to swap with.
+		void swap(btree_set& other) {
+			// Check if the two maps are the same
+			if(&other == this)
+				return;
+
+			// Save this B-tree set's values
+			MemoryResource* auxMemoryResource = memoryResource;
+			Node* auxRoot = setRoot;
+			Node* auxLeftmost = setLeftmost;
+			Node* auxRightmost = setRightmost;
+			size_type auxSize = setSize;
+
+			// Set this B-tree set's new values
+			memoryResource = other.memoryResource;
+			setRoot = other.setRoot;
+			setLeftmost = other.setLeftmost;
+			setRightmost = other.setRightmost;
+			setSize = other.setSize;
+
+			// Set the other B-tree set's new values
+			other.memoryResource = auxMemoryResource;
+			other.setRoot = auxRoot;
+			other.setLeftmost = auxLeftmost;
+			other.setRightmost = auxRightmost;
+			other.setSize = auxSize;
+		}
+
+		/// @brief Returns an iterator to the beginning of the B-tree set.
+		/// @return An iterator to the beginning of the B-tree set.
+		iterator begin() {
+			return iterator(setLeftmost, 0);
+		}
+		/// @brief Returns a const iterator to the beginning of the B-tree set.
+		/// @return A const iterator to the beginning of the B-tree set.
+		const_iterator begin() const {
+			return const_iterator(setLeftmost, 0);
+		}
+		/// @brief Returns an iterator to the end of the B-tree set.
+		/// @return An iterator to the end of the B-tree set.
+		iterator end() {
+			return iterator(setRightmost, setRightmost ? setRightmost->count : 0);
+		}
+		/// @brief Returns a const iterator to the end of the B-tree set.
+		/// @return A const iterator to the end of the B-tree set.
+		const_iterator end() const {
+			return const_iterator(setRightmost, setRightmost ? setRightmost->count : 0);
+		}
+		/// @brief Returns a const iterator to the beginning of the B-tree set.
+		/// @return A const iterator to the beginning of the B-tree set.
+		const_iterator cbegin() const {
+			return begin();
+		}
+		/// @brief Returns a const iterator to the end of the B-tree set.
+		/// @return A const iterator to the end of the B-tree set.
+		const_iterator cend() const {
+			return end();
+		}
+
+		/// @brief Checks if the B-tree set is empty.
+		/// @return True if the B-tree set is empty, otherwise false.
+		bool8_t empty() const {
+			return !setSize;
+		}
+		/// @brief Gets the number of values in the B-tree set.
+		/// @return The B-tree set's size.
+		size_type size() const {
+			return setSize;
+		}
+		/// @brief Gets the maximum number of values the B-tree set can hold.
+		/// @return The B-tree set's max size.
+		size_type max_size() const {
+			return SIZE_T_MAX / sizeof(value_type);
+		}
+
+		/// @brief Gets the memory resource the B-tree set allocates its memory from.
+		/// @return A pointer to the B-tree set's memory resource, or a nullptr if it allocates from the heap.
+		MemoryResource* get_memory_resource() const {
+			return memoryResource;
+		}
+
+		/// @brief Destroys the B-tree set.
+		~btree_set() {
+			// Destruct every value and free every node
+			if(setRoot)
+				DestroyNode(setRoot);
+		}
+	private:
+		/// @brief The size every node is fitted to, which holds a few cache lines.
+		static const size_type NODE_SIZE = 256;
+		/// @brief The size of every node's header.
+		static const size_type NODE_HEADER_SIZE = sizeof(void*) + 2 * sizeof(uint16_t) + sizeof(bool8_t);
+		/// @brief The maximum number of values in every node. At least 3 are needed for splitting nodes.
+		static const size_type NODE_CAPACITY = (NODE_SIZE - NODE_HEADER_SIZE) / sizeof(value_type) > 3 ? (NODE_SIZE - NODE_HEADER_SIZE) / sizeof(value_type) : 3;
+		/// @brief The number of values below which nodes are merged with or refilled from their siblings after an erase.
+		static const size_type NODE_MIN_COUNT = NODE_CAPACITY >> 1;
+
+		struct Node {
+			pointer GetValues() {
+				return (pointer)valueData;
+			}
+
+			Node* parent;
+			uint16_t position;
+			uint16_t count;
+			bool8_t leaf;
+			alignas(value_type) uint8_t valueData[NODE_CAPACITY * sizeof(value_type)];
+		};
+		struct InternalNode : Node {
+			Node* children[NODE_CAPACITY + 1];
+		};
+
+		static Node** GetChildren(Node* node) {
+			return ((InternalNode*)node)->children;
+		}
+		static void Increment(Node*& node, size_type& position) {
+			if(!node->leaf) {
+				// Move onto the leftmost value of the right subtree
+				node = GetChildren(node)[position + 1];
+				while(!node->leaf)
+					node = GetChildren(node)[0];
+				position = 0;
+
+				return;
+			}
+
+			// Move onto the next value of the leaf, if it exists
+			if(++position != node->count)
+				return;
+
+			// Climb up until a value after the leaf is found, staying at the end if there isn't one
+			Node* leaf = node;
+			while(position == node->count && node->parent) {
+				position = node->position;
+				node = node->parent;
+			}
+
+			if(position == node->count) {
+				node = leaf;
+				position = leaf->count;
+			}
+		}
+		static void Decrement(Node*& node, size_type& position) {
+			if(!node->leaf) {
+				// Move onto the rightmost value of the left subtree
+				node = GetChildren(node)[position];
+				while(!node->leaf)
+					node = GetChildren(node)[node->count];
+				position = node->count - 1;
+
+				return;
+			}
+
+			// Move onto the previous value of the leaf, if it exists
+			if(position) {
+				--position;
+				return;
+			}
+
+			// Climb up until a value before the leaf is found
+			while(!position && node->parent) {
+				position = node->position;
+				node = node->parent;
+			}
+
+			--position;
+		}
+
+		template<class K>
+		static size_type SearchLowerBound(Node* node, const K& key) {
+			pointer values = node->GetValues();
+			size_type length = node->count;
+
+			// Count the values with lower keys if the keys are numbers, since the comparisons are cheap and independent of each other
+			if constexpr(std::is_arithmetic_v<key_type>) {
+				size_type position = 0;
+				for(size_type i = 0; i != length; ++i)
+					position += Lower()(values[i], key);
+
+				return position;
+			}
+
+			// Exit the function if the node has no values
+			if(!length)
+				return 0;
+
+			// Binary search for the first value whose key isn't lower than the given key, halving the range without branching
+			pointer base = values;
+			while(length > 1) {
+				size_type half = length >> 1;
+				base = Lower()(base[half - 1], key) ? base + half : base;
+				length -= half;
+			}
+
+			return (size_type)(base - values) + Lower()(base[0], key);
+		}
+		template<class K>
+		static size_type SearchUpperBound(Node* node, const K& key) {
+			pointer values = node->GetValues();
+			size_type length = node->count;
+
+			// Count the values with keys that aren't higher if the keys are numbers, since the comparisons are cheap and independent of each other
+			if constexpr(std::is_arithmetic_v<key_type>) {
+				size_type position = 0;
+				for(size_type i = 0; i != length; ++i)
+					position += !Lower()(key, values[i]);
+
+				return position;
+			}
+
+			// Exit the function if the node has no values
+			if(!length)
+				return 0;
+
+			// Binary search for the first value whose key is higher than the given key, halving the range without branching
+			pointer base = values;
+			while(length > 1) {
+				size_type half = length >> 1;
+				base = Lower()(key, base[half - 1]) ? base : base + half;
+				length -= half;
+			}
+
+			return (size_type)(base - values) + !Lower()(key, base[0]);
+		}
+		iterator GetNextValid(Node* node, size_type position) const {
+			// Climb up while the position is past the end of its node, since the next value is then in an ancestor
+			while(position == node->count && node->parent) {
+				position = node->position;
+				node = node->parent;
+			}
+
+			if(position == node->count)
+				return iterator(setRightmost, setRightmost->count);
+
+			return iterator(node, position);
+		}
+		iterator FindKey(const key_type& key) const {
+			// Exit the function if the B-tree set has no nodes
+			if(!setRoot)
+				return iterator(nullptr, 0);
+
+			// Descend the B-tree, stopping at the first node holding the key
+			Node* node = setRoot;
+			while(true) {
+				size_type position = SearchLowerBound(node, key);
+				if(position != node->count && Equal()(node->GetValues()[position], key))
+					return iterator(node, position);
+
+				if(node->leaf)
+					return iterator(setRightmost, setRightmost->count);
+
+				node = GetChildren(node)[position];
+			}
+		}
+		iterator LowerBound(const key_type& key) const {
+			// Exit the function if the B-tree set has no nodes
+			if(!setRoot)
+				return iterator(nullptr, 0);
+
+			// Descend to the leaf the key would be in
+			Node* node = setRoot;
+			size_type position = SearchLowerBound(node, key);
+			while(!node->leaf) {
+				node = GetChildren(node)[position];
+				position = SearchLowerBound(node, key);
+			}
+
+			return GetNextValid(node, position);
+		}
+		iterator UpperBound(const key_type& key) const {
+			// Exit the function if the B-tree set has no nodes
+			if(!setRoot)
+				return iterator(nullptr, 0);
+
+			// Descend to the leaf right after the key's position
+			Node* node = setRoot;
+			size_type position = SearchUpperBound(node, key);
+			while(!node->leaf) {
+				node = GetChildren(node)[position];
+				position = SearchUpperBound(node, key);
+			}
+
+			return GetNextValid(node, position);
+		}
+
+		Node* AllocNode(bool8_t leaf) {
+			// Allocate the node, which only has children if it isn't a leaf
+			Node* node = (Node*)AllocMemory(memoryResource, leaf ? sizeof(Node) : sizeof(InternalNode));
+			if(!node)
+				throw BadAllocException("Failed to allocate B-tree set node!");
+
+			node->parent = nullptr;
+			node->position = 0;
+			node->count = 0;
+			node->leaf = leaf;
+
+			return node;
+		}
+		void FreeNode(Node* node) {
+			FreeMemory(memoryResource, node);
+		}
+		void DestroyNode(Node* node) {
+			// Destruct the node's values
+			pointer values = node->GetValues();
+			for(size_type i = 0; i != node->count; ++i)
+				values[i].~value_type();
+
+			// Destroy the node's children
+			if(!node->leaf) {
+				Node** children = GetChildren(node);
+				for(size_type i = 0; i <= node->count; ++i)
+					DestroyNode(children[i]);
+			}
+
+			FreeNode(node);
+		}
+		Node* CopyNode(Node* other, Node* parent, size_type position) {
+			// Allocate the node and copy the other node's values
+			Node* node = AllocNode(other->leaf);
+			node->parent = parent;
+			node->position = (uint16_t)position;
+
+			pointer values = node->GetValues();
+			pointer otherValues = other->GetValues();
+			for(; node->count != other->count; ++node->count)
+				new(values + node->count) value_type(otherValues[node->count]);
+
+			// Copy the node's children
+			if(!node->leaf) {
+				Node** children = GetChildren(node);
+				Node** otherChildren = GetChildren(other);
+				for(size_type i = 0; i <= node->count; ++i)
+					children[i] = CopyNode(otherChildren[i], node, i);
+			}
+
+			return node;
+		}
+		void CopyTree(const btree_set& other) {
+			// Exit the function if the other B-tree set has no nodes
+			if(!other.setRoot)
+				return;
+
+			// Copy every node, then find the leftmost and rightmost leaves
+			setRoot = CopyNode(other.setRoot, nullptr, 0);
+			setSize = other.setSize;
+
+			setLeftmost = setRoot;
+			while(!setLeftmost->leaf)
+				setLeftmost = GetChildren(setLeftmost)[0];
+
+			setRightmost = setRoot;
+			while(!setRightmost->leaf)
+				setRightmost = GetChildren(setRightmost)[setRightmost->count];
+		}
+
+		pair<iterator, bool8_t> PrepareInsert(const key_type& key) {
+			// Create the root leaf if the B-tree set has no nodes
+			if(!setRoot) {
+				setRoot = AllocNode(true);
+				setLeftmost = setRoot;
+				setRightmost = setRoot;
+			}
+
+			// Descend to the leaf the key belongs in, exiting the function if the key is found on the way
+			Node* node = setRoot;
+			size_type position;
+			while(true) {
+				position = SearchLowerBound(node, key);
+				if(position != node->count && Equal()(node->GetValues()[position], key))
+					return { iterator(node, position), false };
+
+				if(node->leaf)
+					break;
+
+				node = GetChildren(node)[position];
+			}
+
+			// Split the leaf if it's full
+			if(node->count == NODE_CAPACITY)
+				SplitNode(node, position);
+
+			// Move the following values forward to make room for the new value
+			pointer values = node->GetValues();
+			wfe::memmove(values + position + 1, values + position, (node->count - position) * sizeof(value_type));
+			++node->count;
+			++setSize;
+
+			return { iterator(node, position), true };
+		}
+		void SplitNode(Node*& node, size_type& position) {
+			// Make sure the node's parent has room for the node's middle value, creating a new root or splitting the parent if needed
+			if(!node->parent) {
+				Node* root = AllocNode(false);
+				GetChildren(root)[0] = node;
+				node->parent = root;
+				node->position = 0;
+				setRoot = root;
+			} else if(node->parent->count == NODE_CAPACITY) {
+				Node* parent = node->parent;
+				size_type parentPosition = node->position;
+				SplitNode(parent, parentPosition);
+			}
+
+			// Split the node in half, unless the new value is inserted at either end, in which case the other half is kept full; this way, sorted inserts fill every node
+			size_type leftCount;
+			if(position == NODE_CAPACITY) {
+				leftCount = NODE_CAPACITY - 1;
+			} else if(!position) {
+				leftCount = 0;
+			} else {
+				leftCount = NODE_CAPACITY >> 1;
+			}
+			size_type rightCount = NODE_CAPACITY - leftCount - 1;
+
+			// Move the values after the middle value into a new right sibling
+			Node* right = AllocNode(node->leaf);
+			pointer values = node->GetValues();
+			wfe::memcpy(right->GetValues(), values + leftCount + 1, rightCount * sizeof(value_type));
+
+			if(!node->leaf) {
+				Node** children = GetChildren(node);
+				Node** rightChildren = GetChildren(right);
+				for(size_type i = 0; i <= rightCount; ++i) {
+					rightChildren[i] = children[leftCount + 1 + i];
+					rightChildren[i]->parent = right;
+					rightChildren[i]->position = (uint16_t)i;
+				}
+			}
+
+			node->count = (uint16_t)leftCount;
+			right->count = (uint16_t)rightCount;
+
+			// Move the middle value into the parent, right before the new sibling
+			Node* parent = node->parent;
+			size_type parentPosition = node->position;
+			pointer parentValues = parent->GetValues();
+			Node** parentChildren = GetChildren(parent);
+
+			wfe::memmove(parentValues + parentPosition + 1, parentValues + parentPosition, (parent->count - parentPosition) * sizeof(value_type));
+			wfe::memcpy(parentValues + parentPosition, values + leftCount, sizeof(value_type));
+
+			for(size_type i = parent->count; i != parentPosition; --i) {
+				parentChildren[i + 1] = parentChildren[i];
+				parentChildren[i + 1]->position = (uint16_t)(i + 1);
+			}
+			parentChildren[parentPosition + 1] = right;
+			right->parent = parent;
+			right->position = (uint16_t)(parentPosition + 1);
+			++parent->count;
+
+			if(node == setRightmost)
+				setRightmost = right;
+
+			// Continue in the half the new value belongs in
+			if(position > leftCount) {
+				node = right;
+				position -= leftCount + 1;
+			}
+		}
+
+		void MergeNodes(Node* left, Node* right) {
+			// Move the separating value and every value of the right node to the end of the left node
+			Node* parent = left->parent;
+			size_type separator = left->position;
+			pointer leftValues = left->GetValues();
+			pointer parentValues = parent->GetValues();
+
+			wfe::memcpy(leftValues + left->count, parentValues + separator, sizeof(value_type));
+			wfe::memcpy(leftValues + left->count + 1, right->GetValues(), right->count * sizeof(value_type));
+
+			if(!left->leaf) {
+				Node** leftChildren = GetChildren(left);
+				Node** rightChildren = GetChildren(right);
+				for(size_type i = 0; i <= right->count; ++i) {
+					size_type position = left->count + 1 + i;
+					leftChildren[position] = rightChildren[i];
+					leftChildren[position]->parent = left;
+					leftChildren[position]->position = (uint16_t)position;
+				}
+			}
+
+			left->count += right->count + 1;
+
+			// Remove the separating value and the right node from the parent
+			Node** parentChildren = GetChildren(parent);
+			wfe::memmove(parentValues + separator, parentValues + separator + 1, (parent->count - separator - 1) * sizeof(value_type));
+			for(size_type i = separator + 1; i != parent->count; ++i) {
+				parentChildren[i] = parentChildren[i + 1];
+				parentChildren[i]->position = (uint16_t)i;
+			}
+			--parent->count;
+
+			if(right == setRightmost)
+				setRightmost = left;
+
+			FreeNode(right);
+		}
+		void RotateFromLeft(Node* left, Node* node) {
+			// Move the node's values forward, then move the separating value into the node and the left sibling's last value into the parent
+			Node* parent = node->parent;
+			size_type separator = node->position - 1;
+			pointer values = node->GetValues();
+			pointer parentValues = parent->GetValues();
+
+			wfe::memmove(values + 1, values, node->count * sizeof(value_type));
+			wfe::memcpy(values, parentValues + separator, sizeof(value_type));
+			wfe::memcpy(parentValues + separator, left->GetValues() + left->count - 1, sizeof(value_type));
+
+			// Move the left sibling's last child to the start of the node
+			if(!node->leaf) {
+				Node** children = GetChildren(node);
+				for(size_type i = node->count + 1; i; --i) {
+					children[i] = children[i - 1];
+					children[i]->position = (uint16_t)i;
+				}
+
+				children[0] = GetChildren(left)[left->count];
+				children[0]->parent = node;
+				children[0]->position = 0;
+			}
+
+			--left->count;
+			++node->count;
+		}
+		void RotateFromRight(Node* node, Node* right) {
+			// Move the separating value to the end of the node and the right sibling's first value into the parent
+			Node* parent = node->parent;
+			size_type separator = node->position;
+			pointer rightValues = right->GetValues();
+			pointer parentValues = parent->GetValues();
+
+			wfe::memcpy(node->GetValues() + node->count, parentValues + separator, sizeof(value_type));
+			wfe::memcpy(parentValues + separator, rightValues, sizeof(value_type));
+			wfe::memmove(rightValues, rightValues + 1, (right->count - 1) * sizeof(value_type));
+
+			// Move the right sibling's first child to the end of the node
+			if(!node->leaf) {
+				Node** children = GetChildren(node);
+				Node** rightChildren = GetChildren(right);
+
+				children[node->count + 1] = rightChildren[0];
+				children[node->count + 1]->parent = node;
+				children[node->count + 1]->position = (uint16_t)(node->count + 1);
+
+				for(size_type i = 0; i != right->count; ++i) {
+					rightChildren[i] = rightChildren[i + 1];
+					rightChildren[i]->position = (uint16_t)i;
+				}
+			}
+
+			++node->count;
+			--right->count;
+		}
+		void RebalanceAfterErase(Node*& iterNode, size_type& iterPosition) {
+			// Fix every underfull node from the leaf up, keeping the given position pointing at the same place in the sorted order
+			Node* node = iterNode;
+			while(node != setRoot) {
+				// Exit the function if the node has enough values
+				if(node->count >= NODE_MIN_COUNT)
+					return;
+
+				Node* parent = node->parent;
+				size_type position = node->position;
+				Node* left = position ? GetChildren(parent)[position - 1] : nullptr;
+				Node* right = position != parent->count ? GetChildren(parent)[position + 1] : nullptr;
+
+				if(left && left->count + node->count < NODE_CAPACITY) {
+					// Merge the node into its left sibling
+					if(iterNode == node) {
+						iterNode = left;
+						iterPosition += left->count + 1;
+					}
+
+					MergeNodes(left, node);
+				} else if(right && node->count + right->count < NODE_CAPACITY) {
+					// Merge the right sibling into the node
+					MergeNodes(node, right);
+				} else if(left) {
+					// Move a value from the left sibling into the node
+					RotateFromLeft(left, node);
+					if(iterNode == node)
+						++iterPosition;
+
+					return;
+				} else {
+					// Move a value from the right sibling into the node
+					RotateFromRight(node, right);
+					return;
+				}
+
+				// Continue with the parent, which lost a value
+				node = parent;
+			}
+
+			// Replace the root with its only child if it has no values left
+			if(!setRoot->leaf && !setRoot->count) {
+				Node* root = setRoot;
+				setRoot = GetChildren(root)[0];
+				setRoot->parent = nullptr;
+				setRoot->position = 0;
+
+				FreeNode(root);
+			}
+		}
+
+		MemoryResource* memoryResource = nullptr;
+		Node* setRoot = nullptr;
+		Node* setLeftmost = nullptr;
+		Node* setRightmost = nullptr;
+		size_type setSize = 0;
+	};
+}
\ No newline at end of file
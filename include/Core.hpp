@@ -1,6 +1,10 @@
 #pragma once
 
 #include "Allocator.hpp"
+#include "ArenaAllocator.hpp"
+#include "AtomicQueue.hpp"
+#include "BTreeMap.hpp"
+#include "BTreeSet.hpp"
 #include "BuildInfo.hpp"
 #include "Compare.hpp"
 #include "Debug.hpp"
@@ -8,7 +12,11 @@
 #include "DynamicLib.hpp"
 #include "Event.hpp"
 #include "Exception.hpp"
+#include "EytzingerIndex.hpp"
 #include "Files.hpp"
+#include "FlatUnorderedMap.hpp"
+#include "FlatUnorderedSet.hpp"
+#include "HashGroup.hpp"
 #include "Job.hpp"
 #include "Map.hpp"
 #include "Math.hpp"
@@ -18,10 +26,12 @@
 #include "New.hpp"
 #include "Pair.hpp"
 #include "Platform.hpp"
+#include "PoolAllocator.hpp"
 #include "Quaternion.hpp"
 #include "Runner.hpp"
 #include "Semaphore.hpp"
 #include "Set.hpp"
+#include "Sort.hpp"
 #include "String.hpp"
 #include "Thread.hpp"
 #include "UnorderedMap.hpp"
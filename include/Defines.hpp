@@ -175,7 +175,7 @@ namespace wfe {
 /// @brief Declares the specified function as inline.
 #define WFE_INLINE inline
 /// @brief Declares the specified function as not inline.
-#define WFE_NOINLINE
+#define WFE_NOINLINE __attribute__((noinline))
 #endif
 
 /// @brief Gets the string version of the macro's value. Used for a string conversion workaround.
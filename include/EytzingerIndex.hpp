@@ -0,0 +1,199 @@
+#pragma once
+
+#include "Defines.hpp"
+#include "Allocator.hpp"
+#include "Exception.hpp"
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#if defined(_M_X64) || defined(_M_IX86)
+#include <xmmintrin.h>
+#endif
+#endif
+
+namespace wfe {
+	/// @brief Prefetches the cache line holding the given address. The address doesn't have to be valid.
+	/// @param address The address to prefetch.
+	WFE_INLINE void EytzingerPrefetch(const void* address) {
+#if defined(_MSC_VER)
+#if defined(_M_X64) || defined(_M_IX86)
+		_mm_prefetch((const char*)address, _MM_HINT_T0);
+#else
+		(void)address;
+#endif
+#else
+		__builtin_prefetch(address);
+#endif
+	}
+	/// @brief Counts the trailing set bits of the given value.
+	/// @param value The value to check.
+	/// @return The number of trailing set bits.
+	WFE_INLINE uint32_t EytzingerTrailingOnes(uint64_t value) {
+		// Every value has a cleared bit, since indices never fill all 64 bits
+#if defined(_MSC_VER)
+		unsigned long index;
+		_BitScanForward64(&index, ~value);
+		return (uint32_t)index;
+#else
+		return (uint32_t)__builtin_ctzll(~value);
+#endif
+	}
+
+	/// @brief A read-only copy of a sorted array's keys, stored in Eytzinger (breadth first) order. The keys form a perfect binary tree, padded with copies of the highest key, so every search walks down the same number of levels with one comparison each and no unpredictable branches. The first levels stay in cache and the next levels are prefetched, and the leaf reached encodes the wanted position.
+	/// @tparam Key The type of the indexed keys.
+	/// @tparam Lower The function struct used to check if one key should be before another.
+	template<class Key, class Lower>
+	class EytzingerIndex {
+	public:
+		/// @brief The number of tree nodes that fill two cache lines. Every node's descendants a few levels below start this many times further into the tree, and fill the two cache lines that are prefetched.
+		static const size_t PREFETCH_NODE_COUNT = sizeof(Key) < 128 ? 128 / sizeof(Key) : 1;
+
+		/// @brief Creates an empty index.
+		constexpr EytzingerIndex() = default;
+		EytzingerIndex(const EytzingerIndex&) = delete;
+		EytzingerIndex(EytzingerIndex&&) noexcept = delete;
+
+		EytzingerIndex& operator=(const EytzingerIndex&) = delete;
+		EytzingerIndex& operator=(EytzingerIndex&&) = delete;
+
+		/// @brief Builds the index from the given sorted keys, replacing its old contents.
+		/// @param resource The memory resource to allocate from, or a nullptr to allocate from the heap.
+		/// @param keys A pointer to the first sorted key.
+		/// @param count The number of keys.
+		/// @param stride The distance in bytes between two consecutive keys.
+		void Build(MemoryResource* resource, const Key* keys, size_t count, size_t stride) {
+			// Free the old index
+			Clear();
+
+			// Exit the function if there are no keys to index
+			if(!count)
+				return;
+
+			// Set the first leaf to the lowest power of 2 higher than the key count, so that the tree's nodes fit every key
+			size_t leafStart = 1;
+			while(leafStart <= count)
+				leafStart <<= 1;
+
+			// Allocate the tree's nodes, aligning them to a cache line so that every prefetch fetches whole nodes
+			memoryResource = resource;
+			indexKeys = (Key*)AllocMemory(memoryResource, leafStart * sizeof(Key), 64);
+			if(!indexKeys)
+				throw BadAllocException("Failed to allocate Eytzinger index keys!");
+
+			indexCount = count;
+			indexLeafStart = leafStart;
+
+			// Start from the leftmost node, which holds the lowest key
+			size_t node = leafStart >> 1;
+
+			// Fill the nodes in order, walking the implicit tree from every node to its in-order successor
+			const uint8_t* key = (const uint8_t*)keys;
+			for(size_t i = 0; i != leafStart - 1; ++i) {
+				new(indexKeys + node) Key(*(const Key*)key);
+
+				// Move on to the next key, padding the tree with the highest key
+				if(i + 1 < count)
+					key += stride;
+
+				if((node << 1) < leafStart) {
+					// Go to the leftmost node of the right subtree
+					node = node << 1 | 1;
+					while((node << 1) < leafStart)
+						node <<= 1;
+				} else {
+					// Go up until the current node is a left child, and then to its parent
+					node >>= EytzingerTrailingOnes(node) + 1;
+				}
+			}
+		}
+		/// @brief Frees the index's contents.
+		void Clear() {
+			// Exit the function if there is no index to free
+			if(!indexKeys)
+				return;
+
+			// Destruct every key in the index
+			for(size_t i = 1; i != indexLeafStart; ++i)
+				indexKeys[i].~Key();
+
+			// Free the index's memory
+			FreeMemory(memoryResource, indexKeys);
+
+			indexKeys = nullptr;
+			indexCount = 0;
+			indexLeafStart = 0;
+		}
+		/// @brief Swaps the two indices' contents.
+		/// @param other The index to swap with.
+		void Swap(EytzingerIndex& other) {
+			MemoryResource* auxMemoryResource = memoryResource;
+			Key* auxKeys = indexKeys;
+			size_t auxCount = indexCount;
+			size_t auxLeafStart = indexLeafStart;
+
+			memoryResource = other.memoryResource;
+			indexKeys = other.indexKeys;
+			indexCount = other.indexCount;
+			indexLeafStart = other.indexLeafStart;
+
+			other.memoryResource = auxMemoryResource;
+			other.indexKeys = auxKeys;
+			other.indexCount = auxCount;
+			other.indexLeafStart = auxLeafStart;
+		}
+
+		/// @brief Tests if the index was built from at least one key.
+		/// @return True if the index can be searched, otherwise false.
+		bool8_t IsBuilt() const {
+			return indexKeys;
+		}
+		/// @brief Finds the position of the first key that isn't lower than the given key.
+		/// @param key The key to compare with.
+		/// @return The wanted key's position in the sorted keys the index was built from, or the number of keys if it doesn't exist.
+		size_t LowerBound(const Key& key) const {
+			// Walk down the tree, going right past every lower key
+			size_t node = 1;
+			while(node < indexLeafStart) {
+				// Prefetch the node's descendants a few levels below
+				uintptr_t descendants = (uintptr_t)indexKeys + node * PREFETCH_NODE_COUNT * sizeof(Key);
+				EytzingerPrefetch((const void*)descendants);
+				EytzingerPrefetch((const void*)(descendants + 64));
+
+				node = (node << 1) + Lower()(indexKeys[node], key);
+			}
+
+			// The leaf's bits are the turns taken, which add up to the number of lower keys
+			size_t pos = node - indexLeafStart;
+			return pos < indexCount ? pos : indexCount;
+		}
+		/// @brief Finds the position of the first key that is higher than the given key.
+		/// @param key The key to compare with.
+		/// @return The wanted key's position in the sorted keys the index was built from, or the number of keys if it doesn't exist.
+		size_t UpperBound(const Key& key) const {
+			// Walk down the tree, going right past every key that isn't higher
+			size_t node = 1;
+			while(node < indexLeafStart) {
+				// Prefetch the node's descendants a few levels below
+				uintptr_t descendants = (uintptr_t)indexKeys + node * PREFETCH_NODE_COUNT * sizeof(Key);
+				EytzingerPrefetch((const void*)descendants);
+				EytzingerPrefetch((const void*)(descendants + 64));
+
+				node = (node << 1) + !Lower()(key, indexKeys[node]);
+			}
+
+			// The leaf's bits are the turns taken, which add up to the number of keys that aren't higher
+			size_t pos = node - indexLeafStart;
+			return pos < indexCount ? pos : indexCount;
+		}
+
+		/// @brief Destroys the index.
+		~EytzingerIndex() {
+			Clear();
+		}
+	private:
+		MemoryResource* memoryResource = nullptr;
+		Key* indexKeys = nullptr;
+		size_t indexCount = 0;
+		size_t indexLeafStart = 0;
+	};
+}
\ No newline at end of file
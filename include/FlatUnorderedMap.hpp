@@ -0,0 +1,1097 @@
+#pragma once
+
+#include "Allocator.hpp"
+#include "Compare.hpp"
+#include "Defines.hpp"
+#include "Exception.hpp"
+#include "HashGroup.hpp"
+#include "Math.hpp"
+#include "Memory.hpp"
+#include "Pair.hpp"
+#include <initializer_list>
+#include <unordered_map>
+
+namespace wfe {
+	/// @brief Holds values with unique keys in a single open addressing table. Every slot has a control byte holding 7 bits of its key's hash, which lookups compare a whole group at a time before touching the slots themselves. Unlike unordered_map, no value is ever moved by erasing other values, though inserting may move every value.
+	/// @tparam Key The type for the value's keys.
+	/// @tparam T The type of the flat unordered map's values.
+	/// @tparam KeyHash The function struct used for hashing keys.
+	/// @tparam Equal The function struct used for comparing keys.
+	template<class Key, class T, class KeyHash = Hash<Key>, class Equal = EqualComp<Key>>
+	class flat_unordered_map {
+	public:
+		/// @brief The flat unordered map's key.
+		typedef Key key_type;
+		/// @brief The flat unordered map's values.
+		typedef T mapped_type;
+		/// @brief A pair that holds the key and its corresponding value.
+		typedef pair<const key_type, mapped_type> value_type;
+		/// @brief A reference to the flat unordered map's value.
+		typedef value_type& reference;
+		/// @brief A const reference to the flat unordered map's value.
+		typedef const value_type& const_reference;
+		/// @brief A pointer to the flat unordered map's value.
+		typedef value_type* pointer;
+		/// @brief A const pointer to the flat unordered map's value.
+		typedef const value_type* const_pointer;
+		/// @brief Used for holding differences.
+		typedef ptrdiff_t difference_type;
+		/// @brief Used for holding sizes.
+		typedef size_t size_type;
+
+		struct const_iterator;
+
+		/// @brief An iterator to the flat unordered map's values.
+		struct iterator {
+			/// @brief Copies the given iterator.
+			/// @param other The iterator to copy.
+			iterator(const iterator& other) = default;
+			/// @brief Moves the given iterator's contents.
+			/// @param other The iterator to move from.
+			iterator(iterator&& other) noexcept = default;
+
+			/// @brief Copies the given iterator's contents into this iterator.
+			/// @param other The iterator to copy from.
+			/// @return A reference to this iterator.
+			iterator& operator=(const iterator& other) = default;
+			/// @brief Moves the given iterator's contents into this iterator.
+			/// @param other The iterator to move from.
+			/// @return A reference to this iterator.
+			iterator& operator=(iterator&& other) noexcept = default;
+
+			/// @brief Compares the two iterators.
+			/// @param other The iterator to compare with.
+			/// @return True if the iterators are equal, otherwise false.
+			bool8_t operator==(const iterator& other) const {
+				return slot == other.slot;
+			}
+			/// @brief Compares the two iterators.
+			/// @param other The iterator to compare with.
+			/// @return True if the iterators are different, otherwise false.
+			bool8_t operator!=(const iterator& other) const {
+				return slot != other.slot;
+			}
+
+			/// @brief Increments this iterator.
+			/// @return A reference to this iterator.
+			iterator& operator++() {
+				// Move onto the next full slot
+				++ctrl;
+				++slot;
+				SkipEmptySlots();
+
+				return *this;
+			}
+			/// @brief Increments this iterator.
+			/// @return This iterator's previous state.
+			iterator operator++(int) {
+				// Save the current state of the iterator
+				iterator currentIter = *this;
+
+				// Move onto the next full slot
+				++ctrl;
+				++slot;
+				SkipEmptySlots();
+
+				return currentIter;
+			}
+
+			/// @brief Accesses the iterator value's members.
+			/// @return The iterator's pointer.
+			pointer operator->() const {
+				return slot;
+			}
+			/// @brief Accesses the iterator's value.
+			/// @return A reference to the iterator's value.
+			reference operator*() const {
+				return *slot;
+			}
+
+			/// @brief Destruct this iterator.
+			~iterator() = default;
+		private:
+			iterator(const int8_t* ctrl, pointer slot) : ctrl(ctrl), slot(slot) { }
+
+			void SkipEmptySlots() {
+				// Skip whole runs of empty and deleted slots at once, stopping at a full slot or the sentinel
+				while(*ctrl < HASH_CONTROL_SENTINEL) {
+					size_type skipCount = HashGroup(ctrl).CountLeadingEmptyOrDeleted();
+					ctrl += skipCount;
+					slot += skipCount;
+				}
+			}
+
+			const int8_t* ctrl;
+			pointer slot;
+
+			friend flat_unordered_map;
+			friend const_iterator;
+		};
+		/// @brief A const iterator to the flat unordered map's values.
+		struct const_iterator {
+			/// @brief Copies the given iterator.
+			/// @param other The iterator to copy.
+			const_iterator(const const_iterator& other) = default;
+			/// @brief Moves the given iterator's contents.
+			/// @param other The iterator to move from.
+			const_iterator(const_iterator&& other) noexcept = default;
+			/// @brief Copies the given iterator.
+			/// @param other The iterator to copy.
+			const_iterator(const iterator& other) : ctrl(other.ctrl), slot(other.slot) { }
+
+			/// @brief Copies the given iterator's contents into this iterator.
+			/// @param other The iterator to copy from.
+			/// @return A reference to this iterator.
+			const_iterator& operator=(const const_iterator& other) = default;
+			/// @brief Moves the given iterator's contents into this iterator.
+			/// @param other The iterator to move from.
+			/// @return A reference to this iterator.
+			const_iterator& operator=(const_iterator&& other) noexcept = default;
+
+			/// @brief Compares the two iterators.
+			/// @param other The iterator to compare with.
+			/// @return True if the iterators are equal, otherwise false.
+			bool8_t operator==(const const_iterator& other) const {
+				return slot == other.slot;
+			}
+			/// @brief Compares the two iterators.
+			/// @param other The iterator to compare with.
+			/// @return True if the iterators are different, otherwise false.
+			bool8_t operator!=(const const_iterator& other) const {
+				return slot != other.slot;
+			}
+
+			/// @brief Increments this iterator.
+			/// @return A reference to this iterator.
+			const_iterator& operator++() {
+				// Move onto the next full slot
+				++ctrl;
+				++slot;
+				SkipEmptySlots();
+
+				return *this;
+			}
+			/// @brief Increments this iterator.
+			/// @return This iterator's previous state.
+			const_iterator operator++(int) {
+				// Save the current state of the iterator
+				const_iterator currentIter = *this;
+
+				// Move onto the next full slot
+				++ctrl;
+				++slot;
+				SkipEmptySlots();
+
+				return currentIter;
+			}
+
+			/// @brief Accesses the iterator value's members.
+			/// @return The iterator's pointer.
+			const_pointer operator->() const {
+				return slot;
+			}
+			/// @brief Accesses the iterator's value.
+			/// @return A reference to the iterator's value.
+			const_reference operator*() const {
+				return *slot;
+			}
+
+			/// @brief Destruct this iterator.
+			~const_iterator() = default;
+		private:
+			const_iterator(const int8_t* ctrl, const_pointer slot) : ctrl(ctrl), slot(slot) { }
+
+			void SkipEmptySlots() {
+				// Skip whole runs of empty and deleted slots at once, stopping at a full slot or the sentinel
+				while(*ctrl < HASH_CONTROL_SENTINEL) {
+					size_type skipCount = HashGroup(ctrl).CountLeadingEmptyOrDeleted();
+					ctrl += skipCount;
+					slot += skipCount;
+				}
+			}
+
+			const int8_t* ctrl;
+			const_pointer slot;
+
+			friend flat_unordered_map;
+		};
+
+		/// @brief The max load factor of every flat unordered map, which can only be lowered.
+		static constexpr float32_t MAX_LOAD_FACTOR = 0.875f;
+		/// @brief The lowest max load factor of every flat unordered map, which lower max load factors are raised to.
+		static constexpr float32_t MIN_LOAD_FACTOR = 0.125f;
+
+		/// @brief Creates an empty flat unordered map. No memory is allocated until the first value is inserted, unless a slot count is given.
+		/// @param n The minimum number of slots.
+		flat_unordered_map(size_type n = 0) {
+			// Allocate the wanted slots
+			if(n)
+				rehash(n);
+		}
+		/// @brief Creates an empty flat unordered map that allocates its memory from the given resource.
+		/// @param resource The memory resource to allocate from. It must outlive the flat unordered map.
+		/// @param n The minimum number of slots.
+		explicit flat_unordered_map(MemoryResource& resource, size_type n = 0) : memoryResource(&resource) {
+			// Allocate the wanted slots
+			if(n)
+				rehash(n);
+		}
+		/// @brief Copies the given flat unordered map.
+		/// @param other The flat unordered map to copy.
+		flat_unordered_map(const flat_unordered_map& other) : umapMaxLoadFactor(other.umapMaxLoadFactor) {
+			// Copy the other flat unordered map's slots
+			CopySlots(other);
+		}
+		/// @brief Moves the given flat unordered map's contents.
+		/// @param other The flat unordered map whose contents to move.
+		flat_unordered_map(flat_unordered_map&& other) noexcept : memoryResource(other.memoryResource), umapControls(other.umapControls), umapSlots(other.umapSlots), umapCapacity(other.umapCapacity), umapSize(other.umapSize), umapGrowthLeft(other.umapGrowthLeft), umapMaxLoadFactor(other.umapMaxLoadFactor) {
+			// Unlink all data from the other flat unordered map
+			other.ResetEmpty();
+		}
+		/// @brief Constructs a flat unordered map with all the values in the list.
+		/// @param list The list to copy from.
+		/// @param n The minimum number of slots.
+		flat_unordered_map(std::initializer_list<value_type> list, size_type n = 0) {
+			// Allocate enough slots for the whole list, then insert every value
+			reserve(list.size());
+			if(n > umapCapacity)
+				rehash(n);
+
+			insert(list);
+		}
+		/// @brief Copies the given std library unordered map.
+		/// @param other The std library unordered map to copy from.
+		flat_unordered_map(const std::unordered_map<key_type, mapped_type>& other) {
+			// Allocate enough slots for the whole map, then insert every value
+			reserve(other.size());
+
+			for(const auto& val : other)
+				insert({ val.first, val.second });
+		}
+
+		/// @brief Copies the given flat unordered map's contents into this map.
+		/// @param other The flat unordered map to copy from.
+		/// @return A reference to this flat unordered map.
+		flat_unordered_map& operator=(const flat_unordered_map& other) {
+			// Check if the two maps are the same
+			if(&other == this)
+				return *this;
+
+			// Free the flat unordered map's previous data
+			DestroySlots();
+			FreeSlots();
+
+			// Copy the other flat unordered map's slots
+			umapMaxLoadFactor = other.umapMaxLoadFactor;
+			CopySlots(other);
+
+			return *this;
+		}
+		/// @brief Moves the given flat unordered map's contents into this map.
+		/// @param other The flat unordered map to move from.
+		/// @return A reference to this flat unordered map.
+		flat_unordered_map& operator=(flat_unordered_map&& other) {
+			// Check if the two maps are the same
+			if(&other == this)
+				return *this;
+
+			// Free the flat unordered map's previous data
+			DestroySlots();
+			FreeSlots();
+
+			// Set the flat unordered map's new values
+			memoryResource = other.memoryResource;
+			umapControls = other.umapControls;
+			umapSlots = other.umapSlots;
+			umapCapacity = other.umapCapacity;
+			umapSize = other.umapSize;
+			umapGrowthLeft = other.umapGrowthLeft;
+			umapMaxLoadFactor = other.umapMaxLoadFactor;
+
+			// Unlink all data from the other flat unordered map
+			other.ResetEmpty();
+
+			return *this;
+		}
+		/// @brief Copies the given list's values into this flat unordered map.
+		/// @param list The list to copy from.
+		/// @return A reference to this flat unordered map.
+		flat_unordered_map& operator=(std::initializer_list<value_type> list) {
+			// Remove the previous values, then insert every value from the list
+			clear();
+			reserve(list.size());
+			insert(list);
+
+			return *this;
+		}
+
+		/// @brief Accesses or inserts a value with the given key.
+		/// @param key The key to look for.
+		/// @return A reference to the value with the given key.
+		mapped_type& operator[](const key_type& key) {
+			// Look for the key, preparing a slot for it if it doesn't exist
+			uint64_t hash = KeyHash()(key);
+			size_type ind = FindIndex(key, hash);
+			if(ind != SIZE_T_MAX)
+				return umapSlots[ind].second;
+
+			ind = PrepareInsert(hash);
+
+			// Initialize the value
+			new((void*)&(umapSlots[ind].first)) key_type(key);
+			new(&(umapSlots[ind].second)) mapped_type();
+
+			return umapSlots[ind].second;
+		}
+		/// @brief Accesses or inserts a value with the given key.
+		/// @param key The key to look for.
+		/// @return A reference to the value with the given key.
+		mapped_type& operator[](key_type&& key) {
+			// Look for the key, preparing a slot for it if it doesn't exist
+			uint64_t hash = KeyHash()(key);
+			size_type ind = FindIndex(key, hash);
+			if(ind != SIZE_T_MAX)
+				return umapSlots[ind].second;
+
+			ind = PrepareInsert(hash);
+
+			// Initialize the value
+			new((void*)&(umapSlots[ind].first)) key_type(std::move(key));
+			new(&(umapSlots[ind].second)) mapped_type();
+
+			return umapSlots[ind].second;
+		}
+		/// @brief Accesses the value with the given key.
+		/// @param key The key to look for.
+		/// @return A reference to the value with the given key.
+		mapped_type& at(const key_type& key) {
+			// Look for the key
+			size_type ind = FindIndex(key, KeyHash()(key));
+
+			// The value wasn't found; throw an error
+			if(ind == SIZE_T_MAX)
+				throw OutOfRangeException("Failed to find the wanted key in a flat unordered map!");
+
+			return umapSlots[ind].second;
+		}
+		/// @brief Accesses the value with the given key.
+		/// @param key The key to look for.
+		/// @return A const reference to the value with the given key.
+		const mapped_type& at(const key_type& key) const {
+			// Look for the key
+			size_type ind = FindIndex(key, KeyHash()(key));
+
+			// The value wasn't found; throw an error
+			if(ind == SIZE_T_MAX)
+				throw OutOfRangeException("Failed to find the wanted key in a flat unordered map!");
+
+			return umapSlots[ind].second;
+		}
+
+		/// @brief Accesses the value with the given key, without converting the key to the key type.
+		/// @tparam K The type of the key, which must be supported by both the hash and the comparison function structs.
+		/// @param key The key to look for.
+		/// @return A reference to the value with the given key.
+		template<class K> requires TransparentHash<KeyHash, Equal>
+		mapped_type& at(const K& key) {
+			// Look for the key
+			size_type ind = FindIndex(key, KeyHash()(key));
+
+			// The value wasn't found; throw an error
+			if(ind == SIZE_T_MAX)
+				throw OutOfRangeException("Failed to find the wanted key in a flat unordered map!");
+
+			return umapSlots[ind].second;
+		}
+		/// @brief Accesses the value with the given key, without converting the key to the key type.
+		/// @tparam K The type of the key, which must be supported by both the hash and the comparison function structs.
+		/// @param key The key to look for.
+		/// @return A const reference to the value with the given key.
+		template<class K> requires TransparentHash<KeyHash, Equal>
+		const mapped_type& at(const K& key) const {
+			// Look for the key
+			size_type ind = FindIndex(key, KeyHash()(key));
+
+			// The value wasn't found; throw an error
+			if(ind == SIZE_T_MAX)
+				throw OutOfRangeException("Failed to find the wanted key in a flat unordered map!");
+
+			return umapSlots[ind].second;
+		}
+
+		/// @brief Finds the value with the given key.
+		/// @param key The key to look for.
+		/// @return An iterator to the wanted value if it exists, otherwise flat_unordered_map::end().
+		iterator find(const key_type& key) {
+			return find_with_hash(key, KeyHash()(key));
+		}
+		/// @brief Finds the value with the given key.
+		/// @param key The key to look for.
+		/// @return A const iterator to the wanted value if it exists, otherwise flat_unordered_map::end().
+		const_iterator find(const key_type& key) const {
+			return find_with_hash(key, KeyHash()(key));
+		}
+		/// @brief Gets the number of values with the given key.
+		/// @param key The key to look for.
+		/// @return The number of values with the given key.
+		size_type count(const key_type& key) const {
+			return FindIndex(key, KeyHash()(key)) != SIZE_T_MAX;
+		}
+		/// @brief Finds the range of values with the given key.
+		/// @param key The key to look for.
+		/// @return The bounds of the wanted range.
+		pair<iterator, iterator> equal_range(const key_type& key) {
+			// Look for the key, returning a pair of end iterators if it wasn't found
+			iterator first = find(key);
+			if(first == end())
+				return { first, first };
+
+			iterator last = first;
+			++last;
+
+			return { first, last };
+		}
+		/// @brief Finds the range of values with the given key.
+		/// @param key The key to look for.
+		/// @return The bounds of the wanted range.
+		pair<const_iterator, const_iterator> equal_range(const key_type& key) const {
+			// Look for the key, returning a pair of end iterators if it wasn't found
+			const_iterator first = find(key);
+			if(first == end())
+				return { first, first };
+
+			const_iterator last = first;
+			++last;
+
+			return { first, last };
+		}
+
+		/// @brief Finds the value with the given key, without converting the key to the key type.
+		/// @tparam K The type of the key, which must be supported by both the hash and the comparison function structs.
+		/// @param key The key to look for.
+		/// @return An iterator to the wanted value if it exists, otherwise flat_unordered_map::end().
+		template<class K> requires TransparentHash<KeyHash, Equal>
+		iterator find(const K& key) {
+			return find_with_hash(key, KeyHash()(key));
+		}
+		/// @brief Finds the value with the given key, without converting the key to the key type.
+		/// @tparam K The type of the key, which must be supported by both the hash and the comparison function structs.
+		/// @param key The key to look for.
+		/// @return A const iterator to the wanted value if it exists, otherwise flat_unordered_map::end().
+		template<class K> requires TransparentHash<KeyHash, Equal>
+		const_iterator find(const K& key) const {
+			return find_with_hash(key, KeyHash()(key));
+		}
+		/// @brief Gets the number of values with the given key, without converting the key to the key type.
+		/// @tparam K The type of the key, which must be supported by both the hash and the comparison function structs.
+		/// @param key The key to look for.
+		/// @return The number of values with the given key.
+		template<class K> requires TransparentHash<KeyHash, Equal>
+		size_type count(const K& key) const {
+			return FindIndex(key, KeyHash()(key)) != SIZE_T_MAX;
+		}
+		/// @brief Finds the range of values with the given key, without converting the key to the key type.
+		/// @tparam K The type of the key, which must be supported by both the hash and the comparison function structs.
+		/// @param key The key to look for.
+		/// @return The bounds of the wanted range.
+		template<class K> requires TransparentHash<KeyHash, Equal>
+		pair<iterator, iterator> equal_range(const K& key) {
+			// Look for the key, returning a pair of end iterators if it wasn't found
+			iterator first = find(key);
+			if(first == end())
+				return { first, first };
+
+			iterator last = first;
+			++last;
+
+			return { first, last };
+		}
+		/// @brief Finds the range of values with the given key, without converting the key to the key type.
+		/// @tparam K The type of the key, which must be supported by both the hash and the comparison function structs.
+		/// @param key The key to look for.
+		/// @return The bounds of the wanted range.
+		template<class K> requires TransparentHash<KeyHash, Equal>
+		pair<const_iterator, const_iterator> equal_range(const K& key) const {
+			// Look for the key, returning a pair of end iterators if it wasn't found
+			const_iterator first = find(key);
+			if(first == end())
+				return { first, first };
+
+			const_iterator last = first;
+			++last;
+
+			return { first, last };
+		}
+		/// @brief Finds the value with the given key using a hash computed by the caller, which lets the same hash be used for lookups in several maps.
+		/// @param key The key to look for.
+		/// @param hash The key's hash, which must be equal to the hash given by the map's hash function struct.
+		/// @return An iterator to the wanted value if it exists, otherwise flat_unordered_map::end().
+		iterator find_with_hash(const key_type& key, uint64_t hash) {
+			size_type ind = FindIndex(key, hash);
+			return ind != SIZE_T_MAX ? iterator(umapControls + ind, umapSlots + ind) : end();
+		}
+		/// @brief Finds the value with the given key using a hash computed by the caller, which lets the same hash be used for lookups in several maps.
+		/// @param key The key to look for.
+		/// @param hash The key's hash, which must be equal to the hash given by the map's hash function struct.
+		/// @return A const iterator to the wanted value if it exists, otherwise flat_unordered_map::end().
+		const_iterator find_with_hash(const key_type& key, uint64_t hash) const {
+			size_type ind = FindIndex(key, hash);
+			return ind != SIZE_T_MAX ? const_iterator(umapControls + ind, umapSlots + ind) : end();
+		}
+		/// @brief Finds the value with the given key using a hash computed by the caller, without converting the key to the key type.
+		/// @tparam K The type of the key, which must be supported by both the hash and the comparison function structs.
+		/// @param key The key to look for.
+		/// @param hash The key's hash, which must be equal to the hash given by the map's hash function struct.
+		/// @return An iterator to the wanted value if it exists, otherwise flat_unordered_map::end().
+		template<class K> requires TransparentHash<KeyHash, Equal>
+		iterator find_with_hash(const K& key, uint64_t hash) {
+			size_type ind = FindIndex(key, hash);
+			return ind != SIZE_T_MAX ? iterator(umapControls + ind, umapSlots + ind) : end();
+		}
+		/// @brief Finds the value with the given key using a hash computed by the caller, without converting the key to the key type.
+		/// @tparam K The type of the key, which must be supported by both the hash and the comparison function structs.
+		/// @param key The key to look for.
+		/// @param hash The key's hash, which must be equal to the hash given by the map's hash function struct.
+		/// @return A const iterator to the wanted value if it exists, otherwise flat_unordered_map::end().
+		template<class K> requires TransparentHash<KeyHash, Equal>
+		const_iterator find_with_hash(const K& key, uint64_t hash) const {
+			size_type ind = FindIndex(key, hash);
+			return ind != SIZE_T_MAX ? const_iterator(umapControls + ind, umapSlots + ind) : end();
+		}
+
+		/// @brief Emplaces the constructed value into the flat unordered map.
+		/// @tparam ...Args The arg types to construct the value with.
+		/// @param ...args The args to construct the value with.
+		/// @return A pair containing an iterator to the emplaced value or a value with the same key and a bool that is true if a new value was inserted, otherwise false.
+		template<class... Args>
+		pair<iterator, bool8_t> emplace(Args&&... args) {
+			// Construct the value
+			value_type val(args...);
+
+			// Insert the value into the flat unordered map
+			return insert(val);
+		}
+		/// @brief Emplaces the constructed value into the flat unordered map using the given hint.
+		/// @tparam ...Args The arg types to construct the value with.
+		/// @param pos A hint for the position of the emplaced value.
+		/// @param ...args The args to construct the value with.
+		/// @return An iterator to the emplaced value or a value with the same key.
+		template<class... Args>
+		iterator emplace_hint(const_iterator pos, Args&&... args) {
+			// Construct the value
+			value_type val(args...);
+
+			// Insert the value into the flat unordered map using the given hint
+			return insert(pos, val);
+		}
+		/// @brief Inserts the given value into the flat unordered map.
+		/// @param val The value to insert.
+		/// @return A pair containing an iterator to the inserted value or a value with the same key and a bool that is true if a new value was inserted, otherwise false.
+		pair<iterator, bool8_t> insert(const_reference val) {
+			return insert_with_hash(val, KeyHash()(val.first));
+		}
+		/// @brief Inserts the given value into the flat unordered map using a hash computed by the caller.
+		/// @param val The value to insert.
+		/// @param hash The hash of the value's key, which must be equal to the hash given by the map's hash function struct.
+		/// @return A pair containing an iterator to the inserted value or a value with the same key and a bool that is true if a new value was inserted, otherwise false.
+		pair<iterator, bool8_t> insert_with_hash(const_reference val, uint64_t hash) {
+			// Look for the value's key
+			size_type ind = FindIndex(val.first, hash);
+			if(ind != SIZE_T_MAX)
+				return { iterator(umapControls + ind, umapSlots + ind), false };
+
+			// Prepare a slot for the value and copy the value into it
+			ind = PrepareInsert(hash);
+			new(umapSlots + ind) value_type(val);
+
+			return { iterator(umapControls + ind, umapSlots + ind), true };
+		}
+		/// @brief Inserts the given value into the flat unordered map using the given hint.
+		/// @param pos A hint for the position of the inserted value.
+		/// @param val The value to insert.
+		/// @return An iterator the the inserted value or a value with the same key.
+		iterator insert(const_iterator pos, const_reference val) {
+			// Simply insert the value without using the given hint
+			(void)pos;
+			return insert(val).first;
+		}
+		/// @brief Inserts all values from the given list into the flat unordered map.
+		/// @param list The list to insert from.
+		void insert(std::initializer_list<value_type> list) {
+			// Insert every value from the given list
+			const_pointer end = list.end();
+			for(const_pointer ptr = list.begin(); ptr != end; ++ptr)
+				insert(*ptr);
+		}
+		/// @brief Erases the value at the given position from the flat unordered map. Iterators to other values stay valid.
+		/// @param pos The position to erase from.
+		/// @return An iterator to the value after the erased value.
+		iterator erase(const_iterator pos) {
+			// Erase the value from its slot
+			size_type ind = pos.slot - umapSlots;
+			EraseIndex(ind);
+
+			// Move onto the next full slot
+			iterator next(umapControls + ind + 1, umapSlots + ind + 1);
+			next.SkipEmptySlots();
+
+			return next;
+		}
+		/// @brief Erases the value at the given position from the flat unordered map. Iterators to other values stay valid.
+		/// @param pos The position to erase from.
+		/// @return An iterator to the value after the erased value.
+		iterator erase(iterator pos) {
+			return erase(const_iterator(pos));
+		}
+		/// @brief Erases the value with the given key from the flat unordered map.
+		/// @param key The key to look for.
+		/// @return The number of erased values.
+		size_type erase(const key_type& key) {
+			// Look for the key, exiting the function if it wasn't found
+			size_type ind = FindIndex(key, KeyHash()(key));
+			if(ind == SIZE_T_MAX)
+				return 0;
+
+			// Erase the value from its slot
+			EraseIndex(ind);
+
+			return 1;
+		}
+		/// @brief Erases the value with the given key from the flat unordered map, without converting the key to the key type.
+		/// @tparam K The type of the key, which must be supported by both the hash and the comparison function structs.
+		/// @param key The key to look for.
+		/// @return The number of erased values.
+		template<class K> requires TransparentHash<KeyHash, Equal>
+		size_type erase(const K& key) {
+			// Look for the key, exiting the function if it wasn't found
+			size_type ind = FindIndex(key, KeyHash()(key));
+			if(ind == SIZE_T_MAX)
+				return 0;
+
+			// Erase the value from its slot
+			EraseIndex(ind);
+
+			return 1;
+		}
+		/// @brief Erases all values from the given range.
+		/// @param first An iterator to the first erased element.
+		/// @param last An iterator to right after the last erased element.
+		/// @return An iterator to the value after the last erased value.
+		iterator erase(const_iterator first, const_iterator last) {
+			// Erase every value in the range; erasing never moves the remaining values
+			while(first != last)
+				first = erase(first);
+
+			return iterator(last.ctrl, (pointer)last.slot);
+		}
+		/// @brief Clears the contents of the flat unordered map, keeping its slots.
+		void clear() {
+			// Destruct every value in the flat unordered map
+			DestroySlots();
+
+			// Mark every slot as empty
+			if(umapCapacity)
+				ResetControls();
+
+			umapSize = 0;
+			umapGrowthLeft = GetMaxGrowth(umapCapacity);
+		}
+		/// @brief Swaps the contents of the two flat unordered maps.
+		/// @param other The flat unordered map to swap with.
+		void swap(flat_unordered_map& other) {
+			// Exit the function if the two flat unordered maps are the same
+			if(&other == this)
+				return;
+
+			// Save this flat unordered map's values
+			MemoryResource* auxMemoryResource = memoryResource;
+			int8_t* auxControls = umapControls;
+			pointer auxSlots = umapSlots;
+			size_type auxCapacity = umapCapacity;
+			size_type auxSize = umapSize;
+			size_type auxGrowthLeft = umapGrowthLeft;
+			float32_t auxMaxLoadFactor = umapMaxLoadFactor;
+
+			// Set this flat unordered map's values
+			memoryResource = other.memoryResource;
+			umapControls = other.umapControls;
+			umapSlots = other.umapSlots;
+			umapCapacity = other.umapCapacity;
+			umapSize = other.umapSize;
+			umapGrowthLeft = other.umapGrowthLeft;
+			umapMaxLoadFactor = other.umapMaxLoadFactor;
+
+			// Set the other flat unordered map's values
+			other.memoryResource = auxMemoryResource;
+			other.umapControls = auxControls;
+			other.umapSlots = auxSlots;
+			other.umapCapacity = auxCapacity;
+			other.umapSize = auxSize;
+			other.umapGrowthLeft = auxGrowthLeft;
+			other.umapMaxLoadFactor = auxMaxLoadFactor;
+		}
+
+		/// @brief Returns an iterator to the beginning of the flat unordered map.
+		/// @return An iterator to the beginning of the flat unordered map.
+		iterator begin() {
+			iterator iter(umapControls, umapSlots);
+			iter.SkipEmptySlots();
+			return iter;
+		}
+		/// @brief Returns a const iterator to the beginning of the flat unordered map.
+		/// @return A const iterator to the beginning of the flat unordered map.
+		const_iterator begin() const {
+			const_iterator iter(umapControls, umapSlots);
+			iter.SkipEmptySlots();
+			return iter;
+		}
+		/// @brief Returns an iterator to the end of the flat unordered map.
+		/// @return An iterator to the end of the flat unordered map.
+		iterator end() {
+			return iterator(umapControls + umapCapacity, umapSlots + umapCapacity);
+		}
+		/// @brief Returns a const iterator to the end of the flat unordered map.
+		/// @return A const iterator to the end of the flat unordered map.
+		const_iterator end() const {
+			return const_iterator(umapControls + umapCapacity, umapSlots + umapCapacity);
+		}
+		/// @brief Returns a const iterator to the beginning of the flat unordered map.
+		/// @return A const iterator to the beginning of the flat unordered map.
+		const_iterator cbegin() const {
+			return begin();
+		}
+		/// @brief Returns a const iterator to the end of the flat unordered map.
+		/// @return A const iterator to the end of the flat unordered map.
+		const_iterator cend() const {
+			return end();
+		}
+
+		/// @brief Tests if the flat unordered map is empty.
+		/// @return True if the flat unordered map is empty, otherwise false.
+		bool8_t empty() const {
+			return !umapSize;
+		}
+		/// @brief Gets the flat unordered map's size.
+		/// @return The flat unordered map's size.
+		size_type size() const {
+			return umapSize;
+		}
+		/// @brief Returns the flat unordered map's maximum possible size.
+		/// @return The flat unordered map's maximum possible size.
+		size_type max_size() const {
+			return SIZE_T_MAX / (sizeof(value_type) + 1);
+		}
+
+		/// @brief Gets the number of buckets in the flat unordered map, which is its number of slots.
+		/// @return The number of buckets in the flat unordered map.
+		size_type bucket_count() const {
+			return umapCapacity;
+		}
+		/// @brief Gets the maximum possible number of buckets in the flat unordered map.
+		/// @return The maximum possible number of buckets.
+		size_type max_bucket_count() const {
+			return SIZE_T_MAX / (sizeof(value_type) + 1);
+		}
+		/// @brief Gets the number of values in the given bucket. Every bucket is a single slot.
+		/// @param n The wanted bucket's index.
+		/// @return The number of values in the given bucket.
+		size_type bucket_size(size_type n) const {
+			return n < umapCapacity && umapControls[n] >= 0;
+		}
+		/// @brief Gets the given key's bucket index.
+		/// @param key The key whose bucket index to get.
+		/// @return The index of the slot holding the given key, or the first slot of the key's first probed group if the key isn't in the flat unordered map.
+		size_type bucket(const key_type& key) const {
+			// Return the key's slot if it exists
+			uint64_t hash = KeyHash()(key);
+			size_type ind = FindIndex(key, hash);
+			if(ind != SIZE_T_MAX)
+				return ind;
+			if(!umapCapacity)
+				return 0;
+
+			return ((size_type)hash & GetGroupMask()) * HashGroup::WIDTH;
+		}
+
+		/// @brief Gets the flat unordered map's load factor, which is equal to the ratio between the total number of values and the number of slots.
+		/// @return The flat unordered map's load factor.
+		float32_t load_factor() const {
+			return umapCapacity ? (float32_t)umapSize / (float32_t)umapCapacity : 0.f;
+		}
+		/// @brief Gets the flat unordered map's max load factor, which is equal to the ratio between the total number of values and the number of slots.
+		/// @return The flat unordered map's max load factor.
+		float32_t max_load_factor() const {
+			return umapMaxLoadFactor;
+		}
+		/// @brief Sets the flat unordered map's max load factor, which is equal to the ratio between the total number of values and the number of slots. It is capped at MAX_LOAD_FACTOR, since probes slow down sharply on fuller tables, and raised to MIN_LOAD_FACTOR, since the slot count grows without bound as the factor approaches 0.
+		/// @param z The flat unordered map's new max load factor.
+		void max_load_factor(float32_t z) {
+			// Clamp the max load factor, raising NaN to the min as well
+			if(!(z >= MIN_LOAD_FACTOR))
+				z = MIN_LOAD_FACTOR;
+			else if(z > MAX_LOAD_FACTOR)
+				z = MAX_LOAD_FACTOR;
+			umapMaxLoadFactor = z;
+
+			// Rebuild the table for the new load factor
+			if(umapCapacity)
+				rehash(umapCapacity);
+		}
+		/// @brief Sets the flat unordered map's slot count, rounded up to a power of two that can hold every value.
+		/// @param n The flat unordered map's minimum slot count.
+		void rehash(size_type n) {
+			// Get the lowest valid slot count that is at least n and holds every value
+			size_type newCapacity = GetCapacity(umapSize);
+			while(newCapacity < n)
+				newCapacity = newCapacity ? newCapacity << 1 : HashGroup::WIDTH;
+
+			// Rebuild the table, which also removes every deleted slot
+			Resize(newCapacity);
+		}
+		/// @brief Allocates enough slots to hold the given number of values without rehashing.
+		/// @param n The requested number of values.
+		void reserve(size_type n) {
+			// Grow the table if it can't hold the given number of values
+			if(n > umapSize + umapGrowthLeft)
+				Resize(GetCapacity(n));
+		}
+
+		/// @brief Gets the memory resource the flat unordered map allocates its memory from.
+		/// @return A pointer to the flat unordered map's memory resource, or a nullptr if it allocates from the heap.
+		MemoryResource* get_memory_resource() const {
+			return memoryResource;
+		}
+
+		/// @brief Destroys the flat unordered map.
+		~flat_unordered_map() {
+			// Destruct every value and free the flat unordered map's slots
+			DestroySlots();
+			FreeSlots();
+		}
+	private:
+		size_type GetMaxGrowth(size_type capacity) const {
+			// Always leave at least one empty slot, which every probe needs to stop
+			if(!capacity)
+				return 0;
+
+			size_type maxGrowth = (size_type)((float32_t)capacity * umapMaxLoadFactor);
+			return maxGrowth < capacity ? maxGrowth : capacity - 1;
+		}
+		size_type GetCapacity(size_type n) const {
+			// Get the lowest power of 2 slot count, of at least one group, whose max growth fits n values
+			if(!n)
+				return 0;
+
+			size_type capacity = HashGroup::WIDTH;
+			while(GetMaxGrowth(capacity) < n)
+				capacity <<= 1;
+
+			return capacity;
+		}
+		size_type GetGroupMask() const {
+			return (umapCapacity / HashGroup::WIDTH) - 1;
+		}
+		template<class K>
+		size_type FindIndex(const K& key, uint64_t hash) const {
+			// Exit the function if the flat unordered map has no slots
+			if(!umapCapacity)
+				return SIZE_T_MAX;
+
+			int8_t control = GetHashControl(hash);
+			size_type groupMask = GetGroupMask();
+			size_type group = (size_type)hash & groupMask;
+
+			// Probe the groups in triangular order, which visits every group once when the group count is a power of 2
+			for(size_type step = 1; ; ++step) {
+				size_type groupStart = group * HashGroup::WIDTH;
+				HashGroup groupControls(umapControls + groupStart);
+
+				// Compare the keys of every slot with a matching control byte
+				for(uint64_t mask = groupControls.Match(control); mask; mask &= mask - 1) {
+					size_type ind = groupStart + HashGroup::GetIndex(mask);
+					if(Equal()(umapSlots[ind].first, key))
+						return ind;
+				}
+
+				// Exit the loop if the group has an empty slot, since the key would've been inserted there
+				if(groupControls.MatchEmpty())
+					return SIZE_T_MAX;
+
+				group = (group + step) & groupMask;
+			}
+		}
+		size_type FindInsertIndex(uint64_t hash) const {
+			size_type groupMask = GetGroupMask();
+			size_type group = (size_type)hash & groupMask;
+
+			// Probe the groups in the same order as lookups, stopping at the first empty or deleted slot
+			for(size_type step = 1; ; ++step) {
+				size_type groupStart = group * HashGroup::WIDTH;
+				uint64_t mask = HashGroup(umapControls + groupStart).MatchEmptyOrDeleted();
+				if(mask)
+					return groupStart + HashGroup::GetIndex(mask);
+
+				group = (group + step) & groupMask;
+			}
+		}
+		size_type PrepareInsert(uint64_t hash) {
+			// Grow the table if every usable slot is taken; if at least half the growth was lost to deleted slots, rebuilding at the same size is enough
+			if(!umapGrowthLeft) {
+				size_type maxGrowth = GetMaxGrowth(umapCapacity);
+				Resize(umapSize < (maxGrowth >> 1) ? umapCapacity : (umapCapacity ? umapCapacity << 1 : HashGroup::WIDTH));
+			}
+
+			// Claim the slot, only using up growth if it was empty rather than deleted
+			size_type ind = FindInsertIndex(hash);
+			umapGrowthLeft -= umapControls[ind] == HASH_CONTROL_EMPTY;
+			umapControls[ind] = GetHashControl(hash);
+			++umapSize;
+
+			return ind;
+		}
+		void EraseIndex(size_type ind) {
+			// Destruct the value
+			umapSlots[ind].~value_type();
+			--umapSize;
+
+			// Mark the slot as empty if its group has another empty slot, since no probe could've passed over the group; otherwise, mark it as deleted so that probes keep going
+			size_type groupStart = ind & ~(HashGroup::WIDTH - 1);
+			if(HashGroup(umapControls + groupStart).MatchEmpty()) {
+				umapControls[ind] = HASH_CONTROL_EMPTY;
+				++umapGrowthLeft;
+			} else {
+				umapControls[ind] = HASH_CONTROL_DELETED;
+			}
+		}
+		void ResetControls() {
+			// Mark every slot as empty and place the sentinel after the last slot
+			wfe::memset(umapControls, (uint8_t)HASH_CONTROL_EMPTY, umapCapacity + HashGroup::WIDTH);
+			umapControls[umapCapacity] = HASH_CONTROL_SENTINEL;
+		}
+		void ResetEmpty() {
+			umapControls = (int8_t*)GetEmptyHashControls();
+			umapSlots = nullptr;
+			umapCapacity = 0;
+			umapSize = 0;
+			umapGrowthLeft = 0;
+		}
+		void AllocSlots(size_type capacity) {
+			// Allocate the control bytes and the slots in a single block, with the slots right after the padded control bytes
+			size_type alignment = alignof(value_type) > HashGroup::WIDTH ? alignof(value_type) : HashGroup::WIDTH;
+			size_type controlSize = (capacity + HashGroup::WIDTH + alignof(value_type) - 1) & ~(alignof(value_type) - 1);
+			int8_t* data = (int8_t*)AllocMemory(memoryResource, controlSize + capacity * sizeof(value_type), alignment);
+			if(!data)
+				throw BadAllocException("Failed to allocate flat unordered map slots!");
+
+			umapControls = data;
+			umapSlots = (pointer)(data + controlSize);
+			umapCapacity = capacity;
+			umapGrowthLeft = GetMaxGrowth(capacity) - umapSize;
+
+			ResetControls();
+		}
+		void FreeSlots() {
+			// The control bytes start the slots' memory block
+			if(umapCapacity)
+				FreeMemory(memoryResource, umapControls);
+		}
+		void DestroySlots() {
+			// Destruct the value in every full slot
+			for(size_type i = 0; umapSize && i != umapCapacity; ++i)
+				if(umapControls[i] >= 0)
+					umapSlots[i].~value_type();
+		}
+		void CopySlots(const flat_unordered_map& other) {
+			// Set this flat unordered map to the empty state if the other map has no slots
+			ResetEmpty();
+			if(!other.umapCapacity)
+				return;
+
+			// Allocate as many slots as the other flat unordered map and copy its values into the same slots
+			AllocSlots(other.umapCapacity);
+			wfe::memcpy(umapControls, other.umapControls, umapCapacity + HashGroup::WIDTH);
+
+			for(size_type i = 0; i != umapCapacity; ++i)
+				if(umapControls[i] >= 0)
+					new(umapSlots + i) value_type(other.umapSlots[i]);
+
+			umapSize = other.umapSize;
+			umapGrowthLeft = other.umapGrowthLeft;
+		}
+		void Resize(size_type newCapacity) {
+			// Save the flat unordered map's old slots
+			int8_t* oldControls = umapControls;
+			pointer oldSlots = umapSlots;
+			size_type oldCapacity = umapCapacity;
+
+			// Allocate the new slots, or fall back to the shared empty controls if no slots are needed
+			if(newCapacity) {
+				AllocSlots(newCapacity);
+			} else {
+				ResetEmpty();
+			}
+
+			// Move every value into its slot in the new table; values are relocated bitwise, like the other containers do
+			for(size_type i = 0; i != oldCapacity; ++i) {
+				if(oldControls[i] < 0)
+					continue;
+
+				uint64_t hash = KeyHash()(oldSlots[i].first);
+				size_type ind = FindInsertIndex(hash);
+				umapControls[ind] = GetHashControl(hash);
+				wfe::memcpy(umapSlots + ind, oldSlots + i, sizeof(value_type));
+			}
+
+			// Free the old slots
+			if(oldCapacity)
+				FreeMemory(memoryResource, oldControls);
+		}
+
+		MemoryResource* memoryResource = nullptr;
+		int8_t* umapControls = (int8_t*)GetEmptyHashControls();
+		pointer umapSlots = nullptr;
+		size_type umapCapacity = 0;
+		size_type umapSize = 0;
+		size_type umapGrowthLeft = 0;
+		float32_t umapMaxLoadFactor = MAX_LOAD_FACTOR;
+	};
+
+	/// @brief Compares the given flat unordered maps.
+	/// @tparam Key The flat unordered map key's type.
+	/// @tparam T The flat unordered map value's type.
+	/// @param umap1 The first flat unordered map to compare.
+	/// @param umap2 The second flat unordered map to compare.
+	/// @return True if the two flat unordered maps are equal, otherwise false.
+	template<class Key, class T>
+	WFE_INLINE bool8_t operator==(const flat_unordered_map<Key, T>& umap1, const flat_unordered_map<Key, T>& umap2) {
+		// Exit the function if the two flat unordered maps have different sizes
+		if(umap1.size() != umap2.size())
+			return false;
+
+		// Search for every value from the first map in the second map
+		for(const auto& val : umap1) {
+			// Search for the value in the second flat unordered map
+			auto iter = umap2.find(val.first);
+
+			// Exit the function if the value wasn't found
+			if(iter == umap2.end())
+				return false;
+
+			// Exit the function if the values are different
+			if(iter->second != val.second)
+				return false;
+		}
+
+		return true;
+	}
+	/// @brief Compares the given flat unordered maps.
+	/// @tparam Key The flat unordered map key's type.
+	/// @tparam T The flat unordered map value's type.
+	/// @param umap1 The first flat unordered map to compare.
+	/// @param umap2 The second flat unordered map to compare.
+	/// @return True if the two flat unordered maps are different, otherwise false.
+	template<class Key, class T>
+	WFE_INLINE bool8_t operator!=(const flat_unordered_map<Key, T>& umap1, const flat_unordered_map<Key, T>& umap2) {
+		return !(umap1 == umap2);
+	}
+}
\ No newline at end of file
@@ -0,0 +1,1014 @@
+#pragma once
+
+#include "Allocator.hpp"
+#include "Compare.hpp"
+#include "Defines.hpp"
+#include "Exception.hpp"
+#include "HashGroup.hpp"
+#include "Math.hpp"
+#include "Memory.hpp"
+#include "Pair.hpp"
+#include <initializer_list>
+#include <unordered_set>
+
+namespace wfe {
+	/// @brief Holds unique values in a single open addressing table. Every slot has a control byte holding 7 bits of its value's hash, which lookups compare a whole group at a time before touching the slots themselves. Unlike unordered_set, no value is ever moved by erasing other values, though inserting may move every value.
+	/// @tparam T The type of the flat unordered set's values.
+	/// @tparam ValHash The function struct used for hashing values.
+	/// @tparam Equal The function struct used for comparing values.
+	template<class T, class ValHash = Hash<T>, class Equal = EqualComp<T>>
+	class flat_unordered_set {
+	public:
+		/// @brief The flat unordered set's key.
+		typedef T key_type;
+		/// @brief The flat unordered set's value.
+		typedef T value_type;
+		/// @brief A reference to the flat unordered set's value.
+		typedef T& reference;
+		/// @brief A const reference to the flat unordered set's value.
+		typedef const T& const_reference;
+		/// @brief A pointer to the flat unordered set's value.
+		typedef T* pointer;
+		/// @brief A const pointer to the flat unordered set's value.
+		typedef const T* const_pointer;
+		/// @brief Used for holding differences.
+		typedef ptrdiff_t difference_type;
+		/// @brief Used for holding sizes.
+		typedef size_t size_type;
+
+		struct const_iterator;
+
+		/// @brief An iterator to the flat unordered set's values.
+		struct iterator {
+			/// @brief Copies the given iterator.
+			/// @param other The iterator to copy.
+			iterator(const iterator& other) = default;
+			/// @brief Moves the given iterator's contents.
+			/// @param other The iterator to move from.
+			iterator(iterator&& other) noexcept = default;
+
+			/// @brief Copies the given iterator's contents into this iterator.
+			/// @param other The iterator to copy from.
+			/// @return A reference to this iterator.
+			iterator& operator=(const iterator& other) = default;
+			/// @brief Moves the given iterator's contents into this iterator.
+			/// @param other The iterator to move from.
+			/// @return A reference to this iterator.
+			iterator& operator=(iterator&& other) noexcept = default;
+
+			/// @brief Compares the two iterators.
+			/// @param other The iterator to compare with.
+			/// @return True if the iterators are equal, otherwise false.
+			bool8_t operator==(const iterator& other) const {
+				return slot == other.slot;
+			}
+			/// @brief Compares the two iterators.
+			/// @param other The iterator to compare with.
+			/// @return True if the iterators are different, otherwise false.
+			bool8_t operator!=(const iterator& other) const {
+				return slot != other.slot;
+			}
+
+			/// @brief Increments this iterator.
+			/// @return A reference to this iterator.
+			iterator& operator++() {
+				// Move onto the next full slot
+				++ctrl;
+				++slot;
+				SkipEmptySlots();
+
+				return *this;
+			}
+			/// @brief Increments this iterator.
+			/// @return This iterator's previous state.
+			iterator operator++(int) {
+				// Save the current state of the iterator
+				iterator currentIter = *this;
+
+				// Move onto the next full slot
+				++ctrl;
+				++slot;
+				SkipEmptySlots();
+
+				return currentIter;
+			}
+
+			/// @brief Accesses the iterator value's members.
+			/// @return The iterator's pointer.
+			pointer operator->() const {
+				return slot;
+			}
+			/// @brief Accesses the iterator's value.
+			/// @return A reference to the iterator's value.
+			reference operator*() const {
+				return *slot;
+			}
+
+			/// @brief Destruct this iterator.
+			~iterator() = default;
+		private:
+			iterator(const int8_t* ctrl, pointer slot) : ctrl(ctrl), slot(slot) { }
+
+			void SkipEmptySlots() {
+				// Skip whole runs of empty and deleted slots at once, stopping at a full slot or the sentinel
+				while(*ctrl < HASH_CONTROL_SENTINEL) {
+					size_type skipCount = HashGroup(ctrl).CountLeadingEmptyOrDeleted();
+					ctrl += skipCount;
+					slot += skipCount;
+				}
+			}
+
+			const int8_t* ctrl;
+			pointer slot;
+
+			friend flat_unordered_set;
+			friend const_iterator;
+		};
+		/// @brief A const iterator to the flat unordered set's values.
+		struct const_iterator {
+			/// @brief Copies the given iterator.
+			/// @param other The iterator to copy.
+			const_iterator(const const_iterator& other) = default;
+			/// @brief Moves the given iterator's contents.
+			/// @param other The iterator to move from.
+			const_iterator(const_iterator&& other) noexcept = default;
+			/// @brief Copies the given iterator.
+			/// @param other The iterator to copy.
+			const_iterator(const iterator& other) : ctrl(other.ctrl), slot(other.slot) { }
+
+			/// @brief Copies the given iterator's contents into this iterator.
+			/// @param other The iterator to copy from.
+			/// @return A reference to this iterator.
+			const_iterator& operator=(const const_iterator& other) = default;
+			/// @brief Moves the given iterator's contents into this iterator.
+			/// @param other The iterator to move from.
+			/// @return A reference to this iterator.
+			const_iterator& operator=(const_iterator&& other) noexcept = default;
+
+			/// @brief Compares the two iterators.
+			/// @param other The iterator to compare with.
+			/// @return True if the iterators are equal, otherwise false.
+			bool8_t operator==(const const_iterator& other) const {
+				return slot == other.slot;
+			}
+			/// @brief Compares the two iterators.
+			/// @param other The iterator to compare with.
+			/// @return True if the iterators are different, otherwise false.
+			bool8_t operator!=(const const_iterator& other) const {
+				return slot != other.slot;
+			}
+
+			/// @brief Increments this iterator.
+			/// @return A reference to this iterator.
+			const_iterator& operator++() {
+				// Move onto the next full slot
+				++ctrl;
+				++slot;
+				SkipEmptySlots();
+
+				return *this;
+			}
+			/// @brief Increments this iterator.
+			/// @return This iterator's previous state.
+			const_iterator operator++(int) {
+				// Save the current state of the iterator
+				const_iterator currentIter = *this;
+
+				// Move onto the next full slot
+				++ctrl;
+				++slot;
+				SkipEmptySlots();
+
+				return currentIter;
+			}
+
+			/// @brief Accesses the iterator value's members.
+			/// @return The iterator's pointer.
+			const_pointer operator->() const {
+				return slot;
+			}
+			/// @brief Accesses the iterator's value.
+			/// @return A reference to the iterator's value.
+			const_reference operator*() const {
+				return *slot;
+			}
+
+			/// @brief Destruct this iterator.
+			~const_iterator() = default;
+		private:
+			const_iterator(const int8_t* ctrl, const_pointer slot) : ctrl(ctrl), slot(slot) { }
+
+			void SkipEmptySlots() {
+				// Skip whole runs of empty and deleted slots at once, stopping at a full slot or the sentinel
+				while(*ctrl < HASH_CONTROL_SENTINEL) {
+					size_type skipCount = HashGroup(ctrl).CountLeadingEmptyOrDeleted();
+					ctrl += skipCount;
+					slot += skipCount;
+				}
+			}
+
+			const int8_t* ctrl;
+			const_pointer slot;
+
+			friend flat_unordered_set;
+		};
+
+		/// @brief The max load factor of every flat unordered set, which can only be lowered.
+		static constexpr float32_t MAX_LOAD_FACTOR = 0.875f;
+		/// @brief The lowest max load factor of every flat unordered set, which lower max load factors are raised to.
+		static constexpr float32_t MIN_LOAD_FACTOR = 0.125f;
+
+		/// @brief Creates an empty flat unordered set. No memory is allocated until the first value is inserted, unless a slot count is given.
+		/// @param n The minimum number of slots.
+		flat_unordered_set(size_type n = 0) {
+			// Allocate the wanted slots
+			if(n)
+				rehash(n);
+		}
+		/// @brief Creates an empty flat unordered set that allocates its memory from the given resource.
+		/// @param resource The memory resource to allocate from. It must outlive the flat unordered set.
+		/// @param n The minimum number of slots.
+		explicit flat_unordered_set(MemoryResource& resource, size_type n = 0) : memoryResource(&resource) {
+			// Allocate the wanted slots
+			if(n)
+				rehash(n);
+		}
+		/// @brief Copies the given flat unordered set.
+		/// @param other The flat unordered set to copy.
+		flat_unordered_set(const flat_unordered_set& other) : usetMaxLoadFactor(other.usetMaxLoadFactor) {
+			// Copy the other flat unordered set's slots
+			CopySlots(other);
+		}
+		/// @brief Moves the given flat unordered set's contents.
+		/// @param other The flat unordered set whose contents to move.
+		flat_unordered_set(flat_unordered_set&& other) noexcept : memoryResource(other.memoryResource), usetControls(other.usetControls), usetSlots(other.usetSlots), usetCapacity(other.usetCapacity), usetSize(other.usetSize), usetGrowthLeft(other.usetGrowthLeft), usetMaxLoadFactor(other.usetMaxLoadFactor) {
+			// Unlink all data from the other flat unordered set
+			other.ResetEmpty();
+		}
+		/// @brief Constructs a flat unordered set with all the values in the list.
+		/// @param list The list to copy from.
+		/// @param n The minimum number of slots.
+		flat_unordered_set(std::initializer_list<value_type> list, size_type n = 0) {
+			// Allocate enough slots for the whole list, then insert every value
+			reserve(list.size());
+			if(n > usetCapacity)
+				rehash(n);
+
+			insert(list);
+		}
+		/// @brief Copies the given std library unordered set.
+		/// @param other The std library unordered set to copy from.
+		flat_unordered_set(const std::unordered_set<value_type>& other) {
+			// Allocate enough slots for the whole set, then insert every value
+			reserve(other.size());
+
+			for(const auto& val : other)
+				insert(val);
+		}
+
+		/// @brief Copies the given flat unordered set's contents into this set.
+		/// @param other The flat unordered set to copy from.
+		/// @return A reference to this flat unordered set.
+		flat_unordered_set& operator=(const flat_unordered_set& other) {
+			// Check if the two sets are the same
+			if(&other == this)
+				return *this;
+
+			// Free the flat unordered set's previous data
+			DestroySlots();
+			FreeSlots();
+
+			// Copy the other flat unordered set's slots
+			usetMaxLoadFactor = other.usetMaxLoadFactor;
+			CopySlots(other);
+
+			return *this;
+		}
+		/// @brief Moves the given flat unordered set's contents into this set.
+		/// @param other The flat unordered set to move from.
+		/// @return A reference to this flat unordered set.
+		flat_unordered_set& operator=(flat_unordered_set&& other) {
+			// Check if the two sets are the same
+			if(&other == this)
+				return *this;
+
+			// Free the flat unordered set's previous data
+			DestroySlots();
+			FreeSlots();
+
+			// Set the flat unordered set's new values
+			memoryResource = other.memoryResource;
+			usetControls = other.usetControls;
+			usetSlots = other.usetSlots;
+			usetCapacity = other.usetCapacity;
+			usetSize = other.usetSize;
+			usetGrowthLeft = other.usetGrowthLeft;
+			usetMaxLoadFactor = other.usetMaxLoadFactor;
+
+			// Unlink all data from the other flat unordered set
+			other.ResetEmpty();
+
+			return *this;
+		}
+		/// @brief Copies the given list's values into this flat unordered set.
+		/// @param list The list to copy from.
+		/// @return A reference to this flat unordered set.
+		flat_unordered_set& operator=(std::initializer_list<value_type> list) {
+			// Remove the previous values, then insert every value from the list
+			clear();
+			reserve(list.size());
+			insert(list);
+
+			return *this;
+		}
+
+		/// @brief Converts the flat unordered set to an std library unordered set.
+		operator std::unordered_set<value_type>() const {
+			// Insert every value from this set into the std library unordered set
+			std::unordered_set<value_type> uset(usetSize);
+			for(const auto& val : *this)
+				uset.insert(val);
+
+			return uset;
+		}
+
+		/// @brief Finds the wanted value in the flat unordered set.
+		/// @param val The value to find.
+		/// @return An iterator to the wanted value if it exists, otherwise flat_unordered_set::end().
+		iterator find(const_reference val) {
+			return find_with_hash(val, ValHash()(val));
+		}
+		/// @brief Finds the wanted value in the flat unordered set.
+		/// @param val The value to find.
+		/// @return A const iterator to the wanted value if it exists, otherwise flat_unordered_set::end().
+		const_iterator find(const_reference val) const {
+			return find_with_hash(val, ValHash()(val));
+		}
+		/// @brief Gets the number of values equal to the given value.
+		/// @param val The value to look for.
+		/// @return The number of values equal to the given value.
+		size_type count(const_reference val) const {
+			return FindIndex(val, ValHash()(val)) != SIZE_T_MAX;
+		}
+		/// @brief Finds the range of values equal to the given value.
+		/// @param val The value to look for.
+		/// @return The bounds of the wanted range.
+		pair<iterator, iterator> equal_range(const_reference val) {
+			// Look for the value, returning a pair of end iterators if it wasn't found
+			iterator first = find(val);
+			if(first == end())
+				return { first, first };
+
+			iterator last = first;
+			++last;
+
+			return { first, last };
+		}
+		/// @brief Finds the range of values equal to the given value.
+		/// @param val The value to look for.
+		/// @return The bounds of the wanted range.
+		pair<const_iterator, const_iterator> equal_range(const_reference val) const {
+			// Look for the value, returning a pair of end iterators if it wasn't found
+			const_iterator first = find(val);
+			if(first == end())
+				return { first, first };
+
+			const_iterator last = first;
+			++last;
+
+			return { first, last };
+		}
+
+		/// @brief Finds the wanted value in the flat unordered set, without converting it to the value type.
+		/// @tparam K The type of the value, which must be supported by both the hash and the comparison function structs.
+		/// @param val The value to find.
+		/// @return An iterator to the wanted value if it exists, otherwise flat_unordered_set::end().
+		template<class K> requires TransparentHash<ValHash, Equal>
+		iterator find(const K& val) {
+			return find_with_hash(val, ValHash()(val));
+		}
+		/// @brief Finds the wanted value in the flat unordered set, without converting it to the value type.
+		/// @tparam K The type of the value, which must be supported by both the hash and the comparison function structs.
+		/// @param val The value to find.
+		/// @return A const iterator to the wanted value if it exists, otherwise flat_unordered_set::end().
+		template<class K> requires TransparentHash<ValHash, Equal>
+		const_iterator find(const K& val) const {
+			return find_with_hash(val, ValHash()(val));
+		}
+		/// @brief Gets the number of values equal to the given value, without converting it to the value type.
+		/// @tparam K The type of the value, which must be supported by both the hash and the comparison function structs.
+		/// @param val The value to look for.
+		/// @return The number of values equal to the given value.
+		template<class K> requires TransparentHash<ValHash, Equal>
+		size_type count(const K& val) const {
+			return FindIndex(val, ValHash()(val)) != SIZE_T_MAX;
+		}
+		/// @brief Finds the range of values equal to the given value, without converting it to the value type.
+		/// @tparam K The type of the value, which must be supported by both the hash and the comparison function structs.
+		/// @param val The value to look for.
+		/// @return The bounds of the wanted range.
+		template<class K> requires TransparentHash<ValHash, Equal>
+		pair<iterator, iterator> equal_range(const K& val) {
+			// Look for the value, returning a pair of end iterators if it wasn't found
+			iterator first = find(val);
+			if(first == end())
+				return { first, first };
+
+			iterator last = first;
+			++last;
+
+			return { first, last };
+		}
+		/// @brief Finds the range of values equal to the given value, without converting it to the value type.
+		/// @tparam K The type of the value, which must be supported by both the hash and the comparison function structs.
+		/// @param val The value to look for.
+		/// @return The bounds of the wanted range.
+		template<class K> requires TransparentHash<ValHash, Equal>
+		pair<const_iterator, const_iterator> equal_range(const K& val) const {
+			// Look for the value, returning a pair of end iterators if it wasn't found
+			const_iterator first = find(val);
+			if(first == end())
+				return { first, first };
+
+			const_iterator last = first;
+			++last;
+
+			return { first, last };
+		}
+		/// @brief Finds the wanted value in the flat unordered set using a hash computed by the caller, which lets the same hash be used for lookups in several sets.
+		/// @param val The value to find.
+		/// @param hash The value's hash, which must be equal to the hash given by the set's hash function struct.
+		/// @return An iterator to the wanted value if it exists, otherwise flat_unordered_set::end().
+		iterator find_with_hash(const_reference val, uint64_t hash) {
+			size_type ind = FindIndex(val, hash);
+			return ind != SIZE_T_MAX ? iterator(usetControls + ind, usetSlots + ind) : end();
+		}
+		/// @brief Finds the wanted value in the flat unordered set using a hash computed by the caller, which lets the same hash be used for lookups in several sets.
+		/// @param val The value to find.
+		/// @param hash The value's hash, which must be equal to the hash given by the set's hash function struct.
+		/// @return A const iterator to the wanted value if it exists, otherwise flat_unordered_set::end().
+		const_iterator find_with_hash(const_reference val, uint64_t hash) const {
+			size_type ind = FindIndex(val, hash);
+			return ind != SIZE_T_MAX ? const_iterator(usetControls + ind, usetSlots + ind) : end();
+		}
+		/// @brief Finds the wanted value in the flat unordered set using a hash computed by the caller, without converting it to the value type.
+		/// @tparam K The type of the value, which must be supported by both the hash and the comparison function structs.
+		/// @param val The value to find.
+		/// @param hash The value's hash, which must be equal to the hash given by the set's hash function struct.
+		/// @return An iterator to the wanted value if it exists, otherwise flat_unordered_set::end().
+		template<class K> requires TransparentHash<ValHash, Equal>
+		iterator find_with_hash(const K& val, uint64_t hash) {
+			size_type ind = FindIndex(val, hash);
+			return ind != SIZE_T_MAX ? iterator(usetControls + ind, usetSlots + ind) : end();
+		}
+		/// @brief Finds the wanted value in the flat unordered set using a hash computed by the caller, without converting it to the value type.
+		/// @tparam K The type of the value, which must be supported by both the hash and the comparison function structs.
+		/// @param val The value to find.
+		/// @param hash The value's hash, which must be equal to the hash given by the set's hash function struct.
+		/// @return A const iterator to the wanted value if it exists, otherwise flat_unordered_set::end().
+		template<class K> requires TransparentHash<ValHash, Equal>
+		const_iterator find_with_hash(const K& val, uint64_t hash) const {
+			size_type ind = FindIndex(val, hash);
+			return ind != SIZE_T_MAX ? const_iterator(usetControls + ind, usetSlots + ind) : end();
+		}
+
+		/// @brief Emplaces the constructed value into the flat unordered set.
+		/// @tparam ...Args The arg types to construct the value with.
+		/// @param ...args The args to construct the value with.
+		/// @return A pair containing an iterator to the emplaced value or an identical value and a bool that is true if a new value was inserted, otherwise false.
+		template<class... Args>
+		pair<iterator, bool8_t> emplace(Args&&... args) {
+			// Construct the value
+			value_type val(args...);
+
+			// Insert the value into the flat unordered set
+			return insert(val);
+		}
+		/// @brief Emplaces the constructed value into the flat unordered set using the given hint.
+		/// @tparam ...Args The arg types to construct the value with.
+		/// @param pos A hint for the position of the emplaced value.
+		/// @param ...args The args to construct the value with.
+		/// @return An iterator to the emplaced value or an identical value.
+		template<class... Args>
+		iterator emplace_hint(const_iterator pos, Args&&... args) {
+			// Construct the value
+			value_type val(args...);
+
+			// Insert the value into the flat unordered set using the given hint
+			return insert(pos, val);
+		}
+		/// @brief Inserts the given value into the flat unordered set.
+		/// @param val The value to insert.
+		/// @return A pair containing an iterator to the inserted value or an identical value and a bool that is true if a new value was inserted, otherwise false.
+		pair<iterator, bool8_t> insert(const_reference val) {
+			return insert_with_hash(val, ValHash()(val));
+		}
+		/// @brief Inserts the given value into the flat unordered set.
+		/// @param val The value to insert.
+		/// @return A pair containing an iterator to the inserted value or an identical value and a bool that is true if a new value was inserted, otherwise false.
+		pair<iterator, bool8_t> insert(value_type&& val) {
+			return insert_with_hash(val, ValHash()(val));
+		}
+		/// @brief Inserts the given value into the flat unordered set using a hash computed by the caller.
+		/// @param val The value to insert.
+		/// @param hash The value's hash, which must be equal to the hash given by the set's hash function struct.
+		/// @return A pair containing an iterator to the inserted value or an identical value and a bool that is true if a new value was inserted, otherwise false.
+		pair<iterator, bool8_t> insert_with_hash(const_reference val, uint64_t hash) {
+			// Look for the value
+			size_type ind = FindIndex(val, hash);
+			if(ind != SIZE_T_MAX)
+				return { iterator(usetControls + ind, usetSlots + ind), false };
+
+			// Prepare a slot for the value and copy the value into it
+			ind = PrepareInsert(hash);
+			new(usetSlots + ind) value_type(val);
+
+			return { iterator(usetControls + ind, usetSlots + ind), true };
+		}
+		/// @brief Inserts the given value into the flat unordered set using the given hint.
+		/// @param pos A hint for the position of the inserted value.
+		/// @param val The value to insert.
+		/// @return An iterator the the inserted value or an identical value.
+		iterator insert(const_iterator pos, const_reference val) {
+			// Simply insert the value without using the given hint
+			(void)pos;
+			return insert(val).first;
+		}
+		/// @brief Inserts the given value into the flat unordered set using the given hint.
+		/// @param pos A hint for the position of the inserted value.
+		/// @param val The value to insert.
+		/// @return An iterator the the inserted value or an identical value.
+		iterator insert(const_iterator pos, value_type&& val) {
+			// Simply insert the value without using the given hint
+			(void)pos;
+			return insert(val).first;
+		}
+		/// @brief Inserts all values from the given list into the flat unordered set.
+		/// @param list The list to insert from.
+		void insert(std::initializer_list<value_type> list) {
+			// Insert every value from the given list
+			const_pointer end = list.end();
+			for(const_pointer ptr = list.begin(); ptr != end; ++ptr)
+				insert(*ptr);
+		}
+		/// @brief Erases the value at the given position from the flat unordered set. Iterators to other values stay valid.
+		/// @param pos The position to erase from.
+		/// @return An iterator to the value after the erased value.
+		iterator erase(const_iterator pos) {
+			// Erase the value from its slot
+			size_type ind = pos.slot - usetSlots;
+			EraseIndex(ind);
+
+			// Move onto the next full slot
+			iterator next(usetControls + ind + 1, usetSlots + ind + 1);
+			next.SkipEmptySlots();
+
+			return next;
+		}
+		/// @brief Erases the value at the given position from the flat unordered set. Iterators to other values stay valid.
+		/// @param pos The position to erase from.
+		/// @return An iterator to the value after the erased value.
+		iterator erase(iterator pos) {
+			return erase(const_iterator(pos));
+		}
+		/// @brief Erases the given value from the flat unordered set.
+		/// @param val The value to erase.
+		/// @return The number of erased values.
+		size_type erase(const_reference val) {
+			// Look for the value, exiting the function if it wasn't found
+			size_type ind = FindIndex(val, ValHash()(val));
+			if(ind == SIZE_T_MAX)
+				return 0;
+
+			// Erase the value from its slot
+			EraseIndex(ind);
+
+			return 1;
+		}
+		/// @brief Erases the given value from the flat unordered set, without converting it to the value type.
+		/// @tparam K The type of the value, which must be supported by both the hash and the comparison function structs.
+		/// @param val The value to erase.
+		/// @return The number of erased values.
+		template<class K> requires TransparentHash<ValHash, Equal>
+		size_type erase(const K& val) {
+			// Look for the value, exiting the function if it wasn't found
+			size_type ind = FindIndex(val, ValHash()(val));
+			if(ind == SIZE_T_MAX)
+				return 0;
+
+			// Erase the value from its slot
+			EraseIndex(ind);
+
+			return 1;
+		}
+		/// @brief Erases all values from the given range.
+		/// @param first An iterator to the first erased element.
+		/// @param last An iterator to right after the last erased element.
+		/// @return An iterator to the value after the last erased value.
+		iterator erase(const_iterator first, const_iterator last) {
+			// Erase every value in the range; erasing never moves the remaining values
+			while(first != last)
+				first = erase(first);
+
+			return iterator(last.ctrl, (pointer)last.slot);
+		}
+		/// @brief Clears the contents of the flat unordered set, keeping its slots.
+		void clear() {
+			// Destruct every value in the flat unordered set
+			DestroySlots();
+
+			// Mark every slot as empty
+			if(usetCapacity)
+				ResetControls();
+
+			usetSize = 0;
+			usetGrowthLeft = GetMaxGrowth(usetCapacity);
+		}
+		/// @brief Swaps the contents of the two flat unordered sets.
+		/// @param other The flat unordered set to swap with.
+		void swap(flat_unordered_set& other) {
+			// Exit the function if the two flat unordered sets are the same
+			if(&other == this)
+				return;
+
+			// Save this flat unordered set's values
+			MemoryResource* auxMemoryResource = memoryResource;
+			int8_t* auxControls = usetControls;
+			pointer auxSlots = usetSlots;
+			size_type auxCapacity = usetCapacity;
+			size_type auxSize = usetSize;
+			size_type auxGrowthLeft = usetGrowthLeft;
+			float32_t auxMaxLoadFactor = usetMaxLoadFactor;
+
+			// Set this flat unordered set's values
+			memoryResource = other.memoryResource;
+			usetControls = other.usetControls;
+			usetSlots = other.usetSlots;
+			usetCapacity = other.usetCapacity;
+			usetSize = other.usetSize;
+			usetGrowthLeft = other.usetGrowthLeft;
+			usetMaxLoadFactor = other.usetMaxLoadFactor;
+
+			// Set the other flat unordered set's values
+			other.memoryResource = auxMemoryResource;
+			other.usetControls = auxControls;
+			other.usetSlots = auxSlots;
+			other.usetCapacity = auxCapacity;
+			other.usetSize = auxSize;
+			other.usetGrowthLeft = auxGrowthLeft;
+			other.usetMaxLoadFactor = auxMaxLoadFactor;
+		}
+
+		/// @brief Returns an iterator to the beginning of the flat unordered set.
+		/// @return An iterator to the beginning of the flat unordered set.
+		iterator begin() {
+			iterator iter(usetControls, usetSlots);
+			iter.SkipEmptySlots();
+			return iter;
+		}
+		/// @brief Returns a const iterator to the beginning of the flat unordered set.
+		/// @return A const iterator to the beginning of the flat unordered set.
+		const_iterator begin() const {
+			const_iterator iter(usetControls, usetSlots);
+			iter.SkipEmptySlots();
+			return iter;
+		}
+		/// @brief Returns an iterator to the end of the flat unordered set.
+		/// @return An iterator to the end of the flat unordered set.
+		iterator end() {
+			return iterator(usetControls + usetCapacity, usetSlots + usetCapacity);
+		}
+		/// @brief Returns a const iterator to the end of the flat unordered set.
+		/// @return A const iterator to the end of the flat unordered set.
+		const_iterator end() const {
+			return const_iterator(usetControls + usetCapacity, usetSlots + usetCapacity);
+		}
+		/// @brief Returns a const iterator to the beginning of the flat unordered set.
+		/// @return A const iterator to the beginning of the flat unordered set.
+		const_iterator cbegin() const {
+			return begin();
+		}
+		/// @brief Returns a const iterator to the end of the flat unordered set.
+		/// @return A const iterator to the end of the flat unordered set.
+		const_iterator cend() const {
+			return end();
+		}
+
+		/// @brief Tests if the flat unordered set is empty.
+		/// @return True if the flat unordered set is empty, otherwise false.
+		bool8_t empty() const {
+			return !usetSize;
+		}
+		/// @brief Gets the flat unordered set's size.
+		/// @return The flat unordered set's size.
+		size_type size() const {
+			return usetSize;
+		}
+		/// @brief Returns the flat unordered set's maximum possible size.
+		/// @return The flat unordered set's maximum possible size.
+		size_type max_size() const {
+			return SIZE_T_MAX / (sizeof(value_type) + 1);
+		}
+
+		/// @brief Gets the number of buckets in the flat unordered set, which is its number of slots.
+		/// @return The number of buckets in the flat unordered set.
+		size_type bucket_count() const {
+			return usetCapacity;
+		}
+		/// @brief Gets the maximum possible number of buckets in the flat unordered set.
+		/// @return The maximum possible number of buckets.
+		size_type max_bucket_count() const {
+			return SIZE_T_MAX / (sizeof(value_type) + 1);
+		}
+		/// @brief Gets the number of values in the given bucket. Every bucket is a single slot.
+		/// @param n The wanted bucket's index.
+		/// @return The number of values in the given bucket.
+		size_type bucket_size(size_type n) const {
+			return n < usetCapacity && usetControls[n] >= 0;
+		}
+		/// @brief Gets the given value's bucket index.
+		/// @param val The value whose bucket index to get.
+		/// @return The index of the slot holding the given value, or the first slot of the value's first probed group if the value isn't in the flat unordered set.
+		size_type bucket(const_reference val) const {
+			// Return the value's slot if it exists
+			uint64_t hash = ValHash()(val);
+			size_type ind = FindIndex(val, hash);
+			if(ind != SIZE_T_MAX)
+				return ind;
+			if(!usetCapacity)
+				return 0;
+
+			return ((size_type)hash & GetGroupMask()) * HashGroup::WIDTH;
+		}
+
+		/// @brief Gets the flat unordered set's load factor, which is equal to the ratio between the total number of values and the number of slots.
+		/// @return The flat unordered set's load factor.
+		float32_t load_factor() const {
+			return usetCapacity ? (float32_t)usetSize / (float32_t)usetCapacity : 0.f;
+		}
+		/// @brief Gets the flat unordered set's max load factor, which is equal to the ratio between the total number of values and the number of slots.
+		/// @return The flat unordered set's max load factor.
+		float32_t max_load_factor() const {
+			return usetMaxLoadFactor;
+		}
+		/// @brief Sets the flat unordered set's max load factor, which is equal to the ratio between the total number of values and the number of slots. It is capped at MAX_LOAD_FACTOR, since probes slow down sharply on fuller tables, and raised to MIN_LOAD_FACTOR, since the slot count grows without bound as the factor approaches 0.
+		/// @param z The flat unordered set's new max load factor.
+		void max_load_factor(float32_t z) {
+			// Clamp the max load factor, raising NaN to the min as well
+			if(!(z >= MIN_LOAD_FACTOR))
+				z = MIN_LOAD_FACTOR;
+			else if(z > MAX_LOAD_FACTOR)
+				z = MAX_LOAD_FACTOR;
+			usetMaxLoadFactor = z;
+
+			// Rebuild the table for the new load factor
+			if(usetCapacity)
+				rehash(usetCapacity);
+		}
+		/// @brief Sets the flat unordered set's slot count, rounded up to a power of two that can hold every value.
+		/// @param n The flat unordered set's minimum slot count.
+		void rehash(size_type n) {
+			// Get the lowest valid slot count that is at least n and holds every value
+			size_type newCapacity = GetCapacity(usetSize);
+			while(newCapacity < n)
+				newCapacity = newCapacity ? newCapacity << 1 : HashGroup::WIDTH;
+
+			// Rebuild the table, which also removes every deleted slot
+			Resize(newCapacity);
+		}
+		/// @brief Allocates enough slots to hold the given number of values without rehashing.
+		/// @param n The requested number of values.
+		void reserve(size_type n) {
+			// Grow the table if it can't hold the given number of values
+			if(n > usetSize + usetGrowthLeft)
+				Resize(GetCapacity(n));
+		}
+
+		/// @brief Gets the memory resource the flat unordered set allocates its memory from.
+		/// @return A pointer to the flat unordered set's memory resource, or a nullptr if it allocates from the heap.
+		MemoryResource* get_memory_resource() const {
+			return memoryResource;
+		}
+
+		/// @brief Destroys the flat unordered set.
+		~flat_unordered_set() {
+			// Destruct every value and free the flat unordered set's slots
+			DestroySlots();
+			FreeSlots();
+		}
+	private:
+		size_type GetMaxGrowth(size_type capacity) const {
+			// Always leave at least one empty slot, which every probe needs to stop
+			if(!capacity)
+				return 0;
+
+			size_type maxGrowth = (size_type)((float32_t)capacity * usetMaxLoadFactor);
+			return maxGrowth < capacity ? maxGrowth : capacity - 1;
+		}
+		size_type GetCapacity(size_type n) const {
+			// Get the lowest power of 2 slot count, of at least one group, whose max growth fits n values
+			if(!n)
+				return 0;
+
+			size_type capacity = HashGroup::WIDTH;
+			while(GetMaxGrowth(capacity) < n)
+				capacity <<= 1;
+
+			return capacity;
+		}
+		size_type GetGroupMask() const {
+			return (usetCapacity / HashGroup::WIDTH) - 1;
+		}
+		template<class K>
+		size_type FindIndex(const K& val, uint64_t hash) const {
+			// Exit the function if the flat unordered set has no slots
+			if(!usetCapacity)
+				return SIZE_T_MAX;
+
+			int8_t control = GetHashControl(hash);
+			size_type groupMask = GetGroupMask();
+			size_type group = (size_type)hash & groupMask;
+
+			// Probe the groups in triangular order, which visits every group once when the group count is a power of 2
+			for(size_type step = 1; ; ++step) {
+				size_type groupStart = group * HashGroup::WIDTH;
+				HashGroup groupControls(usetControls + groupStart);
+
+				// Compare the values of every slot with a matching control byte
+				for(uint64_t mask = groupControls.Match(control); mask; mask &= mask - 1) {
+					size_type ind = groupStart + HashGroup::GetIndex(mask);
+					if(Equal()(usetSlots[ind], val))
+						return ind;
+				}
+
+				// Exit the loop if the group has an empty slot, since the value would've been inserted there
+				if(groupControls.MatchEmpty())
+					return SIZE_T_MAX;
+
+				group = (group + step) & groupMask;
+			}
+		}
+		size_type FindInsertIndex(uint64_t hash) const {
+			size_type groupMask = GetGroupMask();
+			size_type group = (size_type)hash & groupMask;
+
+			// Probe the groups in the same order as lookups, stopping at the first empty or deleted slot
+			for(size_type step = 1; ; ++step) {
+				size_type groupStart = group * HashGroup::WIDTH;
+				uint64_t mask = HashGroup(usetControls + groupStart).MatchEmptyOrDeleted();
+				if(mask)
+					return groupStart + HashGroup::GetIndex(mask);
+
+				group = (group + step) & groupMask;
+			}
+		}
+		size_type PrepareInsert(uint64_t hash) {
+			// Grow the table if every usable slot is taken; if at least half the growth was lost to deleted slots, rebuilding at the same size is enough
+			if(!usetGrowthLeft) {
+				size_type maxGrowth = GetMaxGrowth(usetCapacity);
+				Resize(usetSize < (maxGrowth >> 1) ? usetCapacity : (usetCapacity ? usetCapacity << 1 : HashGroup::WIDTH));
+			}
+
+			// Claim the slot, only using up growth if it was empty rather than deleted
+			size_type ind = FindInsertIndex(hash);
+			usetGrowthLeft -= usetControls[ind] == HASH_CONTROL_EMPTY;
+			usetControls[ind] = GetHashControl(hash);
+			++usetSize;
+
+			return ind;
+		}
+		void EraseIndex(size_type ind) {
+			// Destruct the value
+			usetSlots[ind].~value_type();
+			--usetSize;
+
+			// Mark the slot as empty if its group has another empty slot, since no probe could've passed over the group; otherwise, mark it as deleted so that probes keep going
+			size_type groupStart = ind & ~(HashGroup::WIDTH - 1);
+			if(HashGroup(usetControls + groupStart).MatchEmpty()) {
+				usetControls[ind] = HASH_CONTROL_EMPTY;
+				++usetGrowthLeft;
+			} else {
+				usetControls[ind] = HASH_CONTROL_DELETED;
+			}
+		}
+		void ResetControls() {
+			// Mark every slot as empty and place the sentinel after the last slot
+			wfe::memset(usetControls, (uint8_t)HASH_CONTROL_EMPTY, usetCapacity + HashGroup::WIDTH);
+			usetControls[usetCapacity] = HASH_CONTROL_SENTINEL;
+		}
+		void ResetEmpty() {
+			usetControls = (int8_t*)GetEmptyHashControls();
+			usetSlots = nullptr;
+			usetCapacity = 0;
+			usetSize = 0;
+			usetGrowthLeft = 0;
+		}
+		void AllocSlots(size_type capacity) {
+			// Allocate the control bytes and the slots in a single block, with the slots right after the padded control bytes
+			size_type alignment = alignof(value_type) > HashGroup::WIDTH ? alignof(value_type) : HashGroup::WIDTH;
+			size_type controlSize = (capacity + HashGroup::WIDTH + alignof(value_type) - 1) & ~(alignof(value_type) - 1);
+			int8_t* data = (int8_t*)AllocMemory(memoryResource, controlSize + capacity * sizeof(value_type), alignment);
+			if(!data)
+				throw BadAllocException("Failed to allocate flat unordered set slots!");
+
+			usetControls = data;
+			usetSlots = (pointer)(data + controlSize);
+			usetCapacity = capacity;
+			usetGrowthLeft = GetMaxGrowth(capacity) - usetSize;
+
+			ResetControls();
+		}
+		void FreeSlots() {
+			// The control bytes start the slots' memory block
+			if(usetCapacity)
+				FreeMemory(memoryResource, usetControls);
+		}
+		void DestroySlots() {
+			// Destruct the value in every full slot
+			for(size_type i = 0; usetSize && i != usetCapacity; ++i)
+				if(usetControls[i] >= 0)
+					usetSlots[i].~value_type();
+		}
+		void CopySlots(const flat_unordered_set& other) {
+			// Set this flat unordered set to the empty state if the other set has no slots
+			ResetEmpty();
+			if(!other.usetCapacity)
+				return;
+
+			// Allocate as many slots as the other flat unordered set and copy its values into the same slots
+			AllocSlots(other.usetCapacity);
+			wfe::memcpy(usetControls, other.usetControls, usetCapacity + HashGroup::WIDTH);
+
+			for(size_type i = 0; i != usetCapacity; ++i)
+				if(usetControls[i] >= 0)
+					new(usetSlots + i) value_type(other.usetSlots[i]);
+
+			usetSize = other.usetSize;
+			usetGrowthLeft = other.usetGrowthLeft;
+		}
+		void Resize(size_type newCapacity) {
+			// Save the flat unordered set's old slots
+			int8_t* oldControls = usetControls;
+			pointer oldSlots = usetSlots;
+			size_type oldCapacity = usetCapacity;
+
+			// Allocate the new slots, or fall back to the shared empty controls if no slots are needed
+			if(newCapacity) {
+				AllocSlots(newCapacity);
+			} else {
+				ResetEmpty();
+			}
+
+			// Move every value into its slot in the new table; values are relocated bitwise, like the other containers do
+			for(size_type i = 0; i != oldCapacity; ++i) {
+				if(oldControls[i] < 0)
+					continue;
+
+				uint64_t hash = ValHash()(oldSlots[i]);
+				size_type ind = FindInsertIndex(hash);
+				usetControls[ind] = GetHashControl(hash);
+				wfe::memcpy(usetSlots + ind, oldSlots + i, sizeof(value_type));
+			}
+
+			// Free the old slots
+			if(oldCapacity)
+				FreeMemory(memoryResource, oldControls);
+		}
+
+		MemoryResource* memoryResource = nullptr;
+		int8_t* usetControls = (int8_t*)GetEmptyHashControls();
+		pointer usetSlots = nullptr;
+		size_type usetCapacity = 0;
+		size_type usetSize = 0;
+		size_type usetGrowthLeft = 0;
+		float32_t usetMaxLoadFactor = MAX_LOAD_FACTOR;
+	};
+
+	/// @brief Compares the two given flat unordered sets.
+	/// @tparam T The type of the two flat unordered set's values.
+	/// @param uset1 The first flat unordered set to compare.
+	/// @param uset2 The second flat unordered set to compare.
+	/// @return True if the two flat unordered sets are equal, otherwise false.
+	template<class T>
+	WFE_INLINE bool8_t operator==(const flat_unordered_set<T>& uset1, const flat_unordered_set<T>& uset2) {
+		// Exit the function if the flat unordered sets have different sizes
+		if(uset1.size() != uset2.size())
+			return false;
+
+		// Search for every value in the first set in the second set
+		for(const auto& val : uset1)
+			if(!uset2.count(val))
+				return false;
+
+		return true;
+	}
+	/// @brief Compares the two given flat unordered sets.
+	/// @tparam T The type of the two flat unordered set's values.
+	/// @param uset1 The first flat unordered set to compare.
+	/// @param uset2 The second flat unordered set to compare.
+	/// @return True if the two flat unordered sets are different, otherwise false.
+	template<class T>
+	WFE_INLINE bool8_t operator!=(const flat_unordered_set<T>& uset1, const flat_unordered_set<T>& uset2) {
+		return !(uset1 == uset2);
+	}
+}
\ No newline at end of file
@@ -0,0 +1,159 @@
+#pragma once
+
+#include "Defines.hpp"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define WFE_HASH_GROUP_SSE2
+#include <emmintrin.h>
+#endif
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace wfe {
+	/// @brief The control byte of an empty slot in an open addressing hash table.
+	constexpr int8_t HASH_CONTROL_EMPTY = -128;
+	/// @brief The control byte of a slot whose value was erased, which probes must skip over.
+	constexpr int8_t HASH_CONTROL_DELETED = -2;
+	/// @brief The control byte placed right after a hash table's last slot, which stops iteration.
+	constexpr int8_t HASH_CONTROL_SENTINEL = -1;
+
+	/// @brief Gets the index of the lowest set bit in the given mask.
+	/// @param mask The mask to check, which must not be 0.
+	/// @return The index of the lowest set bit.
+	WFE_INLINE uint32_t HashGroupLowestBit(uint64_t mask) {
+#if defined(_MSC_VER)
+		unsigned long index;
+		_BitScanForward64(&index, mask);
+		return (uint32_t)index;
+#else
+		return (uint32_t)__builtin_ctzll(mask);
+#endif
+	}
+
+	/// @brief Gets the control byte of a full slot from the given hash. The top 7 bits are used, since the low bits select the slot's group.
+	/// @param hash The hash of the slot's key.
+	/// @return The slot's control byte.
+	WFE_INLINE int8_t GetHashControl(uint64_t hash) {
+		return (int8_t)(hash >> 57);
+	}
+
+	/// @brief A group of consecutive control bytes of an open addressing hash table, which are probed together. Every match returns a mask with one bit set per matching slot, whose slot indices are extracted with HashGroup::GetIndex.
+	struct HashGroup {
+#if defined(WFE_HASH_GROUP_SSE2)
+		/// @brief The number of control bytes in every group.
+		static const size_t WIDTH = 16;
+		/// @brief The shift from a mask bit's index to its slot's index.
+		static const uint32_t MASK_SHIFT = 0;
+
+		/// @brief Loads the group starting at the given control byte.
+		/// @param ctrl A pointer to the group's first control byte, which doesn't have to be aligned.
+		explicit HashGroup(const int8_t* ctrl) : ctrl(_mm_loadu_si128((const __m128i*)ctrl)) { }
+
+		/// @brief Matches the group's full slots with the given control byte.
+		/// @param control The control byte to look for, created by GetHashControl.
+		/// @return A mask of the matching slots.
+		uint64_t Match(int8_t control) const {
+			return (uint64_t)_mm_movemask_epi8(_mm_cmpeq_epi8(ctrl, _mm_set1_epi8(control)));
+		}
+		/// @brief Matches the group's empty slots.
+		/// @return A mask of the empty slots.
+		uint64_t MatchEmpty() const {
+			return Match(HASH_CONTROL_EMPTY);
+		}
+		/// @brief Matches the group's empty and deleted slots, which have the top bit set and are lower than the sentinel.
+		/// @return A mask of the empty and deleted slots.
+		uint64_t MatchEmptyOrDeleted() const {
+			return (uint64_t)_mm_movemask_epi8(_mm_cmpgt_epi8(_mm_set1_epi8(HASH_CONTROL_SENTINEL), ctrl));
+		}
+		/// @brief Matches the group's full slots, which have the top bit cleared.
+		/// @return A mask of the full slots.
+		uint64_t MatchFull() const {
+			return (uint64_t)(_mm_movemask_epi8(ctrl) ^ 0xffff);
+		}
+		/// @brief Matches the group's full slots and the sentinel, which are the only control bytes higher than the deleted byte.
+		/// @return A mask of the full slots and the sentinel.
+		uint64_t MatchFullOrSentinel() const {
+			return (uint64_t)_mm_movemask_epi8(_mm_cmpgt_epi8(ctrl, _mm_set1_epi8(HASH_CONTROL_DELETED)));
+		}
+
+		__m128i ctrl;
+#else
+		/// @brief The number of control bytes in every group.
+		static const size_t WIDTH = 8;
+		/// @brief The shift from a mask bit's index to its slot's index.
+		static const uint32_t MASK_SHIFT = 3;
+
+		/// @brief Loads the group starting at the given control byte.
+		/// @param ctrl A pointer to the group's first control byte, which doesn't have to be aligned.
+		explicit HashGroup(const int8_t* ctrl) {
+			// Load the control bytes as a little endian word, so that lower slots map to lower bits
+			const uint8_t* bytes = (const uint8_t*)ctrl;
+			this->ctrl = 0;
+			for(size_t i = 0; i != WIDTH; ++i)
+				this->ctrl |= (uint64_t)bytes[i] << (i << 3);
+		}
+
+		/// @brief Matches the group's full slots with the given control byte. Rarely, a slot right after a match is also reported; callers compare the keys anyway.
+		/// @param control The control byte to look for, created by GetHashControl.
+		/// @return A mask of the matching slots.
+		uint64_t Match(int8_t control) const {
+			// Find the zero bytes after xoring with the wanted byte
+			uint64_t diff = ctrl ^ (LSBS * (uint8_t)control);
+			return (diff - LSBS) & ~diff & MSBS;
+		}
+		/// @brief Matches the group's empty slots, which have the top bit set and bit 1 cleared.
+		/// @return A mask of the empty slots.
+		uint64_t MatchEmpty() const {
+			return ctrl & (~ctrl << 6) & MSBS;
+		}
+		/// @brief Matches the group's empty and deleted slots, which have the top bit set and bit 0 cleared.
+		/// @return A mask of the empty and deleted slots.
+		uint64_t MatchEmptyOrDeleted() const {
+			return ctrl & (~ctrl << 7) & MSBS;
+		}
+		/// @brief Matches the group's full slots, which have the top bit cleared.
+		/// @return A mask of the full slots.
+		uint64_t MatchFull() const {
+			return ~ctrl & MSBS;
+		}
+		/// @brief Matches the group's full slots and the sentinel.
+		/// @return A mask of the full slots and the sentinel.
+		uint64_t MatchFullOrSentinel() const {
+			return ~MatchEmptyOrDeleted() & MSBS;
+		}
+
+		static const uint64_t LSBS = 0x0101010101010101;
+		static const uint64_t MSBS = 0x8080808080808080;
+
+		uint64_t ctrl;
+#endif
+
+		/// @brief Gets the index in the group of the first slot in the given mask.
+		/// @param mask The mask to check, which must not be 0.
+		/// @return The slot's index in the group.
+		static size_t GetIndex(uint64_t mask) {
+			return HashGroupLowestBit(mask) >> MASK_SHIFT;
+		}
+		/// @brief Counts the empty and deleted slots at the start of the group, which iterators skip over at once.
+		/// @return The number of leading empty and deleted slots.
+		size_t CountLeadingEmptyOrDeleted() const {
+			uint64_t mask = MatchFullOrSentinel();
+			return mask ? GetIndex(mask) : WIDTH;
+		}
+	};
+
+	/// @brief Gets the control bytes used by hash tables with no slots. They hold the sentinel followed by empty slots, so that iterating over an empty table needs no special case.
+	/// @return A pointer to the shared control bytes.
+	WFE_INLINE const int8_t* GetEmptyHashControls() {
+		alignas(16) static const int8_t emptyControls[HashGroup::WIDTH] {
+			HASH_CONTROL_SENTINEL, HASH_CONTROL_EMPTY, HASH_CONTROL_EMPTY, HASH_CONTROL_EMPTY, HASH_CONTROL_EMPTY, HASH_CONTROL_EMPTY, HASH_CONTROL_EMPTY, HASH_CONTROL_EMPTY,
+#if defined(WFE_HASH_GROUP_SSE2)
+			HASH_CONTROL_EMPTY, HASH_CONTROL_EMPTY, HASH_CONTROL_EMPTY, HASH_CONTROL_EMPTY, HASH_CONTROL_EMPTY, HASH_CONTROL_EMPTY, HASH_CONTROL_EMPTY, HASH_CONTROL_EMPTY
+#endif
+		};
+
+		return emptyControls;
+	}
+}
\ No newline at end of file
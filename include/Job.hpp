@@ -1,16 +1,26 @@
 #pragma once
 
 #include "Defines.hpp"
+#include "Allocator.hpp"
+#include "AtomicQueue.hpp"
+#include "Exception.hpp"
 #include "Mutex.hpp"
 #include "Semaphore.hpp"
 #include "Thread.hpp"
-#include "UnorderedMap.hpp"
 
 namespace wfe {
+	/// @brief A job system that runs submitted jobs on a pool of worker threads. Every worker owns a job deque, from which other idle workers may steal. Jobs may depend on other jobs, forming job graphs.
 	class JobManager {
+	private:
+		struct Job;
+		struct JobSuccessor;
+		struct JobQueue;
+		struct WorkerInfo;
 	public:
 		/// @brief The function pointer type for a job's function.
 		typedef void*(*JobFunction)(void* args);
+		/// @brief The function pointer type for a parallel for loop's function, called for every chunk of the loop's range.
+		typedef void(*ParallelForFunction)(size_t begin, size_t end, void* args);
 
 		/// @brief A class that can retrieve a job's result once finished.
 		class Result {
@@ -36,49 +46,168 @@ namespace wfe {
 		private:
 			friend JobManager;
 
-			JobManager* manager;
-			size_t jobInd;
+			void Detach();
+
+			Job* job = nullptr;
 
 			Semaphore semaphore;
-			void* result;
+			void* result = nullptr;
 		};
 
 		/// @brief Creates a job manager.
 		/// @param threadCount The number of threads used by the job manager.
-		JobManager(size_t threadCount = 6);
+		/// @param pinThreads Whether to pin every worker thread to its own logical processor out of the ones the process may run on, keeping its cache warm. Ignored if there are more workers than allowed processors, and workers that can't be pinned run unpinned.
+		JobManager(size_t threadCount = 6, bool8_t pinThreads = false);
 		JobManager(const JobManager&) = delete;
 		JobManager(JobManager&) noexcept = delete;
 
 		JobManager& operator=(const JobManager&) = delete;
 		JobManager& operator=(JobManager&) = delete;
 
-		/// @brief Submits a job to be executed.
+		/// @brief Submits a job to be executed. Jobs submitted from one of the manager's worker threads are pushed to that worker's own deque, while other jobs are pushed to a lock-free queue shared by all workers.
 		/// @param func The function to call in the job.
 		/// @param args The args to call the job function with.
-		/// @param result A reference to the result variable which will be used to 
+		/// @param result A reference to the result variable which will be used to retrieve the job's result.
 		void SubmitJob(JobFunction func, void* args, Result& result);
+		/// @brief Submits a job that will only be executed once all of its dependencies have finished. No worker thread is blocked while the job waits for its dependencies.
+		/// @param func The function to call in the job.
+		/// @param args The args to call the job function with.
+		/// @param result A reference to the result variable which will be used to retrieve the job's result.
+		/// @param dependencyCount The number of jobs the new job depends on.
+		/// @param dependencies An array of pointers to the results of the jobs the new job depends on. Results that aren't attached to a job are ignored.
+		void SubmitJob(JobFunction func, void* args, Result& result, size_t dependencyCount, Result* const* dependencies);
+		/// @brief Submits multiple jobs to be executed at once. The entire batch is queued with one lock per worker queue and the workers are woken with a single signal.
+		/// @param jobCount The number of jobs to submit.
+		/// @param funcs An array of the functions to call in every job.
+		/// @param args An array of the args to call every job function with.
+		/// @param results An array of the result variables which will be used to retrieve every job's result.
+		void SubmitJobs(size_t jobCount, const JobFunction* funcs, void* const* args, Result* results);
+		/// @brief Submits a continuation job, which will be executed once the given job has finished.
+		/// @param dependency A reference to the result of the job to continue.
+		/// @param func The function to call in the continuation job.
+		/// @param args The args to call the continuation job function with.
+		/// @param result A reference to the result variable which will be used to retrieve the continuation job's result.
+		void SubmitContinuation(Result& dependency, JobFunction func, void* args, Result& result);
+
+		/// @brief Gets the number of threads used by the job manager.
+		/// @return The number of threads used by the job manager.
+		size_t GetThreadCount() const {
+			return threadCount;
+		}
 
-		/// @brief Destroys the job manager.
+		/// @brief Destroys the job manager. Every job that was already submitted is executed before the worker threads exit.
 		~JobManager();
+		/// @brief Runs the given function over the given range in parallel and waits for it to finish. The range is split into chunks whose size adapts to the remaining work, and the calling thread runs chunks and other queued jobs while it waits.
+		/// @param begin The beginning of the range.
+		/// @param end The end of the range.
+		/// @param grainSize The minimum number of indices in a chunk, or 0 to choose it based on the range's size and the thread count.
+		/// @param func The function to call for every chunk of the range.
+		/// @param args The args to call the function with.
+		void ParallelFor(size_t begin, size_t end, size_t grainSize, ParallelForFunction func, void* args);
+		/// @brief Calls the given function for every index in the given range in parallel and waits for it to finish.
+		/// @tparam Func The type of the function to call, which must be callable with a size_t index.
+		/// @param begin The beginning of the range.
+		/// @param end The end of the range.
+		/// @param grainSize The minimum number of indices in a chunk, or 0 to choose it based on the range's size and the thread count.
+		/// @param func The function to call for every index.
+		template<class Func>
+		void ParallelFor(size_t begin, size_t end, size_t grainSize, Func func) {
+			// Call the function for every index in every chunk
+			ParallelFor(begin, end, grainSize, [](size_t chunkBegin, size_t chunkEnd, void* args) {
+				Func& func = *(Func*)args;
+				for(size_t i = chunkBegin; i != chunkEnd; ++i)
+					func(i);
+			}, &func);
+		}
+		/// @brief Maps every index in the given range to a value and reduces all values in parallel.
+		/// @tparam T The type of the reduced value.
+		/// @tparam MapFunc The type of the map function, which must be callable with a size_t index and return a T.
+		/// @tparam ReduceFunc The type of the reduce function, which must be callable with two Ts and return a T. The function must be associative.
+		/// @param begin The beginning of the range.
+		/// @param end The end of the range.
+		/// @param grainSize The number of indices reduced sequentially in a chunk, or 0 to choose it based on the range's size and the thread count.
+		/// @param identity The identity value of the reduce function.
+		/// @param mapFunc The function that maps every index to a value.
+		/// @param reduceFunc The function that combines two values.
+		/// @return The reduced value.
+		template<class T, class MapFunc, class ReduceFunc>
+		T ParallelReduce(size_t begin, size_t end, size_t grainSize, const T& identity, MapFunc mapFunc, ReduceFunc reduceFunc) {
+			// Exit the function if the range is empty
+			if(begin >= end)
+				return identity;
+
+			// Choose a grain size that gives every thread a few chunks, if none was given
+			size_t count = end - begin;
+			if(!grainSize) {
+				grainSize = count / ((threadCount + 1) << 2);
+				if(!grainSize)
+					grainSize = 1;
+			}
+
+			// Reduce every chunk into its own partial value
+			struct ReduceInfo {
+				size_t begin;
+				size_t end;
+				size_t grainSize;
+				const T& identity;
+				MapFunc& mapFunc;
+				ReduceFunc& reduceFunc;
+				T* partials;
+			} info { begin, end, grainSize, identity, mapFunc, reduceFunc, nullptr };
+
+			size_t chunkCount = (count + grainSize - 1) / grainSize;
+			info.partials = (T*)AllocMemory(chunkCount * sizeof(T));
+			if(!info.partials)
+				throw BadAllocException("Failed to allocate parallel reduce partial values!");
+
+			ParallelFor(0, chunkCount, 1, [](size_t chunkBegin, size_t chunkEnd, void* args) {
+				ReduceInfo& info = *(ReduceInfo*)args;
+
+				for(size_t chunk = chunkBegin; chunk != chunkEnd; ++chunk) {
+					size_t indexBegin = info.begin + chunk * info.grainSize;
+					size_t indexEnd = (info.end - indexBegin > info.grainSize) ? indexBegin + info.grainSize : info.end;
+
+					T value = info.identity;
+					for(size_t i = indexBegin; i != indexEnd; ++i)
+						value = info.reduceFunc(value, info.mapFunc(i));
+
+					new(info.partials + chunk) T(value);
+				}
+			}, &info);
+
+			// Reduce the partial values in order
+			T value = identity;
+			for(size_t i = 0; i != chunkCount; ++i) {
+				value = reduceFunc(value, info.partials[i]);
+				info.partials[i].~T();
+			}
+
+			FreeMemory(info.partials);
+
+			return value;
+		}
 	private:
-		static void* JobThreadManager(void* args);
+		struct ParallelForInfo;
 
-		struct Job {
-			JobFunction func;
-			void* args;
-			Result* result;
+		static void* JobThreadManager(void* args);
+		static void* ParallelForJob(void* args);
+		static void RunParallelForChunks(ParallelForInfo* info);
 
-			size_t next;
-		};
+		Job* CreateJob(JobFunction func, void* args, Result* result, size_t dependencyCount);
+		void QueueJobs(size_t jobCount, Job* const* jobs);
+		void PushJobs(size_t queueInd, size_t jobCount, Job* const* jobs);
+		bool8_t TryRunQueuedJob();
+		Job* PopJob(size_t workerInd, bool8_t blocking = false);
+		void RunJob(Job* job);
 
 	 	size_t threadCount;
 		Thread* threads;
-		
-		size_t jobCapacity;
-		Job* jobList;
-		size_t queueFront, queueBack;
-		size_t freeList;
-		AtomicMutex queueMutex;
+		WorkerInfo* workerInfos;
+		JobQueue* queues;
+
+		AtomicQueue<Job*> injectionQueue;
+		atomic_size_t nextQueue;
+		atomic_uint8_t stopping;
 		Semaphore jobQueueSemaphore;
 	};
-}
\ No newline at end of file
+}
@@ -4,8 +4,10 @@
 #include "Allocator.hpp"
 #include "Debug.hpp"
 #include "Exception.hpp"
+#include "EytzingerIndex.hpp"
 #include "Memory.hpp"
 #include "Pair.hpp"
+#include "Sort.hpp"
 #include <initializer_list>
 #include <map>
 
@@ -39,9 +41,12 @@ namespace wfe {
 
 		/// @brief Creates an empty map.
 		constexpr map() = default;
+		/// @brief Creates an empty map that allocates its memory from the given resource.
+		/// @param resource The memory resource to allocate from. It must outlive the map.
+		explicit map(MemoryResource& resource) : memoryResource(&resource) { }
 		/// @brief Copies the given map.
 		/// @param other The map to copy.
-		map(const map& other) : mapSize(other.mapSize), mapCapacity(other.mapCapacity), mapData(AllocMemory(mapCapacity * sizeof(value_type))) {
+		map(const map& other) : mapSize(other.mapSize), mapCapacity(other.mapCapacity), mapData(AllocMemory(memoryResource, mapCapacity * sizeof(value_type))) {
 			// Check if the memory was allocated correctly
 			if(mapCapacity && !mapData)
 				throw BadAllocException("Failed to allocate map data!");
@@ -55,9 +60,12 @@ namespace wfe {
 		}
 		/// @brief Moves the given map's contents.
 		/// @param other The map whose contents to move.
-		map(map&& other) noexcept : mapSize(other.mapSize), mapCapacity(other.mapCapacity), mapData(other.mapData) {
+		map(map&& other) noexcept : memoryResource(other.memoryResource), mapSize(other.mapSize), mapCapacity(other.mapCapacity), mapData(other.mapData) {
 			// Unlink the data from the given map
 			other.mapData = nullptr;
+
+			// Take the given map's frozen index
+			mapIndex.Swap(other.mapIndex);
 		}
 		/// @brief Copies every value from the given list.
 		/// @param list The map to copy from.
@@ -72,7 +80,7 @@ namespace wfe {
 			mapCapacity <<= 1;
 
 			// Allocate the map's memory
-			mapData = (pointer)AllocMemory(mapCapacity * sizeof(value_type));
+			mapData = (pointer)AllocMemory(memoryResource, mapCapacity * sizeof(value_type));
 
 			if(mapCapacity && !mapData)
 				throw BadAllocException("Failed to allocate map data!");
@@ -118,7 +126,7 @@ namespace wfe {
 			mapCapacity <<= 1;
 
 			// Allocate the map's memory
-			mapData = AllocMemory(mapCapacity * sizeof(value_type));
+			mapData = AllocMemory(memoryResource, mapCapacity * sizeof(value_type));
 
 			if(mapCapacity && !mapData)
 				throw BadAllocException("Failed to allocate map data!");
@@ -138,6 +146,9 @@ namespace wfe {
 			if(&other == this)
 				return *this;
 			
+			// Thaw the map, since its frozen index won't match the new values
+			thaw();
+
 			if(mapSize) {
 				// Destruct the map's values
 				pointer end = mapData + mapSize;
@@ -146,13 +157,13 @@ namespace wfe {
 					ptr->~value_type();
 				
 				// Free the map's memory
-				FreeMemory(mapData);
+				FreeMemory(memoryResource, mapData);
 			}
 
 			// Set the map's new values
 			mapSize = other.mapSize;
 			mapCapacity = other.mapCapacity;
-			mapData = (pointer)AllocMemory(mapCapacity * sizeof(value_type));
+			mapData = (pointer)AllocMemory(memoryResource, mapCapacity * sizeof(value_type));
 
 			// Check if the memory was allocated correctly
 			if(mapCapacity && !mapData)
@@ -171,6 +182,9 @@ namespace wfe {
 		/// @param other The map to move from.
 		/// @return A reference to this map.
 		map& operator=(map&& other) {
+			// Thaw the map, since its frozen index won't match the new values
+			thaw();
+
 			if(mapSize) {
 				// Destruct the map's values
 				pointer end = mapData + mapSize;
@@ -179,10 +193,11 @@ namespace wfe {
 					ptr->~value_type();
 				
 				// Free the map's memory
-				FreeMemory(mapData);
+				FreeMemory(memoryResource, mapData);
 			}
 
 			// Set the map's new values
+			memoryResource = other.memoryResource;
 			mapSize = other.mapSize;
 			mapCapacity = other.mapCapacity;
 			mapData = other.mapData;
@@ -190,12 +205,18 @@ namespace wfe {
 			// Unlink the data from the given map
 			other.mapData = nullptr;
 
+			// Take the given map's frozen index
+			mapIndex.Swap(other.mapIndex);
+
 			return *this;
 		}
 		/// @brief Copies the items from the given list into this map.
 		/// @param list The list to copy from.
 		/// @return A reference to this map.
 		map& operator=(std::initializer_list<value_type> list) {
+			// Thaw the map, since its frozen index won't match the new values
+			thaw();
+
 			if(mapSize) {
 				// Destruct the map's values
 				pointer end = mapData + mapSize;
@@ -204,7 +225,7 @@ namespace wfe {
 					ptr->~value_type();
 				
 				// Free the map's memory
-				FreeMemory(mapData);
+				FreeMemory(memoryResource, mapData);
 			}
 
 			// Set the map's new values
@@ -221,7 +242,7 @@ namespace wfe {
 			mapCapacity <<= 1;
 
 			// Allocate the map's memory
-			mapData = AllocMemory(mapCapacity * sizeof(value_type));
+			mapData = AllocMemory(memoryResource, mapCapacity * sizeof(value_type));
 
 			if(mapCapacity && !mapData)
 				throw BadAllocException("Failed to allocate map data!");
@@ -285,6 +306,9 @@ namespace wfe {
 			if(pos != mapSize && Equal()(mapData[pos].first, key))
 				return mapData[pos].second;
 			
+			// Thaw the map, since its frozen index won't match the changed values
+			thaw();
+
 			// Increment the map's size
 			++mapSize;
 
@@ -302,9 +326,9 @@ namespace wfe {
 
 				// Reallocate the set's memory
 				if(!mapData) {
-					mapData = (pointer)AllocMemory(mapCapacity * sizeof(value_type));
+					mapData = (pointer)AllocMemory(memoryResource, mapCapacity * sizeof(value_type));
 				} else {
-					mapData = (pointer)ReallocMemory(mapData, mapCapacity * sizeof(value_type));
+					mapData = (pointer)ReallocMemory(memoryResource, mapData, mapCapacity * sizeof(value_type));
 				}
 				
 				// Check if the memory was allocated correctly
@@ -340,6 +364,9 @@ namespace wfe {
 			if(pos != mapSize && Equal()(mapData[pos].first, key))
 				return mapData[pos].second;
 			
+			// Thaw the map, since its frozen index won't match the changed values
+			thaw();
+
 			// Increment the map's size
 			++mapSize;
 
@@ -357,9 +384,9 @@ namespace wfe {
 
 				// Reallocate the set's memory
 				if(!mapData) {
-					mapData = (pointer)AllocMemory(mapCapacity * sizeof(value_type));
+					mapData = (pointer)AllocMemory(memoryResource, mapCapacity * sizeof(value_type));
 				} else {
-					mapData = (pointer)ReallocMemory(mapData, mapCapacity * sizeof(value_type));
+					mapData = (pointer)ReallocMemory(memoryResource, mapData, mapCapacity * sizeof(value_type));
 				}
 				
 				// Check if the memory was allocated correctly
@@ -379,17 +406,8 @@ namespace wfe {
 		/// @param key The key to look for.
 		/// @return A reference to the wanted value.
 		mapped_type& at(const key_type& key) {
-			// Set the bynary search step to the highest power of 2 lower than or equal to the map's size
-			size_type step = 1;
-			for(size_type stepStep = sizeof(size_type) << 2; stepStep; stepStep >>= 1)
-				if((step << stepStep) <= mapSize)
-					step <<= stepStep;
-			
-			// Find the wanted value
-			size_type pos = mapSize;
-			for(; step; step >>= 1)
-				if(pos >= step && !Lower()(mapData[pos - step].first, key))
-					pos -= step;
+			// Find the wanted pair
+			size_type pos = SearchLowerBound(key);
 			
 			// Assert that the wanted value must exist in the map
 			WFE_ASSERT(pos != mapSize && Equal()(mapData[pos].first, key), "The wanted value must exist in the set!")
@@ -400,17 +418,8 @@ namespace wfe {
 		/// @param key The key to look for.
 		/// @return A reference to the wanted value.
 		const mapped_type& at(const key_type& key) const {
-			// Set the bynary search step to the highest power of 2 lower than or equal to the map's size
-			size_type step = 1;
-			for(size_type stepStep = sizeof(size_type) << 2; stepStep; stepStep >>= 1)
-				if((step << stepStep) <= mapSize)
-					step <<= stepStep;
-			
-			// Find the wanted value
-			size_type pos = mapSize;
-			for(; step; step >>= 1)
-				if(pos >= step && !Lower()(mapData[pos - step].first, key))
-					pos -= step;
+			// Find the wanted pair
+			size_type pos = SearchLowerBound(key);
 			
 			// Assert that the wanted value must exist in the map
 			WFE_ASSERT(pos != mapSize && Equal()(mapData[pos].first, key), "The wanted value must exist in the set!")
@@ -438,6 +447,9 @@ namespace wfe {
 			if(pos != mapSize && Equal()(mapData[pos].first, val.first))
 				return { mapData + pos, false };
 			
+			// Thaw the map, since its frozen index won't match the changed values
+			thaw();
+
 			// Increment the map's size
 			++mapSize;
 
@@ -455,9 +467,9 @@ namespace wfe {
 
 				// Reallocate the set's memory
 				if(!mapData) {
-					mapData = (pointer)AllocMemory(mapCapacity * sizeof(value_type));
+					mapData = (pointer)AllocMemory(memoryResource, mapCapacity * sizeof(value_type));
 				} else {
-					mapData = (pointer)ReallocMemory(mapData, mapCapacity * sizeof(value_type));
+					mapData = (pointer)ReallocMemory(memoryResource, mapData, mapCapacity * sizeof(value_type));
 				}
 				
 				// Check if the memory was allocated correctly
@@ -493,6 +505,9 @@ namespace wfe {
 			if(pos != mapSize && Equal()(mapData[pos].first, val.first))
 				return { mapData + pos, false };
 			
+			// Thaw the map, since its frozen index won't match the changed values
+			thaw();
+
 			// Increment the map's size
 			++mapSize;
 
@@ -510,9 +525,9 @@ namespace wfe {
 
 				// Reallocate the set's memory
 				if(!mapData) {
-					mapData = (pointer)AllocMemory(mapCapacity * sizeof(value_type));
+					mapData = (pointer)AllocMemory(memoryResource, mapCapacity * sizeof(value_type));
 				} else {
-					mapData = (pointer)ReallocMemory(mapData, mapCapacity * sizeof(value_type));
+					mapData = (pointer)ReallocMemory(memoryResource, mapData, mapCapacity * sizeof(value_type));
 				}
 				
 				// Check if the memory was allocated correctly
@@ -543,6 +558,9 @@ namespace wfe {
 				// Save the position hint's index relative to the map's data
 				size_type posInd = pos - mapData;
 
+				// Thaw the map, since its frozen index won't match the changed values
+				thaw();
+
 				// Increment the map's size
 				++mapSize;
 
@@ -560,9 +578,9 @@ namespace wfe {
 
 					// Reallocate the set's memory
 					if(!mapData) {
-						mapData = (pointer)AllocMemory(mapCapacity * sizeof(value_type));
+						mapData = (pointer)AllocMemory(memoryResource, mapCapacity * sizeof(value_type));
 					} else {
-						mapData = (pointer)ReallocMemory(mapData, mapCapacity * sizeof(value_type));
+						mapData = (pointer)ReallocMemory(memoryResource, mapData, mapCapacity * sizeof(value_type));
 					}
 					
 					// Check if the memory was allocated correctly
@@ -612,6 +630,9 @@ namespace wfe {
 			if(posInd != mapSize && Equal()(mapData[posInd].first, val.first))
 				return mapData + posInd;
 			
+			// Thaw the map, since its frozen index won't match the changed values
+			thaw();
+
 			// Increment the map's size
 			++mapSize;
 
@@ -629,9 +650,9 @@ namespace wfe {
 
 				// Reallocate the set's memory
 				if(!mapData) {
-					mapData = (pointer)AllocMemory(mapCapacity * sizeof(value_type));
+					mapData = (pointer)AllocMemory(memoryResource, mapCapacity * sizeof(value_type));
 				} else {
-					mapData = (pointer)ReallocMemory(mapData, mapCapacity * sizeof(value_type));
+					mapData = (pointer)ReallocMemory(memoryResource, mapData, mapCapacity * sizeof(value_type));
 				}
 				
 				// Check if the memory was allocated correctly
@@ -662,6 +683,9 @@ namespace wfe {
 				// Save the position hint's index relative to the map's data
 				size_type posInd = pos - mapData;
 
+				// Thaw the map, since its frozen index won't match the changed values
+				thaw();
+
 				// Increment the map's size
 				++mapSize;
 
@@ -679,9 +703,9 @@ namespace wfe {
 
 					// Reallocate the set's memory
 					if(!mapData) {
-						mapData = (pointer)AllocMemory(mapCapacity * sizeof(value_type));
+						mapData = (pointer)AllocMemory(memoryResource, mapCapacity * sizeof(value_type));
 					} else {
-						mapData = (pointer)ReallocMemory(mapData, mapCapacity * sizeof(value_type));
+						mapData = (pointer)ReallocMemory(memoryResource, mapData, mapCapacity * sizeof(value_type));
 					}
 					
 					// Check if the memory was allocated correctly
@@ -731,6 +755,9 @@ namespace wfe {
 			if(posInd != mapSize && Equal()(mapData[posInd].first, val.first))
 				return mapData + posInd;
 			
+			// Thaw the map, since its frozen index won't match the changed values
+			thaw();
+
 			// Increment the map's size
 			++mapSize;
 
@@ -748,9 +775,9 @@ namespace wfe {
 
 				// Reallocate the set's memory
 				if(!mapData) {
-					mapData = (pointer)AllocMemory(mapCapacity * sizeof(value_type));
+					mapData = (pointer)AllocMemory(memoryResource, mapCapacity * sizeof(value_type));
 				} else {
-					mapData = (pointer)ReallocMemory(mapData, mapCapacity * sizeof(value_type));
+					mapData = (pointer)ReallocMemory(memoryResource, mapData, mapCapacity * sizeof(value_type));
 				}
 				
 				// Check if the memory was allocated correctly
@@ -782,6 +809,83 @@ namespace wfe {
 			for(const_pointer ptr = list.begin() + 1; ptr != end; ++ptr)
 				posHint = insert(posHint, *ptr);
 		}
+		/// @brief Replaces the map's contents with the pairs from the given unsorted range. The pairs are copied, sorted and deduplicated in O(n log n), instead of shifting the map for every insertion. The first of every pair with the same key is kept.
+		/// @param first A pointer to the range's first pair.
+		/// @param last A pointer to right after the range's last pair.
+		/// @param jobManager The job manager to sort large ranges on in parallel, or a nullptr to sort on the calling thread.
+		void assign_unsorted(const_pointer first, const_pointer last, JobManager* jobManager = nullptr) {
+			// Destruct the map's old values
+			clear();
+
+			// Assert that the map's size must be lower than the maximum possible size
+			size_type count = last - first;
+			WFE_ASSERT(count < max_size(), "The map's size must be lower than the maximum possible size!")
+
+			// Check if memory needs to be reallocated
+			if(count > mapCapacity) {
+				// Set the map's capacity to the lowest power of 2 higher than or equal to the range's size
+				mapCapacity = 1;
+				for(size_type step = sizeof(size_type) << 2; step; step >>= 1)
+					if((mapCapacity << step) < count)
+						mapCapacity <<= step;
+				mapCapacity <<= 1;
+
+				// Reallocate the map's memory
+				if(!mapData) {
+					mapData = (pointer)AllocMemory(memoryResource, mapCapacity * sizeof(value_type));
+				} else {
+					mapData = (pointer)ReallocMemory(memoryResource, mapData, mapCapacity * sizeof(value_type));
+				}
+
+				// Check if the memory was allocated correctly
+				if(mapCapacity && !mapData)
+					throw BadAllocException("Failed to allocate map data!");
+			}
+
+			// Copy every pair from the range
+			pointer end = mapData + count;
+			const_pointer ptr2 = first;
+
+			for(pointer ptr = mapData; ptr != end; ++ptr)
+				new(ptr) value_type(*ptr2++);
+
+			// Sort the pairs, keeping equal pairs in their original order, and remove the duplicates
+			SortPairs(mapData, count, jobManager);
+			mapSize = RemoveDuplicatePairs(mapData, count);
+		}
+		/// @brief Inserts every pair from the given unsorted range. The range is copied, sorted and deduplicated in O(k log k) and then merged with the map in linear time, instead of shifting the map for every insertion. Pairs whose keys are already in the map aren't inserted, and the first of every pair with the same key in the range is kept.
+		/// @param first A pointer to the range's first pair.
+		/// @param last A pointer to right after the range's last pair.
+		/// @param jobManager The job manager to sort large ranges on in parallel, or a nullptr to sort on the calling thread.
+		void insert_range(const_pointer first, const_pointer last, JobManager* jobManager = nullptr) {
+			// Exit the function if the given range is empty
+			size_type count = last - first;
+			if(!count)
+				return;
+
+			// Copy every pair from the range
+			pointer values = (pointer)AllocMemory(memoryResource, count * sizeof(value_type));
+			if(!values)
+				throw BadAllocException("Failed to allocate map data!");
+
+			pointer end = values + count;
+			const_pointer ptr2 = first;
+
+			for(pointer ptr = values; ptr != end; ++ptr)
+				new(ptr) value_type(*ptr2++);
+
+			// Sort the pairs, keeping equal pairs in their original order, and remove the duplicates
+			SortPairs(values, count, jobManager);
+			count = RemoveDuplicatePairs(values, count);
+
+			// Merge the pairs into the map, destructing the ones that weren't inserted
+			end = values + MergePairs(values, count);
+
+			for(pointer ptr = values; ptr != end; ++ptr)
+				ptr->~value_type();
+
+			FreeMemory(memoryResource, values);
+		}
 		/// @brief Erases the pair at the given position.
 		/// @param pos The position to erase from.
 		/// @return A pointer to the space occupied by the erased pair.
@@ -789,6 +893,9 @@ namespace wfe {
 			// Assert that the given pointer must be in range
 			WFE_ASSERT(pos >= begin() && pos < end(), "The given pointer must be in range!")
 
+			// Thaw the map, since its frozen index won't match the changed values
+			thaw();
+
 			// Decrement the map's size
 			--mapSize;
 			
@@ -820,6 +927,9 @@ namespace wfe {
 			if(pos == mapSize || !Equal()(mapData[pos].first, key))
 				return 0;
 			
+			// Thaw the map, since its frozen index won't match the changed values
+			thaw();
+
 			// Decrement the map's size
 			--mapSize;
 
@@ -852,11 +962,27 @@ namespace wfe {
 			// Move part of the map backwards to erase the pairs from the given range
 			wfe::memcpy((pointer)first, last, (mapData + mapSize - last) * sizeof(size_type));
 
+			// Thaw the map, since its frozen index won't match the changed values
+			thaw();
+
 			// Decrease the map's size by the erased size
 			mapSize -= erasedSize;
 
 			return (pointer)first;
 		}
+		/// @brief Moves every pair from the given map into this map in linear time, walking both sorted maps at once. Pairs whose keys are already in this map stay in the given map.
+		/// @param other The map to merge from.
+		void merge(map& other) {
+			// Exit the function if the given map is the same as this map
+			if(&other == this)
+				return;
+
+			// Thaw the given map, since its frozen index won't match its remaining values
+			other.thaw();
+
+			// Merge the given map's pairs, leaving the ones that weren't moved in it
+			other.mapSize = MergePairs(other.mapData, other.mapSize);
+		}
 		/// @brief Swaps the two map's contents.
 		/// @param other The map to swap with.
 		void swap(map& other) {
@@ -865,19 +991,25 @@ namespace wfe {
 				return;
 			
 			// Save this map's values
+			MemoryResource* auxMemoryResource = memoryResource;
 			size_type auxSize = mapSize;
 			size_type auxCapacity = mapCapacity;
 			pointer auxData = mapData;
 
 			// Set this map's new values
+			memoryResource = other.memoryResource;
 			mapSize = other.mapSize;
 			mapCapacity = other.mapCapacity;
 			mapData = other.mapData;
 
 			// Set the given map's new values
+			other.memoryResource = auxMemoryResource;
 			other.mapSize = auxSize;
 			other.mapCapacity = auxCapacity;
 			other.mapData = auxData;
+
+			// Swap the two maps' frozen indices
+			mapIndex.Swap(other.mapIndex);
 		}
 		/// @brief Clears the map's contents.
 		void clear() noexcept {
@@ -888,6 +1020,9 @@ namespace wfe {
 					ptr->~value_type();
 			}
 
+			// Thaw the map, since its frozen index won't match the changed values
+			thaw();
+
 			// Set the map's size to 0
 			mapSize = 0;
 		}
@@ -958,17 +1093,8 @@ namespace wfe {
 		/// @param key The key whose pair to look for.
 		/// @return A pointer to the wanted pair, or map::end() if it doesn't exist.
 		pointer find(const key_type& key) {
-			// Set the binary search's step to the highest power of 2 lower than or equal to the map's size
-			size_type step = 1;
-			for(size_type stepStep = sizeof(size_type) << 2; stepStep; stepStep >>= 1)
-				if((step << stepStep) <= mapSize)
-					step <<= stepStep;
-			
 			// Find the wanted pair
-			size_type pos = mapSize;
-			for(; step; step >>= 1)
-				if(pos >= step && !Lower()(mapData[pos - step].first, key))
-					pos -= step;
+			size_type pos = SearchLowerBound(key);
 			
 			// Check if the wanted pair exists
 			if(pos != mapSize && Equal()(mapData[pos].first, key))
@@ -980,17 +1106,8 @@ namespace wfe {
 		/// @param key The key whose pair to look for.
 		/// @return A const pointer to the wanted pair, or map::end() if it doesn't exist.
 		const_pointer find(const key_type& key) const {
-			// Set the binary search's step to the highest power of 2 lower than or equal to the map's size
-			size_type step = 1;
-			for(size_type stepStep = sizeof(size_type) << 2; stepStep; stepStep >>= 1)
-				if((step << stepStep) <= mapSize)
-					step <<= stepStep;
-			
 			// Find the wanted pair
-			size_type pos = mapSize;
-			for(; step; step >>= 1)
-				if(pos >= step && !Lower()(mapData[pos - step].first, key))
-					pos -= step;
+			size_type pos = SearchLowerBound(key);
 			
 			// Check if the wanted pair exists
 			if(pos != mapSize && Equal()(mapData[pos].first, key))
@@ -1002,36 +1119,18 @@ namespace wfe {
 		/// @param key THe key whose pairs to look for.
 		/// @return The number of wanted pairs.
 		size_type count(const key_type& key) const {
-			// Set the binary search's step to the highest power of 2 lower than or equal to the map's size
-			size_type step = 1;
-			for(size_type stepStep = sizeof(size_type) << 2; stepStep; stepStep >>= 1)
-				if((step << stepStep) <= mapSize)
-					step <<= stepStep;
-			
 			// Find the wanted pair
-			size_type pos = mapSize;
-			for(; step; step >>= 1)
-				if(pos >= step && !Lower()(mapData[pos - step].first < key))
-					pos -= step;
+			size_type pos = SearchLowerBound(key);
 			
 			// Check if the wanted pair exists
-			return pos != mapSize && Equal()(mapData[pos], key);
+			return pos != mapSize && Equal()(mapData[pos].first, key);
 		}
 		/// @brief Finds the first pair whose key isn't lower than the given key.
 		/// @param key The key to compare with.
 		/// @return A pointer to the wanted pair, or map::end() if it doesn't exist.
 		pointer lower_bound(const key_type& key) {
-			// Set the binary search's step to the highest power of 2 lower than or equal to the map's size
-			size_type step = 1;
-			for(size_type stepStep = sizeof(size_type) << 2; stepStep; stepStep >>= 1)
-				if((step << stepStep) <= mapSize)
-					step <<= stepStep;
-			
 			// Find the wanted pair
-			size_type pos = mapSize;
-			for(; step; step >>= 1)
-				if(pos >= step && !Lower()(mapData[pos - step].first, key))
-					pos -= step;
+			size_type pos = SearchLowerBound(key);
 			
 			return mapData + pos;
 		}
@@ -1039,17 +1138,8 @@ namespace wfe {
 		/// @param key The key to compare with.
 		/// @return A const pointer to the wanted pair, or map::end() if it doesn't exist.
 		const_pointer lower_bound(const key_type& key) const {
-			// Set the binary search's step to the highest power of 2 lower than or equal to the map's size
-			size_type step = 1;
-			for(size_type stepStep = sizeof(size_type) << 2; stepStep; stepStep >>= 1)
-				if((step << stepStep) <= mapSize)
-					step <<= stepStep;
-			
 			// Find the wanted pair
-			size_type pos = mapSize;
-			for(; step; step >>= 1)
-				if(pos >= step && !Lower()(mapData[pos - step].first, key))
-					pos -= step;
+			size_type pos = SearchLowerBound(key);
 			
 			return mapData + pos;
 		}
@@ -1057,17 +1147,8 @@ namespace wfe {
 		/// @param key The key to compare with.
 		/// @return A pointer to the wanted pair, or map::end() if it doesn't exist.
 		pointer upper_bound(const key_type& key) {
-			// Set the binary search's step to the highest power of 2 lower than or equal to the map's size
-			size_type step = 1;
-			for(size_type stepStep = sizeof(size_type) << 2; stepStep; stepStep >>= 1)
-				if((step << stepStep) <= mapSize)
-					step <<= stepStep;
-			
 			// Find the wanted pair
-			size_type pos = mapSize;
-			for(; step; step >>= 1)
-				if(pos >= step && Lower()(key, mapData[pos - step].first))
-					pos -= step;
+			size_type pos = SearchUpperBound(key);
 			
 			return mapData + pos;
 		}
@@ -1075,17 +1156,8 @@ namespace wfe {
 		/// @param key The key to compare with.
 		/// @return A const pointer to the wanted pair, or map::end() if it doesn't exist.
 		const_pointer upper_bound(const key_type& key) const {
-			// Set the binary search's step to the highest power of 2 lower than or equal to the map's size
-			size_type step = 1;
-			for(size_type stepStep = sizeof(size_type) << 2; stepStep; stepStep >>= 1)
-				if((step << stepStep) <= mapSize)
-					step <<= stepStep;
-			
 			// Find the wanted pair
-			size_type pos = mapSize;
-			for(; step; step >>= 1)
-				if(pos >= step && Lower()(key, mapData[pos - step].first))
-					pos -= step;
+			size_type pos = SearchUpperBound(key);
 			
 			return mapData + pos;
 		}
@@ -1126,6 +1198,27 @@ namespace wfe {
 			return range;
 		}
 
+		/// @brief Freezes the map, building a read-only copy of its keys in Eytzinger (breadth first) order, which find, count, at, lower_bound, upper_bound and equal_range search instead of the sorted pairs. This makes lookups in large maps several times faster, at the cost of another copy of the keys. Inserting or erasing pairs thaws the map.
+		void freeze() {
+			// Build the index from the map's sorted keys
+			mapIndex.Build(memoryResource, mapSize ? &mapData->first : nullptr, mapSize, sizeof(value_type));
+		}
+		/// @brief Thaws the map, freeing its frozen index.
+		void thaw() {
+			mapIndex.Clear();
+		}
+		/// @brief Tests if the map is frozen.
+		/// @return True if the map is frozen and not empty, otherwise false.
+		bool8_t is_frozen() const {
+			return mapIndex.IsBuilt();
+		}
+
+		/// @brief Gets the memory resource the map allocates its memory from.
+		/// @return A pointer to the map's memory resource, or a nullptr if it allocates from the heap.
+		MemoryResource* get_memory_resource() const {
+			return memoryResource;
+		}
+
 		/// @brief Destroys the map.
 		~map() {
 			if(mapData) {
@@ -1136,12 +1229,141 @@ namespace wfe {
 					ptr->~value_type();
 				
 				// Free the map's memory
-				FreeMemory(mapData);
+				FreeMemory(memoryResource, mapData);
 			}
 		}
 	private:
+		struct PairLower {
+			bool8_t operator()(const value_type& pair1, const value_type& pair2) const {
+				return Lower()(pair1.first, pair2.first);
+			}
+		};
+
+		void SortPairs(pointer values, size_type count, JobManager* jobManager) {
+			if(jobManager) {
+				ParallelSort<value_type, PairLower>(*jobManager, values, count, memoryResource);
+			} else {
+				Sort<value_type, PairLower>(values, count, memoryResource);
+			}
+		}
+		size_type RemoveDuplicatePairs(pointer values, size_type count) {
+			// Exit the function if there are no pairs
+			if(!count)
+				return 0;
+
+			// Keep the first pair of every run of equal keys, moving it right after the last kept pair
+			pointer last = values;
+			pointer end = values + count;
+
+			for(pointer ptr = values + 1; ptr != end; ++ptr) {
+				if(Equal()(last->first, ptr->first)) {
+					ptr->~value_type();
+				} else if(++last != ptr) {
+					RelocateValue(last, ptr);
+				}
+			}
+
+			return last - values + 1;
+		}
+		size_type MergePairs(pointer values, size_type count) {
+			// Exit the function if there are no pairs to merge
+			if(!count)
+				return 0;
+
+			// Thaw the map, since its frozen index won't match the merged values
+			thaw();
+
+			// Assert that the map's size must be lower than the maximum possible size
+			WFE_ASSERT(mapSize + count < max_size(), "The map's size must be lower than the maximum possible size!")
+
+			// Set the merged map's capacity to the lowest power of 2 higher than or equal to its maximum size
+			size_type newCapacity = 1;
+			for(size_type step = sizeof(size_type) << 2; step; step >>= 1)
+				if((newCapacity << step) < mapSize + count)
+					newCapacity <<= step;
+			newCapacity <<= 1;
+
+			// Allocate the merged map's memory
+			pointer newData = (pointer)AllocMemory(memoryResource, newCapacity * sizeof(value_type));
+			if(!newData)
+				throw BadAllocException("Failed to allocate map data!");
+
+			// Take the lower pair from either side, moving the given pairs that are already in the map to the start of the given pairs
+			pointer ptr1 = mapData;
+			pointer end1 = mapData + mapSize;
+			pointer ptr2 = values;
+			pointer end2 = values + count;
+			pointer dest = newData;
+			pointer rejected = values;
+
+			while(ptr1 != end1 && ptr2 != end2) {
+				if(Lower()(ptr2->first, ptr1->first)) {
+					RelocateValue(dest++, ptr2++);
+				} else {
+					if(!Lower()(ptr1->first, ptr2->first)) {
+						if(rejected != ptr2)
+							RelocateValue(rejected, ptr2);
+						++rejected;
+						++ptr2;
+					}
+
+					RelocateValue(dest++, ptr1++);
+				}
+			}
+
+			// Move the pairs left on either side
+			wfe::memcpy(dest, ptr1, (end1 - ptr1) * sizeof(value_type));
+			dest += end1 - ptr1;
+			wfe::memcpy(dest, ptr2, (end2 - ptr2) * sizeof(value_type));
+			dest += end2 - ptr2;
+
+			// Replace the map's memory with the merged pairs
+			if(mapData)
+				FreeMemory(memoryResource, mapData);
+
+			mapData = newData;
+			mapSize = dest - newData;
+			mapCapacity = newCapacity;
+
+			return rejected - values;
+		}
+		size_type SearchLowerBound(const key_type& key) const {
+			// Search the frozen index, if the map has one
+			if(mapIndex.IsBuilt())
+				return mapIndex.LowerBound(key);
+
+			// Halve the searched range until one pair is left, choosing each half without branching
+			const_pointer base = mapData;
+			size_type size = mapSize;
+			while(size > 1) {
+				size_type half = size >> 1;
+				base = Lower()(base[half].first, key) ? base + half : base;
+				size -= half;
+			}
+
+			return (base - mapData) + (size && Lower()(base->first, key));
+		}
+		size_type SearchUpperBound(const key_type& key) const {
+			// Search the frozen index, if the map has one
+			if(mapIndex.IsBuilt())
+				return mapIndex.UpperBound(key);
+
+			// Halve the searched range until one pair is left, choosing each half without branching
+			const_pointer base = mapData;
+			size_type size = mapSize;
+			while(size > 1) {
+				size_type half = size >> 1;
+				base = !Lower()(key, base[half].first) ? base + half : base;
+				size -= half;
+			}
+
+			return (base - mapData) + (size && !Lower()(key, base->first));
+		}
+
+		MemoryResource* memoryResource = nullptr;
 		size_type mapSize = 0;
 		size_type mapCapacity = 0;
 		pointer mapData = 0;
+		EytzingerIndex<key_type, Lower> mapIndex;
 	};
 }
\ No newline at end of file
@@ -116,6 +116,13 @@ namespace wfe {
 	/// @return A random floating point number in the given range.
 	float32_t RandomFloatInRange(float32_t min, float32_t max);
 
+	/// @brief Hashes the given memory block. Strings hashed through Hash<string> and Hash<const char_t*> give the same result as their characters hashed with a seed of 0.
+	/// @param data A pointer to the memory block.
+	/// @param size The size of the memory block.
+	/// @param seed The seed to hash the block with. Different seeds give unrelated hashes.
+	/// @return A 64-bit hash of the memory block.
+	uint64_t HashMemory(const void* data, size_t size, uint64_t seed = 0);
+
 	/// @brief A function struct hsed for hashing a specific type.
 	/// @tparam T The type of the values to hash.
 	template<class T>
@@ -125,6 +132,14 @@ namespace wfe {
 		/// @return A 64-bit hash of the given value.
 		uint64_t operator()(const T& val) const;
 	};
+	/// @brief Checks if the given hash and comparison function structs both accept keys of other types, which they mark by defining an is_transparent type. Hash containers with such function structs can look up keys without converting them to the key type.
+	/// @tparam KeyHash The function struct used for hashing keys.
+	/// @tparam Equal The function struct used for comparing keys.
+	template<class KeyHash, class Equal>
+	concept TransparentHash = requires {
+		typename KeyHash::is_transparent;
+		typename Equal::is_transparent;
+	};
 
 	/// @brief Combines the two given hashes.
 	/// @param hash1 The first hash to combine.
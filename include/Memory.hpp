@@ -170,4 +170,8 @@ namespace wfe {
 	/// @param size The maximum number of characters to compare.
 	/// @return The length of the string.
 	size_t strnlen(const char_t* str, size_t size);
+
+	/// @brief Forces the memory functions to use their SSE2 kernels, even if the CPU supports AVX2. Only meant for testing the SSE2 kernels, and has no effect on CPUs the memory functions have no SIMD kernels for.
+	/// @param forced True to force the SSE2 kernels, or false to use the best kernels supported by the CPU again.
+	void SetSSE2MemoryKernelsForced(bool8_t forced);
 }
\ No newline at end of file
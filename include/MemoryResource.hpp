@@ -0,0 +1,27 @@
+#pragma once
+
+#include "Defines.hpp"
+
+namespace wfe {
+	/// @brief An interface for memory sources that containers can allocate their storage from, instead of the global heap.
+	class MemoryResource {
+	public:
+		/// @brief Allocates a memory block from the resource.
+		/// @param size The size of the memory block.
+		/// @param alignment The alignment of the memory block, which must be a power of two.
+		/// @return A pointer to the resulting memory block, or a nullptr if the block couldn't be allocated.
+		virtual void* Alloc(size_t size, size_t alignment) = 0;
+		/// @brief Reallocates the given memory block.
+		/// @param mem The memory block to reallocate, which must have been allocated from the resource.
+		/// @param newSize The new size of the memory block.
+		/// @param alignment The alignment of the memory block, which must be a power of two.
+		/// @return A pointer to the reallocated memory block, or a nullptr if the block couldn't be reallocated.
+		virtual void* Realloc(void* mem, size_t newSize, size_t alignment) = 0;
+		/// @brief Frees the given memory block.
+		/// @param mem The memory block to free, which must have been allocated from the resource.
+		virtual void Free(void* mem) = 0;
+
+		/// @brief Destroys the memory resource.
+		virtual ~MemoryResource() = default;
+	};
+}
@@ -2,6 +2,8 @@
 
 #include "BuildInfo.hpp"
 #include "Defines.hpp"
+#include "Memory.hpp"
+#include "Thread.hpp"
 
 #ifdef WFE_PLATFORM_LINUX
 #include <pthread.h>
@@ -79,7 +81,7 @@ namespace wfe {
 #endif
 	};
 
-	/// @brief An implementation of a mutex that uses atomic variables for synchronization.
+	/// @brief An implementation of a mutex that uses atomic variables for synchronization. Contended locks spin briefly with exponential backoff, then park the calling thread until the mutex is unlocked.
 	class AtomicMutex {
 	public:
 		/// @brief Creates an atomic mutex object.
@@ -95,12 +97,134 @@ namespace wfe {
 		/// @brief Locks the mutex. If the mutex is already locked, the function will return immediately.
 		/// @return True if the mutex was locked, otherwise false.
 		bool8_t TryLock();
-		/// @brief Unlocks the mutex.
+		/// @brief Unlocks the mutex, waking one parked thread if any threads are waiting for it.
 		void Unlock();
 
 		/// @brief Destroys the atomic mutex.
 		~AtomicMutex() = default;
 	private:
-		atomic_uint8_t val = 0;
+		// 0 if unlocked, 1 if locked with no parked threads, 2 if locked with possibly parked threads
+		atomic_uint32_t val = 0;
+	};
+
+	/// @brief An implementation of a reader-writer mutex. Readers are spread between multiple cache line sized slots, one per processor, so that readers don't contend with each other. A writer blocks new readers, then spins briefly and parks until the current readers unlock the mutex.
+	class SharedMutex {
+	public:
+		/// @brief Creates a shared mutex object.
+		SharedMutex();
+		SharedMutex(const SharedMutex&) = delete;
+		SharedMutex(SharedMutex&&) noexcept = delete;
+
+		SharedMutex& operator=(const SharedMutex&) = delete;
+		SharedMutex& operator=(SharedMutex&&) noexcept = delete;
+
+		/// @brief Locks the mutex for exclusive access. The calling thread will wait for all other writers and readers to unlock it.
+		void Lock();
+		/// @brief Locks the mutex for exclusive access. If the mutex is already locked, the function will return immediately.
+		/// @return True if the mutex was locked, otherwise false.
+		bool8_t TryLock();
+		/// @brief Unlocks the mutex from exclusive access.
+		void Unlock();
+
+		/// @brief Locks the mutex for shared access. The calling thread will only wait if a writer holds or is acquiring the mutex.
+		void LockShared();
+		/// @brief Locks the mutex for shared access. If a writer holds the mutex, the function will return immediately.
+		/// @return True if the mutex was locked, otherwise false.
+		bool8_t TryLockShared();
+		/// @brief Unlocks the mutex from shared access. Must be called on the thread that locked it.
+		void UnlockShared();
+
+		/// @brief Destroys the shared mutex.
+		~SharedMutex();
+	private:
+		struct ReaderSlot;
+
+		ReaderSlot& GetReaderSlot();
+		void UnregisterReader(ReaderSlot& slot);
+
+		ReaderSlot* readerSlots;
+		size_t readerSlotCount;
+		atomic_uint32_t writerActive = 0;
+		atomic_uint32_t writerParked = 0;
+		atomic_uint32_t writerWakeSequence = 0;
+		AtomicMutex writerMutex;
+	};
+
+	/// @brief An implementation of a sequence lock, for small read-mostly data. Readers never block writers; instead, they retry if a write happened while they were reading.
+	class SeqLock {
+	public:
+		/// @brief Creates a sequence lock object.
+		SeqLock() = default;
+		SeqLock(const SeqLock&) = delete;
+		SeqLock(SeqLock&&) noexcept = delete;
+
+		SeqLock& operator=(const SeqLock&) = delete;
+		SeqLock& operator=(SeqLock&&) noexcept = delete;
+
+		/// @brief Begins reading the protected data, waiting for any write in progress to end.
+		/// @return The sequence number that must be passed to EndRead.
+		uint32_t BeginRead() const {
+			// Wait until no write is in progress
+			uint32_t sequence = val.load(std::memory_order_acquire);
+			while(sequence & 1) {
+				PauseCurrentThread();
+				sequence = val.load(std::memory_order_acquire);
+			}
+
+			return sequence;
+		}
+		/// @brief Ends reading the protected data.
+		/// @param sequence The sequence number returned by BeginRead.
+		/// @return True if the read data is consistent, or false if a write happened during the read and the read must be retried.
+		bool8_t EndRead(uint32_t sequence) const {
+			// Make sure the data reads happen before the sequence number is reloaded
+			std::atomic_thread_fence(std::memory_order_acquire);
+			return val.load(std::memory_order_relaxed) == sequence;
+		}
+		/// @brief Begins writing the protected data, waiting for other writers to finish.
+		void BeginWrite() {
+			// Lock the writer mutex and mark the write as in progress
+			writerMutex.Lock();
+			val.store(val.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+			std::atomic_thread_fence(std::memory_order_release);
+		}
+		/// @brief Ends writing the protected data.
+		void EndWrite() {
+			// Mark the write as finished and unlock the writer mutex
+			val.store(val.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+			writerMutex.Unlock();
+		}
+
+		/// @brief Reads a consistent copy of the given protected value.
+		/// @tparam T The type of the value, which must be trivially copyable.
+		/// @param src The protected value to read.
+		/// @return A copy of the protected value.
+		template<class T>
+		T Load(const T& src) const {
+			T dst;
+			uint32_t sequence;
+			do {
+				sequence = BeginRead();
+				memcpy(&dst, &src, sizeof(T));
+			} while(!EndRead(sequence));
+
+			return dst;
+		}
+		/// @brief Writes the given value to the protected value.
+		/// @tparam T The type of the value, which must be trivially copyable.
+		/// @param dst The protected value to write to.
+		/// @param src The value to write.
+		template<class T>
+		void Store(T& dst, const T& src) {
+			BeginWrite();
+			memcpy(&dst, &src, sizeof(T));
+			EndWrite();
+		}
+
+		/// @brief Destroys the sequence lock.
+		~SeqLock() = default;
+	private:
+		atomic_uint32_t val = 0;
+		AtomicMutex writerMutex;
 	};
 }
\ No newline at end of file
@@ -15,8 +15,12 @@ namespace wfe {
 	/// @return A pointer to the new object.
 	template<class T, class... Args>
 	WFE_INLINE T* NewObject(Args&&... args) {
-		// Allocate memory for the new object
-		T* newObject = (T*)AllocMemory(sizeof(T));
+		// Allocate memory for the new object, using an aligned block for over-aligned types
+		T* newObject;
+		if constexpr(alignof(T) > DEFAULT_MEMORY_ALIGNMENT)
+			newObject = (T*)AllocAlignedMemory(sizeof(T), alignof(T));
+		else
+			newObject = (T*)AllocMemory(sizeof(T));
 		
 		// Check if the memory was allocated correctly
 		if(!newObject)
@@ -46,8 +50,12 @@ namespace wfe {
 	/// @return A pointer to the new array.
 	template<class T>
 	WFE_INLINE T* NewArray(size_t size) {
-		// Allocate memory for the new array
-		T* newArray = (T*)AllocMemory(size * sizeof(T));
+		// Allocate memory for the new array, using an aligned block for over-aligned types
+		T* newArray;
+		if constexpr(alignof(T) > DEFAULT_MEMORY_ALIGNMENT)
+			newArray = (T*)AllocAlignedMemory(size * sizeof(T), alignof(T));
+		else
+			newArray = (T*)AllocMemory(size * sizeof(T));
 
 		// Check if the memory was allocated correctly
 		if(!newArray)
@@ -19,4 +19,37 @@ namespace wfe {
 	/// @param mem The memory block whose size to get.
 	/// @return The size, in bytes, of the memory block.
 	size_t PlatformGetMemorySize(void* mem);
+	/// @brief Gets the size of a memory page.
+	/// @return The size, in bytes, of a memory page.
+	size_t PlatformGetPageSize();
+	/// @brief Maps new memory pages straight from the platform's virtual memory manager. Large ranges are backed by huge pages when the platform supports them.
+	/// @param size The size, in bytes, of the mapped memory. Must be a multiple of the page size.
+	/// @return A pointer to the mapped memory, or a nullptr if the pages couldn't be mapped.
+	void* PlatformAllocatePages(size_t size);
+	/// @brief Resizes the given mapped memory, moving its pages to a new address without copying them when the platform supports it.
+	/// @param mem The mapped memory to resize.
+	/// @param oldSize The old size, in bytes, of the mapped memory.
+	/// @param newSize The new size, in bytes, of the mapped memory. Must be a multiple of the page size.
+	/// @return A pointer to the resized memory, or a nullptr if the memory couldn't be resized.
+	void* PlatformReallocatePages(void* mem, size_t oldSize, size_t newSize);
+	/// @brief Unmaps the given memory pages, returning them to the platform right away.
+	/// @param mem The mapped memory to unmap.
+	/// @param size The size, in bytes, of the mapped memory.
+	void PlatformFreePages(void* mem, size_t size);
+
+	/// @brief Captures the current thread's call stack using the platform's debugging functions.
+	/// @param frames The array in which the return addresses of the stack's frames will be written.
+	/// @param maxFrameCount The max number of frames to capture.
+	/// @param skipCount The number of innermost frames to skip, not counting this function's own frame.
+	/// @return The number of captured frames.
+	size_t PlatformCaptureBacktrace(void** frames, size_t maxFrameCount, size_t skipCount);
+	/// @brief Describes the given stack frame's return address as its module and offset, along with its symbol name if it is available.
+	/// @param frame The return address to describe.
+	/// @param dest The string in which the description will be written.
+	/// @param maxSize The max size of the description, including its null terminator.
+	void PlatformGetBacktraceFrameName(void* frame, char_t* dest, size_t maxSize);
+
+	/// @brief Checks if the CPU supports AVX2 and the platform saves the AVX registers across context switches.
+	/// @return True if AVX2 instructions can be used, otherwise false.
+	bool8_t PlatformIsAVX2Supported();
 }
\ No newline at end of file
@@ -0,0 +1,307 @@
+#pragma once
+
+#include "Defines.hpp"
+#include "Allocator.hpp"
+#include "Exception.hpp"
+#include "Mutex.hpp"
+#include "New.hpp"
+#include "Thread.hpp"
+#include <utility>
+
+namespace wfe {
+	/// @brief A pool allocator for objects of a single type. Objects are carved out of large slabs and recycled through intrusive free lists, making both allocating and freeing O(1). Every thread owns its own free list, which it uses without locking; nodes move between threads' lists and a central list in whole batches. When a thread exits, its list is moved back to the central list.
+	/// @tparam T The type of the pool's objects.
+	template<class T>
+	class PoolAllocator {
+	public:
+		/// @brief The default number of objects in every slab.
+		static const size_t DEFAULT_SLAB_OBJECT_COUNT = 256;
+
+		/// @brief Creates a pool allocator. No slabs are allocated until the first object is allocated.
+		/// @param slabObjectCount The number of objects in every slab allocated by the pool. Also the number of objects moved between a thread's free list and the central free list at once. A count of 0 is clamped to 1.
+		/// @param memoryUsageType The memory usage type the pool's slabs are allocated with. Slabs are never allocated from the command arena, even with the MEMORY_USAGE_TYPE_COMMAND usage type.
+		PoolAllocator(size_t slabObjectCount = DEFAULT_SLAB_OBJECT_COUNT, MemoryUsageType memoryUsageType = MEMORY_USAGE_TYPE_OTHER) : slabObjectCount(slabObjectCount ? slabObjectCount : 1), memoryUsageType(memoryUsageType) {
+			for(size_t i = 0; i != MAX_THREAD_LIST_PAGE_COUNT; ++i)
+				threadListPages[i].store(nullptr, std::memory_order_relaxed);
+
+			// Flush the list of every thread that exits while the pool exists
+			AddThreadExitCallback(FlushExitedThreadList, this);
+		}
+		PoolAllocator(const PoolAllocator&) = delete;
+		PoolAllocator(PoolAllocator&&) noexcept = delete;
+
+		PoolAllocator& operator=(const PoolAllocator&) = delete;
+		PoolAllocator& operator=(PoolAllocator&&) = delete;
+
+		/// @brief Allocates memory for one object, without constructing it.
+		/// @return A pointer to the object's memory, or a nullptr if a new slab couldn't be allocated.
+		T* Alloc() {
+			// Allocate straight from the central list if the current thread has no list of its own
+			ThreadList* list = GetThreadList();
+			if(!list) {
+				centralMutex.Lock();
+				Node* node = centralNodes;
+				if(!node)
+					node = AllocSlab();
+				if(node) {
+					centralNodes = node->next;
+					--centralNodeCount;
+				}
+				centralMutex.Unlock();
+
+				return (T*)node;
+			}
+
+			// Refill the thread's list if it is empty
+			if(!list->nodes && !RefillThreadList(list))
+				return nullptr;
+
+			// Pop the first node from the thread's list
+			Node* node = list->nodes;
+			list->nodes = node->next;
+			--list->nodeCount;
+
+			return (T*)node;
+		}
+		/// @brief Frees the given object's memory, without destroying it. The object may be freed on any thread.
+		/// @param object A pointer to the object's memory, which must have been allocated by this pool.
+		void Free(T* object) {
+			// Exit the function if no object was given
+			if(!object)
+				return;
+
+			Node* node = (Node*)object;
+
+			// Push the node straight to the central list if the current thread has no list of its own
+			ThreadList* list = GetThreadList();
+			if(!list) {
+				centralMutex.Lock();
+				node->next = centralNodes;
+				centralNodes = node;
+				++centralNodeCount;
+				centralMutex.Unlock();
+
+				return;
+			}
+
+			// Push the node to the thread's list
+			node->next = list->nodes;
+			list->nodes = node;
+			++list->nodeCount;
+
+			// Move a batch of nodes to the central list if the thread's list grew too large, so that other threads can reuse them
+			if(list->nodeCount >= slabObjectCount << 1)
+				FlushThreadList(list);
+		}
+		/// @brief Creates a new object from the pool.
+		/// @tparam ...Args The arg types to create the object with.
+		/// @param ...args The args to create the object with.
+		/// @return A pointer to the new object.
+		template<class... Args>
+		T* New(Args&&... args) {
+			// Allocate memory for the new object
+			T* object = Alloc();
+			if(!object)
+				throw BadAllocException("Failed to allocate pool object memory!");
+
+			// Construct the object in the new memory block
+			new(object) T(std::forward<Args>(args)...);
+
+			return object;
+		}
+		/// @brief Destroys the given object and returns its memory to the pool.
+		/// @param object A pointer to the object to destroy, which must have been created by this pool.
+		void Delete(T* object) {
+			// Destruct the object
+			object->~T();
+
+			// Free the object's memory
+			Free(object);
+		}
+
+		/// @brief Gets the number of objects in every slab allocated by the pool.
+		/// @return The number of objects in every slab.
+		size_t GetSlabObjectCount() const {
+			return slabObjectCount;
+		}
+		/// @brief Gets the memory usage type the pool's slabs are allocated with.
+		/// @return The memory usage type the pool's slabs are allocated with.
+		MemoryUsageType GetMemoryUsageType() const {
+			return memoryUsageType;
+		}
+
+		/// @brief Destroys the pool allocator, freeing all of its slabs. Objects still alive in the pool are not destroyed.
+		~PoolAllocator() {
+			// Stop flushing the lists of exiting threads
+			RemoveThreadExitCallback(FlushExitedThreadList, this);
+
+			// Free every slab; FreeMemory also frees blocks allocated with AllocAlignedMemory
+			Node* slab = slabs;
+			while(slab) {
+				Node* next = slab->next;
+				FreeMemory(slab);
+				slab = next;
+			}
+
+			// Free every thread list page
+			for(size_t i = 0; i != MAX_THREAD_LIST_PAGE_COUNT; ++i) {
+				ThreadList* page = threadListPages[i].load(std::memory_order_relaxed);
+				if(page)
+					DestroyArray(page, THREAD_LIST_PAGE_SIZE);
+			}
+		}
+	private:
+		static const size_t CACHE_LINE_SIZE = 64;
+		static const size_t THREAD_LIST_PAGE_SIZE = 64;
+		static const size_t MAX_THREAD_LIST_PAGE_COUNT = 64;
+
+		union Node {
+			Node* next;
+			alignas(T) char_t data[sizeof(T)];
+		};
+		// Align every list to a cache line so that the lists of different threads never share one
+		struct alignas(CACHE_LINE_SIZE) ThreadList {
+			Node* nodes = nullptr;
+			size_t nodeCount = 0;
+		};
+
+		static void FlushExitedThreadList(size_t threadIndex, void* args) {
+			PoolAllocator* pool = (PoolAllocator*)args;
+
+			// Exit the function if the exiting thread never created its list
+			size_t pageInd = threadIndex / THREAD_LIST_PAGE_SIZE;
+			if(pageInd >= MAX_THREAD_LIST_PAGE_COUNT)
+				return;
+
+			ThreadList* page = pool->threadListPages[pageInd].load(std::memory_order_acquire);
+			if(!page)
+				return;
+
+			ThreadList* list = page + (threadIndex & (THREAD_LIST_PAGE_SIZE - 1));
+			if(!list->nodes)
+				return;
+
+			// Splice the thread's entire list into the central list, leaving the list empty for the next thread to get the same index
+			Node* last = list->nodes;
+			while(last->next)
+				last = last->next;
+
+			pool->centralMutex.Lock();
+			last->next = pool->centralNodes;
+			pool->centralNodes = list->nodes;
+			pool->centralNodeCount += list->nodeCount;
+			pool->centralMutex.Unlock();
+
+			list->nodes = nullptr;
+			list->nodeCount = 0;
+		}
+
+		ThreadList* GetThreadList() {
+			// Find the page holding the current thread's list, exiting the function if the thread's index is past the last page
+			size_t threadIndex = GetCurrentThreadIndex();
+			size_t pageInd = threadIndex / THREAD_LIST_PAGE_SIZE;
+			if(pageInd >= MAX_THREAD_LIST_PAGE_COUNT)
+				return nullptr;
+
+			// Allocate the page if it doesn't exist yet, keeping the other thread's page if it won the race
+			ThreadList* page = threadListPages[pageInd].load(std::memory_order_acquire);
+			if(!page) {
+				ThreadList* newPage = NewArray<ThreadList>(THREAD_LIST_PAGE_SIZE);
+				if(threadListPages[pageInd].compare_exchange_strong(page, newPage, std::memory_order_acq_rel, std::memory_order_acquire)) {
+					page = newPage;
+				} else {
+					DestroyArray(newPage, THREAD_LIST_PAGE_SIZE);
+				}
+			}
+
+			return page + (threadIndex & (THREAD_LIST_PAGE_SIZE - 1));
+		}
+		bool8_t RefillThreadList(ThreadList* list) {
+			centralMutex.Lock();
+
+			// Allocate a new slab if the central list is empty
+			if(!centralNodes && !AllocSlab()) {
+				centralMutex.Unlock();
+				return false;
+			}
+
+			// Move up to a slab's worth of nodes from the central list to the thread's list
+			Node* first = centralNodes;
+			Node* last = first;
+			size_t nodeCount = 1;
+			while(nodeCount != slabObjectCount && last->next) {
+				last = last->next;
+				++nodeCount;
+			}
+
+			centralNodes = last->next;
+			centralNodeCount -= nodeCount;
+
+			centralMutex.Unlock();
+
+			last->next = list->nodes;
+			list->nodes = first;
+			list->nodeCount += nodeCount;
+
+			return true;
+		}
+		void FlushThreadList(ThreadList* list) {
+			// Split a slab's worth of nodes off the front of the thread's list
+			Node* first = list->nodes;
+			Node* last = first;
+			for(size_t i = 1; i != slabObjectCount; ++i)
+				last = last->next;
+
+			list->nodes = last->next;
+			list->nodeCount -= slabObjectCount;
+
+			// Splice the nodes into the central list
+			centralMutex.Lock();
+			last->next = centralNodes;
+			centralNodes = first;
+			centralNodeCount += slabObjectCount;
+			centralMutex.Unlock();
+		}
+		Node* AllocSlab() {
+			// Allocate the slab aligned for the pool's type and outside of the command arena, as the pool owns it until it is destroyed, with its first node holding the link to the next slab
+			bool8_t commandArenaEnabled = IsCommandArenaEnabled();
+			if(commandArenaEnabled)
+				SetCommandArenaEnabled(false);
+
+			PushMemoryUsageType(memoryUsageType);
+			Node* slab = (Node*)AllocAlignedMemory((slabObjectCount + 1) * sizeof(Node), alignof(Node));
+			PopMemoryUsageType();
+
+			if(commandArenaEnabled)
+				SetCommandArenaEnabled(true);
+
+			if(!slab)
+				return nullptr;
+
+			slab->next = slabs;
+			slabs = slab;
+
+			// Link every other node in the slab and push them to the central list
+			Node* first = slab + 1;
+			Node* last = first + slabObjectCount - 1;
+			for(Node* node = first; node != last; ++node)
+				node->next = node + 1;
+			last->next = centralNodes;
+
+			centralNodes = first;
+			centralNodeCount += slabObjectCount;
+
+			return first;
+		}
+
+		size_t slabObjectCount;
+		MemoryUsageType memoryUsageType;
+
+		std::atomic<ThreadList*> threadListPages[MAX_THREAD_LIST_PAGE_COUNT];
+
+		AtomicMutex centralMutex;
+		Node* centralNodes = nullptr;
+		size_t centralNodeCount = 0;
+		Node* slabs = nullptr;
+	};
+}
@@ -1,9 +1,10 @@
 #pragma once
 
+#include "BuildInfo.hpp"
 #include "Defines.hpp"
 
 namespace wfe {
-	/// @brief An implementation of a semaphore.
+	/// @brief An implementation of a semaphore. On Linux, the semaphore only enters the kernel when a thread has to block in Wait or when a blocked thread must be woken.
 	class Semaphore {
 	public:
 		/// @brief The maximum possible value the semaphore can reach.
@@ -64,6 +65,11 @@ namespace wfe {
 		/// @brief Destroys the semaphore.
 		~Semaphore();
 	private:
+#ifdef WFE_PLATFORM_LINUX
+		atomic_uint32_t counter;
+		atomic_uint32_t waiterCount;
+#else
 		void* internalData;
+#endif
 	};
 }
\ No newline at end of file
@@ -5,8 +5,10 @@
 #include "Defines.hpp"
 #include "Memory.hpp"
 #include "Exception.hpp"
+#include "EytzingerIndex.hpp"
 #include "Debug.hpp"
 #include "Pair.hpp"
+#include "Sort.hpp"
 #include <initializer_list>
 #include <set>
 
@@ -37,9 +39,12 @@ namespace wfe {
 
 		/// @brief Creates an empty set.
 		constexpr set() = default;
+		/// @brief Creates an empty set that allocates its memory from the given resource.
+		/// @param resource The memory resource to allocate from. It must outlive the set.
+		explicit set(MemoryResource& resource) : memoryResource(&resource) { }
 		/// @brief Copies the given set.
 		/// @param other The set to copy.
-		set(const set& other) : setSize(other.setSize), setCapacity(other.setCapacity), setData((pointer)AllocMemory(setCapacity * sizeof(value_type))) {
+		set(const set& other) : setSize(other.setSize), setCapacity(other.setCapacity), setData((pointer)AllocMemory(memoryResource, setCapacity * sizeof(value_type))) {
 			// Check if the memory was allocated correctly
 			if(setCapacity && !setData)
 				throw BadAllocException("Failed to allocate set data!");
@@ -53,9 +58,12 @@ namespace wfe {
 		}
 		/// @brief Moves the contents from one set to another.
 		/// @param other The set to move from.
-		set(set&& other) noexcept : setSize(other.setSize), setCapacity(other.setCapacity), setData(other.setData) {
+		set(set&& other) noexcept : memoryResource(other.memoryResource), setSize(other.setSize), setCapacity(other.setCapacity), setData(other.setData) {
 			// Unlink the data from the other set
 			other.setData = nullptr;
+
+			// Take the other set's frozen index
+			setIndex.Swap(other.setIndex);
 		}
 		/// @brief Creates a vector with the elements from the given list.
 		/// @param list The list to copy from.
@@ -70,7 +78,7 @@ namespace wfe {
 			setCapacity <<= 1;
 
 			// Allocate the set's memory
-			setData = (pointer)AllocMemory(setCapacity * sizeof(value_type));
+			setData = (pointer)AllocMemory(memoryResource, setCapacity * sizeof(value_type));
 
 			if(setCapacity && !setData)
 				throw BadAllocException("Failed to allocate set data!");
@@ -111,7 +119,7 @@ namespace wfe {
 			setCapacity <<= 1;
 
 			// Allocate the set's memory
-			setData = (pointer)AllocMemory(setCapacity * sizeof(value_type));
+			setData = (pointer)AllocMemory(memoryResource, setCapacity * sizeof(value_type));
 
 			if(setCapacity && !setData)
 				throw BadAllocException("Failed to allocate set data!");
@@ -132,6 +140,9 @@ namespace wfe {
 			if(&other == this)
 				return *this;
 
+			// Thaw the set, since its frozen index won't match the new values
+			thaw();
+
 			if(setData) {
 				// Destruct every value in the set
 				pointer end = setData + setSize;
@@ -140,13 +151,13 @@ namespace wfe {
 					ptr->~value_type();
 				
 				// Free the set's memory
-				FreeMemory(setData);
+				FreeMemory(memoryResource, setData);
 			}
 
 			// Set the set's new values
 			setSize = other.setSize;
 			setCapacity = other.setCapacity;
-			setData = (pointer)AllocMemory(setCapacity * sizeof(value_type));
+			setData = (pointer)AllocMemory(memoryResource, setCapacity * sizeof(value_type));
 
 			// Check if the memory was allocated correctly
 			if(setCapacity && !setData)
@@ -165,6 +176,9 @@ namespace wfe {
 		/// @param other The set to move from.
 		/// @return A reference to this set.
 		set& operator=(set&& other) {
+			// Thaw the set, since its frozen index won't match the new values
+			thaw();
+
 			if(setData) {
 				// Destruct every value in the set
 				pointer end = setData + setSize;
@@ -173,10 +187,11 @@ namespace wfe {
 					ptr->~value_type();
 				
 				// Free the set's memory
-				FreeMemory(setData);
+				FreeMemory(memoryResource, setData);
 			}
 
 			// Set the set's new data
+			memoryResource = other.memoryResource;
 			setSize = other.setSize;
 			setCapacity = other.setCapacity;
 			setData = other.setData;
@@ -184,12 +199,18 @@ namespace wfe {
 			// Unlink the data from the given set
 			other.setData = nullptr;
 
+			// Take the given set's frozen index
+			setIndex.Swap(other.setIndex);
+
 			return *this;
 		}
 		/// @brief Copies the elements from the given list into this vector.
 		/// @param list The list to copy from.
 		/// @return A reference to this set.
 		set& operator=(std::initializer_list<value_type> list) {
+			// Thaw the set, since its frozen index won't match the new values
+			thaw();
+
 			if(setData) {
 				// Destruct every value in the set
 				pointer end = setData + setSize;
@@ -198,7 +219,7 @@ namespace wfe {
 					ptr->~value_type();
 				
 				// Free the set's memory
-				FreeMemory(setData);
+				FreeMemory(memoryResource, setData);
 			}
 
 			// Assert that the set's size must be lower than the maximum possible size
@@ -215,7 +236,7 @@ namespace wfe {
 			setCapacity <<= 1;
 
 			// Allocate the set's memory
-			setData = (pointer)AllocMemory(setCapacity * sizeof(value_type));
+			setData = (pointer)AllocMemory(memoryResource, setCapacity * sizeof(value_type));
 
 			if(setCapacity && !setData)
 				throw BadAllocException("Failed to allocate set data!");
@@ -275,6 +296,9 @@ namespace wfe {
 			if(pos != setSize && Equal()(val, setData[pos]))
 				return { setData + pos, false };
 			
+			// Thaw the set, since its frozen index won't match the changed values
+			thaw();
+
 			// Increment the set's size
 			++setSize;
 
@@ -292,9 +316,9 @@ namespace wfe {
 
 				// Reallocate the set's memory
 				if(setData) {
-					setData = (pointer)ReallocMemory(setData, setCapacity * sizeof(value_type));
+					setData = (pointer)ReallocMemory(memoryResource, setData, setCapacity * sizeof(value_type));
 				} else {
-					setData = (pointer)AllocMemory(setCapacity * sizeof(value_type));
+					setData = (pointer)AllocMemory(memoryResource, setCapacity * sizeof(value_type));
 				}
 
 				if(setCapacity && !setData)
@@ -329,6 +353,9 @@ namespace wfe {
 			if(pos != setSize && Equal()(val, setData[pos]))
 				return { setData + pos, false };
 			
+			// Thaw the set, since its frozen index won't match the changed values
+			thaw();
+
 			// Increment the set's size
 			++setSize;
 
@@ -346,9 +373,9 @@ namespace wfe {
 
 				// Reallocate the set's memory
 				if(setData) {
-					setData = (pointer)ReallocMemory(setData, setCapacity * sizeof(value_type));
+					setData = (pointer)ReallocMemory(memoryResource, setData, setCapacity * sizeof(value_type));
 				} else {
-					setData = (pointer)AllocMemory(setCapacity * sizeof(value_type));
+					setData = (pointer)AllocMemory(memoryResource, setCapacity * sizeof(value_type));
 				}
 
 				if(setCapacity && !setData)
@@ -375,6 +402,9 @@ namespace wfe {
 			if(pos != end() && Equal()(val, *pos))
 				return (pointer)pos;
 			if((pos == begin() || Lower()(*(pos - 1), val)) && (pos != end() && Lower()(val, *pos))) {
+				// Thaw the set, since its frozen index won't match the changed values
+				thaw();
+
 				// Increment the set's size
 				++setSize;
 
@@ -395,9 +425,9 @@ namespace wfe {
 
 					// Reallocate the set's memory
 					if(setData) {
-						setData = (pointer)ReallocMemory(setData, setCapacity * sizeof(value_type));
+						setData = (pointer)ReallocMemory(memoryResource, setData, setCapacity * sizeof(value_type));
 					} else {
-						setData = (pointer)AllocMemory(setCapacity * sizeof(value_type));
+						setData = (pointer)AllocMemory(memoryResource, setCapacity * sizeof(value_type));
 					}
 
 					if(setCapacity && !setData)
@@ -446,6 +476,9 @@ namespace wfe {
 			if(posInd != setSize && Equal()(val, setData[posInd]))
 				return setData + posInd;
 			
+			// Thaw the set, since its frozen index won't match the changed values
+			thaw();
+
 			// Increment the set's size
 			++setSize;
 
@@ -463,9 +496,9 @@ namespace wfe {
 
 				// Reallocate the set's memory
 				if(setData) {
-					setData = (pointer)ReallocMemory(setData, setCapacity * sizeof(value_type));
+					setData = (pointer)ReallocMemory(memoryResource, setData, setCapacity * sizeof(value_type));
 				} else {
-					setData = (pointer)AllocMemory(setCapacity * sizeof(value_type));
+					setData = (pointer)AllocMemory(memoryResource, setCapacity * sizeof(value_type));
 				}
 
 				if(setCapacity && !setData)
@@ -492,6 +525,9 @@ namespace wfe {
 			if(pos != end() && Equal()(val, *pos))
 				return (pointer)pos;
 			if((pos == begin() || Lower()(*(pos - 1), val)) && (pos != end() && Lower()(val, *pos))) {
+				// Thaw the set, since its frozen index won't match the changed values
+				thaw();
+
 				// Increment the set's size
 				++setSize;
 
@@ -509,9 +545,9 @@ namespace wfe {
 
 					// Reallocate the set's memory
 					if(setData) {
-						setData = (pointer)ReallocMemory(setData, setCapacity * sizeof(value_type));
+						setData = (pointer)ReallocMemory(memoryResource, setData, setCapacity * sizeof(value_type));
 					} else {
-						setData = (pointer)AllocMemory(setCapacity * sizeof(value_type));
+						setData = (pointer)AllocMemory(memoryResource, setCapacity * sizeof(value_type));
 					}
 
 					if(setCapacity && !setData)
@@ -560,6 +596,9 @@ namespace wfe {
 			if(posInd != setSize && Equal()(val, setData[posInd]))
 				return setData + posInd;
 			
+			// Thaw the set, since its frozen index won't match the changed values
+			thaw();
+
 			// Increment the set's size
 			++setSize;
 
@@ -577,9 +616,9 @@ namespace wfe {
 
 				// Reallocate the set's memory
 				if(setData) {
-					setData = (pointer)ReallocMemory(setData, setCapacity * sizeof(value_type));
+					setData = (pointer)ReallocMemory(memoryResource, setData, setCapacity * sizeof(value_type));
 				} else {
-					setData = (pointer)AllocMemory(setCapacity * sizeof(value_type));
+					setData = (pointer)AllocMemory(memoryResource, setCapacity * sizeof(value_type));
 				}
 
 				if(setCapacity && !setData)
@@ -609,6 +648,83 @@ namespace wfe {
 			for(pointer ptr = (pointer)list.begin() + 1; ptr != end; ++ptr)
 				posHint = insert(posHint, *ptr);
 		}
+		/// @brief Replaces the set's contents with the values from the given unsorted range. The values are copied, sorted and deduplicated in O(n log n), instead of shifting the set for every insertion. The first of every value with the same value is kept.
+		/// @param first A pointer to the range's first value.
+		/// @param last A pointer to right after the range's last value.
+		/// @param jobManager The job manager to sort large ranges on in parallel, or a nullptr to sort on the calling thread.
+		void assign_unsorted(const_pointer first, const_pointer last, JobManager* jobManager = nullptr) {
+			// Destruct the set's old values
+			clear();
+
+			// Assert that the set's size must be lower than the maximum possible size
+			size_type count = last - first;
+			WFE_ASSERT(count < max_size(), "The set's size must be lower than the maximum possible size!")
+
+			// Check if memory needs to be reallocated
+			if(count > setCapacity) {
+				// Set the set's capacity to the lowest power of 2 higher than or equal to the range's size
+				setCapacity = 1;
+				for(size_type step = sizeof(size_type) << 2; step; step >>= 1)
+					if((setCapacity << step) < count)
+						setCapacity <<= step;
+				setCapacity <<= 1;
+
+				// Reallocate the set's memory
+				if(!setData) {
+					setData = (pointer)AllocMemory(memoryResource, setCapacity * sizeof(value_type));
+				} else {
+					setData = (pointer)ReallocMemory(memoryResource, setData, setCapacity * sizeof(value_type));
+				}
+
+				// Check if the memory was allocated correctly
+				if(setCapacity && !setData)
+					throw BadAllocException("Failed to allocate set data!");
+			}
+
+			// Copy every value from the range
+			pointer end = setData + count;
+			const_pointer ptr2 = first;
+
+			for(pointer ptr = setData; ptr != end; ++ptr)
+				new(ptr) value_type(*ptr2++);
+
+			// Sort the values, keeping equal values in their original order, and remove the duplicates
+			SortValues(setData, count, jobManager);
+			setSize = RemoveDuplicateValues(setData, count);
+		}
+		/// @brief Inserts every value from the given unsorted range. The range is copied, sorted and deduplicated in O(k log k) and then merged with the set in linear time, instead of shifting the set for every insertion. Values whose values are already in the set aren't inserted, and the first of every value with the same value in the range is kept.
+		/// @param first A pointer to the range's first value.
+		/// @param last A pointer to right after the range's last value.
+		/// @param jobManager The job manager to sort large ranges on in parallel, or a nullptr to sort on the calling thread.
+		void insert_range(const_pointer first, const_pointer last, JobManager* jobManager = nullptr) {
+			// Exit the function if the given range is empty
+			size_type count = last - first;
+			if(!count)
+				return;
+
+			// Copy every value from the range
+			pointer values = (pointer)AllocMemory(memoryResource, count * sizeof(value_type));
+			if(!values)
+				throw BadAllocException("Failed to allocate set data!");
+
+			pointer end = values + count;
+			const_pointer ptr2 = first;
+
+			for(pointer ptr = values; ptr != end; ++ptr)
+				new(ptr) value_type(*ptr2++);
+
+			// Sort the values, keeping equal values in their original order, and remove the duplicates
+			SortValues(values, count, jobManager);
+			count = RemoveDuplicateValues(values, count);
+
+			// Merge the values into the set, destructing the ones that weren't inserted
+			end = values + MergeValues(values, count);
+
+			for(pointer ptr = values; ptr != end; ++ptr)
+				ptr->~value_type();
+
+			FreeMemory(memoryResource, values);
+		}
 		/// @brief Erases the element at the given position.
 		/// @param pos The position to erase from.
 		/// @return A pointer to the space occupied by the erase value.
@@ -616,6 +732,9 @@ namespace wfe {
 			// Assert that the given position must be in range
 			WFE_ASSERT(pos >= begin() && pos < end(), "The given position must be in range!")
 
+			// Thaw the set, since its frozen index won't match the changed values
+			thaw();
+
 			// Decrement the set's size
 			--setSize;
 
@@ -651,6 +770,9 @@ namespace wfe {
 			if(!Equal()(setData[pos], val))
 				return 0;
 			
+			// Thaw the set, since its frozen index won't match the changed values
+			thaw();
+
 			// Decrement the set's size
 			--setSize;
 
@@ -683,11 +805,27 @@ namespace wfe {
 			// Move part of the set backwards to erase the values in the given range
 			wfe::memcpy((pointer)first, last, (setData + setSize - last) * sizeof(value_type));
 
+			// Thaw the set, since its frozen index won't match the changed values
+			thaw();
+
 			// Decrease the set's size
 			setSize -= erasedSize;
 
 			return (pointer)first;
 		}
+		/// @brief Moves every value from the given set into this set in linear time, walking both sorted sets at once. Values whose values are already in this set stay in the given set.
+		/// @param other The set to merge from.
+		void merge(set& other) {
+			// Exit the function if the given set is the same as this set
+			if(&other == this)
+				return;
+
+			// Thaw the given set, since its frozen index won't match its remaining values
+			other.thaw();
+
+			// Merge the given set's values, leaving the ones that weren't moved in it
+			other.setSize = MergeValues(other.setData, other.setSize);
+		}
 		/// @brief Swaps the two set's contents.
 		/// @param other The set to swap with.
 		void swap(set& other) {
@@ -696,19 +834,25 @@ namespace wfe {
 				return;
 			
 			// Save this set's values
+			MemoryResource* auxMemoryResource = memoryResource;
 			size_type auxSize = setSize;
 			size_type auxCapacity = setCapacity;
 			pointer auxData = setData;
 
 			// Set this set's new values
+			memoryResource = other.memoryResource;
 			setSize = other.setSize;
 			setCapacity = other.setCapacity;
 			setData = other.setData;
 
 			// Set the other set's new values
+			other.memoryResource = auxMemoryResource;
 			other.setSize = auxSize;
 			other.setCapacity = auxCapacity;
 			other.setData = auxData;
+
+			// Swap the two sets' frozen indices
+			setIndex.Swap(other.setIndex);
 		}
 		/// @brief Clears the set.
 		void clear() {
@@ -719,6 +863,9 @@ namespace wfe {
 					ptr->~value_type();
 			}
 
+			// Thaw the set, since its frozen index won't match the changed values
+			thaw();
+
 			// Set the set's size to 0
 			setSize = 0;
 		}
@@ -789,21 +936,8 @@ namespace wfe {
 		/// @param val The value to look for.
 		/// @return A pointer to the value, if it was found, otherwise set::end().
 		pointer find(const_reference val) {
-			// Exit the function if the set is empty
-			if(!setSize)
-				return setData;
-			
-			// Set the binary search step to the highest power of 2 lower than or equal to the set's size
-			size_type step = 1;
-			for(size_type stepStep = sizeof(size_type) << 2; stepStep; stepStep >>= 1)
-				if((step << stepStep) <= setSize)
-					step <<= stepStep;
-			
 			// Look for the wanted value
-			size_type pos = setSize;
-			for(; step; step >>= 1)
-				if(pos >= step && !Lower()(setData[pos - step], val))
-					pos -= step;
+			size_type pos = SearchLowerBound(val);
 			
 			// Check if the wanted value was found
 			if(pos != setSize && Equal()(setData[pos], val))
@@ -815,21 +949,8 @@ namespace wfe {
 		/// @param val The value to look for.
 		/// @return A const pointer to the value, if it was found, otherwise set::end().
 		const_pointer find(const_reference val) const {
-			// Exit the function if the set is empty
-			if(!setSize)
-				return setData;
-			
-			// Set the binary search step to the highest power of 2 lower than or equal to the set's size
-			size_type step = 1;
-			for(size_type stepStep = sizeof(size_type) << 2; stepStep; stepStep >>= 1)
-				if((step << stepStep) <= setSize)
-					step <<= stepStep;
-			
 			// Look for the wanted value
-			size_type pos = setSize;
-			for(; step; step >>= 1)
-				if(pos >= step && !Lower()(setData[pos - step], val))
-					pos -= step;
+			size_type pos = SearchLowerBound(val);
 			
 			// Check if the wanted value was found
 			if(pos != setSize && Equal()(setData[pos], val))
@@ -841,21 +962,8 @@ namespace wfe {
 		/// @param val The value to look for.
 		/// @return The number of times the given value appears in the set.
 		size_type count(const_reference val) const {
-			// Exit the function if the set is empty
-			if(!setSize)
-				return 0;
-			
-			// Set the binary search step to the highest power of 2 lower than or equal to the set's size
-			size_type step = 1;
-			for(size_type stepStep = sizeof(size_type) << 2; stepStep; stepStep >>= 1)
-				if((step << stepStep) <= setSize)
-					step <<= stepStep;
-			
 			// Look for the wanted value
-			size_type pos = setSize;
-			for(; step; step >>= 1)
-				if(pos >= step && !Lower()(setData[pos - step], val))
-					pos -= step;
+			size_type pos = SearchLowerBound(val);
 			
 			// Check if the wanted value was found
 			return pos != setSize && Equal()(setData[pos], val);
@@ -864,21 +972,8 @@ namespace wfe {
 		/// @param val The value to compare with.
 		/// @return A pointer to the wanted value, if any exists, otherwise set::end().
 		pointer lower_bound(const_reference val) {
-			// Exit the function if the set is empty
-			if(!setSize)
-				return 0;
-			
-			// Set the binary search step to the highest power of 2 lower than or equal to the set's size
-			size_type step = 1;
-			for(size_type stepStep = sizeof(size_type) << 2; stepStep; stepStep >>= 1)
-				if((step << stepStep) <= setSize)
-					step <<= stepStep;
-			
 			// Look for the wanted value
-			size_type pos = setSize;
-			for(; step; step >>= 1)
-				if(pos >= step && !Lower()(setData[pos - step], val))
-					pos -= step;
+			size_type pos = SearchLowerBound(val);
 			
 			// Return a pointer to the wanted value
 			return setData + pos;
@@ -887,21 +982,8 @@ namespace wfe {
 		/// @param val The value to compare with.
 		/// @return A const pointer to the wanted value, if any exists, otherwise set::end().
 		const_pointer lower_bound(const_reference val) const {
-			// Exit the function if the set is empty
-			if(!setSize)
-				return 0;
-			
-			// Set the binary search step to the highest power of 2 lower than or equal to the set's size
-			size_type step = 1;
-			for(size_type stepStep = sizeof(size_type) << 2; stepStep; stepStep >>= 1)
-				if((step << stepStep) <= setSize)
-					step <<= stepStep;
-			
 			// Look for the wanted value
-			size_type pos = setSize;
-			for(; step; step >>= 1)
-				if(pos >= step && !Lower()(setData[pos - step], val))
-					pos -= step;
+			size_type pos = SearchLowerBound(val);
 			
 			// Return a pointer to the wanted value
 			return setData + pos;
@@ -910,21 +992,8 @@ namespace wfe {
 		/// @param val The value to compare with.
 		/// @return A pointer to the wanted value, if any exists, otherwise set::end().
 		pointer upper_bound(const_reference val) {
-			// Exit the function if the set is empty
-			if(!setSize)
-				return 0;
-			
-			// Set the binary search step to the highest power of 2 lower than or equal to the set's size
-			size_type step = 1;
-			for(size_type stepStep = sizeof(size_type) << 2; stepStep; stepStep >>= 1)
-				if((step << stepStep) <= setSize)
-					step <<= stepStep;
-			
 			// Look for the wanted value
-			size_type pos = setSize;
-			for(; step; step >>= 1)
-				if(pos >= step && Lower()(val, setData[pos - step]))
-					pos -= step;
+			size_type pos = SearchUpperBound(val);
 			
 			// Return a pointer to the wanted value
 			return setData + pos;
@@ -933,21 +1002,8 @@ namespace wfe {
 		/// @param val The value to compare with.
 		/// @return A const pointer to the wanted value, if any exists, otherwise set::end().
 		const_pointer upper_bound(const_reference val) const {
-			// Exit the function if the set is empty
-			if(!setSize)
-				return 0;
-			
-			// Set the binary search step to the highest power of 2 lower than or equal to the set's size
-			size_type step = 1;
-			for(size_type stepStep = sizeof(size_type) << 2; stepStep; stepStep >>= 1)
-				if((step << stepStep) <= setSize)
-					step <<= stepStep;
-			
 			// Look for the wanted value
-			size_type pos = setSize;
-			for(; step; step >>= 1)
-				if(pos >= step && Lower()(val, setData[pos - step]))
-					pos -= step;
+			size_type pos = SearchUpperBound(val);
 			
 			// Return a pointer to the wanted value
 			return setData + pos;
@@ -989,6 +1045,27 @@ namespace wfe {
 			return range;
 		}
 
+		/// @brief Freezes the set, building a read-only copy of its values in Eytzinger (breadth first) order, which find, count, lower_bound, upper_bound and equal_range search instead of the sorted values. This makes lookups in large sets several times faster, at the cost of another copy of the values. Inserting or erasing values thaws the set.
+		void freeze() {
+			// Build the index from the set's sorted values
+			setIndex.Build(memoryResource, setData, setSize, sizeof(value_type));
+		}
+		/// @brief Thaws the set, freeing its frozen index.
+		void thaw() {
+			setIndex.Clear();
+		}
+		/// @brief Tests if the set is frozen.
+		/// @return True if the set is frozen and not empty, otherwise false.
+		bool8_t is_frozen() const {
+			return setIndex.IsBuilt();
+		}
+
+		/// @brief Gets the memory resource the set allocates its memory from.
+		/// @return A pointer to the set's memory resource, or a nullptr if it allocates from the heap.
+		MemoryResource* get_memory_resource() const {
+			return memoryResource;
+		}
+
 		/// @brief Destroys the set.
 		~set() {
 			if(setData) {
@@ -998,12 +1075,135 @@ namespace wfe {
 					ptr->~value_type();
 				
 				// Free the set's data
-				FreeMemory(setData);
+				FreeMemory(memoryResource, setData);
 			}
 		}
 	private:
+		void SortValues(pointer values, size_type count, JobManager* jobManager) {
+			if(jobManager) {
+				ParallelSort<value_type, Lower>(*jobManager, values, count, memoryResource);
+			} else {
+				Sort<value_type, Lower>(values, count, memoryResource);
+			}
+		}
+		size_type RemoveDuplicateValues(pointer values, size_type count) {
+			// Exit the function if there are no values
+			if(!count)
+				return 0;
+
+			// Keep the first value of every run of equal values, moving it right after the last kept value
+			pointer last = values;
+			pointer end = values + count;
+
+			for(pointer ptr = values + 1; ptr != end; ++ptr) {
+				if(Equal()(*last, *ptr)) {
+					ptr->~value_type();
+				} else if(++last != ptr) {
+					RelocateValue(last, ptr);
+				}
+			}
+
+			return last - values + 1;
+		}
+		size_type MergeValues(pointer values, size_type count) {
+			// Exit the function if there are no values to merge
+			if(!count)
+				return 0;
+
+			// Thaw the set, since its frozen index won't match the merged values
+			thaw();
+
+			// Assert that the set's size must be lower than the maximum possible size
+			WFE_ASSERT(setSize + count < max_size(), "The set's size must be lower than the maximum possible size!")
+
+			// Set the merged set's capacity to the lowest power of 2 higher than or equal to its maximum size
+			size_type newCapacity = 1;
+			for(size_type step = sizeof(size_type) << 2; step; step >>= 1)
+				if((newCapacity << step) < setSize + count)
+					newCapacity <<= step;
+			newCapacity <<= 1;
+
+			// Allocate the merged set's memory
+			pointer newData = (pointer)AllocMemory(memoryResource, newCapacity * sizeof(value_type));
+			if(!newData)
+				throw BadAllocException("Failed to allocate set data!");
+
+			// Take the lower value from either side, moving the given values that are already in the set to the start of the given values
+			pointer ptr1 = setData;
+			pointer end1 = setData + setSize;
+			pointer ptr2 = values;
+			pointer end2 = values + count;
+			pointer dest = newData;
+			pointer rejected = values;
+
+			while(ptr1 != end1 && ptr2 != end2) {
+				if(Lower()(*ptr2, *ptr1)) {
+					RelocateValue(dest++, ptr2++);
+				} else {
+					if(!Lower()(*ptr1, *ptr2)) {
+						if(rejected != ptr2)
+							RelocateValue(rejected, ptr2);
+						++rejected;
+						++ptr2;
+					}
+
+					RelocateValue(dest++, ptr1++);
+				}
+			}
+
+			// Move the values left on either side
+			wfe::memcpy(dest, ptr1, (end1 - ptr1) * sizeof(value_type));
+			dest += end1 - ptr1;
+			wfe::memcpy(dest, ptr2, (end2 - ptr2) * sizeof(value_type));
+			dest += end2 - ptr2;
+
+			// Replace the set's memory with the merged values
+			if(setData)
+				FreeMemory(memoryResource, setData);
+
+			setData = newData;
+			setSize = dest - newData;
+			setCapacity = newCapacity;
+
+			return rejected - values;
+		}
+		size_type SearchLowerBound(const value_type& val) const {
+			// Search the frozen index, if the set has one
+			if(setIndex.IsBuilt())
+				return setIndex.LowerBound(val);
+
+			// Halve the searched range until one value is left, choosing each half without branching
+			const_pointer base = setData;
+			size_type size = setSize;
+			while(size > 1) {
+				size_type half = size >> 1;
+				base = Lower()(base[half], val) ? base + half : base;
+				size -= half;
+			}
+
+			return (base - setData) + (size && Lower()(*base, val));
+		}
+		size_type SearchUpperBound(const value_type& val) const {
+			// Search the frozen index, if the set has one
+			if(setIndex.IsBuilt())
+				return setIndex.UpperBound(val);
+
+			// Halve the searched range until one value is left, choosing each half without branching
+			const_pointer base = setData;
+			size_type size = setSize;
+			while(size > 1) {
+				size_type half = size >> 1;
+				base = !Lower()(val, base[half]) ? base + half : base;
+				size -= half;
+			}
+
+			return (base - setData) + (size && !Lower()(val, *base));
+		}
+
+		MemoryResource* memoryResource = nullptr;
 		size_type setSize = 0;
 		size_type setCapacity = 0;
 		pointer setData = nullptr;
+		EytzingerIndex<value_type, Lower> setIndex;
 	};
 }
\ No newline at end of file
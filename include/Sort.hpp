@@ -0,0 +1,230 @@
+#pragma once
+
+#include "Defines.hpp"
+#include "Allocator.hpp"
+#include "Compare.hpp"
+#include "Exception.hpp"
+#include "Job.hpp"
+#include "Memory.hpp"
+
+namespace wfe {
+	/// @brief The length of the runs sorted with insertion sort before being merged.
+	constexpr size_t SORT_RUN_LENGTH = 16;
+	/// @brief The minimum number of values sorted in parallel, under which ParallelSort sorts on the calling thread.
+	constexpr size_t PARALLEL_SORT_MIN_COUNT = 32768;
+
+	/// @brief Relocates one value bitwise. Unlike wfe::memcpy, the copy is inlined, since the value's size is known at compile time.
+	/// @tparam T The type of the relocated value.
+	/// @param dest A pointer to the value's new, uninitialized location.
+	/// @param src A pointer to the value.
+	template<class T>
+	WFE_INLINE void RelocateValue(T* dest, const T* src) {
+#if defined(_MSC_VER)
+		// Copy the value byte by byte, which the compiler turns into a few wide moves
+		uint8_t* destBytes = (uint8_t*)dest;
+		const uint8_t* srcBytes = (const uint8_t*)src;
+		for(size_t i = 0; i != sizeof(T); ++i)
+			destBytes[i] = srcBytes[i];
+#else
+		__builtin_memcpy((void*)dest, (const void*)src, sizeof(T));
+#endif
+	}
+
+	/// @brief Sorts the given short run of values with insertion sort, relocating them bitwise.
+	/// @tparam T The type of the sorted values.
+	/// @tparam Lower The function struct used to check if one value should be before another.
+	/// @param data A pointer to the first value.
+	/// @param count The number of values.
+	template<class T, class Lower>
+	void InsertionSortValues(T* data, size_t count) {
+		alignas(T) uint8_t value[sizeof(T)];
+
+		for(size_t i = 1; i < count; ++i) {
+			// Skip the value if it is already in place
+			if(!Lower()(data[i], data[i - 1]))
+				continue;
+
+			// Find the value's position, after every value that isn't higher than it
+			size_t pos = i - 1;
+			while(pos && Lower()(data[i], data[pos - 1]))
+				--pos;
+
+			// Move the higher values forward and put the value in their place
+			RelocateValue((T*)value, data + i);
+			wfe::memmove(data + pos + 1, data + pos, (i - pos) * sizeof(T));
+			RelocateValue(data + pos, (const T*)value);
+		}
+	}
+	/// @brief Merges the two given sorted runs of values into the given destination, relocating them bitwise. Values from the first run go before equal values from the second run.
+	/// @tparam T The type of the merged values.
+	/// @tparam Lower The function struct used to check if one value should be before another.
+	/// @param first A pointer to the first run.
+	/// @param firstCount The number of values in the first run.
+	/// @param second A pointer to the second run.
+	/// @param secondCount The number of values in the second run.
+	/// @param dest A pointer to the destination, which must not overlap with either run.
+	template<class T, class Lower>
+	void MergeSortedValues(const T* first, size_t firstCount, const T* second, size_t secondCount, T* dest) {
+		const T* firstEnd = first + firstCount;
+		const T* secondEnd = second + secondCount;
+
+		// Take the lower value from either run until one of them runs out, choosing the run without branching
+		while(first != firstEnd && second != secondEnd) {
+			bool8_t takeSecond = Lower()(*second, *first);
+			RelocateValue(dest++, takeSecond ? second : first);
+			second += takeSecond;
+			first += !takeSecond;
+		}
+
+		// Copy the rest of the run that is left
+		wfe::memcpy(dest, first, (firstEnd - first) * sizeof(T));
+		dest += firstEnd - first;
+		wfe::memcpy(dest, second, (secondEnd - second) * sizeof(T));
+	}
+	/// @brief Merges every two neighbouring sorted runs of the given width from the given source into the given destination.
+	/// @tparam T The type of the merged values.
+	/// @tparam Lower The function struct used to check if one value should be before another.
+	/// @param src A pointer to the sorted runs.
+	/// @param dest A pointer to the destination, which must not overlap with the source.
+	/// @param begin The index of the first value to merge, which must be a multiple of twice the width.
+	/// @param end The index right after the last value to merge.
+	/// @param width The width of every sorted run.
+	template<class T, class Lower>
+	void MergeSortedRuns(const T* src, T* dest, size_t begin, size_t end, size_t width) {
+		for(size_t i = begin; i < end; i += width << 1) {
+			size_t middle = end - i > width ? i + width : end;
+			size_t runEnd = end - middle > width ? middle + width : end;
+			MergeSortedValues<T, Lower>(src + i, middle - i, src + middle, runEnd - middle, dest + i);
+		}
+	}
+	/// @brief Sorts the given values with a merge sort, using the given buffer for the merges.
+	/// @tparam T The type of the sorted values.
+	/// @tparam Lower The function struct used to check if one value should be before another.
+	/// @param data A pointer to the first value.
+	/// @param count The number of values.
+	/// @param buffer A pointer to uninitialized memory that can hold every value.
+	/// @return True if the sorted values ended up in the buffer, or false if they are in the given data.
+	template<class T, class Lower>
+	bool8_t SortValuesWithBuffer(T* data, size_t count, T* buffer) {
+		// Sort small runs with insertion sort
+		for(size_t i = 0; i < count; i += SORT_RUN_LENGTH)
+			InsertionSortValues<T, Lower>(data + i, count - i > SORT_RUN_LENGTH ? SORT_RUN_LENGTH : count - i);
+
+		// Merge the runs, going back and forth between the data and the buffer
+		bool8_t inBuffer = false;
+		for(size_t width = SORT_RUN_LENGTH; width < count; width <<= 1) {
+			if(inBuffer) {
+				MergeSortedRuns<T, Lower>(buffer, data, 0, count, width);
+			} else {
+				MergeSortedRuns<T, Lower>(data, buffer, 0, count, width);
+			}
+			inBuffer = !inBuffer;
+		}
+
+		return inBuffer;
+	}
+
+	/// @brief Sorts the given values with a stable merge sort. Values are relocated bitwise, like every container does, so no constructors or destructors are called.
+	/// @tparam T The type of the sorted values.
+	/// @tparam Lower The function struct used to check if one value should be before another.
+	/// @param data A pointer to the first value.
+	/// @param count The number of values.
+	/// @param resource The memory resource to allocate the sort's buffer from, or a nullptr to allocate from the heap.
+	template<class T, class Lower = LowerComp<T>>
+	void Sort(T* data, size_t count, MemoryResource* resource = nullptr) {
+		// Sort short ranges in place
+		if(count <= SORT_RUN_LENGTH) {
+			InsertionSortValues<T, Lower>(data, count);
+			return;
+		}
+
+		// Allocate the merge buffer
+		T* buffer = (T*)AllocMemory(resource, count * sizeof(T));
+		if(!buffer)
+			throw BadAllocException("Failed to allocate sort buffer!");
+
+		// Sort the values, copying them back if they ended up in the buffer
+		if(SortValuesWithBuffer<T, Lower>(data, count, buffer))
+			wfe::memcpy(data, buffer, count * sizeof(T));
+
+		FreeMemory(resource, buffer);
+	}
+	/// @brief Sorts the given values with a stable merge sort, running on the given job manager's threads. Every thread sorts its own part of the values, after which the parts are merged in parallel rounds. Values are relocated bitwise, like every container does, so no constructors or destructors are called.
+	/// @tparam T The type of the sorted values.
+	/// @tparam Lower The function struct used to check if one value should be before another.
+	/// @param jobManager The job manager to run the sort on. Fewer than PARALLEL_SORT_MIN_COUNT values are sorted on the calling thread.
+	/// @param data A pointer to the first value.
+	/// @param count The number of values.
+	/// @param resource The memory resource to allocate the sort's buffer from, or a nullptr to allocate from the heap.
+	template<class T, class Lower = LowerComp<T>>
+	void ParallelSort(JobManager& jobManager, T* data, size_t count, MemoryResource* resource = nullptr) {
+		// Sort small ranges on the calling thread
+		if(count < PARALLEL_SORT_MIN_COUNT) {
+			Sort<T, Lower>(data, count, resource);
+			return;
+		}
+
+		// Allocate the merge buffer
+		T* buffer = (T*)AllocMemory(resource, count * sizeof(T));
+		if(!buffer)
+			throw BadAllocException("Failed to allocate sort buffer!");
+
+		// Split the values into a power of 2 parts, giving every worker thread and the calling thread a part
+		size_t partCount = 1;
+		while(partCount < jobManager.GetThreadCount() + 1 && count / (partCount << 1) >= SORT_RUN_LENGTH)
+			partCount <<= 1;
+
+		struct SortInfo {
+			T* data;
+			T* buffer;
+			size_t count;
+			size_t partSize;
+		} info { data, buffer, count, (count + partCount - 1) / partCount };
+		partCount = (count + info.partSize - 1) / info.partSize;
+
+		// Sort every part on its own
+		jobManager.ParallelFor(0, partCount, 1, [](size_t partBegin, size_t partEnd, void* args) {
+			SortInfo& info = *(SortInfo*)args;
+
+			for(size_t part = partBegin; part != partEnd; ++part) {
+				size_t begin = part * info.partSize;
+				size_t end = info.count - begin > info.partSize ? begin + info.partSize : info.count;
+
+				// Move the part into the buffer if it ended up in the data, so that every part is in the buffer
+				if(!SortValuesWithBuffer<T, Lower>(info.data + begin, end - begin, info.buffer + begin))
+					wfe::memcpy(info.buffer + begin, info.data + begin, (end - begin) * sizeof(T));
+			}
+		}, &info);
+
+		// Merge the parts in rounds, merging every two neighbouring parts in parallel
+		T* src = buffer;
+		T* dest = data;
+		for(size_t width = info.partSize; width < count; width <<= 1) {
+			struct MergeInfo {
+				const T* src;
+				T* dest;
+				size_t count;
+				size_t width;
+			} mergeInfo { src, dest, count, width };
+
+			size_t mergeCount = (count + (width << 1) - 1) / (width << 1);
+			jobManager.ParallelFor(0, mergeCount, 1, [](size_t mergeBegin, size_t mergeEnd, void* args) {
+				MergeInfo& info = *(MergeInfo*)args;
+
+				size_t begin = mergeBegin * (info.width << 1);
+				size_t end = info.count - begin > (mergeEnd - mergeBegin) * (info.width << 1) ? begin + (mergeEnd - mergeBegin) * (info.width << 1) : info.count;
+				MergeSortedRuns<T, Lower>(info.src, info.dest, begin, end, info.width);
+			}, &mergeInfo);
+
+			T* aux = src;
+			src = dest;
+			dest = aux;
+		}
+
+		// Copy the values back if they ended up in the buffer
+		if(src != data)
+			wfe::memcpy(data, src, count * sizeof(T));
+
+		FreeMemory(resource, buffer);
+	}
+}
\ No newline at end of file
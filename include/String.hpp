@@ -2,8 +2,10 @@
 
 #include "Defines.hpp"
 #include "Allocator.hpp"
+#include "Compare.hpp"
 #include "Memory.hpp"
 #include "Exception.hpp"
+#include "Math.hpp"
 #include <stdarg.h>
 #include <stdlib.h>
 #include <string>
@@ -29,9 +31,12 @@ namespace wfe {
 
 		/// @brief Creates an empty string.
 		constexpr string() = default;
+		/// @brief Creates an empty string that allocates its memory from the given resource.
+		/// @param resource The memory resource to allocate from. It must outlive the string.
+		explicit string(MemoryResource& resource) : memoryResource(&resource) { }
 		/// @brief Copies the given string.
 		/// @param other The string to copy.
-		string(const string& other) : strSize(other.strSize), strCapacity(other.strCapacity), strData((pointer)AllocMemory(strCapacity)) {
+		string(const string& other) : strSize(other.strSize), strCapacity(other.strCapacity), strData((pointer)AllocMemory(memoryResource, strCapacity)) {
 			// Check if the memory has been allocated successfully
 			if(strCapacity && !strData)
 				throw BadAllocException("Failed to allocate string data!");
@@ -41,7 +46,7 @@ namespace wfe {
 		}
 		/// @brief Moves the contents from one string to another.
 		/// @param other The string to move from.
-		string(string&& other) noexcept : strSize(other.strSize), strCapacity(other.strCapacity), strData(other.strData) {
+		string(string&& other) noexcept : memoryResource(other.memoryResource), strSize(other.strSize), strCapacity(other.strCapacity), strData(other.strData) {
 			// Unlink the data from the other string
 			other.strData = nullptr;
 		}
@@ -58,7 +63,7 @@ namespace wfe {
 			strCapacity <<= 1;
 			
 			// Allocate the string's data
-			strData = (pointer)AllocMemory(strCapacity);
+			strData = (pointer)AllocMemory(memoryResource, strCapacity);
 			if(strCapacity && !strData)
 				throw BadAllocException("Failed to allocate string data!");
 
@@ -79,7 +84,7 @@ namespace wfe {
 			strCapacity <<= 1;
 			
 			// Allocate the string's data
-			strData = (pointer)AllocMemory(strCapacity);
+			strData = (pointer)AllocMemory(memoryResource, strCapacity);
 			if(strCapacity && !strData)
 				throw BadAllocException("Failed to allocate string data!");
 
@@ -103,7 +108,7 @@ namespace wfe {
 			strCapacity <<= 1;
 			
 			// Allocate the string's data
-			strData = (pointer)AllocMemory(strCapacity);
+			strData = (pointer)AllocMemory(memoryResource, strCapacity);
 			if(strCapacity && !strData)
 				throw BadAllocException("Failed to allocate string data!");
 
@@ -115,7 +120,7 @@ namespace wfe {
 		}
 		/// @brief Copies the given std library string.
 		/// @param str The string to copy.
-		string(const std::string& str) : strSize(str.size()), strCapacity(str.capacity()), strData((pointer)AllocMemory(strCapacity)) {
+		string(const std::string& str) : strSize(str.size()), strCapacity(str.capacity()), strData((pointer)AllocMemory(memoryResource, strCapacity)) {
 			// Check if the memory has been allocated successfully
 			if(strCapacity && !strData)
 				throw BadAllocException("Failed to allocate string data!");
@@ -137,9 +142,9 @@ namespace wfe {
 			strCapacity = other.strCapacity;
 
 			if(strData) {
-				strData = (pointer)ReallocMemory(strData, strCapacity);
+				strData = (pointer)ReallocMemory(memoryResource, strData, strCapacity);
 			} else {
-				strData = (pointer)AllocMemory(strCapacity);
+				strData = (pointer)AllocMemory(memoryResource, strCapacity);
 			}
 
 			// Check if the memory has been allocated successfully
@@ -157,9 +162,10 @@ namespace wfe {
 		string& operator=(string&& other) {
 			// Free the string's contents (if they exist)
 			if(strData)
-				FreeMemory(strData);
+				FreeMemory(memoryResource, strData);
 
 			// Set the new string's values
+			memoryResource = other.memoryResource;
 			strSize = other.strSize;
 			strCapacity = other.strCapacity;
 			strData = other.strData;
@@ -456,9 +462,9 @@ namespace wfe {
 			strCapacity = str.strCapacity;
 
 			if(strData) {
-				strData = (pointer)ReallocMemory(strData, strCapacity);
+				strData = (pointer)ReallocMemory(memoryResource, strData, strCapacity);
 			} else {
-				strData = (pointer)AllocMemory(strCapacity);
+				strData = (pointer)AllocMemory(memoryResource, strCapacity);
 			}
 
 			// Check if the memory has been allocated successfully
@@ -476,9 +482,10 @@ namespace wfe {
 		string& assign(string&& other) {
 			// Free the string's contents (if they exist)
 			if(strData)
-				FreeMemory(strData);
+				FreeMemory(memoryResource, strData);
 			
 			// Set the new string's values
+			memoryResource = other.memoryResource;
 			strSize = other.strSize;
 			strCapacity = other.strCapacity;
 			strData = other.strData;
@@ -1050,16 +1057,19 @@ namespace wfe {
 				return;
 		
 			// Save all member variables of this string separately
+			MemoryResource* auxMemoryResource = memoryResource;
 			size_type auxSize = strSize;
 			size_type auxCapacity = strCapacity;
 			pointer auxData = strData;
 
 			// Copy the data from the given string to this string
+			memoryResource = str.memoryResource;
 			strSize = str.strSize;
 			strCapacity = str.strCapacity;
 			strData = str.strData;
 
 			// Copy the saved data to the given string
+			str.memoryResource = auxMemoryResource;
 			str.strSize = auxSize;
 			str.strCapacity = auxCapacity;
 			str.strData = auxData;
@@ -1147,9 +1157,9 @@ namespace wfe {
 
 				// Reallocate the string's data
 				if(strData) { 
-					strData = (pointer)ReallocMemory(strData, strCapacity);
+					strData = (pointer)ReallocMemory(memoryResource, strData, strCapacity);
 				} else {
-					strData = (pointer)AllocMemory(strCapacity);
+					strData = (pointer)AllocMemory(memoryResource, strCapacity);
 				}
 
 				// Check if the memory has been allocated successfully
@@ -1190,9 +1200,9 @@ namespace wfe {
 
 			// Reallocate the string's data
 			if(strData) { 
-				strData = (pointer)ReallocMemory(strData, newCapacity);
+				strData = (pointer)ReallocMemory(memoryResource, strData, newCapacity);
 			} else {
-				strData = (pointer)AllocMemory(newCapacity);
+				strData = (pointer)AllocMemory(memoryResource, newCapacity);
 			}
 
 			// Check if the memory has been allocated successfully
@@ -4514,18 +4524,126 @@ namespace wfe {
 			return 0;
 		}
 
+		/// @brief Gets the memory resource the string allocates its memory from.
+		/// @return A pointer to the string's memory resource, or a nullptr if it allocates from the heap.
+		MemoryResource* get_memory_resource() const {
+			return memoryResource;
+		}
+
 		/// @brief Destroys the string.
 		~string() {
 			// Free the string's contents (if they exist)
 			if(strData)
-				FreeMemory(strData);
+				FreeMemory(memoryResource, strData);
 		}
 	private:
+		MemoryResource* memoryResource = nullptr;
 		size_type strSize = 0;
 		size_type strCapacity = 0;
 		pointer strData = nullptr;
 	};
 
+	/// @brief A read-only view of a sequence of characters owned by someone else, such as a string or a slice of a file buffer. The characters don't have to be null terminated.
+	class string_view {
+	public:
+		/// @brief The string view's value.
+		typedef char_t value_type;
+		/// @brief A const reference to the string view's value.
+		typedef const char_t& const_reference;
+		/// @brief A const pointer to the string view's value.
+		typedef const char_t* const_pointer;
+		/// @brief A const iterator to the string view's values.
+		typedef const char_t* const_iterator;
+		/// @brief Used for holding sizes.
+		typedef size_t size_type;
+
+		/// @brief Creates an empty string view.
+		constexpr string_view() = default;
+		/// @brief Creates a view of the given null terminated string.
+		/// @param str The string to view.
+		string_view(const_pointer str) : viewData(str), viewSize(strlen(str)) { }
+		/// @brief Creates a view of the given characters.
+		/// @param ptr A pointer to the first character.
+		/// @param size The number of characters.
+		constexpr string_view(const_pointer ptr, size_type size) : viewData(ptr), viewSize(size) { }
+		/// @brief Creates a view of the given string's characters. The view is invalidated when the string is modified or destroyed.
+		/// @param str The string to view.
+		string_view(const string& str) : viewData(str.data()), viewSize(str.length()) { }
+
+		/// @brief Accesses the character at the given position.
+		/// @param pos The position of the wanted character.
+		/// @return A const reference to the wanted character.
+		const_reference operator[](size_type pos) const {
+			return viewData[pos];
+		}
+
+		/// @brief Gets a pointer to the viewed characters.
+		/// @return A pointer to the first viewed character.
+		const_pointer data() const {
+			return viewData;
+		}
+		/// @brief Gets the number of viewed characters.
+		/// @return The number of viewed characters.
+		size_type size() const {
+			return viewSize;
+		}
+		/// @brief Gets the number of viewed characters.
+		/// @return The number of viewed characters.
+		size_type length() const {
+			return viewSize;
+		}
+		/// @brief Tests if the string view is empty.
+		/// @return True if the string view is empty, otherwise false.
+		bool8_t empty() const {
+			return !viewSize;
+		}
+
+		/// @brief Returns an iterator to the beginning of the string view.
+		/// @return An iterator to the beginning of the string view.
+		const_iterator begin() const {
+			return viewData;
+		}
+		/// @brief Returns an iterator to the end of the string view.
+		/// @return An iterator to the end of the string view.
+		const_iterator end() const {
+			return viewData + viewSize;
+		}
+
+		/// @brief Generates a view of the wanted part of this string view.
+		/// @param pos The starting position of the wanted part.
+		/// @param len The length of the wanted part.
+		/// @return A view of the wanted part.
+		string_view substr(size_type pos = 0, size_type len = SIZE_T_MAX) const {
+			// Assert that the starting position must be at most the string view's size
+			WFE_ASSERT(pos <= viewSize, "The starting position of a substring must be at most the string view's size!")
+
+			// Set the actual length of the substring
+			len = (len > (viewSize - pos)) ? (viewSize - pos) : len;
+
+			return string_view(viewData + pos, len);
+		}
+		/// @brief Compares this string view with the given string view.
+		/// @param str The string view to compare with.
+		/// @return An integer representing the relationship between the two strings: < 0 if this string is smaller than the given string, 0 if the two strings are equal and > 0 if this string is bigger than the given string.
+		int32_t compare(string_view str) const {
+			// Compare the common prefix, then the lengths
+			size_type minLength = (viewSize < str.viewSize) ? viewSize : str.viewSize;
+			int32_t result = minLength ? memcmp(viewData, str.viewData, minLength) : 0;
+			if(result)
+				return result;
+
+			return (viewSize > str.viewSize) - (viewSize < str.viewSize);
+		}
+
+		/// @brief Creates a string holding a copy of the viewed characters.
+		explicit operator string() const {
+			return string(viewData, viewSize);
+		}
+	private:
+		const_pointer viewData = nullptr;
+		size_type viewSize = 0;
+	};
+
 	/// @brief Concatenates the two given strings.
 	/// @param str1 The first string.
 	/// @param str2 The second string.
@@ -4762,6 +4880,77 @@ namespace wfe {
 		return str2.compare(str1) <= 0;
 	}
 
+	/// @brief Compares the two given string views.
+	/// @param str1 The first string.
+	/// @param str2 The second string.
+	/// @return True if both strings are equal, otherwise false.
+	WFE_INLINE bool8_t operator==(string_view str1, string_view str2) {
+		return str1.length() == str2.length() && !memcmp(str1.data(), str2.data(), str1.length());
+	}
+	/// @brief Compares the two given string views.
+	/// @param str1 The first string.
+	/// @param str2 The second string.
+	/// @return True if the strings are different, otherwise false.
+	WFE_INLINE bool8_t operator!=(string_view str1, string_view str2) {
+		return !(str1 == str2);
+	}
+	/// @brief Compares the given string with the given string view.
+	/// @param str1 The first string.
+	/// @param str2 The second string.
+	/// @return True if both strings are equal, otherwise false.
+	WFE_INLINE bool8_t operator==(const string& str1, string_view str2) {
+		return string_view(str1) == str2;
+	}
+	/// @brief Compares the given string view with the given string.
+	/// @param str1 The first string.
+	/// @param str2 The second string.
+	/// @return True if both strings are equal, otherwise false.
+	WFE_INLINE bool8_t operator==(string_view str1, const string& str2) {
+		return str1 == string_view(str2);
+	}
+	/// @brief Compares the given string view with the given C string.
+	/// @param str1 The first string.
+	/// @param str2 The second string.
+	/// @return True if both strings are equal, otherwise false.
+	WFE_INLINE bool8_t operator==(string_view str1, const char_t* str2) {
+		return str1 == string_view(str2);
+	}
+	/// @brief Compares the given C string with the given string view.
+	/// @param str1 The first string.
+	/// @param str2 The second string.
+	/// @return True if both strings are equal, otherwise false.
+	WFE_INLINE bool8_t operator==(const char_t* str1, string_view str2) {
+		return string_view(str1) == str2;
+	}
+	/// @brief Compares the given string with the given string view.
+	/// @param str1 The first string.
+	/// @param str2 The second string.
+	/// @return True if the strings are different, otherwise false.
+	WFE_INLINE bool8_t operator!=(const string& str1, string_view str2) {
+		return !(str1 == str2);
+	}
+	/// @brief Compares the given string view with the given string.
+	/// @param str1 The first string.
+	/// @param str2 The second string.
+	/// @return True if the strings are different, otherwise false.
+	WFE_INLINE bool8_t operator!=(string_view str1, const string& str2) {
+		return !(str1 == str2);
+	}
+	/// @brief Compares the given string view with the given C string.
+	/// @param str1 The first string.
+	/// @param str2 The second string.
+	/// @return True if the strings are different, otherwise false.
+	WFE_INLINE bool8_t operator!=(string_view str1, const char_t* str2) {
+		return !(str1 == str2);
+	}
+	/// @brief Compares the given C string with the given string view.
+	/// @param str1 The first string.
+	/// @param str2 The second string.
+	/// @return True if the strings are different, otherwise false.
+	WFE_INLINE bool8_t operator!=(const char_t* str1, string_view str2) {
+		return !(str1 == str2);
+	}
+
 	/// @brief Converts the given number to a string.
 	/// @param num The number to convert.
 	/// @param base The base of the resulting string's number.
@@ -4953,4 +5142,58 @@ namespace wfe {
 		// End the va list
 		va_end(args);
 	}
+
+	/// @brief Hashes strings. Null terminated strings and string views can also be hashed, giving the same hash as a string holding the same characters, which lets hash containers with string keys look them up without creating a string.
+	template<>
+	struct Hash<string> {
+		/// @brief Allows hash containers to pass other key types to this function struct.
+		typedef void is_transparent;
+
+		/// @brief Hashes the given string.
+		/// @param val The string to hash.
+		/// @return A 64-bit hash of the given string.
+		uint64_t operator()(const string& val) const {
+			return HashMemory(val.data(), val.length());
+		}
+		/// @brief Hashes the given null terminated string.
+		/// @param val The string to hash.
+		/// @return A 64-bit hash of the given string.
+		uint64_t operator()(const char_t* val) const {
+			return HashMemory(val, strlen(val));
+		}
+		/// @brief Hashes the given string view.
+		/// @param val The string view to hash.
+		/// @return A 64-bit hash of the given string view.
+		uint64_t operator()(string_view val) const {
+			return HashMemory(val.data(), val.length());
+		}
+	};
+	/// @brief Compares strings with strings, null terminated strings or string views, which lets hash containers with string keys look them up without creating a string.
+	template<>
+	struct EqualComp<string> {
+		/// @brief Allows hash containers to pass other key types to this function struct.
+		typedef void is_transparent;
+
+		/// @brief Checks if the two given strings are equal.
+		/// @param val1 The first string in the comparison.
+		/// @param val2 The second string in the comparison.
+		/// @return True if the two strings are equal, otherwise false.
+		bool8_t operator()(const string& val1, const string& val2) const {
+			return string_view(val1) == string_view(val2);
+		}
+		/// @brief Checks if the given string is equal to the given null terminated string.
+		/// @param val1 The first string in the comparison.
+		/// @param val2 The second string in the comparison.
+		/// @return True if the two strings are equal, otherwise false.
+		bool8_t operator()(const string& val1, const char_t* val2) const {
+			return string_view(val1) == string_view(val2);
+		}
+		/// @brief Checks if the given string is equal to the given string view.
+		/// @param val1 The first string in the comparison.
+		/// @param val2 The second string in the comparison.
+		/// @return True if the two strings are equal, otherwise false.
+		bool8_t operator()(const string& val1, string_view val2) const {
+			return string_view(val1) == val2;
+		}
+	};
 }
\ No newline at end of file
@@ -2,6 +2,10 @@
 
 #include "Defines.hpp"
 
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
 namespace wfe {
 	/// @brief An implementation of a processor thread.
 	class Thread {
@@ -22,15 +26,43 @@ namespace wfe {
 			ERROR_THREAD_NOT_JOINABLE,
 			/// @brief A deadlock in the current thread was detected.
 			ERROR_DETECTED_DEADLOCK,
+			/// @brief The given thread options are invalid or not supported.
+			ERROR_INVALID_OPTIONS,
 			/// @brief An unknown or unhandled error prevented the requested thread operation.
 			ERROR_UNKNOWN
 		} ThreadResult;
 
+		/// @brief All possible thread scheduling priorities.
+		typedef enum {
+			/// @brief The lowest thread priority.
+			PRIORITY_LOWEST,
+			/// @brief A thread priority below normal.
+			PRIORITY_LOW,
+			/// @brief The default thread priority.
+			PRIORITY_NORMAL,
+			/// @brief A thread priority above normal. May require elevated privileges, otherwise the normal priority is kept.
+			PRIORITY_HIGH,
+			/// @brief The highest thread priority. May require elevated privileges, otherwise the normal priority is kept.
+			PRIORITY_HIGHEST
+		} ThreadPriority;
+
 		/// @brief The function that will be run on the thread.
 		typedef void*(*ThreadFunction)(void* args);
 		/// @brief Holds a thread's ID.
 		typedef uint64_t ThreadID;
 
+		/// @brief The options a thread is created with.
+		struct ThreadOptions {
+			/// @brief A bitmask of the processors the thread may run on, or 0 to let it run on any processor. Only the first 64 processors can be selected.
+			uint64_t affinityMask = 0;
+			/// @brief The size of the thread's stack in bytes, or 0 to use the platform's default.
+			size_t stackSize = 0;
+			/// @brief The thread's scheduling priority.
+			ThreadPriority priority = PRIORITY_NORMAL;
+			/// @brief The thread's name, shown in debuggers and profilers, or nullptr to leave it unnamed. Linux truncates names to 15 characters.
+			const char_t* name = nullptr;
+		};
+
 		/// @brief Converts the given thread result to its string equivalent.
 		/// @param result The thread result to convert.
 		/// @return The string equivalent of the given result.
@@ -50,6 +82,8 @@ namespace wfe {
 				return "ERROR_THREAD_NOT_JOINABLE";
 			case ERROR_DETECTED_DEADLOCK:
 				return "ERROR_DETECTED_DEADLOCK";
+			case ERROR_INVALID_OPTIONS:
+				return "ERROR_INVALID_OPTIONS";
 			default:
 				return "ERROR_UNKNOWN";
 			}
@@ -84,6 +118,12 @@ namespace wfe {
 		/// @param args The args to be passed to the given function.
 		/// @return Thread::SUCCESS if the thread began executing correctly, otherwise a corresponding error code.
 		ThreadResult Begin(ThreadFunction func, void* args);
+		/// @brief Begins executing the given function on a thread created with the given options.
+		/// @param func The function to execute on the thread.
+		/// @param args The args to be passed to the given function.
+		/// @param options The options to create the thread with.
+		/// @return Thread::SUCCESS if the thread began executing correctly, otherwise a corresponding error code.
+		ThreadResult Begin(ThreadFunction func, void* args, const ThreadOptions& options);
 		/// @brief Detaches the thread, causing it to be reclaimed by the implementation once it terminates.
 		/// @return Thread::SUCCESS if the thread was detached successfully, otherwise a corresponding error code.
 		ThreadResult Detach();
@@ -105,9 +145,59 @@ namespace wfe {
 	/// @brief Gets the current thread's ID.
 	/// @return THe current thread's ID.
 	Thread::ThreadID GetCurrentThreadID();
+	/// @brief The index GetCurrentThreadIndex returns on a thread that is exiting, once the thread's index was released.
+	constexpr size_t EXITED_THREAD_INDEX = SIZE_T_MAX;
+
+	/// @brief The function pointer type for a thread exit callback.
+	typedef void(*ThreadExitCallback)(size_t threadIndex, void* args);
+
+	/// @brief Assigns the current thread the lowest index that no running thread holds. Called by GetCurrentThreadIndex on the thread's first call.
+	/// @param threadIndex A reference to the thread's cached index, which is set to EXITED_THREAD_INDEX when the thread exits.
+	/// @return The current thread's index.
+	size_t AcquireCurrentThreadIndex(size_t& threadIndex);
+	/// @brief Gets a small index unique to the current thread among all running threads. Indices of exited threads are reused by new threads, so they stay below the peak number of threads running at once. Useful for spreading threads between per-thread slots.
+	/// @return The current thread's index, or EXITED_THREAD_INDEX if the thread is exiting and its index was already released.
+	WFE_INLINE size_t GetCurrentThreadIndex() {
+		// The index starts right below EXITED_THREAD_INDEX until it is assigned
+		static thread_local size_t threadIndex = EXITED_THREAD_INDEX - 1;
+		if(threadIndex == EXITED_THREAD_INDEX - 1)
+			return AcquireCurrentThreadIndex(threadIndex);
+
+		return threadIndex;
+	}
+	/// @brief Adds a callback that is called on every exiting thread that was assigned an index, right before its index is released.
+	/// @param callback The callback to add.
+	/// @param args The args to call the callback with.
+	void AddThreadExitCallback(ThreadExitCallback callback, void* args);
+	/// @brief Removes the given thread exit callback, waiting for any running call to it to finish.
+	/// @param callback The callback to remove.
+	/// @param args The args the callback was added with.
+	void RemoveThreadExitCallback(ThreadExitCallback callback, void* args);
+	/// @brief Hints to the processor that the current thread is running a spin-wait loop, reducing the loop's power usage and its impact on other hardware threads.
+	WFE_INLINE void PauseCurrentThread() {
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+		_mm_pause();
+#elif defined(__x86_64__) || defined(__i386__)
+		__builtin_ia32_pause();
+#elif defined(__aarch64__) || defined(__arm__)
+		asm volatile("yield");
+#endif
+	}
+	/// @brief Yields the rest of the current thread's time slice to other threads.
+	void YieldCurrentThread();
+	/// @brief Parks the current thread until another thread wakes the given value's waiters. Returns immediately if the value doesn't equal the expected value, and may also return spuriously.
+	/// @param value The value to wait on.
+	/// @param expected The value's expected value, checked atomically with parking the thread.
+	void WaitOnValue(atomic_uint32_t& value, uint32_t expected);
+	/// @brief Wakes every thread parked on the given value.
+	/// @param value The value to wake the waiters of.
+	void WakeAllOnValue(atomic_uint32_t& value);
 	/// @brief Exits the current thread, calcelling all processing on it.
 	/// @param returnValue The return value to be extracted on joining the thread.
 	void ExitCurrentThread(void* returnValue);
+	/// @brief Gets a bitmask of the processors the current thread may run on, which may be restricted by the process's affinity, taskset or cgroup cpusets. Only the first 64 processors are included.
+	/// @return The current thread's affinity mask, or 0 if it couldn't be retrieved.
+	uint64_t GetCurrentThreadAffinityMask();
 	/// @brief Returns the number of processors.
 	/// @return The number of processors.
 	size_t GetProcessorCount();
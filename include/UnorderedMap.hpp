@@ -263,7 +263,18 @@ namespace wfe {
 
 		/// @brief Creates an empty unordered map.
 		/// @param n The total number of buckets.
-		unordered_map(size_type n = 16) : umapBucketCount(n), umapBuckets((node_type**)AllocMemory(umapBucketCount * sizeof(node_type*))), umapSize(0), umapCapacity(0), umapData(nullptr) {
+		unordered_map(size_type n = 16) : umapBucketCount(n), umapBuckets((node_type**)AllocMemory(memoryResource, umapBucketCount * sizeof(node_type*))), umapSize(0), umapCapacity(0), umapData(nullptr) {
+			// Check if the unordered map's buckets were allocated correctly
+			if(!umapBuckets)
+				throw BadAllocException("Failed to allocate unordered map buckets!");
+
+			// Set all the bucket pointers to nullptr
+			wfe::memset(umapBuckets, 0, umapBucketCount * sizeof(node_type*));
+		}
+		/// @brief Creates an empty unordered map that allocates its memory from the given resource.
+		/// @param resource The memory resource to allocate from. It must outlive the unordered map.
+		/// @param n The number of buckets.
+		explicit unordered_map(MemoryResource& resource, size_type n = 16) : memoryResource(&resource), umapBucketCount(n), umapBuckets((node_type**)AllocMemory(memoryResource, umapBucketCount * sizeof(node_type*))), umapSize(0), umapCapacity(0), umapData(nullptr) {
 			// Check if the unordered map's buckets were allocated correctly
 			if(!umapBuckets)
 				throw BadAllocException("Failed to allocate unordered map buckets!");
@@ -273,7 +284,7 @@ namespace wfe {
 		}
 		/// @brief Copies the given unordered map.
 		/// @param other The unordered map to copy.
-		unordered_map(const unordered_map& other) : umapBucketCount(other.umapBucketCount), umapBuckets((node_type**)AllocMemory(umapBucketCount * sizeof(node_type*))), umapSize(other.umapSize), umapCapacity(other.umapCapacity), umapData((node_type*)AllocMemory(umapCapacity * sizeof(node_type))), umapMaxLoadFactor(other.umapMaxLoadFactor) {
+		unordered_map(const unordered_map& other) : umapBucketCount(other.umapBucketCount), umapBuckets((node_type**)AllocMemory(memoryResource, umapBucketCount * sizeof(node_type*))), umapSize(other.umapSize), umapCapacity(other.umapCapacity), umapData((node_type*)AllocMemory(memoryResource, umapCapacity * sizeof(node_type))), umapMaxLoadFactor(other.umapMaxLoadFactor) {
 			// Check if the unordered map's buckets were allocated correctly
 			if(!umapBuckets)
 				throw BadAllocException("Failed to allocate unordered map buckets!");
@@ -317,7 +328,7 @@ namespace wfe {
 		}
 		/// @brief Moves the given unordered map's contents.
 		/// @param other THe unordered map whose contents to move.
-		unordered_map(unordered_map&& other) noexcept : umapBucketCount(other.umapBucketCount), umapBuckets(other.umapBuckets), umapSize(other.umapSize), umapCapacity(other.umapCapacity), umapData(other.umapData), umapMaxLoadFactor(other.umapMaxLoadFactor) {
+		unordered_map(unordered_map&& other) noexcept : memoryResource(other.memoryResource), umapBucketCount(other.umapBucketCount), umapBuckets(other.umapBuckets), umapSize(other.umapSize), umapCapacity(other.umapCapacity), umapData(other.umapData), umapMaxLoadFactor(other.umapMaxLoadFactor) {
 			// Unlink all data from the other unordered set
 			other.umapBuckets = nullptr;
 			other.umapData = nullptr;
@@ -325,7 +336,7 @@ namespace wfe {
 		/// @brief Constructs an unordered set with all the values in the list.
 		/// @param list The list to copy from.
 		/// @param n The number of buckets.
-		unordered_map(std::initializer_list<value_type> list, size_type n = 16) : umapBucketCount(n), umapBuckets((node_type**)AllocMemory(umapBucketCount * sizeof(node_type*))), umapSize(0), umapCapacity(1), umapData((node_type*)AllocMemory(sizeof(node_type))) {
+		unordered_map(std::initializer_list<value_type> list, size_type n = 16) : umapBucketCount(n), umapBuckets((node_type**)AllocMemory(memoryResource, umapBucketCount * sizeof(node_type*))), umapSize(0), umapCapacity(1), umapData((node_type*)AllocMemory(memoryResource, sizeof(node_type))) {
 			// Check if the unordered map's buckets were allocated correctly
 			if(!umapBuckets)
 				throw BadAllocException("Failed to allocate unordered map buckets!");
@@ -400,7 +411,7 @@ namespace wfe {
 		}
 		/// @brief Copies the given std library unordered map.
 		/// @param other The std library unordered map to copy from.
-		unordered_map(const std::unordered_map<key_type, mapped_type>& other) : umapBucketCount(other.bucket_count()), umapBuckets((node_type**)AllocMemory(umapBucketCount * sizeof(node_type*))), umapSize(other.size()), umapCapacity(1), umapData(nullptr) {
+		unordered_map(const std::unordered_map<key_type, mapped_type>& other) : umapBucketCount(other.bucket_count()), umapBuckets((node_type**)AllocMemory(memoryResource, umapBucketCount * sizeof(node_type*))), umapSize(other.size()), umapCapacity(1), umapData(nullptr) {
 			// Check if the unordered map's buckets were allocated correctly
 			if(!umapBuckets)
 				throw BadAllocException("Failed to allocate unordered map buckets!");
@@ -415,7 +426,7 @@ namespace wfe {
 			umapCapacity <<= 1;
 
 			// Allocate the unordered map's data
-			umapData = (node_type*)AllocMemory(umapCapacity * sizeof(node_type));
+			umapData = (node_type*)AllocMemory(memoryResource, umapCapacity * sizeof(node_type));
 
 			if(umapCapacity && !umapData)
 				throw BadAllocException("Failed to allocate unordered map data!");
@@ -446,7 +457,7 @@ namespace wfe {
 			
 			// Free the unordered map's previous data
 			if(umapBuckets)
-				FreeMemory(umapBuckets);
+				FreeMemory(memoryResource, umapBuckets);
 			if(umapData) {
 				// Destruct every value in the unordered map
 				node_type* end = umapData + umapSize;
@@ -454,15 +465,15 @@ namespace wfe {
 					ptr->val.~value_type();
 				
 				// Free the unordered map's data
-				FreeMemory(umapData);
+				FreeMemory(memoryResource, umapData);
 			}
 
 			// Set the unordered map's new values
 			umapBucketCount = other.umapBucketCount;
-			umapBuckets = (node_type**)AllocMemory(umapBucketCount * sizeof(node_type*));
+			umapBuckets = (node_type**)AllocMemory(memoryResource, umapBucketCount * sizeof(node_type*));
 			umapSize = other.umapSize;
 			umapCapacity = other.umapCapacity;
-			umapData = (node_type*)AllocMemory(umapCapacity * sizeof(node_type));
+			umapData = (node_type*)AllocMemory(memoryResource, umapCapacity * sizeof(node_type));
 			umapMaxLoadFactor = other.umapMaxLoadFactor;
 
 			// Check if the unordered map's buckets were allocated correctly
@@ -514,7 +525,7 @@ namespace wfe {
 		unordered_map& operator=(unordered_map&& other) {
 			// Free the unordered map's previous data
 			if(umapBuckets)
-				FreeMemory(umapBuckets);
+				FreeMemory(memoryResource, umapBuckets);
 			if(umapData) {
 				// Destruct every value in the unordered map
 				node_type* end = umapData + umapSize;
@@ -522,12 +533,13 @@ namespace wfe {
 					ptr->val.~value_type();
 				
 				// Free the unordered map's data
-				FreeMemory(umapData);
+				FreeMemory(memoryResource, umapData);
 			}
 
 			// Set the unordered map's new values
+			memoryResource = other.memoryResource;
 			umapBucketCount = other.umapBucketCount;
-			umapBuckets = other.umapBuckes;
+			umapBuckets = other.umapBuckets;
 			umapSize = other.umapSize;
 			umapCapacity = other.umapCapacity;
 			umapData = other.umapData;
@@ -545,7 +557,7 @@ namespace wfe {
 		unordered_map& operator=(std::initializer_list<value_type> list) {
 			// Free the unordered map's previous data
 			if(umapBuckets)
-				FreeMemory(umapBuckets);
+				FreeMemory(memoryResource, umapBuckets);
 			if(umapData) {
 				// Destruct every value in the unordered map
 				node_type* end = umapData + umapSize;
@@ -553,7 +565,7 @@ namespace wfe {
 					ptr->val.~value_type();
 				
 				// Free the unordered map's data
-				FreeMemory(umapData);
+				FreeMemory(memoryResource, umapData);
 			}
 
 			// Set the unordered map's bucket count to the lowest power of 2 higher than or equal to the list's size
@@ -563,10 +575,10 @@ namespace wfe {
 					umapBucketCount <<= step;
 			
 			// Set the unordered map's new values
-			umapBuckets = (node_type**)AllocMemory(umapBucketCount * sizeof(node_type*));
+			umapBuckets = (node_type**)AllocMemory(memoryResource, umapBucketCount * sizeof(node_type*));
 			umapSize = 0;
 			umapCapacity = 1;
-			umapData = (node_type*)AllocMemory(sizeof(node_type));
+			umapData = (node_type*)AllocMemory(memoryResource, sizeof(node_type));
 			umapMaxLoadFactor = 1.f;
 
 			// Check if the unordered map's buckets were allocated correctly
@@ -812,156 +824,186 @@ namespace wfe {
 		/// @param key The key to look for.
 		/// @return A reference to the value with the given key.
 		mapped_type& at(const key_type& key) {
-			// Get the current key's bucket
-			size_type currentBucket = bucket(key);
-
-			node_type** elem = umapBuckets + currentBucket;
-
-			// Look for the given key in the bucket
-			while(*elem) {
-				// Check if the current key is already in the unordered map
-				if(Equal()((*elem)->val.first, key))
-					return (*elem)->val.second;
-				
-				// Move on to the next value
-				elem = &((*elem)->next);
-			}
+			// Look for the key
+			node_type* node = FindNode(key, KeyHash()(key));
 
 			// The value wasn't found; throw an error
-			throw OutOfRangeException("Failed to find the wanted key in an unordered map!");
+			if(!node)
+				throw OutOfRangeException("Failed to find the wanted key in an unordered map!");
+
+			return node->val.second;
 		}
 		/// @brief Accesses the value with the given key.
 		/// @param key The key to look for.
 		/// @return A const reference to the value with the given key.
 		const mapped_type& at(const key_type& key) const {
-			// Get the current key's bucket
-			size_type currentBucket = bucket(key);
+			// Look for the key
+			const node_type* node = FindNode(key, KeyHash()(key));
 
-			const node_type* const* elem = umapBucketCount + currentBucket;
+			// The value wasn't found; throw an error
+			if(!node)
+				throw OutOfRangeException("Failed to find the wanted key in an unordered map!");
 
-			// Look for the given key in the bucket
-			while(*elem) {
-				// Check if the current key is already in the unordered map
-				if(Equal()((*elem)->val.first, key))
-					return (*elem)->val.second;
-				
-				// Move on to the next value
-				elem = &((*elem)->next);
-			}
+			return node->val.second;
+		}
+
+		/// @brief Accesses the value with the given key, without converting the key to the key type.
+		/// @tparam K The type of the key, which must be supported by both the hash and the comparison function structs.
+		/// @param key The key to look for.
+		/// @return A reference to the value with the given key.
+		template<class K> requires TransparentHash<KeyHash, Equal>
+		mapped_type& at(const K& key) {
+			// Look for the key
+			node_type* node = FindNode(key, KeyHash()(key));
 
 			// The value wasn't found; throw an error
-			throw OutOfRangeException("Failed to find the wanted key in an unordered map!");
+			if(!node)
+				throw OutOfRangeException("Failed to find the wanted key in an unordered map!");
+
+			return node->val.second;
+		}
+		/// @brief Accesses the value with the given key, without converting the key to the key type.
+		/// @tparam K The type of the key, which must be supported by both the hash and the comparison function structs.
+		/// @param key The key to look for.
+		/// @return A const reference to the value with the given key.
+		template<class K> requires TransparentHash<KeyHash, Equal>
+		const mapped_type& at(const K& key) const {
+			// Look for the key
+			const node_type* node = FindNode(key, KeyHash()(key));
+
+			// The value wasn't found; throw an error
+			if(!node)
+				throw OutOfRangeException("Failed to find the wanted key in an unordered map!");
+
+			return node->val.second;
 		}
 
 		/// @brief Finds the value with the given key.
 		/// @param key The key to look for.
 		/// @return An iterator to the wanted value if it exists, otherwise unordered_map::end().
 		iterator find(const key_type& key) {
-			// Get the current key's bucket
-			size_type currentBucket = bucket(key);
-
-			node_type** elem = umapBuckets + currentBucket;
-
-			// Look for the given key in the bucket
-			while(*elem) {
-				// Check if the current key is already in the unordered map
-				if(Equal()((*elem)->val.first, key))
-					return *elem;
-				
-				// Move on to the next value
-				elem = &((*elem)->next);
-			}
-
-			// The value wasn't found; return an end operator
-			return end();
+			return find_with_hash(key, KeyHash()(key));
 		}
 		/// @brief Finds the value with the given key.
 		/// @param key The key to look for.
 		/// @return A const iterator to the wanted value if it exists, otherwise unordered_map::end().
 		const_iterator find(const key_type& key) const {
-			// Get the current key's bucket
-			size_type currentBucket = bucket(key);
-
-			const node_type* const* elem = umapBuckets + currentBucket;
-
-			// Look for the given key in the bucket
-			while(*elem) {
-				// Check if the current key is already in the unordered map
-				if(Equal()((*elem)->val.first, key))
-					return *elem;
-				
-				// Move on to the next value
-				elem = &((*elem)->next);
-			}
-
-			// The value wasn't found; return an end operator
-			return end();
+			return find_with_hash(key, KeyHash()(key));
 		}
 		/// @brief Gets the number of values with the given key.
-		/// @param key THe key to look for.
+		/// @param key The key to look for.
 		/// @return The number of values with the given key.
 		size_type count(const key_type& key) const {
-			// Get the current key's bucket
-			size_type currentBucket = bucket(key);
-
-			const node_type* const* elem = umapBuckets + currentBucket;
-
-			// Look for the given key in the bucket
-			while(*elem) {
-				// Check if the current key is already in the unordered map
-				if(Equal()((*elem)->val.first, key))
-					return 1;
-				
-				// Move on to the next value
-				elem = (const node_type**)&((*elem)->next);
-			}
-
-			// The value wasn't found; return 0
-			return 0;
+			return FindNode(key, KeyHash()(key)) != nullptr;
 		}
 		/// @brief Finds the range of values with the given key.
 		/// @param key The key to look for.
 		/// @return The bounds of the wanted range.
 		pair<iterator, iterator> equal_range(const key_type& key) {
-			// Get the current key's bucket
-			size_type currentBucket = bucket(key);
-
-			node_type** elem = umapBuckets + currentBucket;
-
-			// Look for the given key in the bucket
-			while(*elem) {
-				// Check if the current key is already in the unordered map
-				if((*elem)->val.first == key)
-					return { *elem, *elem + 1 };
-				
-				// Move on to the next value
-				elem = &((*elem)->next);
-			}
+			// Look for the key, returning a pair of end iterators if it wasn't found
+			node_type* node = FindNode(key, KeyHash()(key));
+			if(!node)
+				return { end(), end() };
 
-			// The value wasn't found; return a pair of end operators
-			return { end(), end() };
+			return { node, node + 1 };
 		}
 		/// @brief Finds the range of values with the given key.
 		/// @param key The key to look for.
 		/// @return The bounds of the wanted range.
 		pair<const_iterator, const_iterator> equal_range(const key_type& key) const {
-			// Get the current key's bucket
-			size_type currentBucket = bucket(key);
-
-			const node_type* const* elem = umapBucketCount + currentBucket;
+			// Look for the key, returning a pair of end iterators if it wasn't found
+			const node_type* node = FindNode(key, KeyHash()(key));
+			if(!node)
+				return { end(), end() };
 
-			// Look for the given key in the bucket
-			while(*elem) {
-				// Check if the current key is already in the unordered map
-				if((*elem)->val.first == key)
-					return { *elem, *elem + 1 };
-				
-				// Move on to the next value
-				elem = &((*elem)->next);
-			}
+			return { node, node + 1 };
+		}
 
-			// The value wasn't found; return a pair of end operators
-			return { end(), end() };
+		/// @brief Finds the value with the given key, without converting the key to the key type.
+		/// @tparam K The type of the key, which must be supported by both the hash and the comparison function structs.
+		/// @param key The key to look for.
+		/// @return An iterator to the wanted value if it exists, otherwise unordered_map::end().
+		template<class K> requires TransparentHash<KeyHash, Equal>
+		iterator find(const K& key) {
+			return find_with_hash(key, KeyHash()(key));
+		}
+		/// @brief Finds the value with the given key, without converting the key to the key type.
+		/// @tparam K The type of the key, which must be supported by both the hash and the comparison function structs.
+		/// @param key The key to look for.
+		/// @return A const iterator to the wanted value if it exists, otherwise unordered_map::end().
+		template<class K> requires TransparentHash<KeyHash, Equal>
+		const_iterator find(const K& key) const {
+			return find_with_hash(key, KeyHash()(key));
+		}
+		/// @brief Gets the number of values with the given key, without converting the key to the key type.
+		/// @tparam K The type of the key, which must be supported by both the hash and the comparison function structs.
+		/// @param key The key to look for.
+		/// @return The number of values with the given key.
+		template<class K> requires TransparentHash<KeyHash, Equal>
+		size_type count(const K& key) const {
+			return FindNode(key, KeyHash()(key)) != nullptr;
+		}
+		/// @brief Finds the range of values with the given key, without converting the key to the key type.
+		/// @tparam K The type of the key, which must be supported by both the hash and the comparison function structs.
+		/// @param key The key to look for.
+		/// @return The bounds of the wanted range.
+		template<class K> requires TransparentHash<KeyHash, Equal>
+		pair<iterator, iterator> equal_range(const K& key) {
+			// Look for the key, returning a pair of end iterators if it wasn't found
+			node_type* node = FindNode(key, KeyHash()(key));
+			if(!node)
+				return { end(), end() };
+
+			return { node, node + 1 };
+		}
+		/// @brief Finds the range of values with the given key, without converting the key to the key type.
+		/// @tparam K The type of the key, which must be supported by both the hash and the comparison function structs.
+		/// @param key The key to look for.
+		/// @return The bounds of the wanted range.
+		template<class K> requires TransparentHash<KeyHash, Equal>
+		pair<const_iterator, const_iterator> equal_range(const K& key) const {
+			// Look for the key, returning a pair of end iterators if it wasn't found
+			const node_type* node = FindNode(key, KeyHash()(key));
+			if(!node)
+				return { end(), end() };
+
+			return { node, node + 1 };
+		}
+		/// @brief Finds the value with the given key using a hash computed by the caller, which lets the same hash be used for lookups in several maps.
+		/// @param key The key to look for.
+		/// @param hash The key's hash, which must be equal to the hash given by the map's hash function struct.
+		/// @return An iterator to the wanted value if it exists, otherwise unordered_map::end().
+		iterator find_with_hash(const key_type& key, uint64_t hash) {
+			node_type* node = FindNode(key, hash);
+			return node ? iterator(node) : end();
+		}
+		/// @brief Finds the value with the given key using a hash computed by the caller, which lets the same hash be used for lookups in several maps.
+		/// @param key The key to look for.
+		/// @param hash The key's hash, which must be equal to the hash given by the map's hash function struct.
+		/// @return A const iterator to the wanted value if it exists, otherwise unordered_map::end().
+		const_iterator find_with_hash(const key_type& key, uint64_t hash) const {
+			const node_type* node = FindNode(key, hash);
+			return node ? const_iterator(node) : end();
+		}
+		/// @brief Finds the value with the given key using a hash computed by the caller, without converting the key to the key type.
+		/// @tparam K The type of the key, which must be supported by both the hash and the comparison function structs.
+		/// @param key The key to look for.
+		/// @param hash The key's hash, which must be equal to the hash given by the map's hash function struct.
+		/// @return An iterator to the wanted value if it exists, otherwise unordered_map::end().
+		template<class K> requires TransparentHash<KeyHash, Equal>
+		iterator find_with_hash(const K& key, uint64_t hash) {
+			node_type* node = FindNode(key, hash);
+			return node ? iterator(node) : end();
+		}
+		/// @brief Finds the value with the given key using a hash computed by the caller, without converting the key to the key type.
+		/// @tparam K The type of the key, which must be supported by both the hash and the comparison function structs.
+		/// @param key The key to look for.
+		/// @param hash The key's hash, which must be equal to the hash given by the map's hash function struct.
+		/// @return A const iterator to the wanted value if it exists, otherwise unordered_map::end().
+		template<class K> requires TransparentHash<KeyHash, Equal>
+		const_iterator find_with_hash(const K& key, uint64_t hash) const {
+			const node_type* node = FindNode(key, hash);
+			return node ? const_iterator(node) : end();
 		}
 
 		/// @brief Emplaces the constructed value into the unordered map.
@@ -993,8 +1035,15 @@ namespace wfe {
 		/// @param val The value to insert.
 		/// @return A pair containing an iterator to the inserted value or a value with the same key and a bool that is true if a new value was inserted, otherwise false.
 		pair<iterator, bool8_t> insert(const_reference val) {
+			return insert_with_hash(val, KeyHash()(val.first));
+		}
+		/// @brief Inserts the given value into the unordered map using a hash computed by the caller.
+		/// @param val The value to insert.
+		/// @param hash The hash of the value's key, which must be equal to the hash given by the map's hash function struct.
+		/// @return A pair containing an iterator to the inserted value or a value with the same key and a bool that is true if a new value was inserted, otherwise false.
+		pair<iterator, bool8_t> insert_with_hash(const_reference val, uint64_t hash) {
 			// Get the current value's bucket
-			size_type currentBucket = bucket(val.first);
+			size_type currentBucket = hash % umapBucketCount;
 
 			node_type** elem = umapBuckets + currentBucket;
 
@@ -1131,62 +1180,25 @@ namespace wfe {
 
 			return (node_type*)pos.node;
 		}
+		/// @brief Erases the value at the given position from the unordered map.
+		/// @param pos The position to erase from.
+		/// @return An iterator to the position occupied by the erased value.
+		iterator erase(iterator pos) {
+			return erase(const_iterator(pos));
+		}
 		/// @brief Erases the value with the given key from the unordered map.
 		/// @param key The key to look for.
 		/// @return The number of erased values.
 		size_type erase(const key_type& key) {
-			// Get the current key's bucket
-			size_type currentBucket = bucket(key);
-
-			// Look for the given value in the current bucket's linked list
-			node_type** elem = umapBuckets + currentBucket;
-
-			while(*elem) {
-				// Check if the given key is in the unordered map
-				if(Equal()((*elem)->val.first, key))
-					break;
-
-				// Move on to the next element
-				elem = &((*elem)->next);
-			}
-
-			// Exit the function if no value with the given key was found
-			if(!*elem)
-				return 0;
-
-			// Remove the value from the current bucket's linked list
-			(*elem)->val.~value_type();
-
-			// Save the value's position
-			node_type* pos = *elem;
-
-			*elem = (*elem)->next;
-
-			// Decrement the unordered map's size
-			--umapSize;
-
-			// Exit the function if the erased value was the last value
-			if(pos == umapData + umapSize)
-				return 1;
-
-			// Get the last value's bucket
-			currentBucket = bucket(umapData[umapSize].val.first);
-
-			// Look for the last value in the current bucket's linked list
-			elem = umapBuckets + currentBucket;
-
-			while(*elem && *elem != umapData + umapSize) {
-				// Move on to the next element
-				elem = &((*elem)->next);
-			}
-
-			// Move the value to the empty space
-			wfe::memcpy(pos, umapData + umapSize, sizeof(node_type));
-
-			// Move the linked list pointer to the last value to the now filled space
-			*elem = pos;
-
-			return 1;
+			return EraseKey(key);
+		}
+		/// @brief Erases the value with the given key from the unordered map, without converting the key to the key type.
+		/// @tparam K The type of the key, which must be supported by both the hash and the comparison function structs.
+		/// @param key The key to look for.
+		/// @return The number of erased values.
+		template<class K> requires TransparentHash<KeyHash, Equal>
+		size_type erase(const K& key) {
+			return EraseKey(key);
 		}
 		/// @brief Erases all values from the given range.
 		/// @param first An iterator to the first erased element.
@@ -1223,6 +1235,7 @@ namespace wfe {
 				return;
 			
 			// Save this unordered map's values
+			MemoryResource* auxMemoryResource = memoryResource;
 			size_type auxBucketCount = umapBucketCount;
 			node_type** auxBuckets = umapBuckets;
 			size_type auxSize = umapSize;
@@ -1231,6 +1244,7 @@ namespace wfe {
 			float32_t auxMaxLoadFactor = umapMaxLoadFactor;
 
 			// Set this umordered map's values
+			memoryResource = other.memoryResource;
 			umapBucketCount = other.umapBucketCount;
 			umapBuckets = other.umapBuckets;
 			umapSize = other.umapSize;
@@ -1239,6 +1253,7 @@ namespace wfe {
 			umapMaxLoadFactor = other.umapMaxLoadFactor;
 
 			// Set the other unordered map's values
+			other.memoryResource = auxMemoryResource;
 			other.umapBucketCount = auxBucketCount;
 			other.umapBuckets = auxBuckets;
 			other.umapSize = auxSize;
@@ -1356,9 +1371,9 @@ namespace wfe {
 
 			// Reallocate the unordered map's buckets
 			if(umapBuckets) {
-				umapBuckets = (node_type**)ReallocMemory(umapBuckets, umapBucketCount * sizeof(node_type*));
+				umapBuckets = (node_type**)ReallocMemory(memoryResource, umapBuckets, umapBucketCount * sizeof(node_type*));
 			} else {
-				umapBuckets = (node_type**)AllocMemory(umapBucketCount * sizeof(node_type*));
+				umapBuckets = (node_type**)AllocMemory(memoryResource, umapBucketCount * sizeof(node_type*));
 			}
 
 			// Check if the unordered map's buckets were allocated correctly
@@ -1394,11 +1409,17 @@ namespace wfe {
 			rehash(newBucketCount);
 		}
 
+		/// @brief Gets the memory resource the unordered map allocates its memory from.
+		/// @return A pointer to the unordered map's memory resource, or a nullptr if it allocates from the heap.
+		MemoryResource* get_memory_resource() const {
+			return memoryResource;
+		}
+
 		/// @brief Destroys the unordered map.
 		~unordered_map() {
 			// Free the unordered map's buckets
 			if(umapBuckets)
-				FreeMemory(umapBuckets);
+				FreeMemory(memoryResource, umapBuckets);
 
 			// Free the unordered map's data
 			if(umapData) {
@@ -1408,19 +1429,83 @@ namespace wfe {
 					ptr->val.~value_type();
 				
 				// Free the unordered map's data
-				FreeMemory(umapData);
+				FreeMemory(memoryResource, umapData);
 			}
 		}
 	private:
+		template<class K>
+		node_type* FindNode(const K& key, uint64_t hash) const {
+			// Look for the given key in its bucket
+			node_type* elem = umapBuckets[hash % umapBucketCount];
+			while(elem && !Equal()(elem->val.first, key))
+				elem = elem->next;
+
+			return elem;
+		}
+		template<class K>
+		size_type EraseKey(const K& key) {
+			// Get the current key's bucket
+			size_type currentBucket = KeyHash()(key) % umapBucketCount;
+
+			// Look for the given value in the current bucket's linked list
+			node_type** elem = umapBuckets + currentBucket;
+
+			while(*elem) {
+				// Check if the given key is in the unordered map
+				if(Equal()((*elem)->val.first, key))
+					break;
+
+				// Move on to the next element
+				elem = &((*elem)->next);
+			}
+
+			// Exit the function if no value with the given key was found
+			if(!*elem)
+				return 0;
+
+			// Remove the value from the current bucket's linked list
+			(*elem)->val.~value_type();
+
+			// Save the value's position
+			node_type* pos = *elem;
+
+			*elem = (*elem)->next;
+
+			// Decrement the unordered map's size
+			--umapSize;
+
+			// Exit the function if the erased value was the last value
+			if(pos == umapData + umapSize)
+				return 1;
+
+			// Get the last value's bucket
+			currentBucket = bucket(umapData[umapSize].val.first);
+
+			// Look for the last value in the current bucket's linked list
+			elem = umapBuckets + currentBucket;
+
+			while(*elem && *elem != umapData + umapSize) {
+				// Move on to the next element
+				elem = &((*elem)->next);
+			}
+
+			// Move the value to the empty space
+			wfe::memcpy(pos, umapData + umapSize, sizeof(node_type));
+
+			// Move the linked list pointer to the last value to the now filled space
+			*elem = pos;
+
+			return 1;
+		}
 		void reallocate(size_type newCapacity) {
 			// Save the unordered map's old data
 			node_type* oldData = umapData;
 
 			// Reallocate the unordered map's data
 			if(umapData) {
-				umapData = (node_type*)ReallocMemory(umapData, newCapacity * sizeof(node_type));
+				umapData = (node_type*)ReallocMemory(memoryResource, umapData, newCapacity * sizeof(node_type));
 			} else {
-				umapData = (node_type*)AllocMemory(newCapacity * sizeof(node_type));
+				umapData = (node_type*)AllocMemory(memoryResource, newCapacity * sizeof(node_type));
 			}
 
 			// Check if the unordered map's data was allocated correctly
@@ -1457,6 +1542,7 @@ namespace wfe {
 			}
 		}
 
+		MemoryResource* memoryResource = nullptr;
 		size_type umapBucketCount;
 		node_type** umapBuckets;
 		size_type umapSize;
@@ -261,7 +261,18 @@ namespace wfe {
 
 		/// @brief Constructs an empty unordered set.
 		/// @param n The number of buckets.
-		unordered_set(size_type n = 16) : usetBucketCount(n), usetBuckets((node_type**)AllocMemory(usetBucketCount * sizeof(node_type*))), usetSize(0), usetCapacity(0), usetData(nullptr) {
+		unordered_set(size_type n = 16) : usetBucketCount(n), usetBuckets((node_type**)AllocMemory(memoryResource, usetBucketCount * sizeof(node_type*))), usetSize(0), usetCapacity(0), usetData(nullptr) {
+			// Check if the bucket list was allocated correctly
+			if(!usetBuckets)
+				throw BadAllocException("Failed to allocate unordered set buckets!");
+			
+			// Set all the bucket pointers to 0
+			wfe::memset(usetBuckets, 0, usetBucketCount * sizeof(node_type*));
+		}
+		/// @brief Creates an empty unordered set that allocates its memory from the given resource.
+		/// @param resource The memory resource to allocate from. It must outlive the unordered set.
+		/// @param n The number of buckets.
+		explicit unordered_set(MemoryResource& resource, size_type n = 16) : memoryResource(&resource), usetBucketCount(n), usetBuckets((node_type**)AllocMemory(memoryResource, usetBucketCount * sizeof(node_type*))), usetSize(0), usetCapacity(0), usetData(nullptr) {
 			// Check if the bucket list was allocated correctly
 			if(!usetBuckets)
 				throw BadAllocException("Failed to allocate unordered set buckets!");
@@ -271,7 +282,7 @@ namespace wfe {
 		}
 		/// @brief Copies the given unordered set.
 		/// @param other The unordered set to copy.
-		unordered_set(const unordered_set& other) : usetBucketCount(other.usetBucketCount), usetBuckets((node_type**)AllocMemory(usetBucketCount * sizeof(node_type*))), usetSize(other.usetSize), usetCapacity(other.usetCapacity), usetData((node_type*)AllocMemory(usetCapacity * sizeof(node_type))), usetMaxLoadFactor(other.usetMaxLoadFactor) {
+		unordered_set(const unordered_set& other) : usetBucketCount(other.usetBucketCount), usetBuckets((node_type**)AllocMemory(memoryResource, usetBucketCount * sizeof(node_type*))), usetSize(other.usetSize), usetCapacity(other.usetCapacity), usetData((node_type*)AllocMemory(memoryResource, usetCapacity * sizeof(node_type))), usetMaxLoadFactor(other.usetMaxLoadFactor) {
 			// Check if the bucket list was allocated correctly
 			if(!usetBuckets)
 				throw BadAllocException("Failed to allocate unordered set buckets!");
@@ -315,7 +326,7 @@ namespace wfe {
 		}
 		/// @brief Moves the given unordered set's contents.
 		/// @param other The unordered set to move from.
-		unordered_set(unordered_set&& other) noexcept : usetBucketCount(other.usetBucketCount), usetBuckets(other.usetBuckets), usetSize(other.usetSize), usetCapacity(other.usetCapacity), usetData(other.usetData), usetMaxLoadFactor(other.usetMaxLoadFactor) {
+		unordered_set(unordered_set&& other) noexcept : memoryResource(other.memoryResource), usetBucketCount(other.usetBucketCount), usetBuckets(other.usetBuckets), usetSize(other.usetSize), usetCapacity(other.usetCapacity), usetData(other.usetData), usetMaxLoadFactor(other.usetMaxLoadFactor) {
 			// Unlink all data from the other unordered set
 			other.usetBuckets = nullptr;
 			other.usetData = nullptr;
@@ -323,7 +334,7 @@ namespace wfe {
 		/// @brief Constructs an unordered set with all the values in the given list.
 		/// @param list The list to copy from.
 		/// @param n The number of buckets.
-		unordered_set(std::initializer_list<value_type> list, size_type n = 16) : usetBucketCount(n), usetBuckets((node_type**)AllocMemory(usetBucketCount * sizeof(node_type*))), usetSize(0), usetCapacity(1), usetData((node_type*)AllocMemory(sizeof(node_type))), usetMaxLoadFactor(1.f) {
+		unordered_set(std::initializer_list<value_type> list, size_type n = 16) : usetBucketCount(n), usetBuckets((node_type**)AllocMemory(memoryResource, usetBucketCount * sizeof(node_type*))), usetSize(0), usetCapacity(1), usetData((node_type*)AllocMemory(memoryResource, sizeof(node_type))), usetMaxLoadFactor(1.f) {
 			// Check if the bucket list was allocated correctly
 			if(!usetBuckets)
 				throw BadAllocException("Failed to allocate unordered set buckets!");
@@ -398,7 +409,7 @@ namespace wfe {
 		}
 		/// @brief Copies the given std library unordered set.
 		/// @param other The std library unordered set to copy from.
-		unordered_set(const std::unordered_set<value_type>& other) : usetBucketCount(other.bucket_count()), usetBuckets((node_type**)AllocMemory(usetBucketCount * sizeof(node_type*))), usetSize(other.size()), usetCapacity(1), usetData(nullptr), usetMaxLoadFactor(other.max_load_factor()) {
+		unordered_set(const std::unordered_set<value_type>& other) : usetBucketCount(other.bucket_count()), usetBuckets((node_type**)AllocMemory(memoryResource, usetBucketCount * sizeof(node_type*))), usetSize(other.size()), usetCapacity(1), usetData(nullptr), usetMaxLoadFactor(other.max_load_factor()) {
 			// Check if the bucket list was allocated correctly
 			if(!usetBuckets)
 				throw BadAllocException("Failed to allocate unordered set buckets!");
@@ -413,7 +424,7 @@ namespace wfe {
 			usetCapacity <<= 1;
 
 			// Allocate the unordered set's data
-			usetData = (node_type*)AllocMemory(usetCapacity * sizeof(node_type));
+			usetData = (node_type*)AllocMemory(memoryResource, usetCapacity * sizeof(node_type));
 			if(usetCapacity && !usetData)
 				throw BadAllocException("Failed to allocate unordered set data!");
 			
@@ -451,18 +462,18 @@ namespace wfe {
 					ptr->~node_type();
 				
 				// Free the unordered set's data
-				FreeMemory(usetData);
+				FreeMemory(memoryResource, usetData);
 
 				// Free the unordered set's buckets
-				FreeMemory(usetBuckets);
+				FreeMemory(memoryResource, usetBuckets);
 			}
 
 			// Set the unordered set's new values
 			usetBucketCount = other.usetBucketCount;
-			usetBuckets = (node_type**)AllocMemory(usetBucketCount * sizeof(node_type*));
+			usetBuckets = (node_type**)AllocMemory(memoryResource, usetBucketCount * sizeof(node_type*));
 			usetSize = other.usetSize;
 			usetCapacity = other.usetCapacity;
-			usetData = (node_type*)AllocMemory(usetCapacity * sizeof(node_type));
+			usetData = (node_type*)AllocMemory(memoryResource, usetCapacity * sizeof(node_type));
 			usetMaxLoadFactor = other.usetMaxLoadFactor;
 
 			// Check if the bucket list was allocated correctly
@@ -520,13 +531,14 @@ namespace wfe {
 					ptr->~node_type();
 				
 				// Free the unordered set's data
-				FreeMemory(usetData);
+				FreeMemory(memoryResource, usetData);
 
 				// Free the unordered set's buckets
-				FreeMemory(usetBuckets);
+				FreeMemory(memoryResource, usetBuckets);
 			}
 
 			// Set the unordered set's new values
+			memoryResource = other.memoryResource;
 			usetBucketCount = other.usetBucketCount;
 			usetBuckets = other.usetBuckets;
 			usetSize = other.usetSize;
@@ -552,10 +564,10 @@ namespace wfe {
 					ptr->~node_type();
 				
 				// Free the unordered set's data
-				FreeMemory(usetData);
+				FreeMemory(memoryResource, usetData);
 
 				// Free the unordered set's buckets
-				FreeMemory(usetBuckets);
+				FreeMemory(memoryResource, usetBuckets);
 			}
 
 			// Set the unordered set's new values
@@ -571,12 +583,12 @@ namespace wfe {
 			usetBucketCount <<= 1;
 
 			// Allocate the unordered set's buckets
-			usetBuckets = (node_type**)AllocMemory(usetBucketCount * sizeof(node_type*));
+			usetBuckets = (node_type**)AllocMemory(memoryResource, usetBucketCount * sizeof(node_type*));
 			if(!usetBuckets)
 				throw BadAllocException("Failed to allocate unordered set buckets!");
 			
 			// Allocate the unordered set's data
-			usetData = (node_type*)AllocMemory(sizeof(node_type));
+			usetData = (node_type*)AllocMemory(memoryResource, sizeof(node_type));
 			if(usetCapacity && !usetData)
 				throw BadAllocException("Failed to allocate unordered set data!");
 
@@ -666,106 +678,128 @@ namespace wfe {
 		/// @param val The value to find.
 		/// @return An iterator to the wanted value if it exists, otherwise unordered_set::end().
 		iterator find(const_reference val) {
-			// Get the bucket for the value
-			size_type valBucket = bucket(val);
-
-			node_type* elem = usetBuckets[valBucket];
-
-			// Look for the given value in the bucket
-			while(elem) {
-				// Compare the values
-				if(Equal()(val, elem->val))
-					return elem;
-				
-				// Move on to the next element
-				elem = elem->next;
-			}
-
-			return end();
+			return find_with_hash(val, ValHash()(val));
 		}
 		/// @brief Finds the wanted value.
 		/// @param val The value to find.
 		/// @return A const iterator to the wanted value.
 		const_iterator find(const_reference val) const {
-			// Get the bucket for the value
-			size_type valBucket = bucket(val);
-
-			const node_type* elem = usetBuckets[valBucket];
-
-			// Look for the given value in the bucket
-			while(elem) {
-				// Compare the values
-				if(Equal()(val, elem->val))
-					return elem;
-				
-				// Move on to the next element
-				elem = elem->next;
-			}
-
-			return end();
+			return find_with_hash(val, ValHash()(val));
 		}
 		/// @brief Gets the number of times the given value appears in the unordered set.
 		/// @param val The value to look for.
 		/// @return The number of times the given value appears in the unordered set.
 		size_type count(const_reference val) const {
-			// Get the bucket for the value
-			size_type valBucket = bucket(val);
-
-			const node_type* elem = usetBuckets[valBucket];
-
-			// Look for the given value in the bucket
-			while(elem) {
-				// Compare the values
-				if(Equal()(val, elem->val))
-					return 1;
-				
-				// Move on to the next element
-				elem = elem->next;
-			}
-
-			return 0;
+			return FindNode(val, ValHash()(val)) != nullptr;
 		}
 		/// @brief Finds the range that includes all elements in the unordered set that are equal to the given value.
 		/// @param val The value to compare with.
 		/// @return A pair containing the lower and upper bounds of the wanted range.
 		pair<iterator, iterator> equal_range(const_reference val) {
-			// Get the bucket for the value
-			size_type valBucket = bucket(val);
+			// Look for the value, returning a pair of end iterators if it wasn't found
+			node_type* node = FindNode(val, ValHash()(val));
+			if(!node)
+				return { end(), end() };
 
-			node_type* elem = usetBuckets[valBucket];
-
-			// Look for the given value in the bucket
-			while(elem) {
-				// Compare the values
-				if(Equal()(val, elem->val))
-					return { elem, elem + 1 };
-				
-				// Move on to the next element
-				elem = elem->next;
-			}
-
-			return { end(), end() };
+			return { node, node + 1 };
 		}
 		/// @brief Finds the range that includes all elements in the unordered set that are equal to the given value.
 		/// @param val The value to compare with.
 		/// @return A pair containing the lower and upper bounds of the wanted range.
 		pair<const_iterator, const_iterator> equal_range(const_reference val) const {
-			// Get the bucket for the value
-			size_type valBucket = bucket(val);
-
-			const node_type* elem = usetBuckets[valBucket];
+			// Look for the value, returning a pair of end iterators if it wasn't found
+			const node_type* node = FindNode(val, ValHash()(val));
+			if(!node)
+				return { end(), end() };
 
-			// Look for the given value in the bucket
-			while(elem) {
-				// Compare the values
-				if(Equal()(val, elem->val))
-					return { elem, elem + 1 };
-				
-				// Move on to the next element
-				elem = elem->next;
-			}
+			return { node, node + 1 };
+		}
 
-			return { end(), end() };
+		/// @brief Finds the wanted value, without converting it to the value type.
+		/// @tparam K The type of the value, which must be supported by both the hash and the comparison function structs.
+		/// @param val The value to find.
+		/// @return An iterator to the wanted value.
+		template<class K> requires TransparentHash<ValHash, Equal>
+		iterator find(const K& val) {
+			return find_with_hash(val, ValHash()(val));
+		}
+		/// @brief Finds the wanted value, without converting it to the value type.
+		/// @tparam K The type of the value, which must be supported by both the hash and the comparison function structs.
+		/// @param val The value to find.
+		/// @return A const iterator to the wanted value.
+		template<class K> requires TransparentHash<ValHash, Equal>
+		const_iterator find(const K& val) const {
+			return find_with_hash(val, ValHash()(val));
+		}
+		/// @brief Gets the number of times the given value appears in the unordered set, without converting it to the value type.
+		/// @tparam K The type of the value, which must be supported by both the hash and the comparison function structs.
+		/// @param val The value to look for.
+		/// @return The number of times the given value appears in the unordered set.
+		template<class K> requires TransparentHash<ValHash, Equal>
+		size_type count(const K& val) const {
+			return FindNode(val, ValHash()(val)) != nullptr;
+		}
+		/// @brief Finds the range that includes all elements in the unordered set that are equal to the given value, without converting it to the value type.
+		/// @tparam K The type of the value, which must be supported by both the hash and the comparison function structs.
+		/// @param val The value to compare with.
+		/// @return A pair containing the lower and upper bounds of the wanted range.
+		template<class K> requires TransparentHash<ValHash, Equal>
+		pair<iterator, iterator> equal_range(const K& val) {
+			// Look for the value, returning a pair of end iterators if it wasn't found
+			node_type* node = FindNode(val, ValHash()(val));
+			if(!node)
+				return { end(), end() };
+
+			return { node, node + 1 };
+		}
+		/// @brief Finds the range that includes all elements in the unordered set that are equal to the given value, without converting it to the value type.
+		/// @tparam K The type of the value, which must be supported by both the hash and the comparison function structs.
+		/// @param val The value to compare with.
+		/// @return A pair containing the lower and upper bounds of the wanted range.
+		template<class K> requires TransparentHash<ValHash, Equal>
+		pair<const_iterator, const_iterator> equal_range(const K& val) const {
+			// Look for the value, returning a pair of end iterators if it wasn't found
+			const node_type* node = FindNode(val, ValHash()(val));
+			if(!node)
+				return { end(), end() };
+
+			return { node, node + 1 };
+		}
+		/// @brief Finds the wanted value using a hash computed by the caller, which lets the same hash be used for lookups in several sets.
+		/// @param val The value to find.
+		/// @param hash The value's hash, which must be equal to the hash given by the set's hash function struct.
+		/// @return An iterator to the wanted value if it exists, otherwise unordered_set::end().
+		iterator find_with_hash(const_reference val, uint64_t hash) {
+			node_type* node = FindNode(val, hash);
+			return node ? iterator(node) : end();
+		}
+		/// @brief Finds the wanted value using a hash computed by the caller, which lets the same hash be used for lookups in several sets.
+		/// @param val The value to find.
+		/// @param hash The value's hash, which must be equal to the hash given by the set's hash function struct.
+		/// @return A const iterator to the wanted value if it exists, otherwise unordered_set::end().
+		const_iterator find_with_hash(const_reference val, uint64_t hash) const {
+			const node_type* node = FindNode(val, hash);
+			return node ? const_iterator(node) : end();
+		}
+		/// @brief Finds the wanted value using a hash computed by the caller, without converting it to the value type.
+		/// @tparam K The type of the value, which must be supported by both the hash and the comparison function structs.
+		/// @param val The value to find.
+		/// @param hash The value's hash, which must be equal to the hash given by the set's hash function struct.
+		/// @return An iterator to the wanted value if it exists, otherwise unordered_set::end().
+		template<class K> requires TransparentHash<ValHash, Equal>
+		iterator find_with_hash(const K& val, uint64_t hash) {
+			node_type* node = FindNode(val, hash);
+			return node ? iterator(node) : end();
+		}
+		/// @brief Finds the wanted value using a hash computed by the caller, without converting it to the value type.
+		/// @tparam K The type of the value, which must be supported by both the hash and the comparison function structs.
+		/// @param val The value to find.
+		/// @param hash The value's hash, which must be equal to the hash given by the set's hash function struct.
+		/// @return A const iterator to the wanted value if it exists, otherwise unordered_set::end().
+		template<class K> requires TransparentHash<ValHash, Equal>
+		const_iterator find_with_hash(const K& val, uint64_t hash) const {
+			const node_type* node = FindNode(val, hash);
+			return node ? const_iterator(node) : end();
 		}
 
 		/// @brief Emplaces a value in the unordered set.
@@ -797,8 +831,15 @@ namespace wfe {
 		/// @param val The value to insert.
 		/// @return A pair containing an iterator to the inserted value or an identical value that was already in the unordered set and a bool that is set to true if a new element was inserted, otherwise false.
 		pair<iterator, bool8_t> insert(const_reference val) {
+			return insert_with_hash(val, ValHash()(val));
+		}
+		/// @brief Inserts the given value in the unordered set using a hash computed by the caller.
+		/// @param val The value to insert.
+		/// @param hash The value's hash, which must be equal to the hash given by the set's hash function struct.
+		/// @return A pair containing an iterator to the inserted value or an identical value that was already in the unordered set and a bool that is set to true if a new element was inserted, otherwise false.
+		pair<iterator, bool8_t> insert_with_hash(const_reference val, uint64_t hash) {
 			// Get the given value's bucket
-			size_type valBucket = bucket(val);
+			size_type valBucket = hash % usetBucketCount;
 
 			node_type** elem = usetBuckets + valBucket;
 
@@ -1026,62 +1067,25 @@ namespace wfe {
 
 			return posPtr;
 		}
+		/// @brief Erases the value at the given position from the unordered set.
+		/// @param pos The position to erase from.
+		/// @return An iterator to the space occupied by the erased value.
+		iterator erase(iterator pos) {
+			return erase(const_iterator(pos));
+		}
 		/// @brief Erases the given value from the unordered set.
 		/// @param val The value to erase.
 		/// @return The number of erased values.
 		size_type erase(const_reference val) {
-			// Decrease the unordered set's size
-			--usetSize;
-
-			// Find the given value in the unordered set
-			size_type valBucket = bucket(val);
-
-			// Exit the function if the value's bucket is empty
-			if(!usetBuckets[valBucket])
-				return 0;
-			
-			// Find the given value in the unordered set
-			node_type** valElem = usetBuckets + valBucket;
-
-			while(*valElem) {
-				// Check if the value is at the current node
-				if(Equal()((*valElem)->val, val))
-					break;
-				
-				// Move on to the next node
-				valElem = &((*valElem)->next);
-			}
-
-			// Check if the value is in the unordered set
-			if(!*valElem)
-				return 0;
-			
-			// Destruct the value
-			(*valElem)->val.~value_type();
-
-			node_type* posPtr = *valElem;
-
-			// Exit the function if the destructed value was the last value in the data
-			node_type* lastPtr = usetData + usetSize;
-
-			if(posPtr == lastPtr)
-				return 1;
-
-			// To keep the unordered set's data consistent, move the last value into the now empty space
-			wfe::memcpy(posPtr, lastPtr, sizeof(node_type));
-
-			// Find the previous value in the last value's bucket
-			size_type lastBucket = bucket(posPtr->val);
-
-			node_type** lastElem = usetBuckets + lastBucket;
-
-			while(*lastElem != lastPtr)
-				lastElem = &((*lastElem)->next);
-			
-			// Set the last value's new memory address
-			*lastElem = posPtr;
-
-			return 1;
+			return EraseValue(val);
+		}
+		/// @brief Erases the given value from the unordered set, without converting it to the value type.
+		/// @tparam K The type of the value, which must be supported by both the hash and the comparison function structs.
+		/// @param val The value to erase.
+		/// @return The number of erased values.
+		template<class K> requires TransparentHash<ValHash, Equal>
+		size_type erase(const K& val) {
+			return EraseValue(val);
 		}
 		/// @brief Erases the values in the given range from the unordered set.
 		/// @param first An inerator to the first erased value.
@@ -1120,6 +1124,7 @@ namespace wfe {
 				return;
 			
 			// Save this unordered set's values
+			MemoryResource* auxMemoryResource = memoryResource;
 			size_type auxBucketCount = usetBucketCount;
 			node_type** auxBuckets = usetBuckets;
 			size_type auxSize = usetSize;
@@ -1128,6 +1133,7 @@ namespace wfe {
 			float32_t auxMaxLoadFactor = usetMaxLoadFactor;
 
 			// Set this unordered set's new values
+			memoryResource = other.memoryResource;
 			usetBucketCount = other.usetBucketCount;
 			usetBuckets = other.usetBuckets;
 			usetSize = other.usetSize;
@@ -1136,6 +1142,7 @@ namespace wfe {
 			usetMaxLoadFactor = other.usetMaxLoadFactor;
 
 			// Set the other unordered set's new values
+			other.memoryResource = auxMemoryResource;
 			other.usetBucketCount = auxBucketCount;
 			other.usetBuckets = auxBuckets;
 			other.usetSize = auxSize;
@@ -1252,9 +1259,9 @@ namespace wfe {
 
 			// Reallocate the unordered set's buckets
 			if(usetBuckets) {
-				usetBuckets = (node_type**)ReallocMemory(usetBuckets, usetBucketCount * sizeof(node_type*));
+				usetBuckets = (node_type**)ReallocMemory(memoryResource, usetBuckets, usetBucketCount * sizeof(node_type*));
 			} else {
-				usetBuckets = (node_type**)AllocMemory(usetBucketCount * sizeof(node_type*));
+				usetBuckets = (node_type**)AllocMemory(memoryResource, usetBucketCount * sizeof(node_type*));
 			}
 
 			// Check if the bucket list was allocated correctly
@@ -1291,6 +1298,12 @@ namespace wfe {
 			rehash(newBucketCount);
 		}
 
+		/// @brief Gets the memory resource the unordered set allocates its memory from.
+		/// @return A pointer to the unordered set's memory resource, or a nullptr if it allocates from the heap.
+		MemoryResource* get_memory_resource() const {
+			return memoryResource;
+		}
+
 		/// @brief Destroys the unordered set.
 		~unordered_set() {
 			if(usetData) {
@@ -1300,23 +1313,44 @@ namespace wfe {
 					ptr->val.~value_type();
 
 				// Free the unordered set's data
-				FreeMemory(usetData);
+				FreeMemory(memoryResource, usetData);
 			}
 			if(usetBuckets) {
 				// Free the unordered set's bucket list
-				FreeMemory(usetBuckets);
+				FreeMemory(memoryResource, usetBuckets);
 			}
 		}
 	private:
+		template<class K>
+		node_type* FindNode(const K& val, uint64_t hash) const {
+			// Look for the given value in its bucket
+			node_type* elem = usetBuckets[hash % usetBucketCount];
+			while(elem && !Equal()(elem->val, val))
+				elem = elem->next;
+
+			return elem;
+		}
+		template<class K>
+		size_type EraseValue(const K& val) {
+			// Look for the value, exiting the function if it wasn't found
+			node_type* node = FindNode(val, ValHash()(val));
+			if(!node)
+				return 0;
+
+			// Erase the value at its position
+			erase(const_iterator(node));
+
+			return 1;
+		}
 		void reallocate(size_type newCapacity) {
 			// Save the unordered set's old data
 			node_type* oldData = usetData;
 
 			// Reallocate the unordered set's data
 			if(usetData) {
-				usetData = (node_type*)ReallocMemory(usetData, newCapacity * sizeof(node_type));
+				usetData = (node_type*)ReallocMemory(memoryResource, usetData, newCapacity * sizeof(node_type));
 			} else {
-				usetData = (node_type*)AllocMemory(newCapacity * sizeof(node_type));
+				usetData = (node_type*)AllocMemory(memoryResource, newCapacity * sizeof(node_type));
 			}
 			
 			// Check if the memory was allocated correctly
@@ -1353,6 +1387,7 @@ namespace wfe {
 			}
 		}
 
+		MemoryResource* memoryResource = nullptr;
 		size_type usetBucketCount;
 		node_type** usetBuckets;
 		size_type usetSize;
@@ -10,8 +10,10 @@
 namespace wfe {
 	/// @brief Holds a vector of elements.
 	/// @tparam T The type of the vector's values.
-	template<class T>
+	/// @tparam Alignment The minimum alignment of the vector's data, which must be a power of two. Useful for SIMD loads and stores on the data.
+	template<class T, size_t Alignment = alignof(T)>
 	class vector {
+		static_assert(Alignment && !(Alignment & (Alignment - 1)), "The vector's alignment must be a power of two!");
 	public:
 		/// @brief The vector's value.
 		typedef T value_type;
@@ -30,9 +32,12 @@ namespace wfe {
 
 		/// @brief Creates an empty vector.
 		constexpr vector() = default;
+		/// @brief Creates an empty vector that allocates its memory from the given resource.
+		/// @param resource The memory resource to allocate from. It must outlive the vector.
+		explicit vector(MemoryResource& resource) : memoryResource(&resource) { }
 		/// @brief Copies the given vector.
 		/// @param other The vector to copy.
-		vector(const vector& other) : vecSize(other.vecSize), vecCapacity(other.vecCapacity), vecData((pointer)AllocMemory(vecCapacity * sizeof(value_type))) {
+		vector(const vector& other) : vecSize(other.vecSize), vecCapacity(other.vecCapacity), vecData((pointer)AllocMemory(memoryResource, vecCapacity * sizeof(value_type), DATA_ALIGNMENT)) {
 			// Check if the memory was allocated correctly
 			if(vecCapacity && !vecData)
 				throw BadAllocException("Failed to allocate vector data!");
@@ -43,7 +48,7 @@ namespace wfe {
 		}
 		/// @brief Moves the contents from one vector to another.
 		/// @param other The vector to move from.
-		vector(vector&& other) noexcept : vecSize(other.vecSize), vecCapacity(other.vecCapacity), vecData(other.vecData) {
+		vector(vector&& other) noexcept : memoryResource(other.memoryResource), vecSize(other.vecSize), vecCapacity(other.vecCapacity), vecData(other.vecData) {
 			// Unlink the data from the given vector
 			other.vecData = nullptr;
 		}
@@ -60,7 +65,7 @@ namespace wfe {
 			vecCapacity <<= 1;
 			
 			// Allocate the vector's data
-			vecData = (pointer)AllocMemory(vecCapacity * sizeof(value_type));
+			vecData = (pointer)AllocMemory(memoryResource, vecCapacity * sizeof(value_type), DATA_ALIGNMENT);
 
 			if(vecCapacity && !vecData)
 				throw BadAllocException("Failed to allocate vector data!");
@@ -84,7 +89,7 @@ namespace wfe {
 			vecCapacity <<= 1;
 			
 			// Allocate the vector's data
-			vecData = (pointer)AllocMemory(vecCapacity * sizeof(value_type));
+			vecData = (pointer)AllocMemory(memoryResource, vecCapacity * sizeof(value_type), DATA_ALIGNMENT);
 
 			if(vecCapacity && !vecData)
 				throw BadAllocException("Failed to allocate vector data!");
@@ -107,7 +112,7 @@ namespace wfe {
 			vecCapacity <<= 1;
 			
 			// Allocate the vector's data
-			vecData = (pointer)AllocMemory(vecCapacity * sizeof(value_type));
+			vecData = (pointer)AllocMemory(memoryResource, vecCapacity * sizeof(value_type), DATA_ALIGNMENT);
 
 			if(vecCapacity && !vecData)
 				throw BadAllocException("Failed to allocate vector data!");
@@ -121,7 +126,7 @@ namespace wfe {
 		}
 		/// @brief Copies the given std library vector.
 		/// @param other The std library vector to copy.
-		vector(const std::vector<T>& other) : vecSize(other.size()), vecCapacity(other.capacity()), vecData((pointer)AllocMemory(vecCapacity * sizeof(value_type))) {
+		vector(const std::vector<T>& other) : vecSize(other.size()), vecCapacity(other.capacity()), vecData((pointer)AllocMemory(memoryResource, vecCapacity * sizeof(value_type), DATA_ALIGNMENT)) {
 			// Check if the memory was allocated correctly
 			if(vecCapacity && !vecData)
 				throw BadAllocException("Failed to allocate vector data!");
@@ -147,13 +152,13 @@ namespace wfe {
 					end->~value_type();
 				
 				// Free the vector's data
-				FreeMemory(vecData);
+				FreeMemory(memoryResource, vecData);
 			}
 
 			// Set the vector's new values
 			vecSize = other.vecSize;
 			vecCapacity = other.vecCapacity;
-			vecData = (pointer)AllocMemory(vecSize * sizeof(value_type));
+			vecData = (pointer)AllocMemory(memoryResource, vecSize * sizeof(value_type), DATA_ALIGNMENT);
 
 			// Check if the memory was allocated correctly
 			if(vecCapacity && !vecData)
@@ -177,10 +182,11 @@ namespace wfe {
 					end->~value_type();
 				
 				// Free the vector's data
-				FreeMemory(vecData);
+				FreeMemory(memoryResource, vecData);
 			}
 
 			// Set the vector's new values
+			memoryResource = other.memoryResource;
 			vecSize = other.vecSize;
 			vecCapacity = other.vecCapacity;
 			vecData = other.vecData;
@@ -202,7 +208,7 @@ namespace wfe {
 					end->~value_type();
 				
 				// Free the vector's data
-				FreeMemory(vecData);
+				FreeMemory(memoryResource, vecData);
 			}
 
 			// Set the vector's new values
@@ -219,7 +225,7 @@ namespace wfe {
 			vecCapacity <<= 1;
 
 			// Allocate the vector's data
-			vecData = (pointer)AllocMemory(vecCapacity * sizeof(value_type));
+			vecData = (pointer)AllocMemory(memoryResource, vecCapacity * sizeof(value_type), DATA_ALIGNMENT);
 
 			if(vecCapacity && !vecData)
 				throw BadAllocException("Failed to allocate vector data!");
@@ -316,7 +322,7 @@ namespace wfe {
 					end->~value_type();
 				
 				// Free the vector's data
-				FreeMemory(vecData);
+				FreeMemory(memoryResource, vecData);
 			}
 
 			// Set the vector's new values
@@ -333,7 +339,7 @@ namespace wfe {
 			vecCapacity <<= 1;
 
 			// Allocate the vector's data
-			vecData = (pointer)AllocMemory(vecCapacity * sizeof(value_type));
+			vecData = (pointer)AllocMemory(memoryResource, vecCapacity * sizeof(value_type), DATA_ALIGNMENT);
 
 			if(vecCapacity && !vecData)
 				throw BadAllocException("Failed to allocate vector data!");
@@ -354,7 +360,7 @@ namespace wfe {
 					end->~value_type();
 				
 				// Free the vector's data
-				FreeMemory(vecData);
+				FreeMemory(memoryResource, vecData);
 			}
 
 			// Set the vector's new values
@@ -371,7 +377,7 @@ namespace wfe {
 			vecCapacity <<= 1;
 
 			// Allocate the vector's data
-			vecData = (pointer)AllocMemory(vecCapacity * sizeof(value_type));
+			vecData = (pointer)AllocMemory(memoryResource, vecCapacity * sizeof(value_type), DATA_ALIGNMENT);
 
 			if(vecCapacity && !vecData)
 				throw BadAllocException("Failed to allocate vector data!");
@@ -667,16 +673,19 @@ namespace wfe {
 				return;
 			
 			// Save the vector's values
+			MemoryResource* auxMemoryResource = memoryResource;
 			size_type auxSize = vecSize;
 			size_type auxCapacity = vecCapacity;
 			pointer auxData = vecData;
 
 			// Set this vector's new values
+			memoryResource = other.memoryResource;
 			vecSize = other.vecSize;
 			vecCapacity = other.vecCapacity;
 			vecData = other.vecData;
 
 			// Set the other vector's new values
+			other.memoryResource = auxMemoryResource;
 			other.vecSize = auxSize;
 			other.vecCapacity = auxCapacity;
 			other.vecData = auxData;
@@ -913,14 +922,14 @@ namespace wfe {
 
 			if(vecData) {
 				// Reallocate the vector's data
-				vecData = (pointer)ReallocMemory(vecData, newCapacity * sizeof(value_type));
+				vecData = (pointer)ReallocMemory(memoryResource, vecData, newCapacity * sizeof(value_type), DATA_ALIGNMENT);
 			} else {
 				// Allocate the vector's data
-				vecData = (pointer)AllocMemory(newCapacity * sizeof(value_type));
+				vecData = (pointer)AllocMemory(memoryResource, newCapacity * sizeof(value_type), DATA_ALIGNMENT);
 			}
 
 			// Check if the memory was allocated correctly
-			if(vecCapacity && !vecData)
+			if(newCapacity && !vecData)
 				throw BadAllocException("Failed to allocate vector data!");
 			
 			// Set the vector's new capacity
@@ -932,6 +941,12 @@ namespace wfe {
 			reserve(0);
 		}
 
+		/// @brief Gets the memory resource the vector allocates its memory from.
+		/// @return A pointer to the vector's memory resource, or a nullptr if it allocates from the heap.
+		MemoryResource* get_memory_resource() const {
+			return memoryResource;
+		}
+
 		/// @brief Destroys the vector.
 		~vector() {
 			// Destruct every value in the vector (if they exist)
@@ -941,10 +956,13 @@ namespace wfe {
 					ptr->~value_type();
 				
 				// Free the vector's data
-				FreeMemory(vecData);
+				FreeMemory(memoryResource, vecData);
 			}
 		}
 	private:
+		static constexpr size_t DATA_ALIGNMENT = Alignment > alignof(T) ? Alignment : alignof(T);
+
+		MemoryResource* memoryResource = nullptr;
 		size_type vecSize = 0;
 		size_type vecCapacity = 0;
 		pointer vecData = nullptr;
@@ -952,11 +970,12 @@ namespace wfe {
 
 	/// @brief Compares the two given vectors.
 	/// @tparam T The type of the vector's value.
+	/// @tparam Alignment The alignment of the vectors' data.
 	/// @param vec1 The first vector to compare.
 	/// @param vec2 The second vector to compare.
 	/// @return True if both vectors are equal, otherwise false.
-	template<class T>
-	WFE_INLINE bool8_t operator==(const vector<T>& vec1, const vector<T>& vec2) {
+	template<class T, size_t Alignment>
+	WFE_INLINE bool8_t operator==(const vector<T, Alignment>& vec1, const vector<T, Alignment>& vec2) {
 		// Exit the function if their sizes are different
 		if(vec1.size() != vec2.size())
 			return false;
@@ -973,11 +992,12 @@ namespace wfe {
 	}
 	/// @brief Compares the two given vectors.
 	/// @tparam T The type of the vector's value.
+	/// @tparam Alignment The alignment of the vectors' data.
 	/// @param vec1 The first vector to compare.
 	/// @param vec2 The second vector to compare.
 	/// @return True if the vectors are different, otherwise false.
-	template<class T>
-	WFE_INLINE bool8_t operator!=(const vector<T>& vec1, const vector<T>& vec2) {
+	template<class T, size_t Alignment>
+	WFE_INLINE bool8_t operator!=(const vector<T, Alignment>& vec1, const vector<T, Alignment>& vec2) {
 		// Exit the function if their sizes are different
 		if(vec1.size() != vec2.size())
 			return true;
@@ -994,11 +1014,12 @@ namespace wfe {
 	}
 	/// @brief Compares the two given vectors.
 	/// @tparam T The type of the vector's value.
+	/// @tparam Alignment The alignment of the vectors' data.
 	/// @param vec1 The first vector to compare.
 	/// @param vec2 The second vector to compare.
 	/// @return True if the first vector is smaller than the second, otherwise false.
-	template<class T>
-	WFE_INLINE bool8_t operator< (const vector<T>& vec1, const vector<T>& vec2) {
+	template<class T, size_t Alignment>
+	WFE_INLINE bool8_t operator< (const vector<T, Alignment>& vec1, const vector<T, Alignment>& vec2) {
 		// Compare every element in both vectors
 		const T* end1 = vec1.end();
 		const T* end2 = vec1.end();
@@ -1013,11 +1034,12 @@ namespace wfe {
 	}
 	/// @brief Compares the two given vectors.
 	/// @tparam T The type of the vector's value.
+	/// @tparam Alignment The alignment of the vectors' data.
 	/// @param vec1 The first vector to compare.
 	/// @param vec2 The second vector to compare.
 	/// @return True if the first vector is smaller than or equal to the second, otherwise false.
-	template<class T>
-	WFE_INLINE bool8_t operator<=(const vector<T>& vec1, const vector<T>& vec2) {
+	template<class T, size_t Alignment>
+	WFE_INLINE bool8_t operator<=(const vector<T, Alignment>& vec1, const vector<T, Alignment>& vec2) {
 		// Compare every element in both vectors
 		const T* end1 = vec1.end();
 		const T* end2 = vec1.end();
@@ -1032,11 +1054,12 @@ namespace wfe {
 	}
 	/// @brief Compares the two given vectors.
 	/// @tparam T The type of the vector's value.
+	/// @tparam Alignment The alignment of the vectors' data.
 	/// @param vec1 The first vector to compare.
 	/// @param vec2 The second vector to compare.
 	/// @return True if the first vector is bigger than the second, otherwise false.
-	template<class T>
-	WFE_INLINE bool8_t operator> (const vector<T>& vec1, const vector<T>& vec2) {
+	template<class T, size_t Alignment>
+	WFE_INLINE bool8_t operator> (const vector<T, Alignment>& vec1, const vector<T, Alignment>& vec2) {
 		// Compare every element in both vectors
 		const T* end1 = vec1.end();
 		const T* end2 = vec1.end();
@@ -1051,11 +1074,12 @@ namespace wfe {
 	}
 	/// @brief Compares the two given vectors.
 	/// @tparam T The type of the vector's value.
+	/// @tparam Alignment The alignment of the vectors' data.
 	/// @param vec1 The first vector to compare.
 	/// @param vec2 The second vector to compare.
 	/// @return True if the first vector is bigger than or equal to the second, otherwise false.
-	template<class T>
-	WFE_INLINE bool8_t operator>=(const vector<T>& vec1, const vector<T>& vec2) {
+	template<class T, size_t Alignment>
+	WFE_INLINE bool8_t operator>=(const vector<T, Alignment>& vec1, const vector<T, Alignment>& vec2) {
 		// Compare every element in both vectors
 		const T* end1 = vec1.end();
 		const T* end2 = vec1.end();
@@ -1,22 +1,764 @@
 #include "Allocator.hpp"
+#include "Files.hpp"
+#include "Memory.hpp"
 #include "Platform.hpp"
-#include "Debug.hpp"
+#include "Mutex.hpp"
+#include "New.hpp"
+#include "String.hpp"
 #include <atomic>
-
-#ifdef WFE_PLATFORM_LINUX
-#include <malloc.h>
-#endif
+#include <stdlib.h>
 
 namespace wfe {
 	// Constants
 	static const size_t MEMORY_USAGE_TYPE_STACK_MAX_SIZE = 128;
+	static const size_t BLOCK_HEADER_SIZE = 16;
+	static const uint16_t BLOCK_FLAG_LARGE = 0x01;
+	static const uint16_t BLOCK_FLAG_ALIGNED = 0x02;
+	static const uint16_t BLOCK_FLAG_OFFSET = 0x04;
+	static const uint16_t BLOCK_FLAG_ARENA = ArenaAllocator::BLOCK_FLAG;
+	static const uint16_t BLOCK_ALIGNMENT_SHIFT = 8;
+
+	static const size_t MAX_SAMPLE_FRAME_COUNT = 32;
+	static const uint32_t MIN_SAMPLE_CAPACITY = 256;
+	static const size_t MAX_SNAPSHOT_LINE_LENGTH = 512;
+	static const char_t* const MEMORY_USAGE_TYPE_NAMES[MEMORY_USAGE_TYPE_COUNT] { "COMMAND", "ASSETS", "COMPONENTS", "RENDERER", "OTHER" };
+
+#ifdef WFE_ALLOCATOR_THREAD_CACHE
+	static const size_t SIZE_CLASS_GRANULARITY = 16;
+	static const size_t MAX_CACHED_SIZE = 4096;
+	static const size_t MAX_CACHED_BYTES_PER_CLASS = 65536;
+	static const size_t MIN_CACHED_BLOCK_COUNT = 8;
+	static const size_t MAX_CACHED_BLOCK_COUNT = 128;
+
+	// Small blocks have no header and are carved out of 64 KiB spans, which are carved out of 2 MiB chunks mapped from the platform; spans are never unmapped, so freed small blocks are only ever reused
+	static const size_t SPAN_SHIFT = 16;
+	static const size_t SPAN_SIZE = (size_t)1 << SPAN_SHIFT;
+	static const size_t SPAN_CHUNK_SIZE = 2097152;
+
+	// The span map covers 48-bit addresses with one byte per span, split into 64 KiB leaves that each cover 4 GiB
+	static const size_t SPAN_MAP_ADDRESS_BITS = 48;
+	static const size_t SPAN_MAP_LEAF_SHIFT = 32;
+	static const size_t SPAN_MAP_ROOT_SIZE = (size_t)1 << (SPAN_MAP_ADDRESS_BITS - SPAN_MAP_LEAF_SHIFT);
+	static const size_t SPAN_MAP_LEAF_SIZE = (size_t)1 << (SPAN_MAP_LEAF_SHIFT - SPAN_SHIFT);
+
+	// Every span map entry holds the span's size class index plus one in its low bits and its memory usage type in its high bits, or 0 if the address isn't in a span
+	static const uint8_t SPAN_CLASS_MASK = 0x1f;
+	static const uint8_t SPAN_USAGE_TYPE_SHIFT = 5;
+
+	// Size classes are spaced 16 bytes apart up to 128 bytes, then 4 classes per doubling up to the max cached size
+	static constexpr size_t SIZE_CLASS_COUNT = 8 + 4 * 5;
+
+	struct SizeClassTable {
+		size_t sizes[SIZE_CLASS_COUNT];
+		size_t maxBlockCounts[SIZE_CLASS_COUNT];
+		size_t batchSizes[SIZE_CLASS_COUNT];
+		uint8_t indices[MAX_CACHED_SIZE / SIZE_CLASS_GRANULARITY + 1];
+
+		constexpr SizeClassTable() : sizes(), maxBlockCounts(), batchSizes(), indices() {
+			// Set every class's size and the number of blocks cached for it
+			size_t classInd = 0;
+			for(size_t size = 16; size <= 128; size += 16)
+				sizes[classInd++] = size;
+			for(size_t step = 32; classInd != SIZE_CLASS_COUNT; step <<= 1)
+				for(size_t i = 0; i != 4; ++i, ++classInd)
+					sizes[classInd] = sizes[classInd - 1] + step;
+
+			for(size_t i = 0; i != SIZE_CLASS_COUNT; ++i) {
+				maxBlockCounts[i] = MAX_CACHED_BYTES_PER_CLASS / sizes[i];
+				if(maxBlockCounts[i] < MIN_CACHED_BLOCK_COUNT)
+					maxBlockCounts[i] = MIN_CACHED_BLOCK_COUNT;
+				if(maxBlockCounts[i] > MAX_CACHED_BLOCK_COUNT)
+					maxBlockCounts[i] = MAX_CACHED_BLOCK_COUNT;
+
+				// Move blocks between the thread caches and the central lists half a cache at a time
+				batchSizes[i] = maxBlockCounts[i] >> 1;
+			}
+
+			// Map every granule count to the smallest class that fits it
+			classInd = 0;
+			for(size_t i = 0; i != MAX_CACHED_SIZE / SIZE_CLASS_GRANULARITY + 1; ++i) {
+				while(sizes[classInd] < i * SIZE_CLASS_GRANULARITY)
+					++classInd;
+				indices[i] = (uint8_t)classInd;
+			}
+		}
+	};
+
+	static constexpr SizeClassTable sizeClasses;
+
+	static_assert(SIZE_CLASS_COUNT < SPAN_CLASS_MASK, "Every size class index plus one must fit the span map entry's class bits!");
+	static_assert(MEMORY_USAGE_TYPE_COUNT <= (1 << (8 - SPAN_USAGE_TYPE_SHIFT)), "Every memory usage type must fit the span map entry's usage type bits!");
+	static_assert(MAX_CACHED_SIZE <= SPAN_SIZE, "Every size class must fit in a span!");
+#endif
+
+	// Internal structs
+	struct BlockHeader {
+		size_t size;
+		// The block's index in the sampled allocation list plus one, or 0 if the block wasn't sampled
+		uint32_t sampleIndex;
+		uint16_t memoryUsageType;
+		uint16_t flags;
+	};
+	struct SampledAllocation {
+		// A size of 0 marks a free slot, since empty blocks are never allocated
+		size_t size;
+		MemoryUsageType memoryUsageType;
+		uint32_t nextFreeIndex;
+		size_t frameCount;
+		void* frames[MAX_SAMPLE_FRAME_COUNT];
+	};
+	struct HeapSnapshotGroup {
+		const SampledAllocation* sample;
+		size_t sampleCount;
+		size_t estimatedSize;
+		size_t estimatedCount;
+	};
+
+	static_assert(sizeof(BlockHeader) == BLOCK_HEADER_SIZE, "The block header must fill the space before the block's data!");
+	static_assert(BLOCK_HEADER_SIZE == ArenaAllocator::ALIGNMENT, "Block headers must end where arena allocation headers end, so that both keep their flags in the same place!");
+
+#ifdef WFE_ALLOCATOR_THREAD_CACHE
+	struct CachedBlock {
+		CachedBlock* next;
+	};
+	struct CentralSizeClass {
+		AtomicMutex mutex;
+		// Blocks freed by exiting threads or by full thread caches, for every memory usage type
+		CachedBlock* blocks[MEMORY_USAGE_TYPE_COUNT];
+		// The unused range of every memory usage type's current span
+		char_t* spanPos[MEMORY_USAGE_TYPE_COUNT];
+		char_t* spanEnd[MEMORY_USAGE_TYPE_COUNT];
+	};
+#endif
+
+	struct ThreadCache {
+#ifdef WFE_ALLOCATOR_THREAD_CACHE
+		CachedBlock* blocks[MEMORY_USAGE_TYPE_COUNT][SIZE_CLASS_COUNT];
+		size_t blockCounts[MEMORY_USAGE_TYPE_COUNT][SIZE_CLASS_COUNT];
+#endif
+
+		// Only written by the owning thread, and only read by others when aggregating the memory usage
+		atomic_ptrdiff_t memoryUsage[MEMORY_USAGE_TYPE_COUNT];
+
+		ArenaAllocator* commandArena;
+		bool8_t commandArenaEnabled;
+
+		ptrdiff_t bytesUntilSample;
+		uint64_t sampleSeed;
+
+		ThreadCache* prev;
+		ThreadCache* next;
+		uint8_t state;
+	};
+	struct ThreadCacheDestructor {
+		~ThreadCacheDestructor();
+	};
 
 	// Internal variables
-	volatile atomic_size_t memoryUsage[MEMORY_USAGE_TYPE_COUNT];
+	static AtomicMutex threadCacheMutex;
+	static ThreadCache* threadCacheList = nullptr;
+	static atomic_ptrdiff_t retiredMemoryUsage[MEMORY_USAGE_TYPE_COUNT];
+	static volatile atomic_size_t memoryUsageSnapshot[MEMORY_USAGE_TYPE_COUNT];
+
+	static std::atomic<bool8_t> allocationProfilerEnabled{false};
+	static atomic_size_t allocationSampleInterval{DEFAULT_ALLOCATION_SAMPLE_INTERVAL};
+	static atomic_size_t largeAllocationThreshold{DEFAULT_LARGE_ALLOCATION_THRESHOLD};
+	static AtomicMutex sampleMutex;
+	static SampledAllocation* samples = nullptr;
+	static uint32_t sampleCapacity = 0;
+	static uint32_t sampleSlotCount = 0;
+	static uint32_t sampleCount = 0;
+	static uint32_t firstFreeSampleIndex = 0;
+
+#ifdef WFE_ALLOCATOR_THREAD_CACHE
+	static CentralSizeClass centralSizeClasses[SIZE_CLASS_COUNT];
+	static AtomicMutex spanMutex;
+	static char_t* spanChunkPos = nullptr;
+	static char_t* spanChunkEnd = nullptr;
+	static std::atomic<uint8_t*> spanMap[SPAN_MAP_ROOT_SIZE];
+#endif
+
+	static thread_local ThreadCache threadCache;
+	static thread_local ThreadCacheDestructor threadCacheDestructor;
 
 	thread_local size_t memoryUsageTypeStackSize = 0;
 	thread_local MemoryUsageType memoryUsageTypeStack[MEMORY_USAGE_TYPE_STACK_MAX_SIZE];
 
+	// Internal functions
+	static WFE_INLINE BlockHeader* GetBlockHeader(void* mem) {
+		return (BlockHeader*)((char_t*)mem - BLOCK_HEADER_SIZE);
+	}
+	static WFE_INLINE void* GetBlockData(void* header) {
+		return (char_t*)header + BLOCK_HEADER_SIZE;
+	}
+	static WFE_INLINE size_t GetBlockOffset(BlockHeader* header) {
+		// Blocks whose header doesn't start their allocation store the distance to it right before the header
+		return (header->flags & BLOCK_FLAG_OFFSET) ? *((size_t*)header - 1) : 0;
+	}
+	static WFE_INLINE size_t GetBlockAlignment(BlockHeader* header) {
+		return (header->flags & BLOCK_FLAG_ALIGNED) ? (size_t)1 << (header->flags >> BLOCK_ALIGNMENT_SHIFT) : BLOCK_HEADER_SIZE;
+	}
+	static BlockHeader* AllocBlock(size_t size, size_t alignment, bool8_t large) {
+		// Reserve enough room to move the block's data up to the next aligned address past its header
+		uint16_t flags = 0;
+		size_t totalSize = BLOCK_HEADER_SIZE + size;
+		if(alignment > BLOCK_HEADER_SIZE) {
+			uint16_t alignmentShift = 0;
+			while(((size_t)1 << alignmentShift) < alignment)
+				++alignmentShift;
+
+			flags = BLOCK_FLAG_ALIGNED | (alignmentShift << BLOCK_ALIGNMENT_SHIFT);
+			totalSize += alignment - BLOCK_HEADER_SIZE;
+		} else
+			alignment = BLOCK_HEADER_SIZE;
+
+		// Map the block's pages straight from the platform if it is large, so that they are returned as soon as the block is freed
+		void* mem;
+		if(large) {
+			size_t pageSize = PlatformGetPageSize();
+			totalSize = (totalSize + pageSize - 1) & ~(pageSize - 1);
+
+			mem = PlatformAllocatePages(totalSize);
+			flags |= BLOCK_FLAG_LARGE;
+		} else
+			mem = PlatformAllocateMemory(totalSize);
+
+		if(!mem)
+			return nullptr;
+
+		// Place the block's data at the first aligned address past the header
+		char_t* data = (char_t*)(((uintptr_t)mem + BLOCK_HEADER_SIZE + alignment - 1) & ~(uintptr_t)(alignment - 1));
+		BlockHeader* header = GetBlockHeader(data);
+
+		// Store the header's offset before it if it doesn't start the allocation; the gap is then at least 16 bytes, as both addresses are 16-byte aligned
+		size_t offset = (char_t*)header - (char_t*)mem;
+		if(offset) {
+			*((size_t*)header - 1) = offset;
+			flags |= BLOCK_FLAG_OFFSET;
+		}
+
+		// The block's size covers all of the allocation's usable space past the header
+		header->size = totalSize - offset - BLOCK_HEADER_SIZE;
+		header->flags = flags;
+
+		return header;
+	}
+	static BlockHeader* ReallocLargeBlock(BlockHeader* header, size_t newSize) {
+		// Exit the function if the block's pages already have the wanted size
+		size_t pageSize = PlatformGetPageSize();
+		size_t offset = GetBlockOffset(header);
+		size_t oldTotalSize = offset + BLOCK_HEADER_SIZE + header->size;
+		size_t newTotalSize = (offset + BLOCK_HEADER_SIZE + newSize + pageSize - 1) & ~(pageSize - 1);
+		if(newTotalSize == oldTotalSize)
+			return header;
+
+		// Remap the block's pages; the header keeps its offset from the pages' start, so the data stays aligned to anything up to the page size
+		char_t* newMem = (char_t*)PlatformReallocatePages((char_t*)header - offset, oldTotalSize, newTotalSize);
+		if(!newMem)
+			return nullptr;
+
+		BlockHeader* newHeader = (BlockHeader*)(newMem + offset);
+		newHeader->size = newTotalSize - offset - BLOCK_HEADER_SIZE;
+
+		return newHeader;
+	}
+	static void FreeBlock(BlockHeader* header) {
+		// Unmap the block's pages if it is large, otherwise return it to the heap
+		size_t offset = GetBlockOffset(header);
+		char_t* mem = (char_t*)header - offset;
+
+		if(header->flags & BLOCK_FLAG_LARGE) {
+			PlatformFreePages(mem, offset + BLOCK_HEADER_SIZE + header->size);
+		} else {
+			PlatformFreeMemory(mem);
+		}
+	}
+	static WFE_NOINLINE ThreadCache* RegisterThreadCache(ThreadCache* cache) {
+		// Return a nullptr if the thread's cache was already destroyed, as the thread is exiting
+		if(cache->state == 2)
+			return nullptr;
+
+		// Register the cache in the global list
+		threadCacheMutex.Lock();
+		cache->prev = nullptr;
+		cache->next = threadCacheList;
+		if(threadCacheList)
+			threadCacheList->prev = cache;
+		threadCacheList = cache;
+		threadCacheMutex.Unlock();
+
+		// Touch the cache's destructor, making sure it runs when the thread exits
+		(void)&threadCacheDestructor;
+
+		cache->state = 1;
+
+		return cache;
+	}
+	static WFE_INLINE ThreadCache* GetThreadCache() {
+		// Return the current thread's cache if it is already registered, otherwise register it
+		ThreadCache* cache = &threadCache;
+		if(cache->state == 1)
+			return cache;
+
+		return RegisterThreadCache(cache);
+	}
+	static void AddMemoryUsage(ThreadCache* cache, MemoryUsageType memoryUsageType, ptrdiff_t size) {
+		// Add the size to the thread's own counter, if it has one, otherwise to the global counter
+		if(cache) {
+			atomic_ptrdiff_t& counter = cache->memoryUsage[memoryUsageType];
+			counter.store(counter.load(std::memory_order_relaxed) + size, std::memory_order_relaxed);
+		} else
+			retiredMemoryUsage[memoryUsageType].fetch_add(size, std::memory_order_relaxed);
+	}
+
+#ifdef WFE_ALLOCATOR_THREAD_CACHE
+	static WFE_INLINE uint8_t GetSpanInfo(const void* mem) {
+		// Addresses past the span map's range never belong to a span
+		uintptr_t address = (uintptr_t)mem;
+		if(address >> SPAN_MAP_ADDRESS_BITS)
+			return 0;
+
+		// Look the address's span up in its leaf; spans are never unmapped, so any other address's entry stays 0
+		uint8_t* leaf = spanMap[address >> SPAN_MAP_LEAF_SHIFT].load(std::memory_order_acquire);
+		return leaf ? leaf[(address >> SPAN_SHIFT) & (SPAN_MAP_LEAF_SIZE - 1)] : 0;
+	}
+	static char_t* AllocSpan(uint8_t spanInfo) {
+		spanMutex.Lock();
+
+		// Map a new chunk if the current one is used up, keeping only its span-aligned range
+		if(spanChunkPos == spanChunkEnd) {
+			char_t* chunk = (char_t*)PlatformAllocatePages(SPAN_CHUNK_SIZE);
+			if(!chunk) {
+				spanMutex.Unlock();
+				return nullptr;
+			}
+
+			spanChunkPos = (char_t*)(((uintptr_t)chunk + SPAN_SIZE - 1) & ~(uintptr_t)(SPAN_SIZE - 1));
+			spanChunkEnd = (char_t*)(((uintptr_t)chunk + SPAN_CHUNK_SIZE) & ~(uintptr_t)(SPAN_SIZE - 1));
+		}
+
+		// Exit the function if the span lies past the span map's range
+		char_t* span = spanChunkPos;
+		uintptr_t address = (uintptr_t)span;
+		if(address >> SPAN_MAP_ADDRESS_BITS) {
+			spanMutex.Unlock();
+			return nullptr;
+		}
+
+		// Get the span's leaf in the span map, mapping it if it doesn't exist yet
+		std::atomic<uint8_t*>& leafPtr = spanMap[address >> SPAN_MAP_LEAF_SHIFT];
+		uint8_t* leaf = leafPtr.load(std::memory_order_relaxed);
+		if(!leaf) {
+			leaf = (uint8_t*)PlatformAllocatePages(SPAN_MAP_LEAF_SIZE);
+			if(!leaf) {
+				spanMutex.Unlock();
+				return nullptr;
+			}
+
+			leafPtr.store(leaf, std::memory_order_release);
+		}
+
+		// Set the span's entry, then take the span from the chunk
+		leaf[(address >> SPAN_SHIFT) & (SPAN_MAP_LEAF_SIZE - 1)] = spanInfo;
+		spanChunkPos += SPAN_SIZE;
+
+		spanMutex.Unlock();
+
+		return span;
+	}
+	static size_t FetchCentralBlocks(ThreadCache* cache, size_t classInd, MemoryUsageType memoryUsageType) {
+		CentralSizeClass& central = centralSizeClasses[classInd];
+		size_t classSize = sizeClasses.sizes[classInd];
+		size_t batchSize = sizeClasses.batchSizes[classInd];
+
+		central.mutex.Lock();
+
+		CachedBlock* first = central.blocks[memoryUsageType];
+		size_t count = 0;
+		if(first) {
+			// Take a batch of blocks from the central list
+			CachedBlock* last = first;
+			for(count = 1; count != batchSize && last->next; ++count)
+				last = last->next;
+
+			central.blocks[memoryUsageType] = last->next;
+			last->next = nullptr;
+		} else {
+			// Take a new span if the current one can't fit another block
+			char_t* pos = central.spanPos[memoryUsageType];
+			char_t* end = central.spanEnd[memoryUsageType];
+			if((size_t)(end - pos) < classSize) {
+				pos = AllocSpan((uint8_t)((classInd + 1) | (memoryUsageType << SPAN_USAGE_TYPE_SHIFT)));
+				if(!pos) {
+					central.mutex.Unlock();
+					return 0;
+				}
+
+				end = pos + SPAN_SIZE;
+			}
+
+			// Carve a batch of blocks out of the span
+			first = (CachedBlock*)pos;
+			CachedBlock* last = first;
+			for(count = 1, pos += classSize; count != batchSize && (size_t)(end - pos) >= classSize; ++count, pos += classSize) {
+				last->next = (CachedBlock*)pos;
+				last = last->next;
+			}
+			last->next = nullptr;
+
+			central.spanPos[memoryUsageType] = pos;
+			central.spanEnd[memoryUsageType] = end;
+		}
+
+		central.mutex.Unlock();
+
+		// Give the batch to the thread's cache
+		cache->blocks[memoryUsageType][classInd] = first;
+		cache->blockCounts[memoryUsageType][classInd] = count;
+
+		return count;
+	}
+	static void ReleaseCentralBlocks(CachedBlock* first, CachedBlock* last, size_t classInd, MemoryUsageType memoryUsageType) {
+		// Link the blocks in front of the central list
+		CentralSizeClass& central = centralSizeClasses[classInd];
+
+		central.mutex.Lock();
+		last->next = central.blocks[memoryUsageType];
+		central.blocks[memoryUsageType] = first;
+		central.mutex.Unlock();
+	}
+	static WFE_NOINLINE void ReleaseCachedBlocks(ThreadCache* cache, size_t classInd, MemoryUsageType memoryUsageType) {
+		// Unlink a batch of blocks from the front of the thread's list
+		size_t batchSize = sizeClasses.batchSizes[classInd];
+
+		CachedBlock* first = cache->blocks[memoryUsageType][classInd];
+		CachedBlock* last = first;
+		for(size_t i = 1; i != batchSize; ++i)
+			last = last->next;
+
+		cache->blocks[memoryUsageType][classInd] = last->next;
+		cache->blockCounts[memoryUsageType][classInd] -= batchSize;
+
+		// Move the batch to the central list
+		ReleaseCentralBlocks(first, last, classInd, memoryUsageType);
+	}
+	static WFE_INLINE void* AllocSmallBlock(ThreadCache* cache, size_t classInd, MemoryUsageType memoryUsageType) {
+		// Refill the thread's list from the central list if it is empty
+		CachedBlock* block = cache->blocks[memoryUsageType][classInd];
+		if(!block) {
+			if(!FetchCentralBlocks(cache, classInd, memoryUsageType))
+				return nullptr;
+
+			block = cache->blocks[memoryUsageType][classInd];
+		}
+
+		// Pop the list's first block
+		cache->blocks[memoryUsageType][classInd] = block->next;
+		--cache->blockCounts[memoryUsageType][classInd];
+
+		return block;
+	}
+	static WFE_INLINE void FreeSmallBlock(void* mem, uint8_t spanInfo) {
+		// Get the block's size class and usage type from its span's entry
+		size_t classInd = (spanInfo & SPAN_CLASS_MASK) - 1;
+		MemoryUsageType memoryUsageType = (MemoryUsageType)(spanInfo >> SPAN_USAGE_TYPE_SHIFT);
+
+		// Decrease the current memory usage
+		ThreadCache* cache = GetThreadCache();
+		AddMemoryUsage(cache, memoryUsageType, -(ptrdiff_t)sizeClasses.sizes[classInd]);
+
+		// Push the block straight to the central list if the thread's cache was already destroyed
+		CachedBlock* block = (CachedBlock*)mem;
+		if(!cache) {
+			ReleaseCentralBlocks(block, block, classInd, memoryUsageType);
+			return;
+		}
+
+		// Move a batch of blocks to the central list if the thread's list is full
+		CachedBlock*& blocks = cache->blocks[memoryUsageType][classInd];
+		size_t& blockCount = cache->blockCounts[memoryUsageType][classInd];
+		if(blockCount == sizeClasses.maxBlockCounts[classInd])
+			ReleaseCachedBlocks(cache, classInd, memoryUsageType);
+
+		// Push the block to the thread's list
+		block->next = blocks;
+		blocks = block;
+		++blockCount;
+	}
+#endif
+
+	static ptrdiff_t GetNextSampleDistance(ThreadCache* cache) {
+		// Pick a pseudo-random distance between 1 and twice the sample interval, so that periodic allocation patterns can't dodge the sampler
+		cache->sampleSeed = cache->sampleSeed * 6364136223846793005ull + 1442695040888963407ull;
+		size_t sampleInterval = allocationSampleInterval.load(std::memory_order_relaxed);
+
+		return (ptrdiff_t)(1 + (cache->sampleSeed >> 33) % (sampleInterval << 1));
+	}
+	static WFE_NOINLINE void SampleAllocation(ThreadCache* cache, BlockHeader* header) {
+		// Seed the thread's sampler on its first call, without sampling the allocation
+		if(!cache->sampleSeed) {
+			cache->sampleSeed = (uint64_t)(uintptr_t)cache | 1;
+			cache->bytesUntilSample = GetNextSampleDistance(cache);
+			return;
+		}
+
+		cache->bytesUntilSample = GetNextSampleDistance(cache);
+
+		// Capture the allocation's call stack, skipping this function and AllocMemory
+		void* frames[MAX_SAMPLE_FRAME_COUNT];
+		size_t frameCount = PlatformCaptureBacktrace(frames, MAX_SAMPLE_FRAME_COUNT, 2);
+
+		sampleMutex.Lock();
+
+		// Take a free slot, growing the sample list if none are left; the list is allocated from the platform heap so that it is never sampled itself
+		uint32_t sampleInd;
+		if(firstFreeSampleIndex) {
+			sampleInd = firstFreeSampleIndex - 1;
+			firstFreeSampleIndex = samples[sampleInd].nextFreeIndex;
+		} else {
+			if(sampleSlotCount == sampleCapacity) {
+				uint32_t newCapacity = sampleCapacity ? sampleCapacity << 1 : MIN_SAMPLE_CAPACITY;
+				SampledAllocation* newSamples = (SampledAllocation*)PlatformReallocateMemory(samples, newCapacity * sizeof(SampledAllocation));
+				if(!newSamples) {
+					sampleMutex.Unlock();
+					return;
+				}
+
+				samples = newSamples;
+				sampleCapacity = newCapacity;
+			}
+
+			sampleInd = sampleSlotCount++;
+		}
+
+		// Record the allocation
+		SampledAllocation& sample = samples[sampleInd];
+		sample.size = header->size;
+		sample.memoryUsageType = (MemoryUsageType)header->memoryUsageType;
+		sample.frameCount = frameCount;
+		memcpy(sample.frames, frames, frameCount * sizeof(void*));
+		++sampleCount;
+
+		sampleMutex.Unlock();
+
+		header->sampleIndex = sampleInd + 1;
+	}
+	static void ResizeSample(BlockHeader* header, size_t newSize) {
+		sampleMutex.Lock();
+		samples[header->sampleIndex - 1].size = newSize;
+		sampleMutex.Unlock();
+	}
+	static void RemoveSample(BlockHeader* header) {
+		uint32_t sampleInd = header->sampleIndex - 1;
+		header->sampleIndex = 0;
+
+		// Push the sample's slot to the free list
+		sampleMutex.Lock();
+		samples[sampleInd].size = 0;
+		samples[sampleInd].nextFreeIndex = firstFreeSampleIndex;
+		firstFreeSampleIndex = sampleInd + 1;
+		--sampleCount;
+		sampleMutex.Unlock();
+	}
+	static void* ReallocBlockMemory(ThreadCache* cache, void* mem, size_t newSize, size_t alignment) {
+		// Get the memory's old size and usage type from its header
+		BlockHeader* header = GetBlockHeader(mem);
+		size_t oldSize = header->size;
+		MemoryUsageType memoryUsageType = (MemoryUsageType)header->memoryUsageType;
+
+		// Keep the block's own alignment if it is stricter than the wanted one
+		size_t blockAlignment = GetBlockAlignment(header);
+		if(alignment < blockAlignment)
+			alignment = blockAlignment;
+
+		// Reallocate the memory, remapping the pages of large blocks so that they grow without being copied
+		bool8_t wasLarge = header->flags & BLOCK_FLAG_LARGE;
+		bool8_t isLarge = newSize >= largeAllocationThreshold.load(std::memory_order_relaxed);
+
+		BlockHeader* newHeader;
+		if(wasLarge && isLarge && alignment == blockAlignment && alignment <= PlatformGetPageSize()) {
+			newHeader = ReallocLargeBlock(header, newSize);
+			if(!newHeader)
+				return nullptr;
+		} else if(!wasLarge && !isLarge && alignment == BLOCK_HEADER_SIZE) {
+			newHeader = (BlockHeader*)PlatformReallocateMemory(header, BLOCK_HEADER_SIZE + newSize);
+			if(!newHeader)
+				return nullptr;
+
+			newHeader->size = newSize;
+		} else if(!wasLarge && !isLarge && alignment == blockAlignment && newSize <= oldSize) {
+			// Keep aligned heap blocks that still fit the new size, as the heap can't resize them in place
+			newHeader = header;
+		} else {
+			// Move the block to a new allocation, keeping its header's info
+			newHeader = AllocBlock(newSize, alignment, isLarge);
+			if(!newHeader)
+				return nullptr;
+
+			memcpy(GetBlockData(newHeader), mem, oldSize < newSize ? oldSize : newSize);
+			newHeader->sampleIndex = header->sampleIndex;
+			newHeader->memoryUsageType = header->memoryUsageType;
+
+			FreeBlock(header);
+		}
+
+		// Update the block's sample with its new size
+		newSize = newHeader->size;
+		if(newHeader->sampleIndex)
+			ResizeSample(newHeader, newSize);
+
+		// Update the current memory usage
+		AddMemoryUsage(cache, memoryUsageType, (ptrdiff_t)newSize - (ptrdiff_t)oldSize);
+
+		return GetBlockData(newHeader);
+	}
+	static void* AllocHeapMemory(ThreadCache* cache, size_t size, MemoryUsageType memoryUsageType) {
+		bool8_t large = size >= largeAllocationThreshold.load(std::memory_order_relaxed);
+
+#ifdef WFE_ALLOCATOR_THREAD_CACHE
+		// Take small blocks from the thread's size class lists, unless the allocation is due to be sampled, as only blocks with a header can hold their sample
+		if(!large && cache && size <= MAX_CACHED_SIZE) {
+			size_t classInd = sizeClasses.indices[(size + SIZE_CLASS_GRANULARITY - 1) / SIZE_CLASS_GRANULARITY];
+			size_t classSize = sizeClasses.sizes[classInd];
+			bool8_t profilerEnabled = allocationProfilerEnabled.load(std::memory_order_relaxed);
+
+			if(!profilerEnabled || cache->bytesUntilSample > (ptrdiff_t)classSize) {
+				void* mem = AllocSmallBlock(cache, classInd, memoryUsageType);
+				if(mem) {
+					if(profilerEnabled)
+						cache->bytesUntilSample -= (ptrdiff_t)classSize;
+
+					// Increase the current memory usage
+					AddMemoryUsage(cache, memoryUsageType, (ptrdiff_t)classSize);
+
+					return mem;
+				}
+			}
+		}
+#endif
+
+		BlockHeader* header = AllocBlock(size, DEFAULT_MEMORY_ALIGNMENT, large);
+		if(!header)
+			return nullptr;
+
+		// Set the memory's usage type in the block's header, where it will be looked for when freeing the memory
+		header->memoryUsageType = memoryUsageType;
+		header->sampleIndex = 0;
+		size = header->size;
+
+		// Sample the allocation once enough bytes were allocated since the last sample, if the profiler is enabled
+		if(allocationProfilerEnabled.load(std::memory_order_relaxed) && cache) {
+			cache->bytesUntilSample -= (ptrdiff_t)size;
+			if(cache->bytesUntilSample <= 0)
+				SampleAllocation(cache, header);
+		}
+
+		// Increase the current memory usage
+		AddMemoryUsage(cache, memoryUsageType, (ptrdiff_t)size);
+
+		return GetBlockData(header);
+	}
+#ifdef WFE_ALLOCATOR_THREAD_CACHE
+	static void* ReallocSmallBlock(ThreadCache* cache, void* mem, size_t newSize, size_t alignment, uint8_t spanInfo) {
+		size_t classInd = (spanInfo & SPAN_CLASS_MASK) - 1;
+		size_t oldSize = sizeClasses.sizes[classInd];
+		MemoryUsageType memoryUsageType = (MemoryUsageType)(spanInfo >> SPAN_USAGE_TYPE_SHIFT);
+
+		// Keep the block if its size class is still the smallest one fitting the new size
+		if(alignment <= DEFAULT_MEMORY_ALIGNMENT && newSize <= oldSize && (!classInd || newSize > sizeClasses.sizes[classInd - 1]))
+			return mem;
+
+		// Move the memory to a new block with the same usage type
+		void* newMem;
+		if(alignment <= DEFAULT_MEMORY_ALIGNMENT) {
+			newMem = AllocHeapMemory(cache, newSize, memoryUsageType);
+		} else {
+			PushMemoryUsageType(memoryUsageType);
+			newMem = AllocAlignedMemory(newSize, alignment);
+			PopMemoryUsageType();
+		}
+		if(!newMem)
+			return nullptr;
+
+		memcpy(newMem, mem, oldSize < newSize ? oldSize : newSize);
+		FreeSmallBlock(mem, spanInfo);
+
+		return newMem;
+	}
+#endif
+	static int CompareSampleStacks(const void* left, const void* right) {
+		const SampledAllocation* leftSample = *(const SampledAllocation* const*)left;
+		const SampledAllocation* rightSample = *(const SampledAllocation* const*)right;
+
+		// Order the samples by their usage type, then by their call stacks
+		if(leftSample->memoryUsageType != rightSample->memoryUsageType)
+			return leftSample->memoryUsageType < rightSample->memoryUsageType ? -1 : 1;
+		if(leftSample->frameCount != rightSample->frameCount)
+			return leftSample->frameCount < rightSample->frameCount ? -1 : 1;
+
+		return memcmp(leftSample->frames, rightSample->frames, leftSample->frameCount * sizeof(void*));
+	}
+	static int CompareSnapshotGroups(const void* left, const void* right) {
+		const HeapSnapshotGroup* leftGroup = (const HeapSnapshotGroup*)left;
+		const HeapSnapshotGroup* rightGroup = (const HeapSnapshotGroup*)right;
+
+		// Order the groups by their estimated size, largest first
+		if(leftGroup->estimatedSize != rightGroup->estimatedSize)
+			return leftGroup->estimatedSize > rightGroup->estimatedSize ? -1 : 1;
+
+		return CompareSampleStacks(&leftGroup->sample, &rightGroup->sample);
+	}
+
+	ThreadCacheDestructor::~ThreadCacheDestructor() {
+		ThreadCache* cache = &threadCache;
+		if(cache->state != 1)
+			return;
+
+		// Destroy the command arena, freeing its chunks
+		if(cache->commandArena) {
+			ArenaAllocator* commandArena = cache->commandArena;
+			cache->commandArena = nullptr;
+			cache->commandArenaEnabled = false;
+
+			DestroyObject(commandArena);
+		}
+
+#ifdef WFE_ALLOCATOR_THREAD_CACHE
+		// Move every cached block to the central lists, where other threads can reuse it
+		for(size_t i = 0; i != MEMORY_USAGE_TYPE_COUNT; ++i)
+			for(size_t j = 0; j != SIZE_CLASS_COUNT; ++j) {
+				CachedBlock* first = cache->blocks[i][j];
+				if(!first)
+					continue;
+
+				CachedBlock* last = first;
+				while(last->next)
+					last = last->next;
+
+				ReleaseCentralBlocks(first, last, j, (MemoryUsageType)i);
+
+				cache->blocks[i][j] = nullptr;
+				cache->blockCounts[i][j] = 0;
+			}
+#endif
+
+		// Move the cache's memory usage to the global counters and unregister it
+		threadCacheMutex.Lock();
+		for(size_t i = 0; i != MEMORY_USAGE_TYPE_COUNT; ++i)
+			retiredMemoryUsage[i].fetch_add(cache->memoryUsage[i].exchange(0, std::memory_order_relaxed), std::memory_order_relaxed);
+
+		if(cache->prev)
+			cache->prev->next = cache->next;
+		else
+			threadCacheList = cache->next;
+		if(cache->next)
+			cache->next->prev = cache->prev;
+		threadCacheMutex.Unlock();
+
+		cache->state = 2;
+	}
+
+	// Public functions
 	void* AllocMemory(size_t size) {
 		// Exit the function if the given size is 0
 		if(!size)
@@ -29,75 +771,192 @@ namespace wfe {
 		} else {
 			memoryUsageType = memoryUsageTypeStack[memoryUsageTypeStackSize - 1];
 		}
-		
-		// Increase the requested size to fit the memory usage and try to allocate the memory
-		void* mem = PlatformAllocateMemory(size + sizeof(MemoryUsageType));
-		if(!mem)
-			return nullptr;
-		
-		// Set the memory's usage type
-		MemoryUsageType* memoryUsageLocation = (MemoryUsageType*)((char_t*)mem + size);
-		*memoryUsageLocation = memoryUsageType;
 
-		// Increase the current memory usage
-		memoryUsage[memoryUsageType] += size + sizeof(MemoryUsageType);
+		ThreadCache* cache = GetThreadCache();
+
+		// Bump the memory from the command arena, if the memory is for a command and the arena is enabled
+		if(memoryUsageType == MEMORY_USAGE_TYPE_COMMAND && cache && cache->commandArenaEnabled) {
+			// Disable the arena while allocating from it, so that its chunks are allocated from the heap
+			cache->commandArenaEnabled = false;
+			void* mem = cache->commandArena->Alloc(size);
+			cache->commandArenaEnabled = true;
+
+			return mem;
+		}
 
-		return mem;
+		return AllocHeapMemory(cache, size, memoryUsageType);
 	}
 	void* ReallocMemory(void* mem, size_t newSize) {
 		// Alloc memory if no previous memory was given
 		if(!mem)
 			return AllocMemory(newSize);
-		
+
 		// Free the given memory if the new size if 0
 		if(!newSize) {
 			FreeMemory(mem);
 			return nullptr;
 		}
 
-		// Get the memory's old size
-		size_t oldSize = PlatformGetMemorySize(mem) - sizeof(MemoryUsageType);
+		ThreadCache* cache = GetThreadCache();
 
-		// Get the memory's usage type
-		MemoryUsageType* memoryUsageLocation = (MemoryUsageType*)((char_t*)mem + oldSize);
-		MemoryUsageType memoryUsageType = *memoryUsageLocation;
+#ifdef WFE_ALLOCATOR_THREAD_CACHE
+		// Reallocate small blocks by their size class, as they have no header
+		uint8_t spanInfo = GetSpanInfo(mem);
+		if(spanInfo)
+			return ReallocSmallBlock(cache, mem, newSize, DEFAULT_MEMORY_ALIGNMENT, spanInfo);
+#endif
 
-		// Reallocate the memory
-		void* newMem = PlatformReallocateMemory(mem, newSize + sizeof(MemoryUsageType));
-		if(!newMem)
-			return nullptr;
-		
-		// Set the memory's usage type
-		memoryUsageLocation = (MemoryUsageType*)((char_t*)newMem + newSize);
-		*memoryUsageLocation = memoryUsageType;
+		// Reallocate arena memory inside the current thread's command arena, or move it to the heap if the thread has no command arena, as the arena it came from may belong to another thread
+		if(GetBlockHeader(mem)->flags & BLOCK_FLAG_ARENA) {
+			if(cache && cache->commandArena) {
+				bool8_t commandArenaEnabled = cache->commandArenaEnabled;
+				cache->commandArenaEnabled = false;
+				void* newMem = cache->commandArena->Realloc(mem, newSize);
+				cache->commandArenaEnabled = commandArenaEnabled;
 
-		// Update the current memory usage
-		memoryUsage[memoryUsageType] += newSize - oldSize;
+				return newMem;
+			}
 
-		return newMem;
+			void* newMem = AllocMemory(newSize);
+			if(!newMem)
+				return nullptr;
+
+			size_t oldSize = GetBlockHeader(mem)->size;
+			memcpy(newMem, mem, oldSize < newSize ? oldSize : newSize);
+
+			return newMem;
+		}
+
+		return ReallocBlockMemory(cache, mem, newSize, DEFAULT_MEMORY_ALIGNMENT);
 	}
 	void FreeMemory(void* mem) {
 		// Exit the function if no memory block was given
 		if(!mem)
 			return;
-		
-		// Get the memory's size
-		size_t size = PlatformGetMemorySize(mem) - sizeof(MemoryUsageType);
 
-		// Get the memory's usage type
-		MemoryUsageType* memoryUsageLocation = (MemoryUsageType*)((char_t*)mem + size);
-		MemoryUsageType memoryUsageType = *memoryUsageLocation;
+#ifdef WFE_ALLOCATOR_THREAD_CACHE
+		// Return small blocks to their size class list, before looking for a header they don't have
+		uint8_t spanInfo = GetSpanInfo(mem);
+		if(spanInfo) {
+			FreeSmallBlock(mem, spanInfo);
+			return;
+		}
+#endif
+
+		// Exit the function if the memory was allocated from an arena, as it is only released when the arena is reset
+		BlockHeader* header = GetBlockHeader(mem);
+		if(header->flags & BLOCK_FLAG_ARENA)
+			return;
+
+		ThreadCache* cache = GetThreadCache();
+
+		// Get the memory's size and usage type from its header
+		size_t size = header->size;
+		MemoryUsageType memoryUsageType = (MemoryUsageType)header->memoryUsageType;
 
 		// Decrease the current memory usage
-		memoryUsage[memoryUsageType] -= size;
+		AddMemoryUsage(cache, memoryUsageType, -(ptrdiff_t)size);
+
+		// Stop tracking the block if it was sampled
+		if(header->sampleIndex)
+			RemoveSample(header);
+
+		// Free the block's memory
+		FreeBlock(header);
+	}
+	void* AllocAlignedMemory(size_t size, size_t alignment) {
+		// Allocate the memory normally if it needs no more than the default alignment
+		if(alignment <= DEFAULT_MEMORY_ALIGNMENT)
+			return AllocMemory(size);
+
+		// Exit the function if the given size is 0 or the alignment isn't a power of two
+		if(!size || (alignment & (alignment - 1)))
+			return nullptr;
+
+		// Retrieve the current memory usage type
+		MemoryUsageType memoryUsageType;
+		if(!memoryUsageTypeStackSize) {
+			memoryUsageType = MEMORY_USAGE_TYPE_OTHER;
+		} else {
+			memoryUsageType = memoryUsageTypeStack[memoryUsageTypeStackSize - 1];
+		}
+
+		ThreadCache* cache = GetThreadCache();
+
+		// Allocate the block, skipping the thread cache and the command arena, which only hold blocks with the default alignment
+		BlockHeader* header = AllocBlock(size, alignment, size >= largeAllocationThreshold.load(std::memory_order_relaxed));
+		if(!header)
+			return nullptr;
+
+		// Set the memory's usage type in the block's header
+		header->memoryUsageType = memoryUsageType;
+		header->sampleIndex = 0;
+		size = header->size;
+
+		// Sample the allocation once enough bytes were allocated since the last sample, if the profiler is enabled
+		if(allocationProfilerEnabled.load(std::memory_order_relaxed) && cache) {
+			cache->bytesUntilSample -= (ptrdiff_t)size;
+			if(cache->bytesUntilSample <= 0)
+				SampleAllocation(cache, header);
+		}
+
+		// Increase the current memory usage
+		AddMemoryUsage(cache, memoryUsageType, (ptrdiff_t)size);
+
+		return GetBlockData(header);
+	}
+	void* ReallocAlignedMemory(void* mem, size_t newSize, size_t alignment) {
+		// Reallocate the memory normally if it needs no more than the default alignment
+		if(alignment <= DEFAULT_MEMORY_ALIGNMENT)
+			return ReallocMemory(mem, newSize);
+
+		// Alloc memory if no previous memory was given
+		if(!mem)
+			return AllocAlignedMemory(newSize, alignment);
+
+		// Free the given memory if the new size if 0
+		if(!newSize) {
+			FreeMemory(mem);
+			return nullptr;
+		}
+
+		// Exit the function if the alignment isn't a power of two
+		if(alignment & (alignment - 1))
+			return nullptr;
+
+#ifdef WFE_ALLOCATOR_THREAD_CACHE
+		// Move small blocks to an aligned block, as they only have the default alignment
+		uint8_t spanInfo = GetSpanInfo(mem);
+		if(spanInfo)
+			return ReallocSmallBlock(GetThreadCache(), mem, newSize, alignment, spanInfo);
+#endif
+
+		// Move the memory out of its arena, if it was allocated from one, as the arena can't align it
+		if(GetBlockHeader(mem)->flags & BLOCK_FLAG_ARENA) {
+			void* newMem = AllocAlignedMemory(newSize, alignment);
+			if(!newMem)
+				return nullptr;
+
+			size_t oldSize = GetBlockHeader(mem)->size;
+			memcpy(newMem, mem, oldSize < newSize ? oldSize : newSize);
+
+			return newMem;
+		}
 
-		// Free the memory
-		PlatformFreeMemory(mem);
+		return ReallocBlockMemory(GetThreadCache(), mem, newSize, alignment);
 	}
 	size_t GetMemorySize(void* mem) {
-		return PlatformGetMemorySize(mem) - sizeof(MemoryUsageType);
+#ifdef WFE_ALLOCATOR_THREAD_CACHE
+		// Get small blocks' size from their size class
+		uint8_t spanInfo = GetSpanInfo(mem);
+		if(spanInfo)
+			return sizeClasses.sizes[(spanInfo & SPAN_CLASS_MASK) - 1];
+#endif
+
+		// Get the block's size from its header, which arena allocations lay out the same way
+		return GetBlockHeader(mem)->size;
 	}
-	
+
 	void PushMemoryUsageType(MemoryUsageType memoryUsageType) {
 		// Push the memory usage type at the top of the stack
 		memoryUsageTypeStack[memoryUsageTypeStackSize++] = memoryUsageType;
@@ -109,4 +968,158 @@ namespace wfe {
 	MemoryUsageType GetMemoryUsageType() {
 		return memoryUsageTypeStack[memoryUsageTypeStackSize - 1];
 	}
-}
\ No newline at end of file
+	void SetCommandArenaEnabled(bool8_t enabled) {
+		ThreadCache* cache = GetThreadCache();
+		if(!cache)
+			return;
+
+		// Create the thread's command arena, if it doesn't exist yet
+		if(enabled && !cache->commandArena)
+			cache->commandArena = NewObject<ArenaAllocator>();
+
+		cache->commandArenaEnabled = enabled;
+	}
+	bool8_t IsCommandArenaEnabled() {
+		ThreadCache* cache = GetThreadCache();
+		return cache && cache->commandArenaEnabled;
+	}
+	void ResetCommandArena() {
+		// Reset the thread's command arena, if it exists
+		ThreadCache* cache = GetThreadCache();
+		if(cache && cache->commandArena)
+			cache->commandArena->Reset();
+	}
+	ArenaAllocator* GetCommandArena() {
+		ThreadCache* cache = GetThreadCache();
+		return cache ? cache->commandArena : nullptr;
+	}
+
+	void SetLargeAllocationThreshold(size_t threshold) {
+		largeAllocationThreshold.store(threshold ? threshold : 1, std::memory_order_relaxed);
+	}
+	size_t GetLargeAllocationThreshold() {
+		return largeAllocationThreshold.load(std::memory_order_relaxed);
+	}
+	void SetAllocationProfilerEnabled(bool8_t enabled) {
+		allocationProfilerEnabled.store(enabled, std::memory_order_relaxed);
+	}
+	bool8_t IsAllocationProfilerEnabled() {
+		return allocationProfilerEnabled.load(std::memory_order_relaxed);
+	}
+	void SetAllocationSampleInterval(size_t sampleInterval) {
+		allocationSampleInterval.store(sampleInterval ? sampleInterval : 1, std::memory_order_relaxed);
+	}
+	size_t GetAllocationSampleInterval() {
+		return allocationSampleInterval.load(std::memory_order_relaxed);
+	}
+	size_t GetSampledAllocationCount() {
+		sampleMutex.Lock();
+		size_t count = sampleCount;
+		sampleMutex.Unlock();
+
+		return count;
+	}
+	bool8_t DumpHeapSnapshot(const char_t* filePath) {
+		// Copy every live sample, so that the snapshot can be written without holding the sample mutex; the file output allocates memory, which may be sampled itself
+		sampleMutex.Lock();
+
+		size_t snapshotCount = sampleCount;
+		SampledAllocation* snapshotSamples = (SampledAllocation*)PlatformAllocateMemory(snapshotCount * sizeof(SampledAllocation) + 1);
+		if(!snapshotSamples) {
+			sampleMutex.Unlock();
+			return false;
+		}
+
+		size_t copiedCount = 0;
+		for(uint32_t i = 0; i != sampleSlotCount; ++i)
+			if(samples[i].size)
+				snapshotSamples[copiedCount++] = samples[i];
+
+		sampleMutex.Unlock();
+
+		// Sort pointers to the samples by their call stacks, then group every run of identical call stacks
+		const SampledAllocation** sortedSamples = (const SampledAllocation**)PlatformAllocateMemory(snapshotCount * sizeof(SampledAllocation*) + 1);
+		HeapSnapshotGroup* groups = (HeapSnapshotGroup*)PlatformAllocateMemory(snapshotCount * sizeof(HeapSnapshotGroup) + 1);
+		if(!sortedSamples || !groups) {
+			PlatformFreeMemory(snapshotSamples);
+			PlatformFreeMemory(sortedSamples);
+			PlatformFreeMemory(groups);
+			return false;
+		}
+
+		for(size_t i = 0; i != snapshotCount; ++i)
+			sortedSamples[i] = snapshotSamples + i;
+		qsort(sortedSamples, snapshotCount, sizeof(SampledAllocation*), CompareSampleStacks);
+
+		size_t sampleInterval = allocationSampleInterval.load(std::memory_order_relaxed);
+		size_t groupCount = 0;
+		for(size_t i = 0; i != snapshotCount; ++i) {
+			if(!groupCount || CompareSampleStacks(&groups[groupCount - 1].sample, sortedSamples + i))
+				groups[groupCount++] = { sortedSamples[i], 0, 0, 0 };
+
+			// Every sample stands for roughly one sample interval's worth of bytes, or only itself if it is larger than the interval
+			HeapSnapshotGroup& group = groups[groupCount - 1];
+			size_t size = sortedSamples[i]->size;
+			size_t estimatedSize = size > sampleInterval ? size : sampleInterval;
+
+			++group.sampleCount;
+			group.estimatedSize += estimatedSize;
+			group.estimatedCount += estimatedSize / size;
+		}
+		qsort(groups, groupCount, sizeof(HeapSnapshotGroup), CompareSnapshotGroups);
+
+		// Write the snapshot's header, followed by one line for every group
+		FileOutput output;
+		bool8_t success = output.Open(filePath);
+		if(success) {
+			char_t line[MAX_SNAPSHOT_LINE_LENGTH];
+			FormatString(line, MAX_SNAPSHOT_LINE_LENGTH, "# Heap snapshot\n# Sample interval: %zu\n# Sampled allocations: %zu\n# Estimated bytes, estimated allocations, sampled allocations, usage type | call stack\n", sampleInterval, snapshotCount);
+			output.WriteBuffer(strlen(line), line);
+
+			for(size_t i = 0; i != groupCount; ++i) {
+				const HeapSnapshotGroup& group = groups[i];
+
+				FormatString(line, MAX_SNAPSHOT_LINE_LENGTH, "%zu %zu %zu %s |", group.estimatedSize, group.estimatedCount, group.sampleCount, MEMORY_USAGE_TYPE_NAMES[group.sample->memoryUsageType]);
+				output.WriteBuffer(strlen(line), line);
+
+				for(size_t j = 0; j != group.sample->frameCount; ++j) {
+					line[0] = ' ';
+					PlatformGetBacktraceFrameName(group.sample->frames[j], line + 1, MAX_SNAPSHOT_LINE_LENGTH - 1);
+					output.WriteBuffer(strlen(line), line);
+				}
+
+				output.WriteBuffer(1, "\n");
+			}
+
+			success = output.Close();
+		}
+
+		// Free the snapshot's temporary lists
+		PlatformFreeMemory(snapshotSamples);
+		PlatformFreeMemory(sortedSamples);
+		PlatformFreeMemory(groups);
+
+		return success;
+	}
+
+	volatile atomic_size_t* GetMemoryUsage() {
+		// Aggregate every memory usage type into the snapshot
+		for(size_t i = 0; i != MEMORY_USAGE_TYPE_COUNT; ++i)
+			memoryUsageSnapshot[i].store(GetMemoryUsage((MemoryUsageType)i), std::memory_order_relaxed);
+
+		return memoryUsageSnapshot;
+	}
+	size_t GetMemoryUsage(MemoryUsageType memoryUsageType) {
+		// Sum the usage of every exited thread and every live thread
+		threadCacheMutex.Lock();
+
+		ptrdiff_t usage = retiredMemoryUsage[memoryUsageType].load(std::memory_order_relaxed);
+		for(ThreadCache* cache = threadCacheList; cache; cache = cache->next)
+			usage += cache->memoryUsage[memoryUsageType].load(std::memory_order_relaxed);
+
+		threadCacheMutex.Unlock();
+
+		// Clamp the usage to 0, since counters of threads that are still running may be slightly out of date
+		return usage > 0 ? (size_t)usage : 0;
+	}
+}
@@ -0,0 +1,205 @@
+#include "ArenaAllocator.hpp"
+#include "Allocator.hpp"
+#include "Memory.hpp"
+
+namespace wfe {
+	// Constants
+	static const size_t ARENA_CHUNK_HEADER_SIZE = (sizeof(void*) + sizeof(size_t) + ArenaAllocator::ALIGNMENT - 1) & ~(ArenaAllocator::ALIGNMENT - 1);
+	static const size_t ARENA_CHUNK_ALIGNMENT = 64;
+
+	// Internal structs
+	struct ArenaAllocator::Chunk {
+		Chunk* next;
+		size_t size;
+	};
+	// Laid out like the allocator's block header, with the size first and the flags last
+	struct ArenaAllocationHeader {
+		size_t size;
+		uint32_t reserved;
+		uint16_t reservedFlags;
+		uint16_t flags;
+	};
+
+	static_assert(sizeof(ArenaAllocationHeader) == ArenaAllocator::ALIGNMENT, "The arena allocation header must fill exactly one alignment unit!");
+
+	// Internal functions
+	static WFE_INLINE size_t AlignArenaSize(size_t size) {
+		return (size + ArenaAllocator::ALIGNMENT - 1) & ~(ArenaAllocator::ALIGNMENT - 1);
+	}
+	static WFE_INLINE size_t GetArenaPadding(const char_t* pos, size_t alignment) {
+		// Get the number of bytes to skip so that the data after the allocation's header is aligned
+		size_t data = (size_t)pos + sizeof(ArenaAllocationHeader);
+		return ((data + alignment - 1) & ~(alignment - 1)) - data;
+	}
+	static WFE_INLINE char_t* GetChunkData(void* chunk) {
+		return (char_t*)chunk + ARENA_CHUNK_HEADER_SIZE;
+	}
+
+	ArenaAllocator::Chunk* ArenaAllocator::AllocChunk(size_t minSize) {
+		// Allocate a chunk of the default size, or larger if the allocation doesn't fit it
+		size_t size = minSize > chunkSize ? minSize : chunkSize;
+
+		// Align the chunk past the default alignment, so that it always gets a block header; small heap blocks have none, and the allocator would mistake the chunk's allocations for them
+		Chunk* chunk = (Chunk*)AllocAlignedMemory(ARENA_CHUNK_HEADER_SIZE + size, ARENA_CHUNK_ALIGNMENT);
+		if(!chunk)
+			return nullptr;
+
+		chunk->next = nullptr;
+		chunk->size = size;
+
+		return chunk;
+	}
+
+	// Public functions
+	ArenaAllocator::ArenaAllocator(size_t chunkSize) : chunkSize(chunkSize) { }
+
+	void* ArenaAllocator::Alloc(size_t size, size_t alignment) {
+		// Exit the function if the given size is 0
+		if(!size)
+			return nullptr;
+
+		// Use the default alignment if a smaller one was given
+		if(alignment < ALIGNMENT)
+			alignment = ALIGNMENT;
+
+		size_t allocSize = sizeof(ArenaAllocationHeader) + AlignArenaSize(size);
+
+		// Calculate the padding needed to align the block after its header
+		size_t padding = GetArenaPadding(pos, alignment);
+
+		// Move to the next chunk that fits the allocation, allocating a new one if none do
+		if((size_t)(end - pos) < padding + allocSize) {
+			// Chunks are only aligned to the default alignment, so reserve room for the worst case padding
+			size_t minSize = allocSize + alignment - ALIGNMENT;
+
+			Chunk* prevChunk = currentChunk;
+			Chunk* chunk = currentChunk ? currentChunk->next : firstChunk;
+			while(chunk && chunk->size < minSize) {
+				prevChunk = chunk;
+				chunk = chunk->next;
+			}
+
+			if(!chunk) {
+				chunk = AllocChunk(minSize);
+				if(!chunk)
+					return nullptr;
+
+				// Link the new chunk after the last one
+				if(prevChunk)
+					prevChunk->next = chunk;
+				else
+					firstChunk = chunk;
+			}
+
+			currentChunk = chunk;
+			pos = GetChunkData(chunk);
+			end = pos + chunk->size;
+			padding = GetArenaPadding(pos, alignment);
+		}
+
+		// Bump the position and write the allocation's header
+		ArenaAllocationHeader* header = (ArenaAllocationHeader*)(pos + padding);
+		header->size = size;
+		header->flags = BLOCK_FLAG;
+		pos += padding + allocSize;
+		usedSize += padding + allocSize;
+
+		lastAlloc = header + 1;
+		return lastAlloc;
+	}
+	void* ArenaAllocator::Realloc(void* mem, size_t newSize, size_t alignment) {
+		// Alloc memory if no previous memory was given
+		if(!mem)
+			return Alloc(newSize, alignment);
+
+		ArenaAllocationHeader* header = (ArenaAllocationHeader*)mem - 1;
+		size_t oldSize = header->size;
+
+		// Resize the block in place if it is aligned correctly and was either the last allocation that still fits its chunk or is shrinking
+		if(!((size_t)mem & (alignment - 1))) {
+			if(mem == lastAlloc) {
+				char_t* newPos = (char_t*)mem + AlignArenaSize(newSize);
+				if(newPos <= end) {
+					usedSize += newPos - pos;
+					pos = newPos;
+					header->size = newSize;
+
+					return mem;
+				}
+			} else if(newSize <= oldSize) {
+				header->size = newSize;
+
+				return mem;
+			}
+		}
+
+		// Allocate a new block and copy the old block's contents
+		void* newMem = Alloc(newSize, alignment);
+		if(!newMem)
+			return nullptr;
+
+		memcpy(newMem, mem, oldSize < newSize ? oldSize : newSize);
+
+		return newMem;
+	}
+	void ArenaAllocator::Free(void*) { }
+	size_t ArenaAllocator::GetSize(const void* mem) const {
+		return ((const ArenaAllocationHeader*)mem - 1)->size;
+	}
+	bool8_t ArenaAllocator::Contains(const void* mem) const {
+		// Check every chunk's range
+		for(Chunk* chunk = firstChunk; chunk; chunk = chunk->next) {
+			char_t* data = GetChunkData(chunk);
+			if((const char_t*)mem >= data && (const char_t*)mem < data + chunk->size)
+				return true;
+		}
+
+		return false;
+	}
+
+	void ArenaAllocator::Reset() {
+		// Move back to the start of the first chunk
+		currentChunk = firstChunk;
+		if(firstChunk) {
+			pos = GetChunkData(firstChunk);
+			end = pos + firstChunk->size;
+		}
+
+		lastAlloc = nullptr;
+		usedSize = 0;
+	}
+	void ArenaAllocator::Release() {
+		// Unlink the chunks before freeing them, since the allocator may check if freed memory belongs to the arena
+		Chunk* chunk = firstChunk;
+		firstChunk = nullptr;
+
+		while(chunk) {
+			Chunk* next = chunk->next;
+			FreeMemory(chunk);
+			chunk = next;
+		}
+
+		currentChunk = nullptr;
+		pos = nullptr;
+		end = nullptr;
+		lastAlloc = nullptr;
+		usedSize = 0;
+	}
+
+	size_t ArenaAllocator::GetUsedSize() const {
+		return usedSize;
+	}
+	size_t ArenaAllocator::GetCapacity() const {
+		// Sum the sizes of every chunk
+		size_t capacity = 0;
+		for(Chunk* chunk = firstChunk; chunk; chunk = chunk->next)
+			capacity += chunk->size;
+
+		return capacity;
+	}
+
+	ArenaAllocator::~ArenaAllocator() {
+		// Free all of the arena's chunks
+		Release();
+	}
+}
@@ -5,65 +5,361 @@
 
 namespace wfe {
 	// Constants
-	const size_t START_THREAD_CAPACITY = 256;
+	static const size_t START_QUEUE_CAPACITY = 256;
+	static const size_t CACHE_LINE_SIZE = 64;
+	static const size_t INJECTION_QUEUE_CAPACITY = 4096;
+	static const size_t MAX_PARALLEL_FOR_HELPER_COUNT = 64;
+	static const uint32_t JOB_SPIN_MAX_BACKOFF = 64;
+
+	// Internal structs
+	struct JobManager::JobSuccessor {
+		Job* job;
+		JobSuccessor* next;
+	};
+	struct JobManager::Job {
+		JobFunction func;
+		void* args;
+		Result* result;
+
+		AtomicMutex resultMutex;
+		atomic_uint8_t refCount;
+
+		atomic_size_t dependencyCount;
+		JobSuccessor* successors;
+		bool8_t finished;
+	};
+	// Align every queue to a cache line so that the queues of different workers never share one
+	struct alignas(CACHE_LINE_SIZE) JobManager::JobQueue {
+		AtomicMutex mutex;
+		Job** jobs;
+		size_t capacity;
+		size_t front;
+		atomic_size_t size;
+	};
+	struct JobManager::WorkerInfo {
+		JobManager* manager;
+		size_t index;
+	};
+
+	// Internal variables
+	static thread_local JobManager* currentManager = nullptr;
+	static thread_local size_t currentWorkerInd = SIZE_T_MAX;
 
 	// Internal functions
 	void* JobManager::JobThreadManager(void* args) {
-		// Get the job manager's pointer
-		JobManager* manager = (JobManager*)args;
+		// Get the worker's info
+		WorkerInfo* info = (WorkerInfo*)args;
+		JobManager* manager = info->manager;
+		size_t workerInd = info->index;
+
+		// Set the current thread's worker info, used when submitting jobs from inside other jobs
+		currentManager = manager;
+		currentWorkerInd = workerInd;
 
 		while(true) {
-			// Wait for at least one job to ba available
+			// Wait for at least one job to be available
 			auto waitResult = manager->jobQueueSemaphore.Wait();
 			if(waitResult != Semaphore::SUCCESS)
 				throw Exception("Failed to wait for semaphore! Error code: %s", Semaphore::SemaphoreResultToString(waitResult));
 
-			// Lock the queue mutex and retrieve the first job's info from the queue
-			manager->queueMutex.Lock();
+			// Look for a job in the worker's own queue, then try to steal one from the other workers
+			Job* job = manager->PopJob(workerInd);
+			uint32_t backoff = 1;
+			while(!job) {
+				// Sweep every queue one last time if the manager is being destroyed, blocking on busy queues instead of skipping them, and exit the loop if no job is left
+				if(manager->stopping.load(std::memory_order_acquire)) {
+					job = manager->PopJob(workerInd, true);
+					break;
+				}
+
+				// The job that signalled the semaphore was taken by another worker or is still being pushed, so wait for a short while, doubling the wait between tries and yielding once it is long enough
+				for(uint32_t i = 0; i != backoff; ++i)
+					PauseCurrentThread();
+				if(backoff < JOB_SPIN_MAX_BACKOFF)
+					backoff <<= 1;
+				else
+					YieldCurrentThread();
+
+				job = manager->PopJob(workerInd);
+			}
+			if(!job)
+				break;
+
+			// Run the job
+			manager->RunJob(job);
+		}
 
-			size_t jobInd = manager->queueFront;
+		return nullptr;
+	}
 
-			// Exit the loop if no job is available, as this means that the manager is begin destroyed
-			if(jobInd == SIZE_T_MAX) {
-				manager->queueMutex.Unlock();
-				break;
+	JobManager::Job* JobManager::PopJob(size_t workerInd, bool8_t blocking) {
+		// Steal from every worker's queue if not called from a worker, as the back of every queue belongs to its worker
+		size_t firstVictimInd = 0, victimCount = threadCount;
+		if(workerInd < threadCount) {
+			// Pop the last job from the worker's own queue, as it is the most likely to still be in the cache
+			JobQueue& ownQueue = queues[workerInd];
+			if(ownQueue.size.load(std::memory_order_relaxed)) {
+				ownQueue.mutex.Lock();
+
+				if(ownQueue.size) {
+					--ownQueue.size;
+					Job* job = ownQueue.jobs[(ownQueue.front + ownQueue.size) & (ownQueue.capacity - 1)];
+
+					ownQueue.mutex.Unlock();
+					return job;
+				}
+
+				ownQueue.mutex.Unlock();
+			}
+
+			firstVictimInd = workerInd + 1;
+			victimCount = threadCount - 1;
+		}
+
+		// Try to pop a job submitted from outside the workers
+		Job* injectedJob;
+		if(injectionQueue.TryPop(injectedJob))
+			return injectedJob;
+
+		// Retry while a job is still being pushed to the injection queue when blocking, as the pop fails until the push finishes
+		while(blocking && !injectionQueue.IsEmpty()) {
+			if(injectionQueue.TryPop(injectedJob))
+				return injectedJob;
+		}
+
+		// Try to steal the oldest job from every other worker's queue
+		for(size_t i = 0; i != victimCount; ++i) {
+			size_t victimInd = firstVictimInd + i;
+			if(victimInd >= threadCount)
+				victimInd -= threadCount;
+
+			JobQueue& victimQueue = queues[victimInd];
+
+			// Skip empty queues without locking them
+			if(!victimQueue.size.load(std::memory_order_relaxed))
+				continue;
+
+			// Skip the queue if it is currently in use, as another queue might have a job available, unless every queue must be checked
+			if(blocking)
+				victimQueue.mutex.Lock();
+			else if(!victimQueue.mutex.TryLock())
+				continue;
+
+			if(victimQueue.size) {
+				Job* job = victimQueue.jobs[victimQueue.front];
+				victimQueue.front = (victimQueue.front + 1) & (victimQueue.capacity - 1);
+				--victimQueue.size;
+
+				victimQueue.mutex.Unlock();
+				return job;
+			}
+
+			victimQueue.mutex.Unlock();
+		}
+
+		return nullptr;
+	}
+	JobManager::Job* JobManager::CreateJob(JobFunction func, void* args, Result* result, size_t dependencyCount) {
+		// Detach the result from its previous job, if it was used before
+		if(result)
+			result->Detach();
+
+		// Create the new job, referenced by both the worker that will run it and its result
+		Job* job = NewObject<Job>();
+		job->func = func;
+		job->args = args;
+		job->result = result;
+		job->refCount.store(result ? 2 : 1, std::memory_order_relaxed);
+		job->dependencyCount.store(dependencyCount, std::memory_order_relaxed);
+		job->successors = nullptr;
+		job->finished = false;
+
+		// Set the result's info
+		if(result)
+			result->job = job;
+
+		return job;
+	}
+	void JobManager::QueueJobs(size_t jobCount, Job* const* jobs) {
+		if(currentManager == this) {
+			// Push every job to the current worker's queue, from which idle workers will steal
+			PushJobs(currentWorkerInd, jobCount, jobs);
+		} else {
+			// Push single jobs to the lock-free injection queue, as batches are already pushed with one lock per worker queue
+			size_t jobInd = 0;
+			if(jobCount == 1 && injectionQueue.TryPush(*jobs))
+				jobInd = 1;
+
+			// Split the remaining jobs evenly between all worker queues, locking every queue only once
+			size_t remainingCount = jobCount - jobInd;
+			if(remainingCount) {
+				size_t firstQueue = nextQueue.fetch_add(1, std::memory_order_relaxed);
+				size_t chunkSize = remainingCount / threadCount, remainder = remainingCount % threadCount;
+
+				for(size_t i = 0; i != threadCount && jobInd != jobCount; ++i) {
+					size_t chunkJobCount = chunkSize + (i < remainder);
+					PushJobs((firstQueue + i) % threadCount, chunkJobCount, jobs + jobInd);
+
+					jobInd += chunkJobCount;
+				}
 			}
+		}
 
-			JobFunction jobFunc = manager->jobList[jobInd].func;
-			void* jobArgs = manager->jobList[jobInd].args;
+		// Wake the workers with a single signal
+		auto signalResult = jobQueueSemaphore.Signal((uint32_t)jobCount);
+		if(signalResult != Semaphore::SUCCESS)
+			throw Exception("Failed to signal semaphore! Error code: %s", Semaphore::SemaphoreResultToString(signalResult));
+	}
+	void JobManager::PushJobs(size_t queueInd, size_t jobCount, Job* const* jobs) {
+		JobQueue& queue = queues[queueInd];
+
+		// Lock the queue's mutex and check if the queue can't fit the new jobs
+		queue.mutex.Lock();
+
+		if(queue.size + jobCount > queue.capacity) {
+			// Allocate a new job array, doubling the capacity until the new jobs fit
+			size_t newCapacity = queue.capacity << 1;
+			while(queue.size + jobCount > newCapacity)
+				newCapacity <<= 1;
+
+			Job** newJobs = (Job**)AllocMemory(newCapacity * sizeof(Job*));
+			if(!newJobs) {
+				queue.mutex.Unlock();
+				throw BadAllocException("Failed to reallocate job queue!");
+			}
 
-			// Remove the current job from the queue and unlock the queue mutex
-			manager->queueFront = manager->jobList[jobInd].next;
-			if(manager->queueFront == SIZE_T_MAX)
-				manager->queueBack = SIZE_T_MAX;
+			// Copy the jobs in order to the new array
+			for(size_t i = 0; i != queue.size; ++i)
+				newJobs[i] = queue.jobs[(queue.front + i) & (queue.capacity - 1)];
 
-			manager->queueMutex.Unlock();
+			// Free the old array and set the new queue info
+			FreeMemory(queue.jobs);
 
-			// Run the job's function
-			void* result = jobFunc(jobArgs);
+			queue.jobs = newJobs;
+			queue.capacity = newCapacity;
+			queue.front = 0;
+		}
+
+		// Add the jobs at the back of the queue and unlock the queue mutex
+		size_t back = queue.front + queue.size;
+		for(size_t i = 0; i != jobCount; ++i)
+			queue.jobs[(back + i) & (queue.capacity - 1)] = jobs[i];
+		queue.size += jobCount;
 
-			// Lock the queue mutex and check if the result still exists
-			manager->queueMutex.Lock();
+		queue.mutex.Unlock();
+	}
+	void JobManager::RunJob(Job* job) {
+		// Run the job's function
+		void* result = job->func(job->args);
 
-			if(manager->jobList[jobInd].result) {
-				// Set the result variable and signal the job's semaphore
-				manager->jobList[jobInd].result->result = result;
+		// Lock the job's result mutex and check if the result still exists
+		job->resultMutex.Lock();
 
-				auto signalResult = manager->jobList[jobInd].result->semaphore.Signal();
+		if(job->result) {
+			// Set the result variable and signal the job's semaphore
+			job->result->result = result;
+
+			auto signalResult = job->result->semaphore.Signal();
+			if(signalResult != Semaphore::SUCCESS)
+				throw Exception("Failed to signal semaphore! Error code: %s", Semaphore::SemaphoreResultToString(signalResult));
+		}
+
+		// Mark the job as finished and take its successor list, so that no other successors will be added
+		job->finished = true;
+		JobSuccessor* successor = job->successors;
+		job->successors = nullptr;
+
+		job->resultMutex.Unlock();
+
+		// Decrement every successor's dependency count, scheduling the successors with no dependencies left
+		while(successor) {
+			if(successor->job->dependencyCount.fetch_sub(1, std::memory_order_acq_rel) == 1)
+				QueueJobs(1, &successor->job);
+
+			JobSuccessor* next = successor->next;
+			DestroyObject(successor);
+			successor = next;
+		}
+
+		// Free the job if its result no longer references it
+		if(job->refCount.fetch_sub(1, std::memory_order_acq_rel) == 1)
+			DestroyObject(job);
+	}
+
+	bool8_t JobManager::TryRunQueuedJob() {
+		// Claim one of the queued jobs' signals, exiting the function if no job is queued
+		if(jobQueueSemaphore.TryWait() != Semaphore::SUCCESS)
+			return false;
+
+		// Find the claimed job, starting with the current worker's queue if called from a worker, or only stealing from the workers' queues otherwise
+		size_t workerInd = (currentManager == this) ? currentWorkerInd : SIZE_T_MAX;
+
+		Job* job = PopJob(workerInd);
+		uint32_t backoff = 1;
+		while(!job) {
+			// The claimed job was taken by another thread or is still being pushed; give its signal back and exit the function once the wait between tries is long enough
+			if(backoff == JOB_SPIN_MAX_BACKOFF) {
+				auto signalResult = jobQueueSemaphore.Signal();
 				if(signalResult != Semaphore::SUCCESS)
 					throw Exception("Failed to signal semaphore! Error code: %s", Semaphore::SemaphoreResultToString(signalResult));
-				
-				// Remove the manager's pointer from the result
-				manager->jobList[jobInd].result->manager = nullptr;
+
+				return false;
 			}
 
-			// Add the current job to the free list and unlock the queue mutex
-			manager->jobList[jobInd].next = manager->freeList;
-			manager->freeList = jobInd;
+			// Wait for a short while, doubling the wait between tries
+			for(uint32_t i = 0; i != backoff; ++i)
+				PauseCurrentThread();
+			backoff <<= 1;
 
-			manager->queueMutex.Unlock();
+			job = PopJob(workerInd);
 		}
 
+		// Run the job
+		RunJob(job);
+
+		return true;
+	}
+
+	struct JobManager::ParallelForInfo {
+		ParallelForFunction func;
+		void* args;
+		size_t end;
+		size_t grainSize;
+		size_t participantCount;
+
+		atomic_size_t next;
+		atomic_size_t pendingHelperCount;
+	};
+
+	void JobManager::RunParallelForChunks(ParallelForInfo* info) {
+		size_t chunkBegin = info->next.load(std::memory_order_relaxed);
+		while(chunkBegin < info->end) {
+			// Take a part of the remaining range proportional to the number of participants, which shrinks as the range is processed
+			size_t remaining = info->end - chunkBegin;
+			size_t chunkSize = remaining / (info->participantCount << 1);
+			if(chunkSize < info->grainSize)
+				chunkSize = info->grainSize;
+			if(chunkSize > remaining)
+				chunkSize = remaining;
+
+			// Try to claim the chunk, retrying with the updated begin index if another thread claimed it first
+			if(!info->next.compare_exchange_weak(chunkBegin, chunkBegin + chunkSize, std::memory_order_relaxed))
+				continue;
+
+			// Run the function on the claimed chunk
+			info->func(chunkBegin, chunkBegin + chunkSize, info->args);
+
+			chunkBegin = info->next.load(std::memory_order_relaxed);
+		}
+	}
+	void* JobManager::ParallelForJob(void* args) {
+		// Run chunks until the range is exhausted
+		ParallelForInfo* info = (ParallelForInfo*)args;
+		RunParallelForChunks(info);
+
+		// Notify the calling thread that this helper is done; the info must not be accessed afterwards
+		info->pendingHelperCount.fetch_sub(1, std::memory_order_release);
+
 		return nullptr;
 	}
 
@@ -77,7 +373,7 @@ namespace wfe {
 			return false;
 		if(waitRes != Semaphore::SUCCESS)
 			throw Exception("Failed to try waiting for semaphore! Error code: %s", Semaphore::SemaphoreResultToString(waitRes));
-		
+
 		// Set the result at the given address, if requested
 		if(result)
 			*result = this->result;
@@ -89,103 +385,239 @@ namespace wfe {
 		auto waitRes = semaphore.Wait();
 		if(waitRes != Semaphore::SUCCESS)
 			throw Exception("Failed to wait for semaphore! Error code: %s", Semaphore::SemaphoreResultToString(waitRes));
-		
+
 		// Set the result at the given address, if requested
 		if(result)
 			*result = this->result;
 	}
 
+	void JobManager::Result::Detach() {
+		// Exit the function if the result isn't attached to a job
+		if(!job)
+			return;
+
+		// Remove the result's pointer from its corresponding job
+		job->resultMutex.Lock();
+		job->result = nullptr;
+		job->resultMutex.Unlock();
+
+		// Free the job if it has already finished
+		if(job->refCount.fetch_sub(1, std::memory_order_acq_rel) == 1)
+			DestroyObject(job);
+
+		job = nullptr;
+	}
+
 	JobManager::Result::~Result() {
-		// Remove the result's pointer from its corresponding job, if it still exists
-		if(manager) {
-			manager->queueMutex.Lock();
-			manager->jobList[jobInd].result = nullptr;
-			manager->queueMutex.Unlock();
-		}
+		// Detach the result from its job, if it still exists
+		Detach();
 	}
 
-	JobManager::JobManager(size_t threadCount) : threadCount(threadCount), jobCapacity(START_THREAD_CAPACITY), jobList((Job*)AllocMemory(jobCapacity * sizeof(Job))), queueFront(SIZE_T_MAX), queueBack(SIZE_T_MAX), freeList(0) {
-		// Check if the job list was allocated successfully
-		if(!jobList)
-			throw BadAllocException("Failed to allocate job list!");
+	JobManager::JobManager(size_t threadCount, bool8_t pinThreads) : threadCount(threadCount), injectionQueue(INJECTION_QUEUE_CAPACITY), nextQueue(0), stopping(false) {
+		// Create the worker info and queue arrays
+		workerInfos = NewArray<WorkerInfo>(threadCount);
+		queues = NewArray<JobQueue>(threadCount);
+
+		for(size_t i = 0; i != threadCount; ++i) {
+			// Set the worker's info
+			workerInfos[i].manager = this;
+			workerInfos[i].index = i;
+
+			// Allocate the worker's queue
+			queues[i].jobs = (Job**)AllocMemory(START_QUEUE_CAPACITY * sizeof(Job*));
+			if(!queues[i].jobs)
+				throw BadAllocException("Failed to allocate job queue!");
+
+			queues[i].capacity = START_QUEUE_CAPACITY;
+			queues[i].front = 0;
+			queues[i].size = 0;
+		}
 
 		// Create the thread array
 		threads = NewArray<Thread>(threadCount);
 
+		// Get the processors the workers may be pinned to, out of the ones the process is allowed to run on
+		uint64_t allowedMask = pinThreads ? GetCurrentThreadAffinityMask() : 0;
+		size_t allowedCount = 0;
+		for(uint64_t mask = allowedMask; mask; mask &= mask - 1)
+			++allowedCount;
+
+		// Pin the workers to their own processors only if every worker can get one, leaving the first allowed processor to the main thread when possible
+		if(threadCount > allowedCount) {
+			allowedMask = 0;
+		} else if(threadCount < allowedCount) {
+			allowedMask &= allowedMask - 1;
+		}
+
 		// Start the job manager on every created thread
 		for(size_t i = 0; i != threadCount; ++i) {
-			auto result = threads[i].Begin(JobThreadManager, this);
-			if(result != Thread::SUCCESS)
+			char_t name[16];
+			snprintf(name, sizeof(name), "WFE Worker %u", (uint32_t)i);
+
+			// Give the worker the lowest allowed processor that is left
+			Thread::ThreadOptions options;
+			options.name = name;
+			options.affinityMask = allowedMask & (~allowedMask + 1);
+			allowedMask &= allowedMask - 1;
+
+			// Start the worker unpinned if it couldn't be pinned to its processor
+			auto result = threads[i].Begin(JobThreadManager, workerInfos + i, options);
+			if(result == Thread::ERROR_INVALID_OPTIONS && options.affinityMask) {
+				options.affinityMask = 0;
+				result = threads[i].Begin(JobThreadManager, workerInfos + i, options);
+			}
+
+			if(result != Thread::SUCCESS) {
+				// Stop and join the workers that were already started, then free the manager's arrays
+				stopping.store(true, std::memory_order_release);
+				if(i)
+					jobQueueSemaphore.Signal((uint32_t)i);
+
+				for(size_t j = 0; j != i; ++j)
+					threads[j].Join();
+				for(size_t j = 0; j != threadCount; ++j)
+					FreeMemory(queues[j].jobs);
+
+				DestroyArray(threads, threadCount);
+				DestroyArray(workerInfos, threadCount);
+				DestroyArray(queues, threadCount);
+
 				throw Exception("Failed to begin running on thread! Error code: %s", Thread::ThreadResultToString(result));
+			}
 		}
-
-		// Set the next indices of jobs in the free list
-		for(size_t i = 0; i != jobCapacity - 1; ++i)
-			jobList[i].next = i + 1;
-		jobList[jobCapacity - 1].next = SIZE_T_MAX;
 	}
 
 	void JobManager::SubmitJob(JobFunction func, void* args, Result& result) {
-		// Lock the queue mutex and check if the job list is full
-		queueMutex.Lock();
-
-		if(freeList == SIZE_T_MAX) {
-			// Reallocate the job list
-			size_t oldCapacity = jobCapacity;
-			jobCapacity >>= 1;
-
-			jobList = (Job*)ReallocMemory(jobList, jobCapacity * sizeof(Job));
-			if(!jobList)
-				throw BadAllocException("Failed to reallocate job list!");
-			
-			// Set the new free list's info
-			freeList = oldCapacity;
-			for(size_t i = oldCapacity; i != jobCapacity - 1; ++i)
-				jobList[i].next = i + 1;
-			jobList[jobCapacity - 1].next = SIZE_T_MAX;
-		}
-
-		// Get an empty job from the free list
-		size_t jobInd = freeList;
-		freeList = jobList[jobInd].next;
-
-		// Set the job's new info
-		jobList[jobInd].func = func;
-		jobList[jobInd].args = args;
-		jobList[jobInd].result = &result;
+		// Submit the job with no dependencies
+		SubmitJob(func, args, result, 0, nullptr);
+	}
+	void JobManager::SubmitJob(JobFunction func, void* args, Result& result, size_t dependencyCount, Result* const* dependencies) {
+		// Create the new job, holding one extra dependency until all dependencies are registered
+		Job* job = CreateJob(func, args, &result, 1);
 
-		// Set the result's info
-		result.manager = this;
-		result.jobInd = jobInd;
-		
-		// Add the new job at the end of the queue
-		if(queueBack == SIZE_T_MAX) {
-			queueFront = jobInd;
-			queueBack = jobInd;
-		} else {
-			jobList[queueBack].next = jobInd;
-			queueBack = jobInd;
+		// Add the new job to the successor list of every unfinished dependency
+		for(size_t i = 0; i != dependencyCount; ++i) {
+			Job* dependency = dependencies[i]->job;
+			if(!dependency)
+				continue;
+
+			dependency->resultMutex.Lock();
+
+			if(!dependency->finished) {
+				JobSuccessor* successor = NewObject<JobSuccessor>();
+				successor->job = job;
+				successor->next = dependency->successors;
+				dependency->successors = successor;
+
+				job->dependencyCount.fetch_add(1, std::memory_order_relaxed);
+			}
+
+			dependency->resultMutex.Unlock();
 		}
-		jobList[jobInd].next = SIZE_T_MAX;
 
-		// Unlock the queue mutex and signal the queue semaphore
-		queueMutex.Unlock();
-		
-		auto signalResult = jobQueueSemaphore.Signal();
-		if(signalResult != Semaphore::SUCCESS)
-			throw Exception("Failed to signal semaphore! Error code: %s", Semaphore::SemaphoreResultToString(signalResult));
+		// Release the extra dependency and schedule the job if all of its dependencies have finished
+		if(job->dependencyCount.fetch_sub(1, std::memory_order_acq_rel) == 1)
+			QueueJobs(1, &job);
+	}
+	void JobManager::SubmitJobs(size_t jobCount, const JobFunction* funcs, void* const* args, Result* results) {
+		// Exit the function if no jobs were given
+		if(!jobCount)
+			return;
+
+		// Create every job in the batch
+		Job** jobs = (Job**)AllocMemory(jobCount * sizeof(Job*));
+		if(!jobs)
+			throw BadAllocException("Failed to allocate job batch!");
+
+		for(size_t i = 0; i != jobCount; ++i)
+			jobs[i] = CreateJob(funcs[i], args[i], results + i, 0);
+
+		// Queue the entire batch and wake the workers with a single signal
+		QueueJobs(jobCount, jobs);
+
+		FreeMemory(jobs);
+	}
+	void JobManager::ParallelFor(size_t begin, size_t end, size_t grainSize, ParallelForFunction func, void* args) {
+		// Exit the function if the range is empty
+		if(begin >= end)
+			return;
+
+		// Choose a grain size that gives every thread a few chunks, if none was given
+		size_t count = end - begin;
+		if(!grainSize) {
+			grainSize = count / ((threadCount + 1) << 2);
+			if(!grainSize)
+				grainSize = 1;
+		}
+
+		// Run the function on the calling thread if the range can't be split
+		size_t chunkCount = (count + grainSize - 1) / grainSize;
+		size_t helperCount = chunkCount - 1;
+		if(helperCount > threadCount)
+			helperCount = threadCount;
+
+		if(!helperCount) {
+			func(begin, end, args);
+			return;
+		}
+
+		// Set the shared loop info
+		ParallelForInfo info;
+		info.func = func;
+		info.args = args;
+		info.end = end;
+		info.grainSize = grainSize;
+		info.participantCount = helperCount + 1;
+		info.next.store(begin, std::memory_order_relaxed);
+		info.pendingHelperCount.store(helperCount, std::memory_order_relaxed);
+
+		// Submit the helper jobs, which have no results, and wake the workers with a single signal
+		Job* helpers[MAX_PARALLEL_FOR_HELPER_COUNT];
+		size_t helperInd = 0;
+		while(helperInd != helperCount) {
+			size_t batchCount = helperCount - helperInd;
+			if(batchCount > MAX_PARALLEL_FOR_HELPER_COUNT)
+				batchCount = MAX_PARALLEL_FOR_HELPER_COUNT;
+
+			for(size_t i = 0; i != batchCount; ++i)
+				helpers[i] = CreateJob(ParallelForJob, &info, nullptr, 0);
+
+			QueueJobs(batchCount, helpers);
+
+			helperInd += batchCount;
+		}
+
+		// Run chunks on the calling thread as well
+		RunParallelForChunks(&info);
+
+		// Run other queued jobs, including the helpers that haven't started yet, until every helper has finished
+		while(info.pendingHelperCount.load(std::memory_order_acquire)) {
+			if(!TryRunQueuedJob())
+				YieldCurrentThread();
+		}
+	}
+	void JobManager::SubmitContinuation(Result& dependency, JobFunction func, void* args, Result& result) {
+		// Submit the job with the given result as its only dependency
+		Result* dependencies[] { &dependency };
+		SubmitJob(func, args, result, 1, dependencies);
 	}
 
 	JobManager::~JobManager() {
 		// Signal the semaphore once for every thread, for them to reach their exit conditions
+		stopping.store(true, std::memory_order_release);
 		jobQueueSemaphore.Signal((uint32_t)threadCount);
-		
+
 		// Join every thread
 		for(size_t i = 0; i != threadCount; ++i)
 			threads[i].Join();
 
-		// Free the thread and job arrays
+		// Free the queues' job arrays
+		for(size_t i = 0; i != threadCount; ++i)
+			FreeMemory(queues[i].jobs);
+
+		// Free the thread, worker info and queue arrays
 		DestroyArray(threads, threadCount);
-		FreeMemory(jobList);
+		DestroyArray(workerInfos, threadCount);
+		DestroyArray(queues, threadCount);
 	}
-}
\ No newline at end of file
+}
@@ -1,7 +1,24 @@
 #include "Math.hpp"
 #include "String.hpp"
+#include "Platform.hpp"
 #include <math.h>
 
+#if defined(__x86_64__) || defined(_M_X64)
+// Hash long blocks with AVX2 on x86-64 CPUs that support it
+#define WFE_HASH_SIMD
+
+#include <immintrin.h>
+#endif
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+#if defined(_MSC_VER)
+#define WFE_HASH_TARGET_AVX2
+#else
+#define WFE_HASH_TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+
 namespace wfe {
 	float32_t Sin(float32_t x) {
 		return sin(x);
@@ -111,12 +128,180 @@ namespace wfe {
 		return ((float32_t)Random() / ((float32_t)RAND_MAX / (max - min))) + min;
 	}
 
-	/// @brief A large prime used for hashing strings.
+	/// @brief A large prime used for combining hashes.
 	static const uint64_t LARGE_PRIME = 0x9ddfea08eb382d69;
+	/// @brief The secret constants used for hashing, taken from https://github.com/wangyi-fudan/wyhash
+	static const uint64_t HASH_SECRET[4] = { 0x2d358dccaa6c78a5, 0x8bb84b93962eacc9, 0x4b33a62ed433d4a3, 0x4d5a2da51de1aa47 };
+	/// @brief The secret used for keying the stripes of long blocks, generated with SplitMix64 from the first hashing secret.
+	alignas(32) static const uint64_t HASH_STRIPE_SECRET[24] = {
+		0x0bd2db2e48789d20, 0x7c621bc543b550a8, 0xb27410639e13de46, 0xd3c4eb1714b569e5,
+		0x9fc8be2266edda39, 0x491e4aceebe4be30, 0x180afb1a9570beb0, 0xca454537878d2950,
+		0xa96a98c828045478, 0xa4a4b920c8e15bf5, 0xae09d92fba683111, 0x1defe04876a32064,
+		0x1b830cede5f3a95f, 0x5d45a31f3dd3297f, 0x1b37fd03b9ada18e, 0xa9cad3754033f149,
+		0x2bbe59b3c2df09d1, 0xc01f604b97fba984, 0xdad0325410c910f5, 0x0677e5dd8bdbadf9,
+		0x2bc9abfd44bc3b36, 0x08cf102312742cef, 0x495cf4650c95833d, 0x288961efe041bc37
+	};
+	/// @brief The minimum size of the blocks hashed as independent 64 byte stripes.
+	static const size_t HASH_LONG_SIZE = 1024;
+	/// @brief The size of every stripe of a long block.
+	static const size_t HASH_STRIPE_SIZE = 64;
+	/// @brief The number of stripes accumulated between two scrambles of the accumulators.
+	static const size_t HASH_BLOCK_STRIPE_COUNT = 16;
+	/// @brief The prime every accumulator is multiplied by when it is scrambled.
+	static const uint32_t HASH_SCRAMBLE_PRIME = 0x9e3779b1;
+
+#if defined(_MSC_VER)
+	typedef uint32_t UnalignedHashUInt32;
+	typedef uint64_t UnalignedHashUInt64;
+#else
+	typedef uint32_t UnalignedHashUInt32 __attribute__((aligned(1), may_alias));
+	typedef uint64_t UnalignedHashUInt64 __attribute__((aligned(1), may_alias));
+#endif
+
+	// Internal hashing functions
+	static WFE_INLINE void HashMultiply(uint64_t& a, uint64_t& b) {
+		// Calculate the full 128-bit product of the two values, storing its low half in the first value and its high half in the second
+#if defined(__SIZEOF_INT128__)
+		__uint128_t product = (__uint128_t)a * b;
+		a = (uint64_t)product;
+		b = (uint64_t)(product >> 64);
+#elif defined(_MSC_VER) && defined(_M_X64)
+		a = _umul128(a, b, &b);
+#else
+		uint64_t aLow = (uint32_t)a, aHigh = a >> 32, bLow = (uint32_t)b, bHigh = b >> 32;
+		uint64_t low = aLow * bLow, mid1 = aHigh * bLow, mid2 = aLow * bHigh, high = aHigh * bHigh;
+		uint64_t mid = (low >> 32) + (uint32_t)mid1 + (uint32_t)mid2;
+
+		a = (low & 0xffffffff) | (mid << 32);
+		b = high + (mid1 >> 32) + (mid2 >> 32) + (mid >> 32);
+#endif
+	}
+	static WFE_INLINE uint64_t HashMix(uint64_t a, uint64_t b) {
+		// Fold the 128-bit product of the two values into 64 bits
+		HashMultiply(a, b);
+		return a ^ b;
+	}
+	static WFE_INLINE uint64_t HashRead64(const char_t* ptr) {
+		return *(const UnalignedHashUInt64*)ptr;
+	}
+	static WFE_INLINE uint64_t HashRead32(const char_t* ptr) {
+		return *(const UnalignedHashUInt32*)ptr;
+	}
+	static WFE_INLINE uint64_t HashRead3(const char_t* ptr, size_t size) {
+		// Read the first, middle and last bytes of a 1 to 3 byte block
+		return ((uint64_t)(uint8_t)ptr[0] << 16) | ((uint64_t)(uint8_t)ptr[size >> 1] << 8) | (uint64_t)(uint8_t)ptr[size - 1];
+	}
+	static WFE_INLINE void HashAccumulateStripe(uint64_t* acc, const char_t* stripe, const char_t* secret) {
+		// Add every lane's data to its neighbour and the product of the lane's keyed halves to the lane itself
+		for(size_t i = 0; i != 8; ++i) {
+			uint64_t value = HashRead64(stripe + (i << 3));
+			uint64_t key = value ^ HashRead64(secret + (i << 3));
+
+			acc[i ^ 1] += value;
+			acc[i] += (key & 0xffffffff) * (key >> 32);
+		}
+	}
+	static WFE_INLINE void HashScrambleAccumulators(uint64_t* acc, const char_t* secret) {
+		// Fold the upper bits of every lane into its lower bits, since the accumulation only carries upwards
+		for(size_t i = 0; i != 8; ++i) {
+			uint64_t value = acc[i];
+			value ^= value >> 47;
+			value ^= HashRead64(secret + (i << 3));
+			acc[i] = value * HASH_SCRAMBLE_PRIME;
+		}
+	}
+	static uint64_t HashMergeAccumulators(const uint64_t* acc, size_t size) {
+		// Mix the lanes in pairs and avalanche their sum
+		uint64_t result = size * LARGE_PRIME;
+		for(size_t i = 0; i != 8; i += 2)
+			result += HashMix(acc[i] ^ HASH_STRIPE_SECRET[i + 1], acc[i + 1] ^ HASH_STRIPE_SECRET[i + 2]);
+
+		return HashMix(result ^ HASH_SECRET[0], HASH_SECRET[1]);
+	}
+	static uint64_t HashLong(const char_t* ptr, size_t size, uint64_t seed) {
+		const char_t* secret = (const char_t*)HASH_STRIPE_SECRET;
+		const char_t* end = ptr + size;
+
+		// Start every lane from the seed
+		uint64_t acc[8];
+		for(size_t i = 0; i != 8; ++i)
+			acc[i] = seed ^ HASH_STRIPE_SECRET[16 + i];
+
+		// Accumulate every whole block of stripes, keying every stripe with a different part of the secret, and scramble the lanes after every block
+		size_t stripeCount = (size - 1) / HASH_STRIPE_SIZE;
+		for(; stripeCount >= HASH_BLOCK_STRIPE_COUNT; stripeCount -= HASH_BLOCK_STRIPE_COUNT) {
+			for(size_t i = 0; i != HASH_BLOCK_STRIPE_COUNT; ++i, ptr += HASH_STRIPE_SIZE)
+				HashAccumulateStripe(acc, ptr, secret + (i << 3));
+
+			HashScrambleAccumulators(acc, secret + 128);
+		}
+
+		// Accumulate the remaining stripes, then the last 64 bytes, which may overlap the previous stripe
+		for(size_t i = 0; i != stripeCount; ++i, ptr += HASH_STRIPE_SIZE)
+			HashAccumulateStripe(acc, ptr, secret + (i << 3));
+		HashAccumulateStripe(acc, end - HASH_STRIPE_SIZE, secret + 121);
+
+		return HashMergeAccumulators(acc, size);
+	}
+
+#if defined(WFE_HASH_SIMD)
+	WFE_HASH_TARGET_AVX2 static WFE_INLINE __m256i HashAccumulateAVX2(__m256i acc, const char_t* data, const char_t* secret) {
+		// Add every lane's data to its neighbour and the product of the lane's keyed halves to the lane itself
+		__m256i value = _mm256_loadu_si256((const __m256i*)data);
+		__m256i key = _mm256_xor_si256(value, _mm256_loadu_si256((const __m256i*)secret));
+		__m256i product = _mm256_mul_epu32(key, _mm256_shuffle_epi32(key, 0x31));
+
+		return _mm256_add_epi64(acc, _mm256_add_epi64(_mm256_shuffle_epi32(value, 0x4e), product));
+	}
+	WFE_HASH_TARGET_AVX2 static WFE_INLINE __m256i HashScrambleAVX2(__m256i acc, const char_t* secret) {
+		// Fold the upper bits of every lane into its lower bits, then multiply the lane by the prime one 32-bit half at a time
+		acc = _mm256_xor_si256(acc, _mm256_srli_epi64(acc, 47));
+		acc = _mm256_xor_si256(acc, _mm256_loadu_si256((const __m256i*)secret));
+
+		__m256i prime = _mm256_set1_epi32((int32_t)HASH_SCRAMBLE_PRIME);
+		__m256i low = _mm256_mul_epu32(acc, prime);
+		__m256i high = _mm256_mul_epu32(_mm256_shuffle_epi32(acc, 0x31), prime);
+
+		return _mm256_add_epi64(low, _mm256_slli_epi64(high, 32));
+	}
+	WFE_HASH_TARGET_AVX2 static uint64_t HashLongAVX2(const char_t* ptr, size_t size, uint64_t seed) {
+		// Calculate the same hash as HashLong, with every stripe held in two registers
+		const char_t* secret = (const char_t*)HASH_STRIPE_SECRET;
+		const char_t* end = ptr + size;
+
+		__m256i seedLanes = _mm256_set1_epi64x((int64_t)seed);
+		__m256i acc1 = _mm256_xor_si256(seedLanes, _mm256_load_si256((const __m256i*)(HASH_STRIPE_SECRET + 16)));
+		__m256i acc2 = _mm256_xor_si256(seedLanes, _mm256_load_si256((const __m256i*)(HASH_STRIPE_SECRET + 20)));
+
+		size_t stripeCount = (size - 1) / HASH_STRIPE_SIZE;
+		for(; stripeCount >= HASH_BLOCK_STRIPE_COUNT; stripeCount -= HASH_BLOCK_STRIPE_COUNT) {
+			for(size_t i = 0; i != HASH_BLOCK_STRIPE_COUNT; ++i, ptr += HASH_STRIPE_SIZE) {
+				acc1 = HashAccumulateAVX2(acc1, ptr, secret + (i << 3));
+				acc2 = HashAccumulateAVX2(acc2, ptr + 32, secret + (i << 3) + 32);
+			}
+
+			acc1 = HashScrambleAVX2(acc1, secret + 128);
+			acc2 = HashScrambleAVX2(acc2, secret + 160);
+		}
+
+		for(size_t i = 0; i != stripeCount; ++i, ptr += HASH_STRIPE_SIZE) {
+			acc1 = HashAccumulateAVX2(acc1, ptr, secret + (i << 3));
+			acc2 = HashAccumulateAVX2(acc2, ptr + 32, secret + (i << 3) + 32);
+		}
+		acc1 = HashAccumulateAVX2(acc1, end - HASH_STRIPE_SIZE, secret + 121);
+		acc2 = HashAccumulateAVX2(acc2, end - 32, secret + 153);
+
+		alignas(32) uint64_t acc[8];
+		_mm256_store_si256((__m256i*)acc, acc1);
+		_mm256_store_si256((__m256i*)(acc + 4), acc2);
+
+		return HashMergeAccumulators(acc, size);
+	}
+#endif
 
 	// Internal integer hashing function
 	static uint64_t HashInt(uint64_t val) {
-		// Use an example hash algorithm from https://github.com/skeeto/hash-prospector/tree/master
+		// Use the SplitMix64 finalizer, which is a bijection, so distinct integers never share a hash; the folded multiply used for memory isn't one
 		val += 0x9e3779b97f4a7c15;
 		val ^= val >> 30;
 		val *= 0xbf58476d1ce4e5b9;
@@ -127,6 +312,74 @@ namespace wfe {
 		return val;
 	}
 
+	uint64_t HashMemory(const void* data, size_t size, uint64_t seed) {
+		const char_t* ptr = (const char_t*)data;
+
+		// Hash long blocks as independent stripes, which can be vectorized
+		if(size > HASH_LONG_SIZE) {
+#if defined(WFE_HASH_SIMD)
+			static const bool8_t avx2Supported = PlatformIsAVX2Supported();
+			if(avx2Supported)
+				return HashLongAVX2(ptr, size, seed);
+#endif
+			return HashLong(ptr, size, seed);
+		}
+
+		seed ^= HashMix(seed ^ HASH_SECRET[0], HASH_SECRET[1]);
+
+		uint64_t a, b;
+		if(size <= 16) {
+			// Read small blocks as two possibly overlapping halves
+			if(size >= 4) {
+				size_t quarter = (size >> 3) << 2;
+				a = (HashRead32(ptr) << 32) | HashRead32(ptr + quarter);
+				b = (HashRead32(ptr + size - 4) << 32) | HashRead32(ptr + size - 4 - quarter);
+			} else if(size) {
+				a = HashRead3(ptr, size);
+				b = 0;
+			} else {
+				a = 0;
+				b = 0;
+			}
+		} else {
+			size_t sizeLeft = size;
+
+			// Mix 48 byte blocks in three independent lanes, which hides the latency of the multiplications
+			if(sizeLeft > 48) {
+				uint64_t seed1 = seed, seed2 = seed;
+				do {
+					seed = HashMix(HashRead64(ptr) ^ HASH_SECRET[1], HashRead64(ptr + 8) ^ seed);
+					seed1 = HashMix(HashRead64(ptr + 16) ^ HASH_SECRET[2], HashRead64(ptr + 24) ^ seed1);
+					seed2 = HashMix(HashRead64(ptr + 32) ^ HASH_SECRET[3], HashRead64(ptr + 40) ^ seed2);
+
+					ptr += 48;
+					sizeLeft -= 48;
+				} while(sizeLeft > 48);
+
+				seed ^= seed1 ^ seed2;
+			}
+
+			// Mix the remaining 16 byte blocks
+			while(sizeLeft > 16) {
+				seed = HashMix(HashRead64(ptr) ^ HASH_SECRET[1], HashRead64(ptr + 8) ^ seed);
+
+				ptr += 16;
+				sizeLeft -= 16;
+			}
+
+			// Read the last 16 bytes, which may overlap the previous block
+			a = HashRead64(ptr + sizeLeft - 16);
+			b = HashRead64(ptr + sizeLeft - 8);
+		}
+
+		// Mix the final block with the seed and the size
+		a ^= HASH_SECRET[1];
+		b ^= seed;
+		HashMultiply(a, b);
+
+		return HashMix(a ^ HASH_SECRET[0] ^ size, b ^ HASH_SECRET[1]);
+	}
+
 	template<>
 	uint64_t Hash<uint8_t>::operator()(const uint8_t& val) const {
 		return HashInt(val);
@@ -168,123 +421,9 @@ namespace wfe {
 		return HashInt(*(uint64_t*)&val);
 	}
 	template<>
-	uint64_t Hash<string>::operator()(const string& val) const {
-		// Apply a common string hashing algorithm
-		uint64_t hash = 0x811c9dc5;
-
-		size_t size = val.length();
-		const char_t* strPtr = val.data();
-
-		while(size >= sizeof(size_t)) {
-			// Save a size_t segment
-			size_t segment = *(const size_t*)strPtr;
-
-			const char_t* segmentPtr = (const char_t*)&segment;
-
-			// Loop through every character in the segment
-			for(size_t i = 0; i != sizeof(size_t); ++i) {
-				// Add the current character to the hash
-				hash ^= *segmentPtr;
-				hash *= LARGE_PRIME;
-
-				// Increment the segment pointer
-				++segmentPtr;
-			}
-
-			// Decrement the string's size by the size of size_t
-			size -= sizeof(size_t);
-
-			// Increment the string pointer by the size of size_t
-			strPtr += sizeof(size_t);
-		}
-#if defined(WFE_ARCHITECTURE_X64)
-		// Check if there is a 4 byte region left to loop through
-		if(size >= sizeof(uint32_t)) {
-			// Save a uint32_t segment
-			uint32_t segment = *(const uint32_t*)strPtr;
-
-			const char_t* segmentPtr = (const char_t*)&segment;
-
-			// Loop through every character in the segment
-			for(size_t i = 0; i != sizeof(uint32_t); ++i) {
-				// Add the current character to the hash
-				hash ^= *segmentPtr;
-				hash *= LARGE_PRIME;
-
-				// Increment the segment pointer
-				++segmentPtr;
-			}
-
-			// Decrement the string's size by the size of uint32_t
-			size -= sizeof(uint32_t);
-
-			// Increment the string pointer by the size of uint32_t
-			strPtr += sizeof(uint32_t);
-		}
-#endif
-		// Check if there is a 2 byte region left to loop through
-		if(size >= sizeof(uint16_t)) {
-			// Save a uint16_t segment
-			uint16_t segment = *(const uint16_t*)strPtr;
-
-			const char_t* segmentPtr = (const char_t*)&segment;
-
-			// Loop through every character in the segment
-			for(size_t i = 0; i != sizeof(uint16_t); ++i) {
-				// Add the current character to the hash
-				hash ^= *segmentPtr;
-				hash *= LARGE_PRIME;
-
-				// Increment the segment pointer
-				++segmentPtr;
-			}
-
-			// Decrement the string's size by the size of uint16_t
-			size -= sizeof(uint16_t);
-
-			// Increment the string pointer by the size of uint16_t
-			strPtr += sizeof(uint16_t);
-		}
-		// Check if there is a 1 byte region left to loop through
-		if(size) {
-			// Add the current character to the hash
-			hash ^= *strPtr;
-			hash *= LARGE_PRIME;
-		}
-
-		return hash;
-	}
-	template<>
 	uint64_t Hash<const char_t*>::operator()(const char_t* const& val) const {
-		// Apply a common string hashing algorithm
-		const char_t* str = val;
-		uint64_t hash = 0x811c9dc5;
-
-		while(true) {
-			// Save a size_t segment
-			size_t segment = *(const size_t*)str;
-
-			const char_t* segmentPtr = (const char_t*)&segment;
-
-			// Loop through every character in the segment
-			for(size_t i = 0; i != sizeof(size_t); ++i) {
-				// Check if the string has ended.
-				if(!*segmentPtr)
-					return hash;
-				
-				// Add the current character to the hash
-				hash ^= *segmentPtr;
-				hash *= LARGE_PRIME;
-
-				// Increment the segment pointer
-				++segmentPtr;
-			}
-
-			// Increment the string pointer by the size of size_t
-			str += sizeof(size_t);
-		}
-
-		return hash;
+		// Hash the string the same way as a string object holding it
+		return HashMemory(val, strlen(val));
 	}
 
 	uint64_t HashCombine(uint64_t hash1, uint64_t hash2) {
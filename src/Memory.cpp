@@ -3,12 +3,842 @@
 #include "Exception.hpp"
 #include "Platform.hpp"
 
+#if defined(__x86_64__) || defined(_M_X64)
+// Every x86-64 CPU supports SSE2, so the memory functions always use SIMD kernels there
+#define WFE_MEMORY_SIMD
+
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+#endif
+
+#if defined(_MSC_VER)
+#define WFE_MEMORY_TARGET_AVX2
+#else
+#define WFE_MEMORY_TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+
+// The scanning kernels read whole aligned lines past the end of strings, which can't cross into an unmapped page but trip the address and thread sanitizers
+#if defined(_MSC_VER)
+#define WFE_MEMORY_NO_SANITIZE
+#else
+#define WFE_MEMORY_NO_SANITIZE __attribute__((no_sanitize("address", "thread")))
+#endif
+
 namespace wfe {
+#if defined(WFE_MEMORY_SIMD)
+	// Constants
+	static const size_t SMALL_COPY_SIZE = 64;
+	static const size_t NON_TEMPORAL_THRESHOLD = 4194304;
+	static const size_t MAX_STRING_SCAN_SIZE = 65536;
+	static const size_t MIN_PAGE_SIZE = 4096;
+
+	// Internal structs
+#if defined(_MSC_VER)
+	typedef uint16_t UnalignedUInt16;
+	typedef uint32_t UnalignedUInt32;
+	typedef uint64_t UnalignedUInt64;
+#else
+	typedef uint16_t UnalignedUInt16 __attribute__((aligned(1), may_alias));
+	typedef uint32_t UnalignedUInt32 __attribute__((aligned(1), may_alias));
+	typedef uint64_t UnalignedUInt64 __attribute__((aligned(1), may_alias));
+#endif
+
+	struct MemoryKernels {
+		void(*copyForward)(char_t* dest, const char_t* src, size_t size);
+		void(*copyBackward)(char_t* dest, const char_t* src, size_t size);
+		void(*set)(char_t* dest, uint8_t c, size_t size);
+		const char_t*(*findByte)(const char_t* ptr, uint8_t c, size_t size);
+		const char_t*(*findByteOrNull)(const char_t* str, uint8_t c);
+		size_t(*complementSpan)(const char_t* str, const char_t* reject);
+		size_t(*span)(const char_t* str, const char_t* accept);
+		const char_t*(*findString)(const char_t* str, const char_t* wanted);
+	};
+
+	// Internal functions
+	static WFE_INLINE void CopySmall(char_t* dest, const char_t* src, size_t size) {
+		// Load every byte before storing any, so that overlapping blocks are copied correctly; the first and last segments overlap when the size isn't a multiple of the segment size
+		if(size > 32) {
+			__m128i seg1 = _mm_loadu_si128((const __m128i*)src);
+			__m128i seg2 = _mm_loadu_si128((const __m128i*)(src + 16));
+			__m128i seg3 = _mm_loadu_si128((const __m128i*)(src + size - 32));
+			__m128i seg4 = _mm_loadu_si128((const __m128i*)(src + size - 16));
+			_mm_storeu_si128((__m128i*)dest, seg1);
+			_mm_storeu_si128((__m128i*)(dest + 16), seg2);
+			_mm_storeu_si128((__m128i*)(dest + size - 32), seg3);
+			_mm_storeu_si128((__m128i*)(dest + size - 16), seg4);
+		} else if(size >= 16) {
+			__m128i seg1 = _mm_loadu_si128((const __m128i*)src);
+			__m128i seg2 = _mm_loadu_si128((const __m128i*)(src + size - 16));
+			_mm_storeu_si128((__m128i*)dest, seg1);
+			_mm_storeu_si128((__m128i*)(dest + size - 16), seg2);
+		} else if(size >= 8) {
+			uint64_t seg1 = *(const UnalignedUInt64*)src;
+			uint64_t seg2 = *(const UnalignedUInt64*)(src + size - 8);
+			*(UnalignedUInt64*)dest = seg1;
+			*(UnalignedUInt64*)(dest + size - 8) = seg2;
+		} else if(size >= 4) {
+			uint32_t seg1 = *(const UnalignedUInt32*)src;
+			uint32_t seg2 = *(const UnalignedUInt32*)(src + size - 4);
+			*(UnalignedUInt32*)dest = seg1;
+			*(UnalignedUInt32*)(dest + size - 4) = seg2;
+		} else if(size >= 2) {
+			uint16_t seg1 = *(const UnalignedUInt16*)src;
+			uint16_t seg2 = *(const UnalignedUInt16*)(src + size - 2);
+			*(UnalignedUInt16*)dest = seg1;
+			*(UnalignedUInt16*)(dest + size - 2) = seg2;
+		} else if(size) {
+			*dest = *src;
+		}
+	}
+	static WFE_INLINE void SetSmall(char_t* dest, uint8_t c, size_t size) {
+		// Set the first and last segments, which overlap when the size isn't a multiple of the segment size
+		if(size >= 16) {
+			__m128i seg = _mm_set1_epi8((char_t)c);
+			_mm_storeu_si128((__m128i*)dest, seg);
+			_mm_storeu_si128((__m128i*)(dest + size - 16), seg);
+			if(size > 32) {
+				_mm_storeu_si128((__m128i*)(dest + 16), seg);
+				_mm_storeu_si128((__m128i*)(dest + size - 32), seg);
+			}
+		} else if(size >= 8) {
+			uint64_t seg = (uint64_t)c * 0x0101010101010101ull;
+			*(UnalignedUInt64*)dest = seg;
+			*(UnalignedUInt64*)(dest + size - 8) = seg;
+		} else if(size >= 4) {
+			uint32_t seg = (uint32_t)c * 0x01010101u;
+			*(UnalignedUInt32*)dest = seg;
+			*(UnalignedUInt32*)(dest + size - 4) = seg;
+		} else if(size >= 2) {
+			uint16_t seg = (uint16_t)(c * 0x0101u);
+			*(UnalignedUInt16*)dest = seg;
+			*(UnalignedUInt16*)(dest + size - 2) = seg;
+		} else if(size) {
+			*dest = (char_t)c;
+		}
+	}
+
+	static void CopyForwardSSE2(char_t* dest, const char_t* src, size_t size) {
+		// Save the first and last segments, which are stored unaligned after the loop
+		__m128i head = _mm_loadu_si128((const __m128i*)src);
+		__m128i tail = _mm_loadu_si128((const __m128i*)(src + size - 16));
+
+		// Skip to the first aligned destination segment
+		size_t skip = 16 - ((size_t)dest & 15);
+		char_t* destPtr = dest + skip;
+		const char_t* srcPtr = src + skip;
+		size_t remaining = size - skip;
+
+		if(size >= NON_TEMPORAL_THRESHOLD) {
+			// Stream very large blocks past the cache, since they would only evict useful data from it
+			for(; remaining > 64; remaining -= 64, destPtr += 64, srcPtr += 64) {
+				__m128i seg1 = _mm_loadu_si128((const __m128i*)srcPtr);
+				__m128i seg2 = _mm_loadu_si128((const __m128i*)(srcPtr + 16));
+				__m128i seg3 = _mm_loadu_si128((const __m128i*)(srcPtr + 32));
+				__m128i seg4 = _mm_loadu_si128((const __m128i*)(srcPtr + 48));
+				_mm_stream_si128((__m128i*)destPtr, seg1);
+				_mm_stream_si128((__m128i*)(destPtr + 16), seg2);
+				_mm_stream_si128((__m128i*)(destPtr + 32), seg3);
+				_mm_stream_si128((__m128i*)(destPtr + 48), seg4);
+			}
+			_mm_sfence();
+		} else {
+			// Copy 64 bytes per iteration
+			for(; remaining > 64; remaining -= 64, destPtr += 64, srcPtr += 64) {
+				__m128i seg1 = _mm_loadu_si128((const __m128i*)srcPtr);
+				__m128i seg2 = _mm_loadu_si128((const __m128i*)(srcPtr + 16));
+				__m128i seg3 = _mm_loadu_si128((const __m128i*)(srcPtr + 32));
+				__m128i seg4 = _mm_loadu_si128((const __m128i*)(srcPtr + 48));
+				_mm_store_si128((__m128i*)destPtr, seg1);
+				_mm_store_si128((__m128i*)(destPtr + 16), seg2);
+				_mm_store_si128((__m128i*)(destPtr + 32), seg3);
+				_mm_store_si128((__m128i*)(destPtr + 48), seg4);
+			}
+		}
+
+		// Copy the remaining whole segments, leaving the rest to the tail
+		for(; remaining > 16; remaining -= 16, destPtr += 16, srcPtr += 16)
+			_mm_store_si128((__m128i*)destPtr, _mm_loadu_si128((const __m128i*)srcPtr));
+
+		_mm_storeu_si128((__m128i*)(dest + size - 16), tail);
+		_mm_storeu_si128((__m128i*)dest, head);
+	}
+	static void CopyBackwardSSE2(char_t* dest, const char_t* src, size_t size) {
+		// Save the first and last segments, which are stored unaligned after the loop
+		__m128i head = _mm_loadu_si128((const __m128i*)src);
+		__m128i tail = _mm_loadu_si128((const __m128i*)(src + size - 16));
+
+		// Skip back to the last aligned destination segment
+		size_t skip = ((size_t)(dest + size) & 15);
+		skip = skip ? skip : 16;
+		char_t* destPtr = dest + size - skip;
+		const char_t* srcPtr = src + size - skip;
+		size_t remaining = size - skip;
+
+		// Copy 64 bytes per iteration, from right to left
+		for(; remaining > 64; remaining -= 64) {
+			destPtr -= 64;
+			srcPtr -= 64;
+
+			__m128i seg1 = _mm_loadu_si128((const __m128i*)srcPtr);
+			__m128i seg2 = _mm_loadu_si128((const __m128i*)(srcPtr + 16));
+			__m128i seg3 = _mm_loadu_si128((const __m128i*)(srcPtr + 32));
+			__m128i seg4 = _mm_loadu_si128((const __m128i*)(srcPtr + 48));
+			_mm_store_si128((__m128i*)destPtr, seg1);
+			_mm_store_si128((__m128i*)(destPtr + 16), seg2);
+			_mm_store_si128((__m128i*)(destPtr + 32), seg3);
+			_mm_store_si128((__m128i*)(destPtr + 48), seg4);
+		}
+
+		// Copy the remaining whole segments, leaving the rest to the head
+		for(; remaining > 16; remaining -= 16) {
+			destPtr -= 16;
+			srcPtr -= 16;
+
+			_mm_store_si128((__m128i*)destPtr, _mm_loadu_si128((const __m128i*)srcPtr));
+		}
+
+		_mm_storeu_si128((__m128i*)dest, head);
+		_mm_storeu_si128((__m128i*)(dest + size - 16), tail);
+	}
+	static void SetSSE2(char_t* dest, uint8_t c, size_t size) {
+		__m128i seg = _mm_set1_epi8((char_t)c);
+
+		// Set the first and last segments unaligned
+		_mm_storeu_si128((__m128i*)dest, seg);
+		_mm_storeu_si128((__m128i*)(dest + size - 16), seg);
+
+		// Skip to the first aligned segment
+		size_t skip = 16 - ((size_t)dest & 15);
+		char_t* destPtr = dest + skip;
+		size_t remaining = size - skip;
+
+		if(size >= NON_TEMPORAL_THRESHOLD) {
+			// Stream very large blocks past the cache
+			for(; remaining > 64; remaining -= 64, destPtr += 64) {
+				_mm_stream_si128((__m128i*)destPtr, seg);
+				_mm_stream_si128((__m128i*)(destPtr + 16), seg);
+				_mm_stream_si128((__m128i*)(destPtr + 32), seg);
+				_mm_stream_si128((__m128i*)(destPtr + 48), seg);
+			}
+			_mm_sfence();
+		} else {
+			// Set 64 bytes per iteration
+			for(; remaining > 64; remaining -= 64, destPtr += 64) {
+				_mm_store_si128((__m128i*)destPtr, seg);
+				_mm_store_si128((__m128i*)(destPtr + 16), seg);
+				_mm_store_si128((__m128i*)(destPtr + 32), seg);
+				_mm_store_si128((__m128i*)(destPtr + 48), seg);
+			}
+		}
+
+		// Set the remaining whole segments
+		for(; remaining > 16; remaining -= 16, destPtr += 16)
+			_mm_store_si128((__m128i*)destPtr, seg);
+	}
+
+	WFE_MEMORY_TARGET_AVX2 static void CopyForwardAVX2(char_t* dest, const char_t* src, size_t size) {
+		// Save the first and last segments, which are stored unaligned after the loop
+		__m256i head = _mm256_loadu_si256((const __m256i*)src);
+		__m256i tail = _mm256_loadu_si256((const __m256i*)(src + size - 32));
+
+		// Skip to the first aligned destination segment
+		size_t skip = 32 - ((size_t)dest & 31);
+		char_t* destPtr = dest + skip;
+		const char_t* srcPtr = src + skip;
+		size_t remaining = size - skip;
+
+		if(size >= NON_TEMPORAL_THRESHOLD) {
+			// Stream very large blocks past the cache, since they would only evict useful data from it
+			for(; remaining > 128; remaining -= 128, destPtr += 128, srcPtr += 128) {
+				__m256i seg1 = _mm256_loadu_si256((const __m256i*)srcPtr);
+				__m256i seg2 = _mm256_loadu_si256((const __m256i*)(srcPtr + 32));
+				__m256i seg3 = _mm256_loadu_si256((const __m256i*)(srcPtr + 64));
+				__m256i seg4 = _mm256_loadu_si256((const __m256i*)(srcPtr + 96));
+				_mm256_stream_si256((__m256i*)destPtr, seg1);
+				_mm256_stream_si256((__m256i*)(destPtr + 32), seg2);
+				_mm256_stream_si256((__m256i*)(destPtr + 64), seg3);
+				_mm256_stream_si256((__m256i*)(destPtr + 96), seg4);
+			}
+			_mm_sfence();
+		} else {
+			// Copy 128 bytes per iteration
+			for(; remaining > 128; remaining -= 128, destPtr += 128, srcPtr += 128) {
+				__m256i seg1 = _mm256_loadu_si256((const __m256i*)srcPtr);
+				__m256i seg2 = _mm256_loadu_si256((const __m256i*)(srcPtr + 32));
+				__m256i seg3 = _mm256_loadu_si256((const __m256i*)(srcPtr + 64));
+				__m256i seg4 = _mm256_loadu_si256((const __m256i*)(srcPtr + 96));
+				_mm256_store_si256((__m256i*)destPtr, seg1);
+				_mm256_store_si256((__m256i*)(destPtr + 32), seg2);
+				_mm256_store_si256((__m256i*)(destPtr + 64), seg3);
+				_mm256_store_si256((__m256i*)(destPtr + 96), seg4);
+			}
+		}
+
+		// Copy the remaining whole segments, leaving the rest to the tail
+		for(; remaining > 32; remaining -= 32, destPtr += 32, srcPtr += 32)
+			_mm256_store_si256((__m256i*)destPtr, _mm256_loadu_si256((const __m256i*)srcPtr));
+
+		_mm256_storeu_si256((__m256i*)(dest + size - 32), tail);
+		_mm256_storeu_si256((__m256i*)dest, head);
+	}
+	WFE_MEMORY_TARGET_AVX2 static void CopyBackwardAVX2(char_t* dest, const char_t* src, size_t size) {
+		// Save the first and last segments, which are stored unaligned after the loop
+		__m256i head = _mm256_loadu_si256((const __m256i*)src);
+		__m256i tail = _mm256_loadu_si256((const __m256i*)(src + size - 32));
+
+		// Skip back to the last aligned destination segment
+		size_t skip = ((size_t)(dest + size) & 31);
+		skip = skip ? skip : 32;
+		char_t* destPtr = dest + size - skip;
+		const char_t* srcPtr = src + size - skip;
+		size_t remaining = size - skip;
+
+		// Copy 128 bytes per iteration, from right to left
+		for(; remaining > 128; remaining -= 128) {
+			destPtr -= 128;
+			srcPtr -= 128;
+
+			__m256i seg1 = _mm256_loadu_si256((const __m256i*)srcPtr);
+			__m256i seg2 = _mm256_loadu_si256((const __m256i*)(srcPtr + 32));
+			__m256i seg3 = _mm256_loadu_si256((const __m256i*)(srcPtr + 64));
+			__m256i seg4 = _mm256_loadu_si256((const __m256i*)(srcPtr + 96));
+			_mm256_store_si256((__m256i*)destPtr, seg1);
+			_mm256_store_si256((__m256i*)(destPtr + 32), seg2);
+			_mm256_store_si256((__m256i*)(destPtr + 64), seg3);
+			_mm256_store_si256((__m256i*)(destPtr + 96), seg4);
+		}
+
+		// Copy the remaining whole segments, leaving the rest to the head
+		for(; remaining > 32; remaining -= 32) {
+			destPtr -= 32;
+			srcPtr -= 32;
+
+			_mm256_store_si256((__m256i*)destPtr, _mm256_loadu_si256((const __m256i*)srcPtr));
+		}
+
+		_mm256_storeu_si256((__m256i*)dest, head);
+		_mm256_storeu_si256((__m256i*)(dest + size - 32), tail);
+	}
+	WFE_MEMORY_TARGET_AVX2 static void SetAVX2(char_t* dest, uint8_t c, size_t size) {
+		__m256i seg = _mm256_set1_epi8((char_t)c);
+
+		// Set the first and last segments unaligned
+		_mm256_storeu_si256((__m256i*)dest, seg);
+		_mm256_storeu_si256((__m256i*)(dest + size - 32), seg);
+
+		// Skip to the first aligned segment
+		size_t skip = 32 - ((size_t)dest & 31);
+		char_t* destPtr = dest + skip;
+		size_t remaining = size - skip;
+
+		if(size >= NON_TEMPORAL_THRESHOLD) {
+			// Stream very large blocks past the cache
+			for(; remaining > 128; remaining -= 128, destPtr += 128) {
+				_mm256_stream_si256((__m256i*)destPtr, seg);
+				_mm256_stream_si256((__m256i*)(destPtr + 32), seg);
+				_mm256_stream_si256((__m256i*)(destPtr + 64), seg);
+				_mm256_stream_si256((__m256i*)(destPtr + 96), seg);
+			}
+			_mm_sfence();
+		} else {
+			// Set 128 bytes per iteration
+			for(; remaining > 128; remaining -= 128, destPtr += 128) {
+				_mm256_store_si256((__m256i*)destPtr, seg);
+				_mm256_store_si256((__m256i*)(destPtr + 32), seg);
+				_mm256_store_si256((__m256i*)(destPtr + 64), seg);
+				_mm256_store_si256((__m256i*)(destPtr + 96), seg);
+			}
+		}
+
+		// Set the remaining whole segments
+		for(; remaining > 32; remaining -= 32, destPtr += 32)
+			_mm256_store_si256((__m256i*)destPtr, seg);
+	}
+
+	static WFE_INLINE size_t CountTrailingZeros(uint64_t x) {
+#if defined(_MSC_VER)
+		unsigned long index;
+		_BitScanForward64(&index, x);
+		return index;
+#else
+		return (size_t)__builtin_ctzll(x);
+#endif
+	}
+	static size_t SpanTable(const char_t* str, const char_t* set, bool8_t accept) {
+		// Mark every character in the set in a lookup table; the null termination character always stops the span
+		uint8_t table[256];
+		SetSmall((char_t*)table, 0, 64);
+		SetSmall((char_t*)table + 64, 0, 64);
+		SetSmall((char_t*)table + 128, 0, 64);
+		SetSmall((char_t*)table + 192, 0, 64);
+		for(; *set; ++set)
+			table[(uint8_t)*set] = 1;
+		table[0] = !accept;
+
+		// Check four characters per iteration until one whose appearence differs from the wanted one is found
+		size_t size = 0;
+		while(true) {
+			if(table[(uint8_t)str[size]] != (uint8_t)accept)
+				return size;
+			if(table[(uint8_t)str[size + 1]] != (uint8_t)accept)
+				return size + 1;
+			if(table[(uint8_t)str[size + 2]] != (uint8_t)accept)
+				return size + 2;
+			if(table[(uint8_t)str[size + 3]] != (uint8_t)accept)
+				return size + 3;
+
+			size += 4;
+		}
+	}
+	static const char_t* FindStringKMP(const char_t* str, const char_t* wanted, size_t wantedLength) {
+		// Generate the KMP table
+		ptrdiff_t* table = (ptrdiff_t*)AllocMemory((wantedLength + 1) * sizeof(ptrdiff_t));
+		if(!table)
+			throw BadAllocException("Failed to allocate KMP table!");
+
+		table[0] = -1;
+		for(size_t i = 1; i != wantedLength + 1; ++i)
+			table[i] = 0;
+
+		size_t pos = 1;
+		ptrdiff_t candidate = 0;
+		while(pos < wantedLength) {
+			if(wanted[pos] == wanted[candidate]) {
+				table[pos] = table[candidate];
+			} else {
+				table[pos] = candidate;
+				while(candidate >= 0 && wanted[pos] != wanted[candidate])
+					candidate = table[candidate];
+			}
+
+			++pos;
+			++candidate;
+		}
+		table[pos] = candidate;
+
+		// Look for the wanted string one character at a time
+		pos = 0;
+		for(size_t i = 0; str[i];) {
+			// Check if a matching character was found
+			if(wanted[pos] == str[i]) {
+				// Move on to the next character
+				++i;
+				++pos;
+
+				// Exit the function if a match for the whole string was found
+				if(pos == wantedLength) {
+					FreeMemory(table);
+					return str + i - wantedLength;
+				}
+			} else {
+				// Start over at the highest match possible
+				ptrdiff_t position = table[pos];
+				if(position < 0) {
+					++i;
+					pos = 0;
+				} else {
+					pos = (size_t)position;
+				}
+			}
+		}
+
+		FreeMemory(table);
+		return nullptr;
+	}
+	static const char_t* FindStringTail(const char_t* str, size_t pos, size_t strLength, const char_t* wanted, size_t wantedLength) {
+		// Check the positions left after the last whole block one by one
+		for(; pos + wantedLength <= strLength; ++pos)
+			if(str[pos] == wanted[0] && !memcmp(str + pos, wanted, wantedLength))
+				return str + pos;
+
+		return nullptr;
+	}
+
+	// Every scanning kernel reads whole aligned 64 byte lines, which never cross a page boundary, so reading past the end of the block or string is safe
+	WFE_MEMORY_NO_SANITIZE static WFE_INLINE uint64_t GetEqualMaskSSE2(const char_t* line, __m128i wanted) {
+		// Compare every byte in the line, exiting early if none match
+		__m128i cmp1 = _mm_cmpeq_epi8(_mm_load_si128((const __m128i*)line), wanted);
+		__m128i cmp2 = _mm_cmpeq_epi8(_mm_load_si128((const __m128i*)(line + 16)), wanted);
+		__m128i cmp3 = _mm_cmpeq_epi8(_mm_load_si128((const __m128i*)(line + 32)), wanted);
+		__m128i cmp4 = _mm_cmpeq_epi8(_mm_load_si128((const __m128i*)(line + 48)), wanted);
+		if(!_mm_movemask_epi8(_mm_or_si128(_mm_or_si128(cmp1, cmp2), _mm_or_si128(cmp3, cmp4))))
+			return 0;
+
+		return (uint64_t)(uint32_t)_mm_movemask_epi8(cmp1) | ((uint64_t)(uint32_t)_mm_movemask_epi8(cmp2) << 16) | ((uint64_t)(uint32_t)_mm_movemask_epi8(cmp3) << 32) | ((uint64_t)(uint32_t)_mm_movemask_epi8(cmp4) << 48);
+	}
+	WFE_MEMORY_NO_SANITIZE static WFE_INLINE __m128i CompareEqualOrNullSSE2(const char_t* block, __m128i wanted) {
+		// A byte is zero in the minimum only if it is either null or equal to the wanted character
+		__m128i value = _mm_load_si128((const __m128i*)block);
+		return _mm_cmpeq_epi8(_mm_min_epu8(_mm_xor_si128(value, wanted), value), _mm_setzero_si128());
+	}
+	WFE_MEMORY_NO_SANITIZE static WFE_INLINE uint64_t GetEqualOrNullMaskSSE2(const char_t* line, __m128i wanted) {
+		// Compare every byte in the line, exiting early if none match
+		__m128i cmp1 = CompareEqualOrNullSSE2(line, wanted);
+		__m128i cmp2 = CompareEqualOrNullSSE2(line + 16, wanted);
+		__m128i cmp3 = CompareEqualOrNullSSE2(line + 32, wanted);
+		__m128i cmp4 = CompareEqualOrNullSSE2(line + 48, wanted);
+		if(!_mm_movemask_epi8(_mm_or_si128(_mm_or_si128(cmp1, cmp2), _mm_or_si128(cmp3, cmp4))))
+			return 0;
+
+		return (uint64_t)(uint32_t)_mm_movemask_epi8(cmp1) | ((uint64_t)(uint32_t)_mm_movemask_epi8(cmp2) << 16) | ((uint64_t)(uint32_t)_mm_movemask_epi8(cmp3) << 32) | ((uint64_t)(uint32_t)_mm_movemask_epi8(cmp4) << 48);
+	}
+	WFE_MEMORY_NO_SANITIZE static WFE_INLINE uint64_t GetStringCandidateMaskSSE2(const char_t* block, size_t lastOffset, __m128i first, __m128i last) {
+		// Find every one of the 64 positions where both the first and the last characters of the wanted string match
+		uint64_t mask = 0;
+		for(size_t i = 0; i != 64; i += 16) {
+			__m128i firstCmp = _mm_cmpeq_epi8(_mm_loadu_si128((const __m128i*)(block + i)), first);
+			__m128i lastCmp = _mm_cmpeq_epi8(_mm_loadu_si128((const __m128i*)(block + lastOffset + i)), last);
+			mask |= (uint64_t)(uint32_t)_mm_movemask_epi8(_mm_and_si128(firstCmp, lastCmp)) << i;
+		}
+
+		return mask;
+	}
+	WFE_MEMORY_NO_SANITIZE static const char_t* FindByteSSE2(const char_t* ptr, uint8_t c, size_t size) {
+		// Exit the function if the block is empty
+		if(!size)
+			return nullptr;
+
+		__m128i wanted = _mm_set1_epi8((char_t)c);
+
+		// Check the line holding the first byte, ignoring every byte before it
+		size_t offset = (size_t)ptr & 63;
+		const char_t* line = ptr - offset;
+		uint64_t mask = GetEqualMaskSSE2(line, wanted) >> offset;
+		size_t index = 0;
+
+		// Check every following line until a match is found or the block ends
+		for(size_t lineStart = 64 - offset; !mask && lineStart < size; lineStart += 64) {
+			line += 64;
+			mask = GetEqualMaskSSE2(line, wanted);
+			index = lineStart;
+		}
+
+		if(!mask)
+			return nullptr;
+
+		index += CountTrailingZeros(mask);
+		return index < size ? ptr + index : nullptr;
+	}
+	WFE_MEMORY_NO_SANITIZE static const char_t* FindByteOrNullSSE2(const char_t* str, uint8_t c) {
+		__m128i wanted = _mm_set1_epi8((char_t)c);
+
+		// Check the line holding the first character, ignoring every character before it
+		size_t offset = (size_t)str & 63;
+		const char_t* line = str - offset;
+		uint64_t mask = GetEqualOrNullMaskSSE2(line, wanted) >> offset;
+		if(mask)
+			return str + CountTrailingZeros(mask);
+
+		// Check every following line until a match is found
+		do {
+			line += 64;
+			mask = GetEqualOrNullMaskSSE2(line, wanted);
+		} while(!mask);
+
+		return line + CountTrailingZeros(mask);
+	}
+	WFE_MEMORY_NO_SANITIZE static size_t ComplementSpanSSE2(const char_t* str, const char_t* reject) {
+		// Look for single characters with the vectorized search
+		if(reject[0] && !reject[1])
+			return FindByteOrNullSSE2(str, (uint8_t)reject[0]) - str;
+
+		return SpanTable(str, reject, false);
+	}
+	WFE_MEMORY_NO_SANITIZE static size_t SpanSSE2(const char_t* str, const char_t* accept) {
+		return SpanTable(str, accept, true);
+	}
+	WFE_MEMORY_NO_SANITIZE static const char_t* FindStringSSE2(const char_t* str, const char_t* wanted) {
+		// Handle empty and single character strings separately
+		if(!wanted[0])
+			return str;
+		if(!wanted[1]) {
+			const char_t* result = FindByteOrNullSSE2(str, (uint8_t)wanted[0]);
+			return *result ? result : nullptr;
+		}
+
+		size_t wantedLength = FindByteSSE2(wanted, 0, SIZE_MAX) - wanted;
+		__m128i first = _mm_set1_epi8(wanted[0]);
+		__m128i last = _mm_set1_epi8(wanted[wantedLength - 1]);
+
+		size_t pos = 0;
+		size_t knownLength = 0;
+		size_t scanSize = 64;
+		size_t verifiedSize = 0;
+		bool8_t endFound = false;
+
+		while(!endFound) {
+			// Look for the null termination character in the next part of the string, so that blocks are only loaded from inside the string
+			const char_t* end = FindByteSSE2(str + knownLength, 0, scanSize);
+			if(end) {
+				knownLength = end - str;
+				endFound = true;
+			} else {
+				knownLength += scanSize;
+				scanSize = scanSize < MAX_STRING_SCAN_SIZE ? scanSize << 1 : scanSize;
+			}
+
+			// Check 64 positions per iteration, as long as every loaded character is known to be inside the string
+			for(; pos + wantedLength + 63 <= knownLength; pos += 64) {
+				uint64_t mask = GetStringCandidateMaskSSE2(str + pos, wantedLength - 1, first, last);
+				for(; mask; mask &= mask - 1) {
+					// Compare the middle of the wanted string at the candidate position
+					size_t candidate = pos + CountTrailingZeros(mask);
+					if(!memcmp(str + candidate + 1, wanted + 1, wantedLength - 2))
+						return str + candidate;
+
+					verifiedSize += wantedLength;
+				}
+
+				// Fall back to KMP if too many candidates fail, which keeps the search linear for adversarial strings
+				if(verifiedSize > (pos << 2) + MAX_STRING_SCAN_SIZE)
+					return FindStringKMP(str + pos + 64, wanted, wantedLength);
+			}
+		}
+
+		return FindStringTail(str, pos, knownLength, wanted, wantedLength);
+	}
+
+	WFE_MEMORY_TARGET_AVX2 WFE_MEMORY_NO_SANITIZE static WFE_INLINE uint64_t GetEqualMaskAVX2(const char_t* line, __m256i wanted) {
+		// Compare every byte in the line, exiting early if none match
+		__m256i cmp1 = _mm256_cmpeq_epi8(_mm256_load_si256((const __m256i*)line), wanted);
+		__m256i cmp2 = _mm256_cmpeq_epi8(_mm256_load_si256((const __m256i*)(line + 32)), wanted);
+		if(!_mm256_movemask_epi8(_mm256_or_si256(cmp1, cmp2)))
+			return 0;
+
+		return (uint64_t)(uint32_t)_mm256_movemask_epi8(cmp1) | ((uint64_t)(uint32_t)_mm256_movemask_epi8(cmp2) << 32);
+	}
+	WFE_MEMORY_TARGET_AVX2 WFE_MEMORY_NO_SANITIZE static WFE_INLINE __m256i CompareEqualOrNullAVX2(const char_t* block, __m256i wanted) {
+		// A byte is zero in the minimum only if it is either null or equal to the wanted character
+		__m256i value = _mm256_load_si256((const __m256i*)block);
+		return _mm256_cmpeq_epi8(_mm256_min_epu8(_mm256_xor_si256(value, wanted), value), _mm256_setzero_si256());
+	}
+	WFE_MEMORY_TARGET_AVX2 WFE_MEMORY_NO_SANITIZE static WFE_INLINE uint64_t GetEqualOrNullMaskAVX2(const char_t* line, __m256i wanted) {
+		// Compare every byte in the line, exiting early if none match
+		__m256i cmp1 = CompareEqualOrNullAVX2(line, wanted);
+		__m256i cmp2 = CompareEqualOrNullAVX2(line + 32, wanted);
+		if(!_mm256_movemask_epi8(_mm256_or_si256(cmp1, cmp2)))
+			return 0;
+
+		return (uint64_t)(uint32_t)_mm256_movemask_epi8(cmp1) | ((uint64_t)(uint32_t)_mm256_movemask_epi8(cmp2) << 32);
+	}
+	WFE_MEMORY_TARGET_AVX2 WFE_MEMORY_NO_SANITIZE static WFE_INLINE uint64_t GetStringCandidateMaskAVX2(const char_t* block, size_t lastOffset, __m256i first, __m256i last) {
+		// Find every one of the 64 positions where both the first and the last characters of the wanted string match
+		__m256i firstCmp1 = _mm256_cmpeq_epi8(_mm256_loadu_si256((const __m256i*)block), first);
+		__m256i firstCmp2 = _mm256_cmpeq_epi8(_mm256_loadu_si256((const __m256i*)(block + 32)), first);
+		__m256i lastCmp1 = _mm256_cmpeq_epi8(_mm256_loadu_si256((const __m256i*)(block + lastOffset)), last);
+		__m256i lastCmp2 = _mm256_cmpeq_epi8(_mm256_loadu_si256((const __m256i*)(block + lastOffset + 32)), last);
+
+		return (uint64_t)(uint32_t)_mm256_movemask_epi8(_mm256_and_si256(firstCmp1, lastCmp1)) | ((uint64_t)(uint32_t)_mm256_movemask_epi8(_mm256_and_si256(firstCmp2, lastCmp2)) << 32);
+	}
+	WFE_MEMORY_TARGET_AVX2 WFE_MEMORY_NO_SANITIZE static const char_t* FindByteAVX2(const char_t* ptr, uint8_t c, size_t size) {
+		// Exit the function if the block is empty
+		if(!size)
+			return nullptr;
+
+		__m256i wanted = _mm256_set1_epi8((char_t)c);
+
+		// Check the line holding the first byte, ignoring every byte before it
+		size_t offset = (size_t)ptr & 63;
+		const char_t* line = ptr - offset;
+		uint64_t mask = GetEqualMaskAVX2(line, wanted) >> offset;
+		size_t index = 0;
+
+		// Check every following line until a match is found or the block ends
+		for(size_t lineStart = 64 - offset; !mask && lineStart < size; lineStart += 64) {
+			line += 64;
+			mask = GetEqualMaskAVX2(line, wanted);
+			index = lineStart;
+		}
+
+		if(!mask)
+			return nullptr;
+
+		index += CountTrailingZeros(mask);
+		return index < size ? ptr + index : nullptr;
+	}
+	WFE_MEMORY_TARGET_AVX2 WFE_MEMORY_NO_SANITIZE static const char_t* FindByteOrNullAVX2(const char_t* str, uint8_t c) {
+		__m256i wanted = _mm256_set1_epi8((char_t)c);
+
+		// Check the line holding the first character, ignoring every character before it
+		size_t offset = (size_t)str & 63;
+		const char_t* line = str - offset;
+		uint64_t mask = GetEqualOrNullMaskAVX2(line, wanted) >> offset;
+		if(mask)
+			return str + CountTrailingZeros(mask);
+
+		// Check every following line until a match is found
+		do {
+			line += 64;
+			mask = GetEqualOrNullMaskAVX2(line, wanted);
+		} while(!mask);
+
+		return line + CountTrailingZeros(mask);
+	}
+	WFE_MEMORY_TARGET_AVX2 WFE_MEMORY_NO_SANITIZE static WFE_INLINE bool8_t LoadSetSSE42(const char_t* set, __m128i& setChars) {
+		// Load the set straight from memory if the load doesn't cross a page boundary, otherwise copy it up to its null termination character
+		if(((size_t)set & (MIN_PAGE_SIZE - 1)) <= MIN_PAGE_SIZE - 16) {
+			setChars = _mm_loadu_si128((const __m128i*)set);
+		} else {
+			alignas(16) char_t setBuffer[16];
+			for(size_t i = 0; i != 16; ++i) {
+				setBuffer[i] = set[i];
+				if(!set[i])
+					break;
+			}
+			setChars = _mm_load_si128((const __m128i*)setBuffer);
+		}
+
+		// Only sets of up to 16 characters, with their null termination character in the register, can be compared at once
+		return _mm_cmpistrs(setChars, setChars, _SIDD_UBYTE_OPS);
+	}
+	template<int32_t Mode>
+	WFE_MEMORY_TARGET_AVX2 WFE_MEMORY_NO_SANITIZE static WFE_INLINE size_t SpanSSE42(const char_t* str, __m128i setChars) {
+		size_t size = 0;
+
+		if(((size_t)str & (MIN_PAGE_SIZE - 1)) <= MIN_PAGE_SIZE - 16) {
+			// Compare the first 16 characters unaligned, which is enough for most short spans
+			__m128i block = _mm_loadu_si128((const __m128i*)str);
+			int32_t index = _mm_cmpistri(setChars, block, Mode);
+			if(index != 16)
+				return index;
+			if(_mm_cmpistrz(setChars, block, Mode))
+				return CountTrailingZeros((uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(block, _mm_setzero_si128())));
+
+			size = 16 - ((size_t)str & 15);
+		} else {
+			// Check the characters before the first aligned block one by one, since the aligned block may hold an earlier null termination character
+			for(; (size_t)(str + size) & 15; ++size)
+				if(!str[size] || !_mm_cmpistri(setChars, _mm_cvtsi32_si128((uint8_t)str[size]), Mode))
+					return size;
+		}
+
+		// Compare every following aligned block against the whole set at once
+		while(true) {
+			__m128i block = _mm_load_si128((const __m128i*)(str + size));
+			int32_t index = _mm_cmpistri(setChars, block, Mode);
+			if(index != 16)
+				return size + index;
+			if(_mm_cmpistrz(setChars, block, Mode))
+				return size + CountTrailingZeros((uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(block, _mm_setzero_si128())));
+
+			size += 16;
+		}
+	}
+	WFE_MEMORY_TARGET_AVX2 WFE_MEMORY_NO_SANITIZE static size_t ComplementSpanAVX2(const char_t* str, const char_t* reject) {
+		// Look for single characters with the vectorized search
+		if(reject[0] && !reject[1])
+			return FindByteOrNullAVX2(str, (uint8_t)reject[0]) - str;
+
+		// Compare against sets of up to 16 characters with SSE4.2, which every AVX2 CPU supports
+		__m128i rejectChars;
+		if(LoadSetSSE42(reject, rejectChars))
+			return SpanSSE42<_SIDD_UBYTE_OPS | _SIDD_CMP_EQUAL_ANY | _SIDD_LEAST_SIGNIFICANT>(str, rejectChars);
+
+		return SpanTable(str, reject, false);
+	}
+	WFE_MEMORY_TARGET_AVX2 WFE_MEMORY_NO_SANITIZE static size_t SpanAVX2(const char_t* str, const char_t* accept) {
+		// Compare against sets of up to 16 characters with SSE4.2; the negative polarity also stops the span at the null termination character
+		__m128i acceptChars;
+		if(LoadSetSSE42(accept, acceptChars))
+			return SpanSSE42<_SIDD_UBYTE_OPS | _SIDD_CMP_EQUAL_ANY | _SIDD_NEGATIVE_POLARITY | _SIDD_LEAST_SIGNIFICANT>(str, acceptChars);
+
+		return SpanTable(str, accept, true);
+	}
+	WFE_MEMORY_TARGET_AVX2 WFE_MEMORY_NO_SANITIZE static const char_t* FindStringAVX2(const char_t* str, const char_t* wanted) {
+		// Handle empty and single character strings separately
+		if(!wanted[0])
+			return str;
+		if(!wanted[1]) {
+			const char_t* result = FindByteOrNullAVX2(str, (uint8_t)wanted[0]);
+			return *result ? result : nullptr;
+		}
+
+		size_t wantedLength = FindByteAVX2(wanted, 0, SIZE_MAX) - wanted;
+		__m256i first = _mm256_set1_epi8(wanted[0]);
+		__m256i last = _mm256_set1_epi8(wanted[wantedLength - 1]);
+
+		size_t pos = 0;
+		size_t knownLength = 0;
+		size_t scanSize = 64;
+		size_t verifiedSize = 0;
+		bool8_t endFound = false;
+
+		while(!endFound) {
+			// Look for the null termination character in the next part of the string, so that blocks are only loaded from inside the string
+			const char_t* end = FindByteAVX2(str + knownLength, 0, scanSize);
+			if(end) {
+				knownLength = end - str;
+				endFound = true;
+			} else {
+				knownLength += scanSize;
+				scanSize = scanSize < MAX_STRING_SCAN_SIZE ? scanSize << 1 : scanSize;
+			}
+
+			// Check 64 positions per iteration, as long as every loaded character is known to be inside the string
+			for(; pos + wantedLength + 63 <= knownLength; pos += 64) {
+				uint64_t mask = GetStringCandidateMaskAVX2(str + pos, wantedLength - 1, first, last);
+				for(; mask; mask &= mask - 1) {
+					// Compare the middle of the wanted string at the candidate position
+					size_t candidate = pos + CountTrailingZeros(mask);
+					if(!memcmp(str + candidate + 1, wanted + 1, wantedLength - 2))
+						return str + candidate;
+
+					verifiedSize += wantedLength;
+				}
+
+				// Fall back to KMP if too many candidates fail, which keeps the search linear for adversarial strings
+				if(verifiedSize > (pos << 2) + MAX_STRING_SCAN_SIZE)
+					return FindStringKMP(str + pos + 64, wanted, wantedLength);
+			}
+		}
+
+		return FindStringTail(str, pos, knownLength, wanted, wantedLength);
+	}
+
+	// Internal variables
+	static const MemoryKernels SSE2_MEMORY_KERNELS { CopyForwardSSE2, CopyBackwardSSE2, SetSSE2, FindByteSSE2, FindByteOrNullSSE2, ComplementSpanSSE2, SpanSSE2, FindStringSSE2 };
+	static const MemoryKernels AVX2_MEMORY_KERNELS { CopyForwardAVX2, CopyBackwardAVX2, SetAVX2, FindByteAVX2, FindByteOrNullAVX2, ComplementSpanAVX2, SpanAVX2, FindStringAVX2 };
+
+	static std::atomic<const MemoryKernels*> memoryKernels = nullptr;
+
+	static WFE_INLINE const MemoryKernels* GetMemoryKernels() {
+		// Select the kernels on the first call; every thread selects the same ones, so racing calls are harmless
+		const MemoryKernels* kernels = memoryKernels.load(std::memory_order_relaxed);
+		if(!kernels) {
+			kernels = PlatformIsAVX2Supported() ? &AVX2_MEMORY_KERNELS : &SSE2_MEMORY_KERNELS;
+			memoryKernels.store(kernels, std::memory_order_relaxed);
+		}
+
+		return kernels;
+	}
+#endif
+
+	// Public functions
+	void SetSSE2MemoryKernelsForced(bool8_t forced) {
+#if defined(WFE_MEMORY_SIMD)
+		// Select the SSE2 kernels, or clear the selected kernels for the next call to select the best supported ones again
+		memoryKernels.store(forced ? &SSE2_MEMORY_KERNELS : nullptr, std::memory_order_relaxed);
+#else
+		(void)forced;
+#endif
+	}
+
 	void* memcpy(void* dest, const void* src, size_t size) {
 		// Exit if the target and source memory block are the same; nothing needs to be copied
 		if(dest == src)
 			return dest;
 
+#if defined(WFE_MEMORY_SIMD)
+		// Copy small blocks inline, and larger blocks with the best kernel supported by the CPU
+		if(size <= SMALL_COPY_SIZE)
+			CopySmall((char_t*)dest, (const char_t*)src, size);
+		else
+			GetMemoryKernels()->copyForward((char_t*)dest, (const char_t*)src, size);
+
+		return dest;
+#else
 		// Convert every given pointer to char pointers
 		char_t* destChar = (char_t*)dest;
 		const char_t* srcChar = (const char_t*)src;
@@ -59,8 +889,28 @@ namespace wfe {
 		}
 
 		return dest;
+#endif
 	}
 	void* memmove(void* dest, const void* src, size_t size) {
+#if defined(WFE_MEMORY_SIMD)
+		// Exit if the target and source memory block are the same; nothing needs to be copied
+		if(dest == src)
+			return dest;
+
+		// Small copies load every byte before storing any, so they handle overlapping blocks as well
+		if(size <= SMALL_COPY_SIZE) {
+			CopySmall((char_t*)dest, (const char_t*)src, size);
+			return dest;
+		}
+
+		// Copy from right to left only if the target block starts inside the source block
+		if(dest < src || (const char_t*)dest >= (const char_t*)src + size)
+			GetMemoryKernels()->copyForward((char_t*)dest, (const char_t*)src, size);
+		else
+			GetMemoryKernels()->copyBackward((char_t*)dest, (const char_t*)src, size);
+
+		return dest;
+#else
 		// Exit if the target and source memory block are the same; nothing needs to be copied
 		if(dest == src) {
 			return dest;
@@ -123,6 +973,7 @@ namespace wfe {
 
 			return dest;
 		}
+#endif
 	}
 	void* memccpy(void* dest, const void* src, int32_t c, size_t size) {
 		// Exit if the target and source memory block are the same; nothing needs to be copied
@@ -271,6 +1122,15 @@ namespace wfe {
 		return nullptr;
 	}
 	void* memset(void* ptr, int32_t c, size_t size) {
+#if defined(WFE_MEMORY_SIMD)
+		// Set small blocks inline, and larger blocks with the best kernel supported by the CPU
+		if(size <= SMALL_COPY_SIZE)
+			SetSmall((char_t*)ptr, (uint8_t)c, size);
+		else
+			GetMemoryKernels()->set((char_t*)ptr, (uint8_t)c, size);
+
+		return ptr;
+#else
 		// Convert the given pointer to a char pointer
 		char_t* ptrChar = (char_t*)ptr;
 
@@ -322,6 +1182,7 @@ namespace wfe {
 		}
 
 		return ptr;
+#endif
 	}
 
 	int32_t memcmp(const void* ptr1, const void* ptr2, size_t size) {
@@ -442,6 +1303,9 @@ namespace wfe {
 		return 0;
 	}
 	void* memchr(void* ptr, int32_t c, size_t size) {
+#if defined(WFE_MEMORY_SIMD)
+		return (void*)GetMemoryKernels()->findByte((const char_t*)ptr, (uint8_t)c, size);
+#else
 		// Convert the given pointer to a char pointer
 		char_t* ptrChar = (char_t*)ptr;
 
@@ -519,8 +1383,12 @@ namespace wfe {
 		}
 
 		return nullptr;
+#endif
 	}
 	const void* memchr(const void* ptr, int32_t c, size_t size) {
+#if defined(WFE_MEMORY_SIMD)
+		return GetMemoryKernels()->findByte((const char_t*)ptr, (uint8_t)c, size);
+#else
 		// Convert the given pointer to a char pointer
 		const char_t* ptrChar = (const char_t*)ptr;
 
@@ -604,8 +1472,12 @@ namespace wfe {
 		}
 
 		return nullptr;
+#endif
 	}
 	void* rawmemchr(void* ptr, int32_t c) {
+#if defined(WFE_MEMORY_SIMD)
+		return (void*)GetMemoryKernels()->findByte((const char_t*)ptr, (uint8_t)c, SIZE_MAX);
+#else
 		// Convert the given pointer to a char pointer
 		char_t* ptrChar = (char_t*)ptr;
 
@@ -632,8 +1504,12 @@ namespace wfe {
 
 		// To avoid compiler error
 		return nullptr;
+#endif
 	}
 	const void* rawmemchr(const void* ptr, int32_t c) {
+#if defined(WFE_MEMORY_SIMD)
+		return GetMemoryKernels()->findByte((const char_t*)ptr, (uint8_t)c, SIZE_MAX);
+#else
 		// Convert the given pointer to a char pointer
 		const char_t* ptrChar = (const char_t*)ptr;
 
@@ -660,6 +1536,7 @@ namespace wfe {
 
 		// To avoid compiler error
 		return nullptr;
+#endif
 	}
 	void* memrchr(void* ptr, int32_t c, size_t size) {
 		// Convert the given pointer to a char pointer
@@ -1153,6 +2030,11 @@ namespace wfe {
 		return 0;
 	}
 	char_t* strchr(char_t* str, int32_t c) {
+#if defined(WFE_MEMORY_SIMD)
+		// Find the first instance of either the wanted character or the null termination character
+		const char_t* result = GetMemoryKernels()->findByteOrNull(str, (uint8_t)c);
+		return *result == (char_t)c ? (char_t*)result : nullptr;
+#else
 		// Look for the wanted character in segments of size_t
 		while(true) {
 			// Save a size_t segment
@@ -1180,8 +2062,14 @@ namespace wfe {
 
 		// To avoid compiler error
 		return nullptr;
+#endif
 	}
 	const char_t* strchr(const char_t* str, int32_t c) {
+#if defined(WFE_MEMORY_SIMD)
+		// Find the first instance of either the wanted character or the null termination character
+		const char_t* result = GetMemoryKernels()->findByteOrNull(str, (uint8_t)c);
+		return *result == (char_t)c ? result : nullptr;
+#else
 		// Look for the wanted character in segments of size_t
 		while(true) {
 			// Save a size_t segment
@@ -1209,6 +2097,7 @@ namespace wfe {
 
 		// To avoid compiler error
 		return nullptr;
+#endif
 	}
 	char_t* strrchr(char_t* str, int32_t c) {
 		// Save the last occurence of the character
@@ -1287,6 +2176,9 @@ namespace wfe {
 		return lastOccurence;
 	}
 	size_t strcspn(const char_t* str, const char_t* reject) {
+#if defined(WFE_MEMORY_SIMD)
+		return GetMemoryKernels()->complementSpan(str, reject);
+#else
 		// Create an apprearence vector for every character in reject
 		uint8_t appears[32];
 		memset(appears, 0, 32 * sizeof(uint8_t));
@@ -1354,8 +2246,12 @@ namespace wfe {
 
 		// To avoid compiler error
 		return 0;        
+#endif
 	}
 	size_t strspn(const char_t* str, const char_t* accept) {
+#if defined(WFE_MEMORY_SIMD)
+		return GetMemoryKernels()->span(str, accept);
+#else
 		// Create an apprearence vector for every character in accept
 		uint8_t appears[32];
 		memset(appears, 0, 32 * sizeof(uint8_t));
@@ -1423,8 +2319,14 @@ namespace wfe {
 
 		// To avoid compiler error
 		return 0;        
+#endif
 	}
 	char_t* strpbrk(char_t* str, const char_t* accept) {
+#if defined(WFE_MEMORY_SIMD)
+		// Skip every character not in accept
+		str += GetMemoryKernels()->complementSpan(str, accept);
+		return *str ? str : nullptr;
+#else
 		// Create an appearence vector for every character in accept
 		uint8_t appears[32];
 		memset(appears, 0, 32 * sizeof(uint8_t));
@@ -1486,8 +2388,14 @@ namespace wfe {
 
 		// To avoid compiler error
 		return nullptr;        
+#endif
 	}
 	const char_t* strpbrk(const char_t* str, const char_t* accept) {
+#if defined(WFE_MEMORY_SIMD)
+		// Skip every character not in accept
+		str += GetMemoryKernels()->complementSpan(str, accept);
+		return *str ? str : nullptr;
+#else
 		// Create an apprearence vector for every character in accept
 		uint8_t appears[32];
 
@@ -1548,8 +2456,12 @@ namespace wfe {
 
 		// To avoid compiler error
 		return nullptr;        
+#endif
 	}
 	char_t* strstr(char_t* str, const char_t* wanted) {
+#if defined(WFE_MEMORY_SIMD)
+		return (char_t*)GetMemoryKernels()->findString(str, wanted);
+#else
 		// Generate the KMP table
 		size_t wantedLength = strlen(wanted);
 
@@ -1623,8 +2535,12 @@ namespace wfe {
 
 		// To avoid compiler error
 		return nullptr;
+#endif
 	}
 	const char_t* strstr(const char_t* str, const char_t* wanted) {
+#if defined(WFE_MEMORY_SIMD)
+		return GetMemoryKernels()->findString(str, wanted);
+#else
 		// Generate the KMP table
 		size_t wantedLength = strlen(wanted);
 
@@ -1698,6 +2614,7 @@ namespace wfe {
 
 		// To avoid compiler error
 		return nullptr;
+#endif
 	}
 
 	char_t* strtok(char_t* str, const char_t* delim) {
@@ -1729,6 +2646,9 @@ namespace wfe {
 	}
 
 	size_t strlen(const char_t* str) {
+#if defined(WFE_MEMORY_SIMD)
+		return GetMemoryKernels()->findByte(str, 0, SIZE_MAX) - str;
+#else
 		size_t size = 0;
 
 		// Look for the null termination character in segments of size_t
@@ -1757,8 +2677,14 @@ namespace wfe {
 
 		// To avoid compiler error
 		return 0;
+#endif
 	}
 	size_t strnlen(const char_t* str, size_t size) {
+#if defined(WFE_MEMORY_SIMD)
+		// Look for the null termination character in the first size characters
+		const char_t* end = GetMemoryKernels()->findByte(str, 0, size);
+		return end ? end - str : size;
+#else
 		size_t stringSize = 0;
 
 		// Look for the null termination character in segments of size_t
@@ -1853,5 +2779,6 @@ namespace wfe {
 
 		// No null termination character was found; return the given max size
 		return stringSize;
+#endif
 	}
 }
\ No newline at end of file
@@ -0,0 +1,142 @@
+#include "Mutex.hpp"
+#include "Allocator.hpp"
+#include "Exception.hpp"
+#include "New.hpp"
+#include "Thread.hpp"
+
+namespace wfe {
+	// Constants
+	static const size_t CACHE_LINE_SIZE = 64;
+	static const uint32_t SHARED_MUTEX_SPIN_COUNT = 16;
+	static const uint32_t SHARED_MUTEX_MAX_BACKOFF = 64;
+
+	// Internal structs
+	// Align every slot to a cache line so that different slots never share one
+	struct alignas(CACHE_LINE_SIZE) SharedMutex::ReaderSlot {
+		atomic_size_t readerCount;
+	};
+
+	// Internal functions
+	SharedMutex::ReaderSlot& SharedMutex::GetReaderSlot() {
+		return readerSlots[GetCurrentThreadIndex() & (readerSlotCount - 1)];
+	}
+	void SharedMutex::UnregisterReader(ReaderSlot& slot) {
+		// Unregister the reader, exiting the function unless it was the last reader in its slot and a writer is waiting
+		if(slot.readerCount.fetch_sub(1, std::memory_order_seq_cst) != 1 || !writerActive.load(std::memory_order_seq_cst))
+			return;
+
+		// Notify the writer that the slot was emptied, waking it only if it is parked
+		writerWakeSequence.fetch_add(1, std::memory_order_seq_cst);
+		if(writerParked.load(std::memory_order_seq_cst))
+			WakeAllOnValue(writerWakeSequence);
+	}
+
+	// Public functions
+	SharedMutex::SharedMutex() : readerSlotCount(1) {
+		// Set the slot count to the lowest power of 2 higher than or equal to the processor count
+		size_t processorCount = GetProcessorCount();
+		while(readerSlotCount < processorCount)
+			readerSlotCount <<= 1;
+
+		// Allocate the reader slots
+		readerSlots = NewArray<ReaderSlot>(readerSlotCount);
+		for(size_t i = 0; i != readerSlotCount; ++i)
+			readerSlots[i].readerCount.store(0, std::memory_order_relaxed);
+	}
+
+	void SharedMutex::Lock() {
+		// Lock the writer mutex, making sure only one writer can hold the mutex
+		writerMutex.Lock();
+
+		// Block new readers and wait for the current readers to unlock the mutex
+		writerActive.store(1, std::memory_order_seq_cst);
+
+		for(size_t i = 0; i != readerSlotCount; ++i) {
+			ReaderSlot& slot = readerSlots[i];
+
+			// Spin for a short while, doubling the wait between checks
+			uint32_t backoff = 1;
+			for(uint32_t j = 0; j != SHARED_MUTEX_SPIN_COUNT && slot.readerCount.load(std::memory_order_seq_cst); ++j) {
+				for(uint32_t k = 0; k != backoff; ++k)
+					PauseCurrentThread();
+				if(backoff < SHARED_MUTEX_MAX_BACKOFF)
+					backoff <<= 1;
+			}
+
+			// Park the thread until the slot's last reader wakes it; the slot is checked again after reading the wake sequence, so that a wake can't be missed
+			while(slot.readerCount.load(std::memory_order_seq_cst)) {
+				writerParked.store(1, std::memory_order_seq_cst);
+
+				uint32_t sequence = writerWakeSequence.load(std::memory_order_seq_cst);
+				if(slot.readerCount.load(std::memory_order_seq_cst))
+					WaitOnValue(writerWakeSequence, sequence);
+			}
+		}
+
+		writerParked.store(0, std::memory_order_relaxed);
+	}
+	bool8_t SharedMutex::TryLock() {
+		// Try to lock the writer mutex
+		if(!writerMutex.TryLock())
+			return false;
+
+		// Block new readers and check if any reader holds the mutex
+		writerActive.store(1, std::memory_order_seq_cst);
+
+		for(size_t i = 0; i != readerSlotCount; ++i) {
+			if(readerSlots[i].readerCount.load(std::memory_order_seq_cst)) {
+				// Unblock the readers and unlock the writer mutex
+				writerActive.store(0, std::memory_order_release);
+				writerMutex.Unlock();
+
+				return false;
+			}
+		}
+
+		return true;
+	}
+	void SharedMutex::Unlock() {
+		// Unblock the readers and unlock the writer mutex
+		writerActive.store(0, std::memory_order_release);
+		writerMutex.Unlock();
+	}
+
+	void SharedMutex::LockShared() {
+		ReaderSlot& slot = GetReaderSlot();
+
+		while(true) {
+			// Register the reader in its slot and check if any writer is active
+			slot.readerCount.fetch_add(1, std::memory_order_seq_cst);
+			if(!writerActive.load(std::memory_order_seq_cst))
+				return;
+
+			// Unregister the reader and wait for the writer to finish by locking and unlocking the writer mutex, which parks the thread if needed
+			UnregisterReader(slot);
+
+			writerMutex.Lock();
+			writerMutex.Unlock();
+		}
+	}
+	bool8_t SharedMutex::TryLockShared() {
+		ReaderSlot& slot = GetReaderSlot();
+
+		// Register the reader in its slot and check if any writer is active
+		slot.readerCount.fetch_add(1, std::memory_order_seq_cst);
+		if(!writerActive.load(std::memory_order_seq_cst))
+			return true;
+
+		// Unregister the reader
+		UnregisterReader(slot);
+
+		return false;
+	}
+	void SharedMutex::UnlockShared() {
+		// Unregister the reader from its slot
+		UnregisterReader(GetReaderSlot());
+	}
+
+	SharedMutex::~SharedMutex() {
+		// Free the reader slots
+		DestroyArray(readerSlots, readerSlotCount);
+	}
+}
@@ -0,0 +1,20 @@
+#include "BuildInfo.hpp"
+
+#ifdef WFE_PLATFORM_LINUX
+
+#include "Platform.hpp"
+
+namespace wfe {
+	// Public functions
+	bool8_t PlatformIsAVX2Supported() {
+#if defined(__x86_64__) || defined(__i386__)
+		// Let the compiler's runtime check the CPU's features, which includes checking that the OS saves the AVX registers
+		__builtin_cpu_init();
+		return __builtin_cpu_supports("avx2");
+#else
+		return false;
+#endif
+	}
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,56 @@
+#include "BuildInfo.hpp"
+
+#ifdef WFE_PLATFORM_LINUX
+
+#include "Platform.hpp"
+#include <dlfcn.h>
+#include <execinfo.h>
+#include <stdio.h>
+
+namespace wfe {
+	// Constants
+	static const size_t MAX_BACKTRACE_FRAME_COUNT = 128;
+
+	// Public functions
+	size_t PlatformCaptureBacktrace(void** frames, size_t maxFrameCount, size_t skipCount) {
+		// Capture the stack using backtrace, including this function's own frame
+		void* allFrames[MAX_BACKTRACE_FRAME_COUNT];
+		size_t totalFrameCount = maxFrameCount + skipCount + 1;
+		if(totalFrameCount > MAX_BACKTRACE_FRAME_COUNT)
+			totalFrameCount = MAX_BACKTRACE_FRAME_COUNT;
+
+		size_t frameCount = (size_t)backtrace(allFrames, (int)totalFrameCount);
+		if(frameCount <= skipCount + 1)
+			return 0;
+
+		// Copy every frame past the skipped ones
+		frameCount -= skipCount + 1;
+		for(size_t i = 0; i != frameCount; ++i)
+			frames[i] = allFrames[i + skipCount + 1];
+
+		return frameCount;
+	}
+	void PlatformGetBacktraceFrameName(void* frame, char_t* dest, size_t maxSize) {
+		// Find the module and symbol containing the address using dladdr
+		Dl_info info;
+		if(!dladdr(frame, &info) || !info.dli_fname) {
+			snprintf(dest, maxSize, "%p", frame);
+			return;
+		}
+
+		// Strip the module's directory
+		const char_t* moduleName = info.dli_fname;
+		for(const char_t* ptr = info.dli_fname; *ptr; ++ptr)
+			if(*ptr == '/')
+				moduleName = ptr + 1;
+
+		size_t moduleOffset = (size_t)((char_t*)frame - (char_t*)info.dli_fbase);
+		if(info.dli_sname) {
+			snprintf(dest, maxSize, "%s+0x%zx(%s+0x%zx)", moduleName, moduleOffset, info.dli_sname, (size_t)((char_t*)frame - (char_t*)info.dli_saddr));
+		} else {
+			snprintf(dest, maxSize, "%s+0x%zx", moduleName, moduleOffset);
+		}
+	}
+}
+
+#endif
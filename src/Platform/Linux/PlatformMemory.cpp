@@ -5,8 +5,14 @@
 #include "Platform.hpp"
 #include <stdlib.h>
 #include <malloc.h>
+#include <sys/mman.h>
+#include <unistd.h>
 
 namespace wfe {
+	// Constants
+	static const size_t HUGE_PAGE_SIZE = 2097152;
+
+	// Public functions
 	void* PlatformAllocateMemory(size_t size) {
 		// Allocate the memory using malloc
 		return ::malloc(size);
@@ -23,6 +29,54 @@ namespace wfe {
 		// Get the memory's size using malloc_usable_size
 		return malloc_usable_size(mem);
 	}
+	size_t PlatformGetPageSize() {
+		// Get the page size using sysconf, only once
+		static const size_t pageSize = (size_t)sysconf(_SC_PAGESIZE);
+		return pageSize;
+	}
+	void* PlatformAllocatePages(size_t size) {
+		// Map the memory straight away if it is too small to hold a huge page
+		if(size < HUGE_PAGE_SIZE) {
+			void* mem = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+			return mem != MAP_FAILED ? mem : nullptr;
+		}
+
+		// Map an extra huge page's worth of memory, so that the range can start at a huge page boundary
+		size_t mappedSize = size + HUGE_PAGE_SIZE;
+		char_t* mem = (char_t*)mmap(nullptr, mappedSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+		if(mem == MAP_FAILED)
+			return nullptr;
+
+		// Unmap the memory before and after the aligned range
+		char_t* alignedMem = (char_t*)(((uintptr_t)mem + HUGE_PAGE_SIZE - 1) & ~(uintptr_t)(HUGE_PAGE_SIZE - 1));
+		size_t headSize = alignedMem - mem;
+		size_t tailSize = mappedSize - headSize - size;
+		if(headSize)
+			munmap(mem, headSize);
+		if(tailSize)
+			munmap(alignedMem + size, tailSize);
+
+		// Ask for the range to be backed by transparent huge pages
+		madvise(alignedMem, size, MADV_HUGEPAGE);
+
+		return alignedMem;
+	}
+	void* PlatformReallocatePages(void* mem, size_t oldSize, size_t newSize) {
+		// Remap the pages using mremap, which moves them without copying if they can't grow in place
+		void* newMem = mremap(mem, oldSize, newSize, MREMAP_MAYMOVE);
+		if(newMem == MAP_FAILED)
+			return nullptr;
+
+		// Ask for the grown range to be backed by transparent huge pages
+		if(newSize >= HUGE_PAGE_SIZE)
+			madvise(newMem, newSize, MADV_HUGEPAGE);
+
+		return newMem;
+	}
+	void PlatformFreePages(void* mem, size_t size) {
+		// Unmap the pages using munmap
+		munmap(mem, size);
+	}
 }
 
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,86 @@
+#include "BuildInfo.hpp"
+
+#ifdef WFE_PLATFORM_LINUX
+
+#include "Semaphore.hpp"
+#include "Thread.hpp"
+#include <errno.h>
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+namespace wfe {
+	// Constants
+	static const uint32_t SEMAPHORE_SPIN_COUNT = 64;
+
+	// Public functions
+	Semaphore::Semaphore(uint32_t start) : counter(start), waiterCount(0) { }
+
+	Semaphore::SemaphoreResult Semaphore::Wait() {
+		while(true) {
+			// Try to decrement the counter, spinning for a short while before blocking
+			for(uint32_t i = 0; i != SEMAPHORE_SPIN_COUNT; ++i) {
+				if(TryWait() == SUCCESS)
+					return SUCCESS;
+
+				PauseCurrentThread();
+			}
+
+			// Register the current thread as a waiter; signalling threads only wake the futex if waiters are registered
+			waiterCount.fetch_add(1, std::memory_order_seq_cst);
+
+			// Block on the futex if the counter is still 0
+			if(!counter.load(std::memory_order_seq_cst)) {
+				int32_t result = (int32_t)syscall(SYS_futex, (uint32_t*)&counter, FUTEX_WAIT_PRIVATE, 0, nullptr, nullptr, 0);
+
+				// EAGAIN means the counter changed before blocking and EINTR means a signal handler interrupted the wait; both are retried
+				if(result && errno != EAGAIN && errno != EINTR) {
+					waiterCount.fetch_sub(1, std::memory_order_relaxed);
+
+					switch(errno) {
+					case EINVAL:
+						return ERROR_INVALID_SEMAPHORE;
+					default:
+						return ERROR_UNKNOWN;
+					}
+				}
+			}
+
+			waiterCount.fetch_sub(1, std::memory_order_relaxed);
+		}
+	}
+	Semaphore::SemaphoreResult Semaphore::TryWait() {
+		// Decrement the counter if it is above 0
+		uint32_t val = counter.load(std::memory_order_relaxed);
+		while(val) {
+			if(counter.compare_exchange_weak(val, val - 1, std::memory_order_acquire, std::memory_order_relaxed))
+				return SUCCESS;
+		}
+
+		return ERROR_ALREADY_LOCKED;
+	}
+	Semaphore::SemaphoreResult Semaphore::Signal(uint32_t signalCount) {
+		// Increase the counter
+		counter.fetch_add(signalCount, std::memory_order_seq_cst);
+
+		// Wake up to one blocked thread for every signal, only entering the kernel if any thread might be blocked
+		if(waiterCount.load(std::memory_order_seq_cst)) {
+			int32_t result = (int32_t)syscall(SYS_futex, (uint32_t*)&counter, FUTEX_WAKE_PRIVATE, (int32_t)(signalCount > INT32_T_MAX ? INT32_T_MAX : signalCount), nullptr, nullptr, 0);
+
+			if(result < 0) {
+				switch(errno) {
+				case EINVAL:
+					return ERROR_INVALID_SEMAPHORE;
+				default:
+					return ERROR_UNKNOWN;
+				}
+			}
+		}
+
+		return SUCCESS;
+	}
+
+	Semaphore::~Semaphore() = default;
+}
+
+#endif
@@ -3,14 +3,46 @@
 #ifdef WFE_PLATFORM_LINUX
 
 #include "Thread.hpp"
-#include "Debug.hpp"
+#include "Allocator.hpp"
+#include "Mutex.hpp"
+#include "Exception.hpp"
 #include "Memory.hpp"
 #include <errno.h>
+#include <linux/futex.h>
 #include <pthread.h>
+#include <sched.h>
+#include <sys/resource.h>
+#include <sys/syscall.h>
 #include <sys/sysinfo.h>
 #include <unistd.h>
 
 namespace wfe {
+	// Constants
+	static const uint32_t ATOMIC_MUTEX_SPIN_COUNT = 16;
+	static const uint32_t ATOMIC_MUTEX_MAX_BACKOFF = 64;
+	static const size_t MAX_THREAD_NAME_LENGTH = 15;
+	static const int32_t THREAD_PRIORITY_NICE_VALUES[] = { 19, 5, 0, -5, -10 };
+
+	// Internal structs
+	struct ThreadParams {
+		Thread::ThreadFunction func;
+		void* args;
+		int32_t niceValue;
+	};
+
+	// Internal functions
+	static void* ThreadFunctionWrapper(void* voidParams) {
+		// Copy and free the given params
+		ThreadParams params = *(ThreadParams*)voidParams;
+		FreeMemory(voidParams);
+
+		// Set the thread's nice value, which Linux applies per thread; ignore failures, since raising the priority may require elevated privileges
+		setpriority(PRIO_PROCESS, (id_t)syscall(SYS_gettid), params.niceValue);
+
+		// Call the given function using the given args
+		return params.func(params.args);
+	}
+
 	bool8_t Thread::operator==(const Thread& other) const {
 		// Compare the two threads using pthread_equal
 		return pthread_equal((pthread_t)internalData, (pthread_t)other.internalData);
@@ -28,10 +60,74 @@ namespace wfe {
 	}
 
 	Thread::ThreadResult Thread::Begin(ThreadFunction func, void* args) {
-		// Use pthread_create to start the thread
-		int32_t result = pthread_create((pthread_t*)&internalData, nullptr, func, args);
+		// Begin the thread with the default options
+		return Begin(func, args, ThreadOptions());
+	}
+	Thread::ThreadResult Thread::Begin(ThreadFunction func, void* args, const ThreadOptions& options) {
+		// Create the thread's attributes
+		pthread_attr_t attr;
+		if(pthread_attr_init(&attr))
+			return ERROR_INSUFFICIENT_RESOURCES;
+
+		// Set the thread's stack size, if one was given
+		if(options.stackSize && pthread_attr_setstacksize(&attr, options.stackSize)) {
+			pthread_attr_destroy(&attr);
+			return ERROR_INVALID_OPTIONS;
+		}
+
+		// Set the thread's affinity, if a mask was given
+		if(options.affinityMask) {
+			cpu_set_t cpuSet;
+			CPU_ZERO(&cpuSet);
+			for(size_t i = 0; i != 64 && i != CPU_SETSIZE; ++i)
+				if(options.affinityMask & ((uint64_t)1 << i))
+					CPU_SET(i, &cpuSet);
+
+			if(pthread_attr_setaffinity_np(&attr, sizeof(cpu_set_t), &cpuSet)) {
+				pthread_attr_destroy(&attr);
+				return ERROR_INVALID_OPTIONS;
+			}
+		}
+
+		// Use pthread_create to start the thread, wrapping the function if its priority must be set from the new thread
+		int32_t result;
+		if(options.priority == PRIORITY_NORMAL) {
+			result = pthread_create((pthread_t*)&internalData, &attr, func, args);
+		} else {
+			// Allocate the params outside of the command arena, as they are freed on the new thread
+			PushMemoryUsageType(MEMORY_USAGE_TYPE_OTHER);
+			ThreadParams* params = (ThreadParams*)AllocMemory(sizeof(ThreadParams));
+			PopMemoryUsageType();
+
+			if(!params) {
+				pthread_attr_destroy(&attr);
+				return ERROR_FAILED_HEAP_ALLOCATION;
+			}
+
+			params->func = func;
+			params->args = args;
+			params->niceValue = THREAD_PRIORITY_NICE_VALUES[options.priority];
+
+			result = pthread_create((pthread_t*)&internalData, &attr, ThreadFunctionWrapper, params);
+			if(result)
+				FreeMemory(params);
+		}
+
+		pthread_attr_destroy(&attr);
+
+		// Set the thread's name, if one was given
+		if(!result && options.name) {
+			char_t name[MAX_THREAD_NAME_LENGTH + 1];
+			size_t nameLength = strnlen(options.name, MAX_THREAD_NAME_LENGTH);
+			memcpy(name, options.name, nameLength);
+			name[nameLength] = 0;
 
-		// Set the thread's ID to the thread pointer
+			pthread_setname_np((pthread_t)internalData, name);
+		}
+
+		// Reset the thread pointer if the thread wasn't created, and set the thread's ID to the thread pointer
+		if(result)
+			internalData = nullptr;
 		threadID = (ThreadID)internalData;
 
 		// Convert the given result to a thread result
@@ -40,6 +136,9 @@ namespace wfe {
 			return SUCCESS;
 		case EAGAIN:
 			return ERROR_INSUFFICIENT_RESOURCES;
+		case EINVAL:
+		case EPERM:
+			return ERROR_INVALID_OPTIONS;
 		default:
 			return ERROR_UNKNOWN;
 		}
@@ -123,20 +222,15 @@ namespace wfe {
 		case 0:
 			break;
 		case EAGAIN:
-			WFE_LOG_FATAL("Failed to create mutex! Reason: Insufficient resources.");
-			break;
+			throw Exception("Failed to create mutex! Reason: Insufficient resources.");
 		case ENOMEM:
-			WFE_LOG_FATAL("Failed to create mutex! Reason: Insufficient memory.");
-			break;
+			throw BadAllocException("Failed to create mutex! Reason: Insufficient memory.");
 		case EPERM:
-			WFE_LOG_FATAL("Failed to create mutex! Reason: Caller lacks privilege.");
-			break;
+			throw Exception("Failed to create mutex! Reason: Caller lacks privilege.");
 		case EBUSY:
-			WFE_LOG_FATAL("Failed to create mutex! Reason: Mutex already initialised.");
-			break;
+			throw Exception("Failed to create mutex! Reason: Mutex already initialised.");
 		default:
-			WFE_LOG_FATAL("Failed to create mutex! Reason: Unknown");
-			break;
+			throw Exception("Failed to create mutex! Reason: Unknown.");
 		}
 	}
 
@@ -201,32 +295,74 @@ namespace wfe {
 	}
 
 	void AtomicMutex::Lock() {
-		// Wait until the mutex's value is set to 0
-		uint8_t target = 0;
-		while(!val.compare_exchange_weak(target, 1)) {
-			// Reset the target value
-			target = 0;
-			sleep(0);
+		// Try to lock the mutex directly
+		uint32_t state = 0;
+		if(val.compare_exchange_strong(state, 1, std::memory_order_acquire, std::memory_order_relaxed))
+			return;
+
+		// Spin for a short while, doubling the wait between attempts
+		uint32_t backoff = 1;
+		for(uint32_t i = 0; i != ATOMIC_MUTEX_SPIN_COUNT && state != 2; ++i) {
+			for(uint32_t j = 0; j != backoff; ++j)
+				PauseCurrentThread();
+			if(backoff < ATOMIC_MUTEX_MAX_BACKOFF)
+				backoff <<= 1;
+
+			// Try to lock the mutex if it was unlocked
+			state = val.load(std::memory_order_relaxed);
+			if(!state && val.compare_exchange_weak(state, 1, std::memory_order_acquire, std::memory_order_relaxed))
+				return;
 		}
+
+		// Mark the mutex as contended and park the thread on the futex until the mutex is unlocked
+		while(val.exchange(2, std::memory_order_acquire))
+			syscall(SYS_futex, (uint32_t*)&val, FUTEX_WAIT_PRIVATE, 2, nullptr, nullptr, 0);
 	}
 	bool8_t AtomicMutex::TryLock() {
 		// Try to set the mutex's value
-		uint8_t target = 0;
-		return val.compare_exchange_weak(target, 1);
+		uint32_t target = 0;
+		return val.compare_exchange_strong(target, 1, std::memory_order_acquire, std::memory_order_relaxed);
 	}
 	void AtomicMutex::Unlock() {
-		// Set the mutex's value to 0
-		val = 0;
+		// Set the mutex's value to 0, waking one parked thread if the mutex was contended
+		if(val.exchange(0, std::memory_order_release) == 2)
+			syscall(SYS_futex, (uint32_t*)&val, FUTEX_WAKE_PRIVATE, 1, nullptr, nullptr, 0);
 	}
 
 	Thread::ThreadID GetCurrentThreadID() {
 		// Get the ID using pthread_self
 		return (Thread::ThreadID)pthread_self();
 	}
+	void YieldCurrentThread() {
+		// Yield the current thread using sched_yield
+		sched_yield();
+	}
+	void WaitOnValue(atomic_uint32_t& value, uint32_t expected) {
+		// Park the thread on the value's futex
+		syscall(SYS_futex, (uint32_t*)&value, FUTEX_WAIT_PRIVATE, expected, nullptr, nullptr, 0);
+	}
+	void WakeAllOnValue(atomic_uint32_t& value) {
+		// Wake every thread parked on the value's futex
+		syscall(SYS_futex, (uint32_t*)&value, FUTEX_WAKE_PRIVATE, INT32_T_MAX, nullptr, nullptr, 0);
+	}
 	void ExitCurrentThread(void* returnValue) {
 		// Exit the current thread using pthread_exit
 		pthread_exit(returnValue);
 	}
+	uint64_t GetCurrentThreadAffinityMask() {
+		// Get the processors the current thread may run on using sched_getaffinity
+		cpu_set_t cpuSet;
+		if(sched_getaffinity(0, sizeof(cpu_set_t), &cpuSet))
+			return 0;
+
+		// Convert the first 64 processors to a bitmask
+		uint64_t affinityMask = 0;
+		for(size_t i = 0; i != 64 && i != CPU_SETSIZE; ++i)
+			if(CPU_ISSET(i, &cpuSet))
+				affinityMask |= (uint64_t)1 << i;
+
+		return affinityMask;
+	}
 	size_t GetProcessorCount() {
 		// Get the processor count using get_nprocs
 		return (size_t)get_nprocs();
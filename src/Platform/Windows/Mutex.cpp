@@ -4,11 +4,21 @@
 
 #include "Mutex.hpp"
 #include "Exception.hpp"
+#include "Thread.hpp"
 
 #define WIN32_LEAN_AND_MEAN
 #include <windows.h>
+#include <synchapi.h>
+
+#ifdef _MSC_VER
+#pragma comment(lib, "Synchronization.lib")
+#endif
 
 namespace wfe {
+	// Constants
+	static const uint32_t ATOMIC_MUTEX_SPIN_COUNT = 16;
+	static const uint32_t ATOMIC_MUTEX_MAX_BACKOFF = 64;
+
 	Mutex::Mutex() {
 		// Create the mutex using CreateMutex
 		internalData = (void*)CreateMutexA(nullptr, FALSE, nullptr);
@@ -123,22 +133,39 @@ namespace wfe {
 	}
 
 	void AtomicMutex::Lock() {
-		// Wait until the mutex's value is set to 0
-		uint8_t target = 0;
-		while(!val.compare_exchange_weak(target, 1)) {
-			// Reset the target value
-			target = 0;
-			Sleep(0);
+		// Try to lock the mutex directly
+		uint32_t state = 0;
+		if(val.compare_exchange_strong(state, 1, std::memory_order_acquire, std::memory_order_relaxed))
+			return;
+
+		// Spin for a short while, doubling the wait between attempts
+		uint32_t backoff = 1;
+		for(uint32_t i = 0; i != ATOMIC_MUTEX_SPIN_COUNT && state != 2; ++i) {
+			for(uint32_t j = 0; j != backoff; ++j)
+				PauseCurrentThread();
+			if(backoff < ATOMIC_MUTEX_MAX_BACKOFF)
+				backoff <<= 1;
+
+			// Try to lock the mutex if it was unlocked
+			state = val.load(std::memory_order_relaxed);
+			if(!state && val.compare_exchange_weak(state, 1, std::memory_order_acquire, std::memory_order_relaxed))
+				return;
 		}
+
+		// Mark the mutex as contended and park the thread using WaitOnAddress until the mutex is unlocked
+		uint32_t contendedState = 2;
+		while(val.exchange(2, std::memory_order_acquire))
+			WaitOnAddress((volatile VOID*)&val, &contendedState, sizeof(uint32_t), INFINITE);
 	}
 	bool8_t AtomicMutex::TryLock() {
 		// Try to set the mutex's value
-		uint8_t target = 0;
-		return val.compare_exchange_weak(target, 1);
+		uint32_t target = 0;
+		return val.compare_exchange_strong(target, 1, std::memory_order_acquire, std::memory_order_relaxed);
 	}
 	void AtomicMutex::Unlock() {
-		// Set the mutex's value to 0
-		val = 0;
+		// Set the mutex's value to 0, waking one parked thread if the mutex was contended
+		if(val.exchange(0, std::memory_order_release) == 2)
+			WakeByAddressSingle((PVOID)&val);
 	}
 }
 
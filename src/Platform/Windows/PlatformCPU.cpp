@@ -0,0 +1,38 @@
+#include "BuildInfo.hpp"
+
+#ifdef WFE_PLATFORM_WINDOWS
+
+#include "Platform.hpp"
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace wfe {
+	// Public functions
+	bool8_t PlatformIsAVX2Supported() {
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+		// Check if the CPU supports AVX and the OS saves the AVX registers
+		int32_t info[4];
+		__cpuid(info, 1);
+		if(!(info[2] & (1 << 27)) || !(info[2] & (1 << 28)) || (_xgetbv(0) & 6) != 6)
+			return false;
+
+		// Check the AVX2 feature bit
+		__cpuid(info, 0);
+		if(info[0] < 7)
+			return false;
+		__cpuidex(info, 7, 0);
+
+		return info[1] & (1 << 5);
+#elif defined(__x86_64__) || defined(__i386__)
+		// Let the compiler's runtime check the CPU's features, which includes checking that the OS saves the AVX registers
+		__builtin_cpu_init();
+		return __builtin_cpu_supports("avx2");
+#else
+		return false;
+#endif
+	}
+}
+
+#endif
\ No newline at end of file
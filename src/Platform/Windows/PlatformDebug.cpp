@@ -0,0 +1,36 @@
+#include "BuildInfo.hpp"
+
+#ifdef WFE_PLATFORM_WINDOWS
+
+#include "Platform.hpp"
+
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#include <stdio.h>
+
+namespace wfe {
+	// Public functions
+	size_t PlatformCaptureBacktrace(void** frames, size_t maxFrameCount, size_t skipCount) {
+		// Capture the stack using RtlCaptureStackBackTrace, skipping this function's own frame
+		return (size_t)RtlCaptureStackBackTrace((DWORD)(skipCount + 1), (DWORD)maxFrameCount, frames, nullptr);
+	}
+	void PlatformGetBacktraceFrameName(void* frame, char_t* dest, size_t maxSize) {
+		// Find the module containing the address
+		HMODULE module;
+		char_t modulePath[MAX_PATH];
+		if(!GetModuleHandleExA(GET_MODULE_HANDLE_EX_FLAG_FROM_ADDRESS | GET_MODULE_HANDLE_EX_FLAG_UNCHANGED_REFCOUNT, (LPCSTR)frame, &module) || !GetModuleFileNameA(module, modulePath, MAX_PATH)) {
+			snprintf(dest, maxSize, "%p", frame);
+			return;
+		}
+
+		// Strip the module's directory
+		const char_t* moduleName = modulePath;
+		for(const char_t* ptr = modulePath; *ptr; ++ptr)
+			if(*ptr == '\\' || *ptr == '/')
+				moduleName = ptr + 1;
+
+		snprintf(dest, maxSize, "%s+0x%zx", moduleName, (size_t)((char_t*)frame - (char_t*)module));
+	}
+}
+
+#endif
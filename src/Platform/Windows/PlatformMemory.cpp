@@ -3,8 +3,10 @@
 #ifdef WFE_PLATFORM_WINDOWS
 
 #include "Platform.hpp"
+#include "Memory.hpp"
 
-#include <heapapi.h>
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
 
 namespace wfe {
 	void* PlatformAllocateMemory(size_t size) {
@@ -23,6 +25,34 @@ namespace wfe {
 		// Get the memory's size using HeapSize
 		return (size_t)HeapSize(GetProcessHeap(), 0, mem);
 	}
+	size_t PlatformGetPageSize() {
+		// Get the page size using GetSystemInfo, only once
+		static const size_t pageSize = [] {
+			SYSTEM_INFO systemInfo;
+			GetSystemInfo(&systemInfo);
+			return (size_t)systemInfo.dwPageSize;
+		}();
+		return pageSize;
+	}
+	void* PlatformAllocatePages(size_t size) {
+		// Reserve and commit the pages using VirtualAlloc
+		return VirtualAlloc(nullptr, size, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE);
+	}
+	void* PlatformReallocatePages(void* mem, size_t oldSize, size_t newSize) {
+		// Map the new pages and copy the old pages' contents, as Windows has no way to remap pages
+		void* newMem = PlatformAllocatePages(newSize);
+		if(!newMem)
+			return nullptr;
+
+		memcpy(newMem, mem, oldSize < newSize ? oldSize : newSize);
+		PlatformFreePages(mem, oldSize);
+
+		return newMem;
+	}
+	void PlatformFreePages(void* mem, size_t size) {
+		// Release the pages using VirtualFree
+		VirtualFree(mem, 0, MEM_RELEASE);
+	}
 }
 
-#endif
\ No newline at end of file
+#endif
@@ -8,8 +8,17 @@
 
 #define WIN32_LEAN_AND_MEAN
 #include <windows.h>
+#include <synchapi.h>
+
+#ifdef _MSC_VER
+#pragma comment(lib, "Synchronization.lib")
+#endif
 
 namespace wfe {
+	// Constants
+	static const size_t MAX_THREAD_NAME_LENGTH = 255;
+	static const int THREAD_PRIORITY_VALUES[] = { THREAD_PRIORITY_LOWEST, THREAD_PRIORITY_BELOW_NORMAL, THREAD_PRIORITY_NORMAL, THREAD_PRIORITY_ABOVE_NORMAL, THREAD_PRIORITY_HIGHEST };
+
 	// Internal structs
 	struct ThreadParams {
 		Thread::ThreadFunction func;
@@ -78,6 +87,10 @@ namespace wfe {
 	}
 
 	Thread::ThreadResult Thread::Begin(ThreadFunction func, void* args) {
+		// Begin the thread with the default options
+		return Begin(func, args, ThreadOptions());
+	}
+	Thread::ThreadResult Thread::Begin(ThreadFunction func, void* args, const ThreadOptions& options) {
 		// Check if the thread was already opened
 		if(internalData)
 			return ERROR_THREAD_ALREADY_BEGUN;
@@ -85,8 +98,8 @@ namespace wfe {
 		// Create another variable to save the thread ID in
 		DWORD threadIDWord;
 
-		// Allocate the current thread's params
-		PushMemoryUsageType(MEMORY_USAGE_TYPE_COMMAND);
+		// Allocate the current thread's params outside of the command arena, as they are freed on the new thread
+		PushMemoryUsageType(MEMORY_USAGE_TYPE_OTHER);
 		ThreadParams* params = (ThreadParams*)AllocMemory(sizeof(ThreadParams));
 		PopMemoryUsageType();
 
@@ -97,8 +110,8 @@ namespace wfe {
 		params->func = func;
 		params->params = args;
 
-		// Create the thread using CreateThread
-		internalData = (void*)CreateThread(NULL, 0, ThreadFunctionWrapper, params, 0, &threadIDWord);
+		// Create the thread suspended using CreateThread, so that its options can be set before it runs
+		internalData = (void*)CreateThread(NULL, (SIZE_T)options.stackSize, ThreadFunctionWrapper, params, options.stackSize ? (CREATE_SUSPENDED | STACK_SIZE_PARAM_IS_A_RESERVATION) : CREATE_SUSPENDED, &threadIDWord);
 
 		// Set the thread's new ID
 		threadID = (ThreadID)threadIDWord;
@@ -124,6 +137,32 @@ namespace wfe {
 			};
 		}
 
+		// Set the thread's affinity, if a mask was given
+		if(options.affinityMask && !SetThreadAffinityMask((HANDLE)internalData, (DWORD_PTR)options.affinityMask)) {
+			TerminateThread((HANDLE)internalData, 0);
+			CloseHandle((HANDLE)internalData);
+			FreeMemory(params);
+
+			internalData = nullptr;
+			threadID = 0;
+
+			return ERROR_INVALID_OPTIONS;
+		}
+
+		// Set the thread's priority; ignore failures, since higher priorities may require elevated privileges
+		if(options.priority != PRIORITY_NORMAL)
+			SetThreadPriority((HANDLE)internalData, THREAD_PRIORITY_VALUES[options.priority]);
+
+		// Set the thread's name, if one was given
+		if(options.name) {
+			wchar_t name[MAX_THREAD_NAME_LENGTH + 1];
+			if(MultiByteToWideChar(CP_UTF8, 0, options.name, -1, name, MAX_THREAD_NAME_LENGTH + 1))
+				SetThreadDescription((HANDLE)internalData, name);
+		}
+
+		// Resume the thread, letting it begin executing
+		ResumeThread((HANDLE)internalData);
+
 		return SUCCESS;
 	}
 	Thread::ThreadResult Thread::Detach() {
@@ -289,6 +328,18 @@ namespace wfe {
 		// Get the current thread ID using GetCurrentThreadId
 		return (Thread::ThreadID)GetCurrentThreadId();
 	}
+	void YieldCurrentThread() {
+		// Yield the current thread using SwitchToThread
+		SwitchToThread();
+	}
+	void WaitOnValue(atomic_uint32_t& value, uint32_t expected) {
+		// Park the thread using WaitOnAddress
+		WaitOnAddress((volatile VOID*)&value, &expected, sizeof(uint32_t), INFINITE);
+	}
+	void WakeAllOnValue(atomic_uint32_t& value) {
+		// Wake every parked thread using WakeByAddressAll
+		WakeByAddressAll((PVOID)&value);
+	}
 	void ExitCurrentThread(void* returnValue) {
 		// Get the current thread's ID
 		Thread::ThreadID threadID = GetCurrentThreadID();
@@ -322,6 +373,14 @@ namespace wfe {
 		// Exit the current thread using ExitThread and return the thread result index
 		ExitThread((DWORD)threadResultIndex);
 	}
+	uint64_t GetCurrentThreadAffinityMask() {
+		// Get the processors the current process may run on using GetProcessAffinityMask, as Windows has no direct way to query a thread's mask
+		DWORD_PTR processMask, systemMask;
+		if(!GetProcessAffinityMask(GetCurrentProcess(), &processMask, &systemMask))
+			return 0;
+
+		return (uint64_t)processMask;
+	}
 	size_t GetProcessorCount() {
 		// Get the SYSTEM_INFO struct
 		SYSTEM_INFO systemInfo;
@@ -0,0 +1,128 @@
+#include "Thread.hpp"
+#include "Mutex.hpp"
+#include "Platform.hpp"
+
+namespace wfe {
+	// Internal structs
+	struct ThreadExitCallbackInfo {
+		ThreadExitCallback callback;
+		void* args;
+	};
+	struct ThreadIndexReleaser {
+		size_t* threadIndex = nullptr;
+
+		~ThreadIndexReleaser();
+	};
+
+	// Internal variables
+	static AtomicMutex threadIndexMutex;
+	static uint64_t* usedThreadIndices = nullptr;
+	static size_t usedThreadIndexWordCount = 0;
+
+	static AtomicMutex threadExitCallbackMutex;
+	static ThreadExitCallbackInfo* threadExitCallbacks = nullptr;
+	static size_t threadExitCallbackCount = 0;
+	static size_t threadExitCallbackCapacity = 0;
+
+	static thread_local ThreadIndexReleaser threadIndexReleaser;
+
+	// Internal functions
+	ThreadIndexReleaser::~ThreadIndexReleaser() {
+		// Exit the function if the thread was never assigned an index
+		if(!threadIndex)
+			return;
+
+		size_t index = *threadIndex;
+
+		// Call every exit callback while the thread still holds its index
+		threadExitCallbackMutex.Lock();
+		for(size_t i = 0; i != threadExitCallbackCount; ++i)
+			threadExitCallbacks[i].callback(index, threadExitCallbacks[i].args);
+		threadExitCallbackMutex.Unlock();
+
+		// Mark the thread's index as released, so that the thread never uses it again
+		*threadIndex = EXITED_THREAD_INDEX;
+		threadIndex = nullptr;
+
+		// Release the index, letting new threads take it
+		threadIndexMutex.Lock();
+		usedThreadIndices[index >> 6] &= ~((uint64_t)1 << (index & 63));
+		threadIndexMutex.Unlock();
+	}
+
+	// Public functions
+	size_t AcquireCurrentThreadIndex(size_t& threadIndex) {
+		threadIndexMutex.Lock();
+
+		// Find the first word of the used index bitmask with an unused index
+		size_t wordInd = 0;
+		while(wordInd != usedThreadIndexWordCount && usedThreadIndices[wordInd] == UINT64_T_MAX)
+			++wordInd;
+
+		// Grow the bitmask if every index is used; the bitmask is allocated from the platform heap, since the allocator's own thread state may be using thread indices
+		if(wordInd == usedThreadIndexWordCount) {
+			size_t newWordCount = usedThreadIndexWordCount ? usedThreadIndexWordCount << 1 : 1;
+			uint64_t* newUsedThreadIndices = (uint64_t*)PlatformReallocateMemory(usedThreadIndices, newWordCount * sizeof(uint64_t));
+			if(!newUsedThreadIndices) {
+				threadIndexMutex.Unlock();
+				return EXITED_THREAD_INDEX;
+			}
+
+			for(size_t i = usedThreadIndexWordCount; i != newWordCount; ++i)
+				newUsedThreadIndices[i] = 0;
+
+			usedThreadIndices = newUsedThreadIndices;
+			usedThreadIndexWordCount = newWordCount;
+		}
+
+		// Take the word's lowest unused index
+		uint64_t word = usedThreadIndices[wordInd];
+		size_t bitInd = 0;
+		while(word & ((uint64_t)1 << bitInd))
+			++bitInd;
+
+		usedThreadIndices[wordInd] = word | ((uint64_t)1 << bitInd);
+
+		threadIndexMutex.Unlock();
+
+		// Register the index's releaser, which runs when the thread exits
+		threadIndex = (wordInd << 6) | bitInd;
+		threadIndexReleaser.threadIndex = &threadIndex;
+
+		return threadIndex;
+	}
+	void AddThreadExitCallback(ThreadExitCallback callback, void* args) {
+		threadExitCallbackMutex.Lock();
+
+		// Grow the callback array if it is full
+		if(threadExitCallbackCount == threadExitCallbackCapacity) {
+			size_t newCapacity = threadExitCallbackCapacity ? threadExitCallbackCapacity << 1 : 16;
+			ThreadExitCallbackInfo* newCallbacks = (ThreadExitCallbackInfo*)PlatformReallocateMemory(threadExitCallbacks, newCapacity * sizeof(ThreadExitCallbackInfo));
+			if(!newCallbacks) {
+				threadExitCallbackMutex.Unlock();
+				return;
+			}
+
+			threadExitCallbacks = newCallbacks;
+			threadExitCallbackCapacity = newCapacity;
+		}
+
+		// Add the callback at the end of the array
+		threadExitCallbacks[threadExitCallbackCount++] = { callback, args };
+
+		threadExitCallbackMutex.Unlock();
+	}
+	void RemoveThreadExitCallback(ThreadExitCallback callback, void* args) {
+		threadExitCallbackMutex.Lock();
+
+		// Find the callback and replace it with the last one
+		for(size_t i = 0; i != threadExitCallbackCount; ++i) {
+			if(threadExitCallbacks[i].callback == callback && threadExitCallbacks[i].args == args) {
+				threadExitCallbacks[i] = threadExitCallbacks[--threadExitCallbackCount];
+				break;
+			}
+		}
+
+		threadExitCallbackMutex.Unlock();
+	}
+}
\ No newline at end of file
@@ -0,0 +1,291 @@
+#include "UnitTests.hpp"
+
+namespace wfe {
+	static void* AllocatorTestAlloc(void* args) {
+		// Allocate a block with the assets memory usage type, to be freed by another thread
+		PushMemoryUsageType(MEMORY_USAGE_TYPE_ASSETS);
+		void* mem = AllocMemory(*(size_t*)args);
+		PopMemoryUsageType();
+
+		return mem;
+	}
+
+	struct alignas(64) AllocatorTestAlignedObject {
+		float32_t values[16];
+	};
+
+	void AllocatorUnitTestCallback(UnitTestList& unitTestList) {
+		unitTestList.name = "Allocator";
+
+		/* Test AllocMemory and FreeMemory */ {
+			// Test 1
+			const size_t test1Sizes[] { 1, 16, 17, 100, 1000, 4096, 5000, 100000 };
+			size_t test1FitCount = 0;
+
+			for(size_t i = 0; i != sizeof(test1Sizes) / sizeof(size_t); ++i) {
+				// Allocate and free the same size twice, making sure reused blocks are still large enough
+				for(size_t j = 0; j != 2; ++j) {
+					char_t* mem = (char_t*)AllocMemory(test1Sizes[i]);
+					memset(mem, 0xAB, test1Sizes[i]);
+
+					if(GetMemorySize(mem) >= test1Sizes[i])
+						++test1FitCount;
+
+					FreeMemory(mem);
+				}
+			}
+
+			UnitTest& unitTest1 = unitTestList.unitTests[unitTestList.unitTestCount++];
+
+			unitTest1.name = "AllocMemory 1";
+			unitTest1.FormatResult("%llu", (unsigned long long)test1FitCount);
+			unitTest1.wantedResult = "16";
+
+			// Test 2
+			size_t test2Before = GetMemoryUsage(MEMORY_USAGE_TYPE_ASSETS);
+			size_t test2ExactCount = 0;
+
+			// Power of two sizes must get blocks of exactly their size, without spilling into a larger size class
+			PushMemoryUsageType(MEMORY_USAGE_TYPE_ASSETS);
+			for(size_t size = 16; size <= 4096; size <<= 1) {
+				void* mem = AllocMemory(size);
+				if(GetMemorySize(mem) == size)
+					++test2ExactCount;
+				FreeMemory(mem);
+			}
+
+			// Grow a small block through several size classes, checking that its contents survive every move
+			uint8_t* test2Mem = (uint8_t*)AllocMemory(16);
+			for(uint8_t i = 0; i != 16; ++i)
+				test2Mem[i] = i;
+			for(size_t size = 32; size <= 2048; size <<= 1) {
+				test2Mem = (uint8_t*)ReallocMemory(test2Mem, size);
+				for(size_t i = size >> 1; i != size; ++i)
+					test2Mem[i] = (uint8_t)i;
+			}
+			PopMemoryUsageType();
+
+			size_t test2Sum = 0;
+			for(size_t i = 0; i != 2048; ++i)
+				test2Sum += test2Mem[i];
+
+			size_t test2During = GetMemoryUsage(MEMORY_USAGE_TYPE_ASSETS);
+			FreeMemory(test2Mem);
+			size_t test2After = GetMemoryUsage(MEMORY_USAGE_TYPE_ASSETS);
+
+			UnitTest& unitTest2 = unitTestList.unitTests[unitTestList.unitTestCount++];
+
+			unitTest2.name = "AllocMemory 2";
+			unitTest2.FormatResult("%llu %llu %i %i", (unsigned long long)test2ExactCount, (unsigned long long)test2Sum, (int32_t)(test2During - test2Before == 2048), (int32_t)(test2After == test2Before));
+			unitTest2.wantedResult = "9 261120 1 1";
+		}
+		/* Test GetMemoryUsage */ {
+			// Test 1
+			size_t test1Before = GetMemoryUsage(MEMORY_USAGE_TYPE_ASSETS);
+
+			PushMemoryUsageType(MEMORY_USAGE_TYPE_ASSETS);
+			void* test1Mem = AllocMemory(1000);
+			PopMemoryUsageType();
+
+			size_t test1During = GetMemoryUsage(MEMORY_USAGE_TYPE_ASSETS);
+			FreeMemory(test1Mem);
+			size_t test1After = GetMemoryUsage(MEMORY_USAGE_TYPE_ASSETS);
+
+			UnitTest& unitTest1 = unitTestList.unitTests[unitTestList.unitTestCount++];
+
+			unitTest1.name = "GetMemoryUsage 1";
+			unitTest1.FormatResult("%i %i", (int32_t)(test1During - test1Before >= 1000), (int32_t)(test1After == test1Before));
+			unitTest1.wantedResult = "1 1";
+
+			// Test 2
+			size_t test2Before = GetMemoryUsage(MEMORY_USAGE_TYPE_ASSETS);
+			size_t test2Size = 2000;
+			void* test2Mem = nullptr;
+			Thread test2Thread;
+
+			test2Thread.Begin(AllocatorTestAlloc, &test2Size);
+			test2Thread.Join(&test2Mem);
+
+			size_t test2During = GetMemoryUsage(MEMORY_USAGE_TYPE_ASSETS);
+			FreeMemory(test2Mem);
+			size_t test2After = GetMemoryUsage(MEMORY_USAGE_TYPE_ASSETS);
+
+			UnitTest& unitTest2 = unitTestList.unitTests[unitTestList.unitTestCount++];
+
+			unitTest2.name = "GetMemoryUsage 2";
+			unitTest2.FormatResult("%i %i", (int32_t)(test2During - test2Before >= 2000), (int32_t)(test2After == test2Before));
+			unitTest2.wantedResult = "1 1";
+		}
+		/* Test the large allocation path */ {
+			// Test 1
+			size_t test1Threshold = GetLargeAllocationThreshold();
+			SetLargeAllocationThreshold(65536);
+
+			size_t test1Before = GetMemoryUsage(MEMORY_USAGE_TYPE_ASSETS);
+
+			// Grow a block from the heap into the large path and keep growing it, checking that its contents survive every move
+			PushMemoryUsageType(MEMORY_USAGE_TYPE_ASSETS);
+			uint32_t* test1Mem = (uint32_t*)AllocMemory(1024 * sizeof(uint32_t));
+			for(uint32_t i = 0; i != 1024; ++i)
+				test1Mem[i] = i;
+
+			test1Mem = (uint32_t*)ReallocMemory(test1Mem, 65536 * sizeof(uint32_t));
+			for(uint32_t i = 1024; i != 65536; ++i)
+				test1Mem[i] = i;
+
+			test1Mem = (uint32_t*)ReallocMemory(test1Mem, 1048576 * sizeof(uint32_t));
+			for(uint32_t i = 65536; i != 1048576; ++i)
+				test1Mem[i] = i;
+			PopMemoryUsageType();
+
+			uint64_t test1Sum = 0;
+			for(uint32_t i = 0; i != 1048576; ++i)
+				test1Sum += test1Mem[i];
+
+			size_t test1Size = GetMemorySize(test1Mem);
+			size_t test1During = GetMemoryUsage(MEMORY_USAGE_TYPE_ASSETS);
+
+			// Shrink the block back to the heap
+			test1Mem = (uint32_t*)ReallocMemory(test1Mem, 16 * sizeof(uint32_t));
+			uint32_t test1Last = test1Mem[15];
+			FreeMemory(test1Mem);
+
+			size_t test1After = GetMemoryUsage(MEMORY_USAGE_TYPE_ASSETS);
+			SetLargeAllocationThreshold(test1Threshold);
+
+			UnitTest& unitTest1 = unitTestList.unitTests[unitTestList.unitTestCount++];
+
+			unitTest1.name = "Large allocations 1";
+			unitTest1.FormatResult("%llu %i %i %u %i", (unsigned long long)test1Sum, (int32_t)(test1Size >= 1048576 * sizeof(uint32_t)), (int32_t)(test1During - test1Before == test1Size), test1Last, (int32_t)(test1After == test1Before));
+			unitTest1.wantedResult = "549755289600 1 1 15 1";
+		}
+		/* Test aligned allocations */ {
+			// Test 1
+			size_t test1Before = GetMemoryUsage(MEMORY_USAGE_TYPE_ASSETS);
+			size_t test1Threshold = GetLargeAllocationThreshold();
+			SetLargeAllocationThreshold(65536);
+
+			// Allocate blocks with different alignments, including one on the large path
+			const size_t test1Alignments[] = { 32, 64, 4096, 4096 };
+			const size_t test1Sizes[] = { 100, 1000, 10000, 100000 };
+			uint8_t* test1Mems[4];
+			size_t test1Misaligned = 0;
+
+			PushMemoryUsageType(MEMORY_USAGE_TYPE_ASSETS);
+			for(size_t i = 0; i != 4; ++i) {
+				test1Mems[i] = (uint8_t*)AllocAlignedMemory(test1Sizes[i], test1Alignments[i]);
+				test1Misaligned += ((size_t)test1Mems[i] & (test1Alignments[i] - 1)) != 0;
+				memset(test1Mems[i], (int32_t)i + 1, test1Sizes[i]);
+			}
+
+			// Grow every block, which must keep both its contents and its alignment
+			size_t test1Corrupted = 0;
+			for(size_t i = 0; i != 4; ++i) {
+				test1Mems[i] = (uint8_t*)ReallocMemory(test1Mems[i], test1Sizes[i] * 3);
+				test1Misaligned += ((size_t)test1Mems[i] & (test1Alignments[i] - 1)) != 0;
+				for(size_t j = 0; j != test1Sizes[i]; ++j)
+					test1Corrupted += test1Mems[i][j] != (uint8_t)(i + 1);
+			}
+			PopMemoryUsageType();
+
+			size_t test1During = GetMemoryUsage(MEMORY_USAGE_TYPE_ASSETS);
+
+			for(size_t i = 0; i != 4; ++i)
+				FreeMemory(test1Mems[i]);
+
+			size_t test1After = GetMemoryUsage(MEMORY_USAGE_TYPE_ASSETS);
+			SetLargeAllocationThreshold(test1Threshold);
+
+			UnitTest& unitTest1 = unitTestList.unitTests[unitTestList.unitTestCount++];
+
+			unitTest1.name = "Aligned allocations 1";
+			unitTest1.FormatResult("%llu %llu %i %i", (unsigned long long)test1Misaligned, (unsigned long long)test1Corrupted, (int32_t)(test1During - test1Before >= 333300), (int32_t)(test1After == test1Before));
+			unitTest1.wantedResult = "0 0 1 1";
+
+			// Test 2
+			size_t test2Misaligned = 0;
+
+			// Check the data of aligned vectors, both on the heap and in an arena
+			vector<float32_t, 32> test2Vec;
+			for(uint32_t i = 0; i != 1000; ++i) {
+				test2Vec.push_back((float32_t)i);
+				test2Misaligned += ((size_t)test2Vec.data() & 31) != 0;
+			}
+
+			ArenaAllocator test2Arena(1024);
+			test2Arena.Alloc(8);
+			vector<float32_t, 64> test2ArenaVec(test2Arena);
+			for(uint32_t i = 0; i != 1000; ++i) {
+				test2ArenaVec.push_back((float32_t)i);
+				test2Misaligned += ((size_t)test2ArenaVec.data() & 63) != 0;
+			}
+
+			// Check over-aligned objects and arrays
+			AllocatorTestAlignedObject* test2Object = NewObject<AllocatorTestAlignedObject>();
+			AllocatorTestAlignedObject* test2Array = NewArray<AllocatorTestAlignedObject>(7);
+			test2Misaligned += ((size_t)test2Object & 63) != 0;
+			test2Misaligned += ((size_t)test2Array & 63) != 0;
+			test2Array = ResizeArray(test2Array, 7, 100);
+			test2Misaligned += ((size_t)test2Array & 63) != 0;
+			DestroyObject(test2Object);
+			DestroyArray(test2Array, 100);
+
+			float32_t test2Sum = 0.f;
+			for(size_t i = 0; i != test2Vec.size(); ++i)
+				test2Sum += test2Vec[i] - test2ArenaVec[i];
+
+			UnitTest& unitTest2 = unitTestList.unitTests[unitTestList.unitTestCount++];
+
+			unitTest2.name = "Aligned allocations 2";
+			unitTest2.FormatResult("%llu %.1f", (unsigned long long)test2Misaligned, test2Sum);
+			unitTest2.wantedResult = "0 0.0";
+		}
+		/* Test the allocation profiler */ {
+			// Test 1
+			size_t test1Interval = GetAllocationSampleInterval();
+			SetAllocationSampleInterval(1);
+			SetAllocationProfilerEnabled(true);
+
+			// Make sure the thread's sampler is seeded before counting
+			FreeMemory(AllocMemory(64));
+
+			size_t test1Before = GetSampledAllocationCount();
+
+			PushMemoryUsageType(MEMORY_USAGE_TYPE_ASSETS);
+			void* test1Mems[16];
+			for(size_t i = 0; i != 16; ++i)
+				test1Mems[i] = AllocMemory(100);
+			test1Mems[0] = ReallocMemory(test1Mems[0], 10000);
+			PopMemoryUsageType();
+
+			SetAllocationProfilerEnabled(false);
+			size_t test1During = GetSampledAllocationCount();
+
+			bool8_t test1Dumped = DumpHeapSnapshot("AllocatorTestSnapshot.txt");
+
+			for(size_t i = 0; i != 16; ++i)
+				FreeMemory(test1Mems[i]);
+			size_t test1After = GetSampledAllocationCount();
+			SetAllocationSampleInterval(test1Interval);
+
+			// Read the snapshot back
+			char_t test1Snapshot[4096];
+			size_t test1SnapshotSize = 0;
+			FileInput test1Input;
+			if(test1Input.Open("AllocatorTestSnapshot.txt")) {
+				test1SnapshotSize = test1Input.ReadBuffer(sizeof(test1Snapshot) - 1, test1Snapshot);
+				test1Input.Close();
+			}
+			test1Snapshot[test1SnapshotSize] = 0;
+			remove("AllocatorTestSnapshot.txt");
+
+			UnitTest& unitTest1 = unitTestList.unitTests[unitTestList.unitTestCount++];
+
+			unitTest1.name = "Allocation profiler 1";
+			unitTest1.FormatResult("%llu %llu %i %i %i", (unsigned long long)(test1During - test1Before), (unsigned long long)(test1After - test1Before), (int32_t)test1Dumped, (int32_t)(strstr(test1Snapshot, "# Heap snapshot") != nullptr), (int32_t)(strstr(test1Snapshot, " 16 16 ASSETS |") != nullptr));
+			unitTest1.wantedResult = "16 0 1 1 1";
+		}
+	}
+
+	WFE_ADD_UNIT_TEST_CALLBACK(AllocatorUnitTestCallback)
+}
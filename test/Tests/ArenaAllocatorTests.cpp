@@ -0,0 +1,206 @@
+#include "UnitTests.hpp"
+
+namespace wfe {
+	static void* ArenaAllocatorTestForeignFree(void* args) {
+		// Query, grow and free command arena memory that was allocated on another thread
+		uint32_t* mem = (uint32_t*)args;
+		size_t size = GetMemorySize(mem);
+
+		mem = (uint32_t*)ReallocMemory(mem, 64 * sizeof(uint32_t));
+		uint32_t value = mem[15];
+		FreeMemory(mem);
+
+		return (void*)(size + value);
+	}
+
+	void ArenaAllocatorUnitTestCallback(UnitTestList& unitTestList) {
+		unitTestList.name = "Arena allocator";
+
+		/* Test Alloc */ {
+			// Test 1
+			ArenaAllocator test1(256);
+
+			char_t* test1Mem1 = (char_t*)test1.Alloc(10);
+			char_t* test1Mem2 = (char_t*)test1.Alloc(100);
+			char_t* test1Mem3 = (char_t*)test1.Alloc(1000);
+			memset(test1Mem1, 1, 10);
+			memset(test1Mem2, 2, 100);
+			memset(test1Mem3, 3, 1000);
+
+			UnitTest& unitTest1 = unitTestList.unitTests[unitTestList.unitTestCount++];
+
+			unitTest1.name = "ArenaAllocator::Alloc 1";
+			unitTest1.FormatResult("%i %i %i %llu %llu %i", (int32_t)(test1Mem2 - test1Mem1), (int32_t)(((uintptr_t)test1Mem3 & (ArenaAllocator::ALIGNMENT - 1)) == 0), (int32_t)test1.Contains(test1Mem3), (unsigned long long)test1.GetSize(test1Mem2), (unsigned long long)test1.GetSize(test1Mem3), (int32_t)(test1Mem1[9] + test1Mem2[99] + test1Mem3[999]));
+			unitTest1.wantedResult = "32 1 1 100 1000 6";
+
+			// Test 2
+			ArenaAllocator test2(256);
+
+			// Allocations from an arena with chunks as small as heap size classes must still be recognized by the global functions
+			char_t* test2Mem1 = (char_t*)test2.Alloc(100);
+			char_t* test2Mem2 = (char_t*)test2.Alloc(100);
+			memset(test2Mem1, 1, 100);
+			memset(test2Mem2, 2, 100);
+
+			size_t test2Size = GetMemorySize(test2Mem1);
+			FreeMemory(test2Mem1);
+
+			char_t* test2Mem3 = (char_t*)AllocMemory(100);
+			memset(test2Mem3, 3, 100);
+
+			UnitTest& unitTest2 = unitTestList.unitTests[unitTestList.unitTestCount++];
+
+			unitTest2.name = "ArenaAllocator::Alloc 2";
+			unitTest2.FormatResult("%llu %i %i", (unsigned long long)test2Size, (int32_t)(test2Mem3 != test2Mem1), (int32_t)(test2Mem1[99] + test2Mem2[99]));
+			unitTest2.wantedResult = "100 1 3";
+
+			FreeMemory(test2Mem3);
+		}
+		/* Test Realloc */ {
+			// Test 1
+			ArenaAllocator test1;
+
+			char_t* test1Mem1 = (char_t*)test1.Alloc(16);
+			memcpy(test1Mem1, "arena", 6);
+			char_t* test1Mem2 = (char_t*)test1.Realloc(test1Mem1, 64);
+			char_t* test1Mem3 = (char_t*)test1.Alloc(16);
+			char_t* test1Mem4 = (char_t*)test1.Realloc(test1Mem2, 128);
+
+			UnitTest& unitTest1 = unitTestList.unitTests[unitTestList.unitTestCount++];
+
+			unitTest1.name = "ArenaAllocator::Realloc 1";
+			unitTest1.FormatResult("%i %i %s %llu", (int32_t)(test1Mem1 == test1Mem2), (int32_t)(test1Mem4 > test1Mem3), test1Mem4, (unsigned long long)test1.GetSize(test1Mem4));
+			unitTest1.wantedResult = "1 1 arena 128";
+		}
+		/* Test Reset */ {
+			// Test 1
+			ArenaAllocator test1(1024);
+
+			void* test1Mem1 = test1.Alloc(100);
+			test1.Alloc(2000);
+			size_t test1Capacity = test1.GetCapacity();
+			test1.Reset();
+			size_t test1Used = test1.GetUsedSize();
+			void* test1Mem2 = test1.Alloc(100);
+			test1.Alloc(2000);
+
+			UnitTest& unitTest1 = unitTestList.unitTests[unitTestList.unitTestCount++];
+
+			unitTest1.name = "ArenaAllocator::Reset 1";
+			unitTest1.FormatResult("%i %llu %i", (int32_t)(test1Mem1 == test1Mem2), (unsigned long long)test1Used, (int32_t)(test1.GetCapacity() == test1Capacity));
+			unitTest1.wantedResult = "1 0 1";
+		}
+		/* Test the command arena */ {
+			// Test 1
+			SetCommandArenaEnabled(true);
+
+			PushMemoryUsageType(MEMORY_USAGE_TYPE_COMMAND);
+			vector<uint32_t> test1Vector;
+			for(uint32_t i = 0; i != 1000; ++i)
+				test1Vector.push_back(i);
+			bool8_t test1InArena = GetCommandArena()->Contains(test1Vector.data());
+			PopMemoryUsageType();
+
+			uint64_t test1Sum = 0;
+			for(uint32_t value : test1Vector)
+				test1Sum += value;
+
+			test1Vector.clear();
+			test1Vector.shrink_to_fit();
+			ResetCommandArena();
+			SetCommandArenaEnabled(false);
+
+			void* test1Heap = AllocMemory(64);
+			bool8_t test1HeapInArena = GetCommandArena()->Contains(test1Heap);
+			FreeMemory(test1Heap);
+
+			UnitTest& unitTest1 = unitTestList.unitTests[unitTestList.unitTestCount++];
+
+			unitTest1.name = "Command arena 1";
+			unitTest1.FormatResult("%i %llu %i", (int32_t)test1InArena, (unsigned long long)test1Sum, (int32_t)test1HeapInArena);
+			unitTest1.wantedResult = "1 499500 0";
+
+			// Test 2
+			SetCommandArenaEnabled(true);
+			PushMemoryUsageType(MEMORY_USAGE_TYPE_COMMAND);
+
+			uint32_t* test2Mem = (uint32_t*)AllocMemory(16 * sizeof(uint32_t));
+			for(uint32_t i = 0; i != 16; ++i)
+				test2Mem[i] = i;
+
+			// Start a thread with a low priority, whose params are allocated on this thread and freed on the new one
+			Thread test2Thread;
+			Thread::ThreadOptions test2Options;
+			test2Options.priority = Thread::PRIORITY_LOW;
+
+			test2Thread.Begin(ArenaAllocatorTestForeignFree, test2Mem, test2Options);
+			PopMemoryUsageType();
+
+			void* test2Result;
+			test2Thread.Join(&test2Result);
+
+			ResetCommandArena();
+			SetCommandArenaEnabled(false);
+
+			UnitTest& unitTest2 = unitTestList.unitTests[unitTestList.unitTestCount++];
+
+			unitTest2.name = "Command arena 2";
+			unitTest2.FormatResult("%llu", (unsigned long long)(size_t)test2Result);
+			unitTest2.wantedResult = "79";
+		}
+		/* Test containers with an arena memory resource */ {
+			// Test 1
+			ArenaAllocator test1;
+
+			vector<uint32_t> test1Vector(test1);
+			for(uint32_t i = 0; i != 1000; ++i)
+				test1Vector.push_back(i);
+
+			string test1String(test1);
+			for(uint32_t i = 0; i != 100; ++i)
+				test1String += "ab";
+
+			set<uint32_t> test1Set(test1);
+			map<uint32_t, uint32_t> test1Map(test1);
+			for(uint32_t i = 0; i != 100; ++i) {
+				test1Set.insert(i * 7 % 100);
+				test1Map[i * 3 % 100] = i;
+			}
+
+			unordered_map<uint32_t, uint32_t> test1UnorderedMap(test1);
+			unordered_set<uint32_t> test1UnorderedSet(test1);
+			for(uint32_t i = 0; i != 100; ++i) {
+				test1UnorderedMap[i] = i * 2;
+				test1UnorderedSet.insert(i);
+			}
+
+			int32_t test1InArena = test1.Contains(test1Vector.data()) + test1.Contains(test1String.data()) + (test1Set.get_memory_resource() == &test1) + (test1Map.get_memory_resource() == &test1) + (test1UnorderedMap.get_memory_resource() == &test1) + (test1UnorderedSet.get_memory_resource() == &test1);
+
+			UnitTest& unitTest1 = unitTestList.unitTests[unitTestList.unitTestCount++];
+
+			unitTest1.name = "MemoryResource containers 1";
+			unitTest1.FormatResult("%i %u %llu %u %u %u %llu", test1InArena, test1Vector[999], (unsigned long long)test1String.size(), (uint32_t)test1Set.size(), test1Map[99], test1UnorderedMap[50], (unsigned long long)test1UnorderedSet.size());
+			unitTest1.wantedResult = "6 999 200 100 33 100 100";
+
+			// Test 2
+			ArenaAllocator test2;
+
+			vector<uint32_t> test2Arena(test2);
+			test2Arena.push_back(1);
+			vector<uint32_t> test2Heap;
+			test2Heap.push_back(2);
+			test2Arena.swap(test2Heap);
+
+			vector<uint32_t> test2Moved(std::move(test2Heap));
+			vector<uint32_t> test2Copy(test2Moved);
+
+			UnitTest& unitTest2 = unitTestList.unitTests[unitTestList.unitTestCount++];
+
+			unitTest2.name = "MemoryResource containers 2";
+			unitTest2.FormatResult("%i %i %i %i %u", (int32_t)(test2Arena.get_memory_resource() == nullptr), (int32_t)(test2Moved.get_memory_resource() == &test2), (int32_t)test2.Contains(test2Moved.data()), (int32_t)(test2Copy.get_memory_resource() == nullptr), test2Copy[0]);
+			unitTest2.wantedResult = "1 1 1 1 1";
+		}
+	}
+
+	WFE_ADD_UNIT_TEST_CALLBACK(ArenaAllocatorUnitTestCallback)
+}
@@ -0,0 +1,118 @@
+#include "UnitTests.hpp"
+
+namespace wfe {
+	struct AtomicQueueTestArgs {
+		AtomicQueue<size_t>* queue;
+		atomic_size_t* sum;
+		size_t begin;
+		size_t end;
+	};
+
+	static void* AtomicQueueTestProducer(void* args) {
+		// Push every value in the range, retrying while the queue is full
+		AtomicQueueTestArgs* testArgs = (AtomicQueueTestArgs*)args;
+		for(size_t i = testArgs->begin; i != testArgs->end; ++i)
+			while(!testArgs->queue->TryPush(i));
+
+		return nullptr;
+	}
+	static void* AtomicQueueTestConsumer(void* args) {
+		// Pop as many values as there are in the range and add them to the sum
+		AtomicQueueTestArgs* testArgs = (AtomicQueueTestArgs*)args;
+		for(size_t i = testArgs->begin; i != testArgs->end; ++i) {
+			size_t val;
+			while(!testArgs->queue->TryPop(val));
+
+			testArgs->sum->fetch_add(val);
+		}
+
+		return nullptr;
+	}
+
+	void AtomicQueueUnitTestCallback(UnitTestList& unitTestList) {
+		unitTestList.name = "Atomic queue";
+
+		/* Test TryPush */ {
+			// Test 1
+			AtomicQueue<uint32_t> test1(3);
+
+			bool8_t test1Result1 = test1.TryPush(1);
+			bool8_t test1Result2 = test1.TryPush(2);
+			bool8_t test1Result3 = test1.TryPush(3);
+			bool8_t test1Result4 = test1.TryPush(4);
+			bool8_t test1Result5 = test1.TryPush(5);
+
+			UnitTest& unitTest1 = unitTestList.unitTests[unitTestList.unitTestCount++];
+
+			unitTest1.name = "TryPush 1";
+			unitTest1.FormatResult("%i %i %i %i %i %llu", (int32_t)test1Result1, (int32_t)test1Result2, (int32_t)test1Result3, (int32_t)test1Result4, (int32_t)test1Result5, (unsigned long long)test1.GetCapacity());
+			unitTest1.wantedResult = "1 1 1 1 0 4";
+
+			// Test 2
+			AtomicQueue<uint32_t> test2(1);
+
+			bool8_t test2Result1 = test2.TryPush(1);
+			bool8_t test2Result2 = test2.TryPush(2);
+			bool8_t test2Result3 = test2.TryPush(3);
+			uint32_t test2Value1 = 0, test2Value2 = 0;
+			test2.TryPop(test2Value1);
+			test2.TryPop(test2Value2);
+			bool8_t test2Result4 = test2.TryPop(test2Value2);
+
+			UnitTest& unitTest2 = unitTestList.unitTests[unitTestList.unitTestCount++];
+
+			unitTest2.name = "TryPush 2";
+			unitTest2.FormatResult("%i %i %i %u %u %i %llu", (int32_t)test2Result1, (int32_t)test2Result2, (int32_t)test2Result3, test2Value1, test2Value2, (int32_t)test2Result4, (unsigned long long)test2.GetCapacity());
+			unitTest2.wantedResult = "1 1 0 1 2 0 2";
+		}
+		/* Test TryPop */ {
+			// Test 1
+			AtomicQueue<uint32_t> test1(4);
+			uint32_t test1Values[3] {};
+
+			test1.TryPush(1);
+			test1.TryPush(2);
+			test1.TryPop(test1Values[0]);
+			test1.TryPush(3);
+			test1.TryPop(test1Values[1]);
+			test1.TryPop(test1Values[2]);
+
+			bool8_t test1Result = test1.TryPop(test1Values[0]);
+
+			UnitTest& unitTest1 = unitTestList.unitTests[unitTestList.unitTestCount++];
+
+			unitTest1.name = "TryPop 1";
+			unitTest1.FormatResult("%u %u %u %i %i", test1Values[0], test1Values[1], test1Values[2], (int32_t)test1Result, (int32_t)test1.IsEmpty());
+			unitTest1.wantedResult = "1 2 3 0 1";
+
+			// Test 2
+			AtomicQueue<size_t> test2(64);
+			atomic_size_t test2Sum = 0;
+			AtomicQueueTestArgs test2Args[4];
+			Thread test2Threads[4];
+
+			for(size_t i = 0; i != 4; ++i) {
+				test2Args[i].queue = &test2;
+				test2Args[i].sum = &test2Sum;
+				test2Args[i].begin = (i >> 1) * 5000;
+				test2Args[i].end = test2Args[i].begin + 5000;
+			}
+
+			test2Threads[0].Begin(AtomicQueueTestProducer, test2Args);
+			test2Threads[1].Begin(AtomicQueueTestConsumer, test2Args + 1);
+			test2Threads[2].Begin(AtomicQueueTestProducer, test2Args + 2);
+			test2Threads[3].Begin(AtomicQueueTestConsumer, test2Args + 3);
+
+			for(size_t i = 0; i != 4; ++i)
+				test2Threads[i].Join();
+
+			UnitTest& unitTest2 = unitTestList.unitTests[unitTestList.unitTestCount++];
+
+			unitTest2.name = "TryPop 2";
+			unitTest2.FormatResult("%llu", (unsigned long long)test2Sum.load());
+			unitTest2.wantedResult = "49995000";
+		}
+	}
+
+	WFE_ADD_UNIT_TEST_CALLBACK(AtomicQueueUnitTestCallback)
+}
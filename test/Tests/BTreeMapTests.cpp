@@ -0,0 +1,245 @@
+#include "UnitTests.hpp"
+
+namespace wfe {
+	void BTreeMapUnitTestCallback(UnitTestList& unitTestList) {
+		unitTestList.name = "B-tree map";
+
+		/* Test operator[] */ {
+			// Test 1
+			btree_map<uint32_t, const char_t*> test1{ { 1, "one" }, { 2, "test" }, { 3, "three" } };
+
+			test1[2] = "two";
+			test1[4] = "four";
+
+			const char_t* test1Result1 = test1[1];
+			const char_t* test1Result2 = test1[2];
+			const char_t* test1Result3 = test1[3];
+			const char_t* test1Result4 = test1[4];
+
+			UnitTest& unitTest1 = unitTestList.unitTests[unitTestList.unitTestCount++];
+
+			unitTest1.name = "operator[] 1";
+			unitTest1.FormatResult("%s %s %s %s", test1Result1, test1Result2, test1Result3, test1Result4);
+			unitTest1.wantedResult = "one two three four";
+		}
+		/* Test at */ {
+			// Test 1
+			btree_map<uint32_t, const char_t*> test1{ { 1, "one" }, { 2, "two" }, { 3, "three" }, { 4, "four" }, { 5, "five" } };
+
+			const char_t* test1Result1 = test1.at(2);
+			const char_t* test1Result2 = test1.at(5);
+			const char_t* test1Result3 = test1.at(1);
+
+			UnitTest& unitTest1 = unitTestList.unitTests[unitTestList.unitTestCount++];
+
+			unitTest1.name = "at 1";
+			unitTest1.FormatResult("%s %s %s", test1Result1, test1Result2, test1Result3);
+			unitTest1.wantedResult = "two five one";
+		}
+		/* Test find */ {
+			// Test 1
+			btree_map<uint32_t, const char_t*> test1{ { 1, "one" }, { 2, "two" }, { 3, "three" }, { 4, "four" }, { 5, "five" } };
+
+			const char_t* test1Result1 = test1.find(2)->second;
+			const char_t* test1Result2 = test1.find(5)->second;
+			int32_t test1Result3 = (test1.find(8) == test1.end()) ? 1 : 0;
+
+			UnitTest& unitTest1 = unitTestList.unitTests[unitTestList.unitTestCount++];
+
+			unitTest1.name = "find 1";
+			unitTest1.FormatResult("%s %s %i", test1Result1, test1Result2, test1Result3);
+			unitTest1.wantedResult = "two five 1";
+		}
+		/* Test count */ {
+			// Test 1
+			btree_map<uint32_t, const char_t*> test1{ { 1, "one" }, { 2, "two" }, { 3, "three" }, { 4, "four" }, { 5, "five" } };
+
+			size_t test1Result1 = test1.count(3);
+			size_t test1Result2 = test1.count(7);
+			size_t test1Result3 = test1.count(2);
+
+			UnitTest& unitTest1 = unitTestList.unitTests[unitTestList.unitTestCount++];
+
+			unitTest1.name = "count 1";
+			unitTest1.FormatResult("%llu %llu %llu", (unsigned long long)test1Result1, (unsigned long long)test1Result2, (unsigned long long)test1Result3);
+			unitTest1.wantedResult = "1 0 1";
+		}
+		/* Test lower_bound and upper_bound */ {
+			// Test 1
+			btree_map<uint32_t, uint32_t> test1;
+			for(uint32_t i = 0; i != 1000; ++i)
+				test1[i * 10] = i;
+
+			uint32_t test1Result1 = test1.lower_bound(500)->second;
+			uint32_t test1Result2 = test1.lower_bound(505)->second;
+			uint32_t test1Result3 = test1.upper_bound(500)->second;
+			int32_t test1Result4 = (test1.lower_bound(9991) == test1.end()) ? 1 : 0;
+			int32_t test1Result5 = (test1.upper_bound(9990) == test1.end()) ? 1 : 0;
+
+			UnitTest& unitTest1 = unitTestList.unitTests[unitTestList.unitTestCount++];
+
+			unitTest1.name = "lower_bound and upper_bound 1";
+			unitTest1.FormatResult("%u %u %u %i %i", test1Result1, test1Result2, test1Result3, test1Result4, test1Result5);
+			unitTest1.wantedResult = "50 51 51 1 1";
+		}
+		/* Test equal_range */ {
+			// Test 1
+			btree_map<uint32_t, const char_t*> test1{ { 1, "one" }, { 2, "two" }, { 3, "three" }, { 4, "four" }, { 5, "five" } };
+
+			auto test1Range = test1.equal_range(4);
+			const char_t* test1Result1 = test1Range.first->second;
+			const char_t* test1Result2 = test1Range.second->second;
+			int32_t test1Result3 = (test1.equal_range(6).first == test1.end()) ? 1 : 0;
+
+			UnitTest& unitTest1 = unitTestList.unitTests[unitTestList.unitTestCount++];
+
+			unitTest1.name = "equal_range 1";
+			unitTest1.FormatResult("%s %s %i", test1Result1, test1Result2, test1Result3);
+			unitTest1.wantedResult = "four five 1";
+		}
+		/* Test insert */ {
+			// Test 1
+			btree_map<uint32_t, const char_t*> test1{ { 5, "five" }, { 3, "three" }, { 1, "one" } };
+
+			test1.insert({ 4, "four" });
+			test1.insert(test1.begin(), { 2, "two" });
+			test1.insert({ { 6, "six" }, { 7, "seven" } });
+
+			// Iterate over the values, which must be sorted by their keys
+			char_t test1Result[64] = "";
+			size_t test1Length = 0;
+			for(const auto& val : test1) {
+				FormatString(test1Result + test1Length, sizeof(test1Result) - test1Length, "%s ", val.second);
+				test1Length = strlen(test1Result);
+			}
+
+			UnitTest& unitTest1 = unitTestList.unitTests[unitTestList.unitTestCount++];
+
+			unitTest1.name = "insert 1";
+			unitTest1.FormatResult("%s", test1Result);
+			unitTest1.wantedResult = "one two three four five six seven ";
+		}
+		/* Test erase */ {
+			// Test 1
+			btree_map<uint32_t, const char_t*> test1{ { 1, "one" }, { 3, "three" }, { 5, "five" }, { 7, "seven" }, { 2, "two" }, { 4, "out" }, { 6, "six" }, { 8, "eight" } };
+
+			test1.erase(test1.find(2));
+			test1.erase(4);
+			test1.erase(test1.find(6), test1.end());
+
+			size_t test1Result1 = test1.count(2);
+			size_t test1Result2 = test1.count(4);
+			size_t test1Result3 = test1.count(7);
+			size_t test1Result4 = test1.size();
+
+			UnitTest& unitTest1 = unitTestList.unitTests[unitTestList.unitTestCount++];
+
+			unitTest1.name = "erase 1";
+			unitTest1.FormatResult("%llu %llu %llu %llu", (unsigned long long)test1Result1, (unsigned long long)test1Result2, (unsigned long long)test1Result3, (unsigned long long)test1Result4);
+			unitTest1.wantedResult = "0 0 0 3";
+		}
+		/* Test erase while iterating */ {
+			// Test 1
+			btree_map<uint32_t, uint32_t> test1;
+			for(uint32_t i = 0; i != 1000; ++i)
+				test1[i] = i * 3;
+
+			// Erase every odd key through the iterator returned by erase, which stays valid while nodes are merged
+			for(auto iter = test1.begin(); iter != test1.end(); ) {
+				if(iter->first & 1)
+					iter = test1.erase(iter);
+				else
+					++iter;
+			}
+
+			size_t test1Result1 = 0;
+			uint64_t test1Result2 = 0;
+			for(const auto& val : test1) {
+				++test1Result1;
+				test1Result2 += val.second;
+			}
+
+			UnitTest& unitTest1 = unitTestList.unitTests[unitTestList.unitTestCount++];
+
+			unitTest1.name = "erase while iterating 1";
+			unitTest1.FormatResult("%llu %llu %llu", (unsigned long long)test1Result1, (unsigned long long)test1Result2, (unsigned long long)test1.size());
+			unitTest1.wantedResult = "500 748500 500";
+		}
+		/* Test random operations */ {
+			// Test 1
+			btree_map<uint32_t, uint32_t> test1;
+			std::map<uint32_t, uint32_t> test1Wanted;
+
+			// Insert, erase and look up random keys, which splits, merges and rotates nodes on every level
+			size_t test1Mismatches = 0;
+			uint32_t seed = 1;
+			for(uint32_t i = 0; i != 200000; ++i) {
+				seed = seed * 1664525u + 1013904223u;
+				uint32_t key = (seed >> 8) % 5000;
+
+				switch((seed >> 4) & 3) {
+				case 0:
+					test1[key] = i;
+					test1Wanted[key] = i;
+					break;
+				case 1:
+					test1Mismatches += test1.erase(key) != test1Wanted.erase(key);
+					break;
+				case 2: {
+					auto iter = test1.lower_bound(key);
+					auto wantedIter = test1Wanted.lower_bound(key);
+					test1Mismatches += (iter == test1.end()) != (wantedIter == test1Wanted.end()) || (iter != test1.end() && iter->first != wantedIter->first);
+					break;
+				}
+				default:
+					auto iter = test1.upper_bound(key);
+					auto wantedIter = test1Wanted.upper_bound(key);
+					test1Mismatches += (iter == test1.end()) != (wantedIter == test1Wanted.end()) || (iter != test1.end() && iter->first != wantedIter->first);
+					break;
+				}
+			}
+
+			// The values must be visited in the same order both forwards and backwards
+			auto wantedIter = test1Wanted.begin();
+			for(auto iter = test1.begin(); iter != test1.end(); ++iter, ++wantedIter)
+				test1Mismatches += iter->first != wantedIter->first || iter->second != wantedIter->second;
+
+			auto wantedReverseIter = test1Wanted.rbegin();
+			for(auto iter = test1.end(); iter != test1.begin(); ++wantedReverseIter)
+				test1Mismatches += (--iter)->first != wantedReverseIter->first;
+
+			UnitTest& unitTest1 = unitTestList.unitTests[unitTestList.unitTestCount++];
+
+			unitTest1.name = "random operations 1";
+			unitTest1.FormatResult("%llu %u", (unsigned long long)test1Mismatches, test1.size() == test1Wanted.size());
+			unitTest1.wantedResult = "0 1";
+		}
+		/* Test copy */ {
+			// Test 1
+			btree_map<string, uint32_t> test1;
+			char_t key[32];
+			for(uint32_t i = 0; i != 100; ++i) {
+				FormatString(key, sizeof(key), "key%03u", i);
+				test1[key] = i;
+			}
+
+			btree_map<string, uint32_t> test1Copy = test1;
+			test1.clear();
+
+			btree_map<string, uint32_t> test1Moved;
+			test1Moved = (btree_map<string, uint32_t>&&)test1Copy;
+
+			uint32_t test1Result1 = test1Moved.at("key042");
+			uint32_t test1Result2 = test1Moved.begin()->second + (--test1Moved.end())->second;
+			size_t test1Result3 = test1.size() + test1Copy.size();
+
+			UnitTest& unitTest1 = unitTestList.unitTests[unitTestList.unitTestCount++];
+
+			unitTest1.name = "copy 1";
+			unitTest1.FormatResult("%u %u %llu %llu", test1Result1, test1Result2, (unsigned long long)test1Moved.size(), (unsigned long long)test1Result3);
+			unitTest1.wantedResult = "42 99 100 0";
+		}
+	}
+
+	WFE_ADD_UNIT_TEST_CALLBACK(BTreeMapUnitTestCallback)
+}
\ No newline at end of file
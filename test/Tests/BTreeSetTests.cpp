@@ -0,0 +1,153 @@
+#include "UnitTests.hpp"
+
+namespace wfe {
+	void BTreeSetUnitTestCallback(UnitTestList& unitTestList) {
+		unitTestList.name = "B-tree set";
+
+		/* Test find */ {
+			// Test 1
+			btree_set<int32_t> test1{ 1, 3, 5, 7, 9 };
+
+			auto test1Result1 = test1.find(5);
+			auto test1Result2 = test1.find(9);
+			int32_t test1Result3 = (test1.find(2) == test1.end()) ? 1 : 0;
+
+			UnitTest& unitTest1 = unitTestList.unitTests[unitTestList.unitTestCount++];
+
+			unitTest1.name = "find 1";
+			unitTest1.FormatResult("%i %i %i", *test1Result1, *test1Result2, test1Result3);
+			unitTest1.wantedResult = "5 9 1";
+		}
+		/* Test count */ {
+			// Test 1
+			btree_set<int32_t> test1{ 1, 2, 3, 4, 5 };
+
+			size_t test1Result1 = test1.count(4);
+			size_t test1Result2 = test1.count(0);
+			size_t test1Result3 = test1.count(2);
+
+			UnitTest& unitTest1 = unitTestList.unitTests[unitTestList.unitTestCount++];
+
+			unitTest1.name = "count 1";
+			unitTest1.FormatResult("%llu %llu %llu", (unsigned long long)test1Result1, (unsigned long long)test1Result2, (unsigned long long)test1Result3);
+			unitTest1.wantedResult = "1 0 1";
+		}
+		/* Test lower_bound and upper_bound */ {
+			// Test 1
+			btree_set<int32_t> test1;
+			for(int32_t i = 0; i != 1000; ++i)
+				test1.insert(i * 10);
+
+			int32_t test1Result1 = *test1.lower_bound(500);
+			int32_t test1Result2 = *test1.lower_bound(505);
+			int32_t test1Result3 = *test1.upper_bound(500);
+			int32_t test1Result4 = (test1.lower_bound(9991) == test1.end()) ? 1 : 0;
+			int32_t test1Result5 = *test1.lower_bound(-5);
+
+			UnitTest& unitTest1 = unitTestList.unitTests[unitTestList.unitTestCount++];
+
+			unitTest1.name = "lower_bound and upper_bound 1";
+			unitTest1.FormatResult("%i %i %i %i %i", test1Result1, test1Result2, test1Result3, test1Result4, test1Result5);
+			unitTest1.wantedResult = "500 510 510 1 0";
+		}
+		/* Test equal_range */ {
+			// Test 1
+			btree_set<int32_t> test1{ 2, 4, 6, 8, 10 };
+
+			auto test1Result1 = test1.equal_range(4);
+			int32_t test1Result2 = (test1.equal_range(1).first == test1.equal_range(1).second) ? 1 : 0;
+
+			UnitTest& unitTest1 = unitTestList.unitTests[unitTestList.unitTestCount++];
+
+			unitTest1.name = "equal_range 1";
+			unitTest1.FormatResult("%i %i %i", *test1Result1.first, *test1Result1.second, test1Result2);
+			unitTest1.wantedResult = "4 6 1";
+		}
+		/* Test insert */ {
+			// Test 1
+			btree_set<int32_t> test1{ 1, 2, 3 };
+
+			test1.insert(5);
+			test1.insert({ 4, 5, 6 });
+
+			int32_t test1Result1 = (test1.find(4) != test1.end()) ? 1 : 0;
+			int32_t test1Result2 = (test1.find(5) != test1.end()) ? 1 : 0;
+			int32_t test1Result3 = (test1.find(6) != test1.end()) ? 1 : 0;
+			size_t test1Result4 = test1.size();
+
+			UnitTest& unitTest1 = unitTestList.unitTests[unitTestList.unitTestCount++];
+
+			unitTest1.name = "insert 1";
+			unitTest1.FormatResult("%i %i %i %llu", test1Result1, test1Result2, test1Result3, (unsigned long long)test1Result4);
+			unitTest1.wantedResult = "1 1 1 6";
+		}
+		/* Test erase */ {
+			// Test 1
+			btree_set<int32_t> test1{ 1, 2, 3, 4, 5, 6, 7, 8, 9, 10 };
+
+			test1.erase(test1.find(4));
+			test1.erase(7);
+			test1.erase(test1.find(9), test1.end());
+
+			int32_t test1Result1 = (test1.find(4) == test1.end()) ? 1 : 0;
+			int32_t test1Result2 = (test1.find(7) == test1.end()) ? 1 : 0;
+			size_t test1Result3 = test1.size();
+
+			UnitTest& unitTest1 = unitTestList.unitTests[unitTestList.unitTestCount++];
+
+			unitTest1.name = "erase 1";
+			unitTest1.FormatResult("%i %i %llu", test1Result1, test1Result2, (unsigned long long)test1Result3);
+			unitTest1.wantedResult = "1 1 6";
+		}
+		/* Test random operations */ {
+			// Test 1
+			btree_set<uint32_t> test1;
+			std::set<uint32_t> test1Wanted;
+
+			// Insert, erase and look up random values, which splits, merges and rotates nodes on every level
+			size_t test1Mismatches = 0;
+			uint32_t seed = 1;
+			for(uint32_t i = 0; i != 200000; ++i) {
+				seed = seed * 1664525u + 1013904223u;
+				uint32_t val = (seed >> 8) % 5000;
+
+				switch((seed >> 4) & 3) {
+				case 0:
+					test1Mismatches += test1.insert(val).second != test1Wanted.insert(val).second;
+					break;
+				case 1:
+					test1Mismatches += test1.erase(val) != test1Wanted.erase(val);
+					break;
+				case 2: {
+					// Erase the value's lower bound through its iterator, checking the returned iterator
+					auto iter = test1.lower_bound(val);
+					auto wantedIter = test1Wanted.lower_bound(val);
+					test1Mismatches += (iter == test1.end()) != (wantedIter == test1Wanted.end());
+					if(iter != test1.end() && wantedIter != test1Wanted.end()) {
+						iter = test1.erase(iter);
+						wantedIter = test1Wanted.erase(wantedIter);
+						test1Mismatches += (iter == test1.end()) != (wantedIter == test1Wanted.end()) || (iter != test1.end() && *iter != *wantedIter);
+					}
+					break;
+				}
+				default:
+					test1Mismatches += test1.count(val) != test1Wanted.count(val);
+					break;
+				}
+			}
+
+			// Every value must be visited in order
+			auto wantedIter = test1Wanted.begin();
+			for(auto iter = test1.begin(); iter != test1.end(); ++iter, ++wantedIter)
+				test1Mismatches += *iter != *wantedIter;
+
+			UnitTest& unitTest1 = unitTestList.unitTests[unitTestList.unitTestCount++];
+
+			unitTest1.name = "random operations 1";
+			unitTest1.FormatResult("%llu %u", (unsigned long long)test1Mismatches, test1.size() == test1Wanted.size());
+			unitTest1.wantedResult = "0 1";
+		}
+	}
+
+	WFE_ADD_UNIT_TEST_CALLBACK(BTreeSetUnitTestCallback)
+}
\ No newline at end of file
@@ -0,0 +1,308 @@
+#include "UnitTests.hpp"
+
+namespace wfe {
+	void FlatUnorderedMapUnitTestCallback(UnitTestList& unitTestList) {
+		unitTestList.name = "Flat unordered map";
+
+		/* Test operator[] */ {
+			// Test 1
+			flat_unordered_map<uint32_t, const char_t*> test1{ { 1, "one" }, { 2, "test" }, { 3, "three" } };
+
+			test1[2] = "two";
+			test1[4] = "four";
+
+			const char_t* test1Result1 = test1[1];
+			const char_t* test1Result2 = test1[2];
+			const char_t* test1Result3 = test1[3];
+			const char_t* test1Result4 = test1[4];
+
+			UnitTest& unitTest1 = unitTestList.unitTests[unitTestList.unitTestCount++];
+
+			unitTest1.name = "operator[] 1";
+			unitTest1.FormatResult("%s %s %s %s", test1Result1, test1Result2, test1Result3, test1Result4);
+			unitTest1.wantedResult = "one two three four";
+
+			// Test 2
+			flat_unordered_map<string, uint32_t> test2;
+
+			// A new key passed as an rvalue must be moved into the map instead of being copied
+			string test2Key = "a key long enough to be allocated on the heap instead of inline";
+			const char_t* test2KeyData = test2Key.data();
+			test2[std::move(test2Key)] = 5;
+
+			UnitTest& unitTest2 = unitTestList.unitTests[unitTestList.unitTestCount++];
+
+			unitTest2.name = "operator[] 2";
+			unitTest2.FormatResult("%i %u", (int32_t)(test2.begin()->first.data() == test2KeyData), test2.begin()->second);
+			unitTest2.wantedResult = "1 5";
+		}
+		/* Test at */ {
+			// Test 1
+			flat_unordered_map<uint32_t, const char_t*> test1{ { 1, "one" }, { 2, "two" }, { 3, "three" }, { 4, "four" }, { 5, "five" } };
+
+			const char_t* test1Result1 = test1.at(2);
+			const char_t* test1Result2 = test1.at(5);
+			const char_t* test1Result3 = test1.at(1);
+
+			UnitTest& unitTest1 = unitTestList.unitTests[unitTestList.unitTestCount++];
+
+			unitTest1.name = "at 1";
+			unitTest1.FormatResult("%s %s %s", test1Result1, test1Result2, test1Result3);
+			unitTest1.wantedResult = "two five one";
+		}
+		/* Test find */ {
+			// Test 1
+			flat_unordered_map<uint32_t, const char_t*> test1{ { 1, "one" }, { 2, "two" }, { 3, "three" }, { 4, "four" }, { 5, "five" } };
+
+			const char_t* test1Result1 = test1.find(2)->second;
+			const char_t* test1Result2 = test1.find(5)->second;
+			int32_t test1Result3 = (test1.find(8) == test1.end()) ? 1 : 0;
+
+			UnitTest& unitTest1 = unitTestList.unitTests[unitTestList.unitTestCount++];
+
+			unitTest1.name = "find 1";
+			unitTest1.FormatResult("%s %s %i", test1Result1, test1Result2, test1Result3);
+			unitTest1.wantedResult = "two five 1";
+		}
+		/* Test count */ {
+			// Test 1
+			flat_unordered_map<uint32_t, const char_t*> test1{ { 1, "one" }, { 2, "two" }, { 3, "three" }, { 4, "four" }, { 5, "five" } };
+
+			size_t test1Result1 = test1.count(3);
+			size_t test1Result2 = test1.count(7);
+			size_t test1Result3 = test1.count(2);
+
+			UnitTest& unitTest1 = unitTestList.unitTests[unitTestList.unitTestCount++];
+
+			unitTest1.name = "count 1";
+			unitTest1.FormatResult("%llu %llu %llu", (unsigned long long)test1Result1, (unsigned long long)test1Result2, (unsigned long long)test1Result3);
+			unitTest1.wantedResult = "1 0 1";
+		}
+		/* Test equal_range */ {
+			// Test 1
+			flat_unordered_map<uint32_t, const char_t*> test1{ { 1, "one" }, { 2, "two" }, { 3, "three" }, { 4, "four" }, { 5, "five" } };
+		
+			const char_t* test1Result1 = test1.equal_range(4).first->second;
+			int32_t test1Result2 = (test1.equal_range(6).first == test1.end()) ? 1 : 0;
+
+			UnitTest& unitTest1 = unitTestList.unitTests[unitTestList.unitTestCount++];
+
+			unitTest1.name = "equal_range 1";
+			unitTest1.FormatResult("%s %i", test1Result1, test1Result2);
+			unitTest1.wantedResult = "four 1";
+		}
+		/* Test insert */ {
+			// Test 1
+			flat_unordered_map<uint32_t, const char_t*> test1{ { 1, "one" }, { 4, "four" } };
+
+			test1.insert({ 3, "three" });
+			test1.insert({ { 2, "two" }, { 5, "five" } });
+
+			const char_t* test1Result1 = test1.at(1);
+			const char_t* test1Result2 = test1.at(2);
+			const char_t* test1Result3 = test1.at(3);
+			const char_t* test1Result4 = test1.at(4);
+			const char_t* test1Result5 = test1.at(5);
+
+			UnitTest& unitTest1 = unitTestList.unitTests[unitTestList.unitTestCount++];
+
+			unitTest1.name = "insert 1";
+			unitTest1.FormatResult("%s %s %s %s %s", test1Result1, test1Result2, test1Result3, test1Result4, test1Result5);
+			unitTest1.wantedResult = "one two three four five";
+		}
+		/* Test erase */ {
+			// Test 1
+			flat_unordered_map<uint32_t, const char_t*> test1{ { 1, "one" }, { 2, "two" }, { 3, "three" }, { 4, "four" }, { 5, "five" } };
+
+			test1.erase(test1.find(2));
+			test1.erase(4);
+
+			size_t test1Result1 = test1.count(2);
+			size_t test1Result2 = test1.count(4);
+			size_t test1Result3 = test1.size();
+
+			UnitTest& unitTest1 = unitTestList.unitTests[unitTestList.unitTestCount++];
+
+			unitTest1.name = "erase 1";
+			unitTest1.FormatResult("%llu %llu %llu", (unsigned long long)test1Result1, (unsigned long long)test1Result2, (unsigned long long)test1Result3);
+			unitTest1.wantedResult = "0 0 3";
+		}
+		/* Test rehash */ {
+			// Test 1
+			flat_unordered_map<uint32_t, const char_t*> test1{ { 1, "one" }, { 2, "two" }, { 3, "three" }, { 4, "four" }, { 5, "five" } };
+
+			test1.rehash(3);
+
+			const char_t* test1Result1 = test1.at(1);
+			const char_t* test1Result2 = test1.at(2);
+			const char_t* test1Result3 = test1.at(3);
+			const char_t* test1Result4 = test1.at(4);
+			const char_t* test1Result5 = test1.at(5);
+
+			UnitTest& unitTest1 = unitTestList.unitTests[unitTestList.unitTestCount++];
+
+			unitTest1.name = "rehash 1";
+			unitTest1.FormatResult("%s %s %s %s %s", test1Result1, test1Result2, test1Result3, test1Result4, test1Result5);
+			unitTest1.wantedResult = "one two three four five";
+		}
+		/* Test max_load_factor */ {
+			// Test 1
+			flat_unordered_map<uint32_t, uint32_t> test1;
+
+			// Max load factors that are 0, negative or near 0 must be raised to the min instead of growing the table forever
+			test1.max_load_factor(0.f);
+			float32_t test1Result1 = test1.max_load_factor();
+			test1.max_load_factor(-1.f);
+			float32_t test1Result2 = test1.max_load_factor();
+			test1.max_load_factor(1e-30f);
+			float32_t test1Result3 = test1.max_load_factor();
+
+			for(uint32_t i = 0; i != 100; ++i)
+				test1[i] = i;
+
+			UnitTest& unitTest1 = unitTestList.unitTests[unitTestList.unitTestCount++];
+
+			unitTest1.name = "max_load_factor 1";
+			unitTest1.FormatResult("%i %i %i %llu %i", (int32_t)(test1Result1 == test1.MIN_LOAD_FACTOR), (int32_t)(test1Result2 == test1.MIN_LOAD_FACTOR), (int32_t)(test1Result3 == test1.MIN_LOAD_FACTOR), (unsigned long long)test1.size(), (int32_t)(test1.load_factor() <= test1.MIN_LOAD_FACTOR));
+			unitTest1.wantedResult = "1 1 1 100 1";
+		}
+		/* Test erase while iterating */ {
+			// Test 1
+			flat_unordered_map<uint32_t, uint32_t> test1;
+			for(uint32_t i = 0; i != 1000; ++i)
+				test1[i] = i * 3;
+
+			// Erase every odd key through the iterator returned by erase
+			for(auto iter = test1.begin(); iter != test1.end(); ) {
+				if(iter->first & 1)
+					iter = test1.erase(iter);
+				else
+					++iter;
+			}
+
+			size_t test1Result1 = 0;
+			uint64_t test1Result2 = 0;
+			for(const auto& val : test1) {
+				++test1Result1;
+				test1Result2 += val.second;
+			}
+
+			UnitTest& unitTest1 = unitTestList.unitTests[unitTestList.unitTestCount++];
+
+			unitTest1.name = "erase while iterating 1";
+			unitTest1.FormatResult("%llu %llu %llu", (unsigned long long)test1Result1, (unsigned long long)test1Result2, (unsigned long long)test1.size());
+			unitTest1.wantedResult = "500 748500 500";
+		}
+		/* Test random operations */ {
+			// Test 1
+			flat_unordered_map<uint32_t, uint32_t> test1;
+			std::unordered_map<uint32_t, uint32_t> test1Wanted;
+
+			// Insert, erase and find random keys from a small range, which leaves many deleted slots behind
+			size_t test1Mismatches = 0;
+			uint32_t seed = 1;
+			for(uint32_t i = 0; i != 200000; ++i) {
+				seed = seed * 1664525u + 1013904223u;
+				uint32_t key = (seed >> 8) % 3000;
+
+				switch((seed >> 4) & 3) {
+				case 0:
+				case 1:
+					test1[key] = i;
+					test1Wanted[key] = i;
+					break;
+				case 2:
+					test1Mismatches += test1.erase(key) != test1Wanted.erase(key);
+					break;
+				default:
+					auto iter = test1.find(key);
+					auto wantedIter = test1Wanted.find(key);
+					test1Mismatches += (iter == test1.end()) != (wantedIter == test1Wanted.end()) || (iter != test1.end() && iter->second != wantedIter->second);
+					break;
+				}
+			}
+
+			// Every value must be reached exactly once while iterating
+			size_t test1Count = 0;
+			for(const auto& val : test1) {
+				++test1Count;
+				test1Mismatches += !test1Wanted.count(val.first) || test1Wanted[val.first] != val.second;
+			}
+
+			UnitTest& unitTest1 = unitTestList.unitTests[unitTestList.unitTestCount++];
+
+			unitTest1.name = "random operations 1";
+			unitTest1.FormatResult("%llu %u %u", (unsigned long long)test1Mismatches, test1Count == test1Wanted.size(), test1.size() == test1Wanted.size());
+			unitTest1.wantedResult = "0 1 1";
+		}
+		/* Test copy */ {
+			// Test 1
+			flat_unordered_map<string, uint32_t> test1;
+			char_t key[32];
+			for(uint32_t i = 0; i != 100; ++i) {
+				FormatString(key, sizeof(key), "key%u", i);
+				test1[key] = i;
+			}
+
+			flat_unordered_map<string, uint32_t> test1Copy = test1;
+			test1.clear();
+
+			flat_unordered_map<string, uint32_t> test1Moved;
+			test1Moved = (flat_unordered_map<string, uint32_t>&&)test1Copy;
+
+			uint32_t test1Result1 = test1Moved.at("key42");
+			size_t test1Result2 = test1Moved.size();
+			size_t test1Result3 = test1.size() + test1Copy.size();
+
+			UnitTest& unitTest1 = unitTestList.unitTests[unitTestList.unitTestCount++];
+
+			unitTest1.name = "copy 1";
+			unitTest1.FormatResult("%u %llu %llu", test1Result1, (unsigned long long)test1Result2, (unsigned long long)test1Result3);
+			unitTest1.wantedResult = "42 100 0";
+		}
+		/* Test heterogeneous lookup */ {
+			// Test 1
+			flat_unordered_map<string, uint32_t> test1 { { "albedo", 1 }, { "normal", 2 }, { "roughness", 3 } };
+			const char_t* test1Path = "textures/normal.png";
+			string_view test1View(test1Path + 9, 6);
+
+			// Look for keys given as C strings and views into other strings, none of which are converted to strings
+			uint32_t test1Result1 = test1.find(test1View)->second;
+			size_t test1Result2 = test1.count("roughness") + test1.count(string_view("rough"));
+			uint32_t test1Result3 = test1.at(string_view(test1Path + 9, 6));
+			size_t test1Result4 = test1.erase("albedo") + test1.erase(string_view("albedo"));
+
+			UnitTest& unitTest1 = unitTestList.unitTests[unitTestList.unitTestCount++];
+
+			unitTest1.name = "heterogeneous lookup 1";
+			unitTest1.FormatResult("%u %llu %u %llu %llu", test1Result1, (unsigned long long)test1Result2, test1Result3, (unsigned long long)test1Result4, (unsigned long long)test1.size());
+			unitTest1.wantedResult = "2 1 2 1 2";
+		}
+		/* Test find_with_hash */ {
+			// Test 1
+			flat_unordered_map<string, uint32_t> test1Engine { { "Transform", 1 }, { "Mesh", 2 } };
+			flat_unordered_map<string, uint32_t> test1Game;
+			const char_t* test1Keys[] { "Transform", "Mesh", "Player", "Enemy" };
+
+			// Hash every key once, then use the same hash to probe both maps and insert into one of them
+			size_t test1EngineHits = 0, test1Inserted = 0;
+			for(uint32_t i = 0; i != 4; ++i) {
+				uint64_t hash = Hash<string>()(test1Keys[i]);
+				if(test1Engine.find_with_hash(test1Keys[i], hash) != test1Engine.end())
+					++test1EngineHits;
+				else
+					test1Inserted += test1Game.insert_with_hash({ test1Keys[i], i }, hash).second;
+			}
+
+			uint32_t test1Result = test1Game.find_with_hash(string("Enemy"), Hash<string>()("Enemy"))->second;
+
+			UnitTest& unitTest1 = unitTestList.unitTests[unitTestList.unitTestCount++];
+
+			unitTest1.name = "find_with_hash 1";
+			unitTest1.FormatResult("%llu %llu %u %u", (unsigned long long)test1EngineHits, (unsigned long long)test1Inserted, test1Result, test1Game.at("Player"));
+			unitTest1.wantedResult = "2 2 3 2";
+		}
+	}
+
+	WFE_ADD_UNIT_TEST_CALLBACK(FlatUnorderedMapUnitTestCallback)
+}
\ No newline at end of file
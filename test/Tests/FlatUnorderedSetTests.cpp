@@ -0,0 +1,184 @@
+#include "UnitTests.hpp"
+
+namespace wfe {
+	void FlatUnorderedSetUnitTestCallback(UnitTestList& unitTestList) {
+		unitTestList.name = "Flat unordered set";
+		
+		/* Test find */ {
+			// Test 1
+			flat_unordered_set<int32_t> test1{ 1, 3, 5, 7, 9 };
+
+			auto test1Result1 = test1.find(5);
+			auto test1Result2 = test1.find(9);
+			int32_t test1Result3 = (test1.find(2) == test1.end()) ? 1 : 0;
+
+			UnitTest& unitTest1 = unitTestList.unitTests[unitTestList.unitTestCount++];
+
+			unitTest1.name = "find 1";
+			unitTest1.FormatResult("%i %i %i", *test1Result1, *test1Result2, test1Result3);
+			unitTest1.wantedResult = "5 9 1";
+		}
+		/* Test count */ {
+			// Test 1
+			flat_unordered_set<int32_t> test1{ 1, 2, 3, 4, 5 };
+
+			size_t test1Result1 = test1.count(4);
+			size_t test1Result2 = test1.count(0);
+			size_t test1Result3 = test1.count(2);
+
+			UnitTest& unitTest1 = unitTestList.unitTests[unitTestList.unitTestCount++];
+
+			unitTest1.name = "count 1";
+			unitTest1.FormatResult("%llu %llu %llu", (unsigned long long)test1Result1, (unsigned long long)test1Result2, (unsigned long long)test1Result3);
+			unitTest1.wantedResult = "1 0 1";
+		}
+		/* Test equal_range */ {
+			// Test 1
+			flat_unordered_set<int32_t> test1{ 2, 4, 6, 8, 10 };
+
+			auto test1Result1 = test1.equal_range(4);
+			int32_t test1Result2 = (test1.equal_range(1).first == test1.end()) ? 1 : 0;
+
+			UnitTest& unitTest1 = unitTestList.unitTests[unitTestList.unitTestCount++];
+
+			unitTest1.name = "equal_range 1";
+			unitTest1.FormatResult("%i %i", *test1Result1.first, test1Result2);
+			unitTest1.wantedResult = "4 1";
+		}
+		/* Test insert */ {
+			// Test 1
+			flat_unordered_set<int32_t> test1{ 1, 2, 3 };
+
+			test1.insert(5);
+			test1.insert({ 4, 5, 6 });
+
+			int32_t test1Result1 = (test1.find(4) != test1.end()) ? 1 : 0;
+			int32_t test1Result2 = (test1.find(5) != test1.end()) ? 1 : 0;
+			int32_t test1Result3 = (test1.find(6) != test1.end()) ? 1 : 0;
+			size_t test1Result4 = test1.size();
+
+			UnitTest& unitTest1 = unitTestList.unitTests[unitTestList.unitTestCount++];
+
+			unitTest1.name = "insert 1";
+			unitTest1.FormatResult("%i %i %i %llu", test1Result1, test1Result2, test1Result3, (unsigned long long)test1Result4);
+			unitTest1.wantedResult = "1 1 1 6";
+		}
+		/* Test erase */ {
+			// Test 1
+			flat_unordered_set<int32_t> test1{ 1, 2, 3, 4, 5, 6, 7, 8, 9, 10 };
+
+			test1.erase(test1.find(4));
+			
+			auto test1Iter1 = test1.find(5);
+			auto test1Iter2 = test1Iter1++;
+
+			test1.erase(test1Iter2, test1Iter1);
+
+			test1.erase(2);
+
+			int32_t test1Result1 = (test1.find(4) == test1.end()) ? 1 : 0;
+			int32_t test1Result2 = (test1.find(5) == test1.end()) ? 1 : 0;
+			int32_t test1Result3 = (test1.find(2) == test1.end()) ? 1 : 0;
+			size_t test1Result4 = test1.size();
+
+			UnitTest& unitTest1 = unitTestList.unitTests[unitTestList.unitTestCount++];
+
+			unitTest1.name = "erase 1";
+			unitTest1.FormatResult("%i %i %i %llu", test1Result1, test1Result2, test1Result3, (unsigned long long)test1Result4);
+			unitTest1.wantedResult = "1 1 1 7";
+		}
+		/* Test rehash */ {
+			// Test 1
+			flat_unordered_set<int32_t> test1{ 1, 2, 3, 4, 5 };
+
+			test1.rehash(3);
+
+			int32_t test1Result1 = (test1.find(1) != test1.end()) ? 1 : 0;
+			int32_t test1Result2 = (test1.find(2) != test1.end()) ? 1 : 0;
+			int32_t test1Result3 = (test1.find(3) != test1.end()) ? 1 : 0;
+			int32_t test1Result4 = (test1.find(4) != test1.end()) ? 1 : 0;
+			int32_t test1Result5 = (test1.find(5) != test1.end()) ? 1 : 0;
+
+			UnitTest& unitTest1 = unitTestList.unitTests[unitTestList.unitTestCount++];
+
+			unitTest1.name = "rehash 1";
+			unitTest1.FormatResult("%i %i %i %i %i", test1Result1, test1Result2, test1Result3, test1Result4, test1Result5);
+			unitTest1.wantedResult = "1 1 1 1 1";
+		}
+		/* Test max_load_factor */ {
+			// Test 1
+			flat_unordered_set<uint32_t> test1;
+
+			// Max load factors that are 0, negative or near 0 must be raised to the min instead of growing the table forever
+			test1.max_load_factor(0.f);
+			float32_t test1Result1 = test1.max_load_factor();
+			test1.max_load_factor(-1.f);
+			float32_t test1Result2 = test1.max_load_factor();
+			test1.max_load_factor(1e-30f);
+			float32_t test1Result3 = test1.max_load_factor();
+
+			for(uint32_t i = 0; i != 100; ++i)
+				test1.insert(i);
+
+			UnitTest& unitTest1 = unitTestList.unitTests[unitTestList.unitTestCount++];
+
+			unitTest1.name = "max_load_factor 1";
+			unitTest1.FormatResult("%i %i %i %llu %i", (int32_t)(test1Result1 == test1.MIN_LOAD_FACTOR), (int32_t)(test1Result2 == test1.MIN_LOAD_FACTOR), (int32_t)(test1Result3 == test1.MIN_LOAD_FACTOR), (unsigned long long)test1.size(), (int32_t)(test1.load_factor() <= test1.MIN_LOAD_FACTOR));
+			unitTest1.wantedResult = "1 1 1 100 1";
+		}
+		/* Test random operations */ {
+			// Test 1
+			flat_unordered_set<uint32_t> test1;
+			std::unordered_set<uint32_t> test1Wanted;
+
+			// Insert, erase and find random values from a small range, which leaves many deleted slots behind
+			size_t test1Mismatches = 0;
+			uint32_t seed = 1;
+			for(uint32_t i = 0; i != 200000; ++i) {
+				seed = seed * 1664525u + 1013904223u;
+				uint32_t val = (seed >> 8) % 3000;
+
+				switch((seed >> 4) & 3) {
+				case 0:
+				case 1:
+					test1Mismatches += test1.insert(val).second != test1Wanted.insert(val).second;
+					break;
+				case 2:
+					test1Mismatches += test1.erase(val) != test1Wanted.erase(val);
+					break;
+				default:
+					test1Mismatches += test1.count(val) != test1Wanted.count(val);
+					break;
+				}
+			}
+
+			// The set must convert to an identical std library set
+			std::unordered_set<uint32_t> test1Converted = test1;
+
+			UnitTest& unitTest1 = unitTestList.unitTests[unitTestList.unitTestCount++];
+
+			unitTest1.name = "random operations 1";
+			unitTest1.FormatResult("%llu %u", (unsigned long long)test1Mismatches, test1Converted == test1Wanted);
+			unitTest1.wantedResult = "0 1";
+		}
+		/* Test heterogeneous lookup */ {
+			// Test 1
+			flat_unordered_set<string> test1 { "albedo", "normal", "roughness" };
+			const char_t* test1Path = "textures/normal.png";
+
+			// Look for values given as C strings and views into other strings, then probe with a precomputed hash
+			size_t test1Result1 = test1.count(string_view(test1Path + 9, 6)) + test1.count("roughness") + test1.count(string_view(test1Path, 8));
+			uint64_t test1Hash = Hash<string>()("metallic");
+			size_t test1Result2 = test1.insert_with_hash("metallic", test1Hash).second + (test1.find_with_hash("metallic", test1Hash) != test1.end());
+			size_t test1Result3 = test1.erase("albedo") + test1.erase(string_view("albedo"));
+
+			UnitTest& unitTest1 = unitTestList.unitTests[unitTestList.unitTestCount++];
+
+			unitTest1.name = "heterogeneous lookup 1";
+			unitTest1.FormatResult("%llu %llu %llu %llu", (unsigned long long)test1Result1, (unsigned long long)test1Result2, (unsigned long long)test1Result3, (unsigned long long)test1.size());
+			unitTest1.wantedResult = "2 2 1 3";
+		}
+	}
+
+	WFE_ADD_UNIT_TEST_CALLBACK(FlatUnorderedSetUnitTestCallback)
+}
\ No newline at end of file
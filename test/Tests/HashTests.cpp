@@ -0,0 +1,233 @@
+#include "UnitTests.hpp"
+#include <stdlib.h>
+
+namespace wfe {
+	static const size_t HASH_TEST_BUFFER_SIZE = 5000;
+	static const size_t HASH_TEST_SPARSE_SIZE = 64;
+	static const size_t HASH_TEST_BUCKET_COUNT = 65536;
+
+	static void HashTestFill(uint8_t* buffer, size_t size, uint32_t seed) {
+		// Fill the buffer with pseudo-random bytes
+		for(size_t i = 0; i != size; ++i) {
+			seed = seed * 1664525u + 1013904223u;
+			buffer[i] = (uint8_t)(seed >> 24);
+		}
+	}
+	static int HashTestCompare(const void* val1, const void* val2) {
+		uint64_t hash1 = *(const uint64_t*)val1, hash2 = *(const uint64_t*)val2;
+		return (hash1 > hash2) - (hash1 < hash2);
+	}
+	static size_t HashTestCountCollisions(uint64_t* hashes, size_t count) {
+		// Sort the hashes and count every hash equal to the previous one
+		qsort(hashes, count, sizeof(uint64_t), HashTestCompare);
+
+		size_t collisionCount = 0;
+		for(size_t i = 1; i < count; ++i)
+			collisionCount += hashes[i] == hashes[i - 1];
+
+		return collisionCount;
+	}
+	static bool8_t HashTestAvalanche(size_t size, size_t bitStep, size_t sampleCount) {
+		// Count how often every output bit flips when a single input bit is flipped
+		uint8_t* buffer = (uint8_t*)AllocMemory(size);
+		size_t bitCount = size << 3;
+		size_t testedBitCount = (bitCount + bitStep - 1) / bitStep;
+		uint32_t* flipCounts = (uint32_t*)AllocMemory(testedBitCount * 64 * sizeof(uint32_t));
+		memset(flipCounts, 0, testedBitCount * 64 * sizeof(uint32_t));
+
+		for(size_t sample = 0; sample != sampleCount; ++sample) {
+			HashTestFill(buffer, size, (uint32_t)sample * 2654435761u + 1);
+			uint64_t hash = HashMemory(buffer, size);
+
+			for(size_t bit = 0, tested = 0; bit < bitCount; bit += bitStep, ++tested) {
+				buffer[bit >> 3] ^= (uint8_t)(1 << (bit & 7));
+				uint64_t diff = hash ^ HashMemory(buffer, size);
+				buffer[bit >> 3] ^= (uint8_t)(1 << (bit & 7));
+
+				for(size_t out = 0; out != 64; ++out)
+					flipCounts[tested * 64 + out] += (uint32_t)((diff >> out) & 1);
+			}
+		}
+
+		// Find the largest deviation from a flip probability of one half
+		float32_t maxBias = 0;
+		for(size_t i = 0; i != testedBitCount * 64; ++i) {
+			float32_t bias = (float32_t)flipCounts[i] / (float32_t)sampleCount - 0.5f;
+			if(bias < 0)
+				bias = -bias;
+			if(bias > maxBias)
+				maxBias = bias;
+		}
+
+		FreeMemory(flipCounts);
+		FreeMemory(buffer);
+
+		// Allow a deviation of six standard deviations of a fair coin, which a good hash never exceeds by chance
+		return maxBias < 3.f / Sqrt((float32_t)sampleCount);
+	}
+
+	void HashUnitTestCallback(UnitTestList& unitTestList) {
+		unitTestList.name = "Hash";
+
+		/* Test HashMemory */ {
+			// Test 1
+			uint8_t* test1Buffer = (uint8_t*)AllocMemory(HASH_TEST_BUFFER_SIZE);
+			HashTestFill(test1Buffer, HASH_TEST_BUFFER_SIZE, 1);
+
+			// Compare against known hashes, which must be the same on every platform and for every code path
+			const size_t test1Sizes[] { 0, 1, 3, 4, 7, 8, 9, 16, 17, 32, 48, 49, 64, 65, 1024, 1025, 1088, 2047, 4999, 5000 };
+			const uint64_t test1Hashes[] {
+				0x93228a4de0eec5a2, 0x8d5fce6ed99f64c0, 0xc1cd03534a2380e1, 0xb025fdf1fb5217ea, 0x57940b10f6b4d133,
+				0x4fa201cde75ec5ff, 0xaa341f665d3429c2, 0xfb5b6435c9cd2d03, 0xf600e8bd5e586641, 0x17eca929e51be8b7,
+				0xf2aa5d81c68fe5e2, 0x870f50e85dfe64f9, 0xc1b732f3f5d2814c, 0xadfbe64feff45066, 0x082554f72042ea45,
+				0x6a5763920ef36c03, 0x2931c7704ef1a193, 0xf0f83ede542e69ee, 0x2c987055adb2faf6, 0x6f6d1e3f93e83db8
+			};
+
+			size_t test1Mismatches = 0;
+			for(size_t i = 0; i != sizeof(test1Sizes) / sizeof(size_t); ++i)
+				test1Mismatches += HashMemory(test1Buffer, test1Sizes[i], test1Sizes[i] == HASH_TEST_BUFFER_SIZE ? 42 : 0) != test1Hashes[i];
+
+			FreeMemory(test1Buffer);
+
+			UnitTest& unitTest1 = unitTestList.unitTests[unitTestList.unitTestCount++];
+
+			unitTest1.name = "HashMemory 1";
+			unitTest1.FormatResult("%llu", (unsigned long long)test1Mismatches);
+			unitTest1.wantedResult = "0";
+
+			// Test 2
+			uint8_t* test2Buffer = (uint8_t*)AllocMemory(HASH_TEST_BUFFER_SIZE);
+			memset(test2Buffer, 0, HASH_TEST_BUFFER_SIZE);
+
+			// Hash blocks of zeros of every length up to past the long block size, along with a few seeds, which must all differ
+			const size_t test2MaxSize = 1100;
+			uint64_t* test2Hashes = (uint64_t*)AllocMemory((test2MaxSize + 1 + 4) * sizeof(uint64_t));
+			for(size_t i = 0; i <= test2MaxSize; ++i)
+				test2Hashes[i] = HashMemory(test2Buffer, i);
+			for(size_t i = 0; i != 4; ++i)
+				test2Hashes[test2MaxSize + 1 + i] = HashMemory(test2Buffer, HASH_TEST_BUFFER_SIZE, i + 1);
+
+			size_t test2Collisions = HashTestCountCollisions(test2Hashes, test2MaxSize + 1 + 4);
+
+			FreeMemory(test2Hashes);
+			FreeMemory(test2Buffer);
+
+			UnitTest& unitTest2 = unitTestList.unitTests[unitTestList.unitTestCount++];
+
+			unitTest2.name = "HashMemory 2";
+			unitTest2.FormatResult("%llu", (unsigned long long)test2Collisions);
+			unitTest2.wantedResult = "0";
+
+			// Test 3
+			// Hash every 64 byte key with up to two bits set, which must all differ
+			const size_t test3BitCount = HASH_TEST_SPARSE_SIZE << 3;
+			const size_t test3KeyCount = 1 + test3BitCount + test3BitCount * (test3BitCount - 1) / 2;
+			uint64_t* test3Hashes = (uint64_t*)AllocMemory(test3KeyCount * sizeof(uint64_t));
+			uint8_t test3Key[HASH_TEST_SPARSE_SIZE];
+			memset(test3Key, 0, HASH_TEST_SPARSE_SIZE);
+
+			size_t test3Count = 0;
+			test3Hashes[test3Count++] = HashMemory(test3Key, HASH_TEST_SPARSE_SIZE);
+			for(size_t i = 0; i != test3BitCount; ++i) {
+				test3Key[i >> 3] ^= (uint8_t)(1 << (i & 7));
+				test3Hashes[test3Count++] = HashMemory(test3Key, HASH_TEST_SPARSE_SIZE);
+
+				for(size_t j = i + 1; j != test3BitCount; ++j) {
+					test3Key[j >> 3] ^= (uint8_t)(1 << (j & 7));
+					test3Hashes[test3Count++] = HashMemory(test3Key, HASH_TEST_SPARSE_SIZE);
+					test3Key[j >> 3] ^= (uint8_t)(1 << (j & 7));
+				}
+
+				test3Key[i >> 3] ^= (uint8_t)(1 << (i & 7));
+			}
+
+			size_t test3Collisions = HashTestCountCollisions(test3Hashes, test3Count);
+
+			FreeMemory(test3Hashes);
+
+			UnitTest& unitTest3 = unitTestList.unitTests[unitTestList.unitTestCount++];
+
+			unitTest3.name = "HashMemory 3";
+			unitTest3.FormatResult("%llu %llu", (unsigned long long)test3Count, (unsigned long long)test3Collisions);
+			unitTest3.wantedResult = "131329 0";
+
+			// Test 4
+			// Flipping any input bit must flip every output bit with a probability close to one half, for short, medium and long blocks
+			bool8_t test4Short = HashTestAvalanche(16, 1, 2000);
+			bool8_t test4Medium = HashTestAvalanche(100, 1, 1000);
+			bool8_t test4Long = HashTestAvalanche(2048, 61, 500);
+
+			UnitTest& unitTest4 = unitTestList.unitTests[unitTestList.unitTestCount++];
+
+			unitTest4.name = "HashMemory 4";
+			unitTest4.FormatResult("%u %u %u", test4Short, test4Medium, test4Long);
+			unitTest4.wantedResult = "1 1 1";
+		}
+		/* Test Hash */ {
+			// Test 1
+			string test1Str = "assets/textures/albedo.png";
+			const char_t* test1CStr = test1Str.c_str();
+
+			UnitTest& unitTest1 = unitTestList.unitTests[unitTestList.unitTestCount++];
+
+			unitTest1.name = "Hash 1";
+			unitTest1.FormatResult("%u %u", Hash<string>()(test1Str) == Hash<const char_t*>()(test1CStr), Hash<string>()(test1Str) == HashMemory(test1CStr, test1Str.length()));
+			unitTest1.wantedResult = "1 1";
+
+			// Test 2
+			uint32_t* test2Buckets = (uint32_t*)AllocMemory(HASH_TEST_BUCKET_COUNT * sizeof(uint32_t));
+			uint32_t test2TopBuckets[128];
+			uint32_t test2MaxLoads[2];
+			uint32_t test2MaxTopLoads[2];
+
+			// Distribute sequential integers and similar strings into buckets by both the low bits and the top 7 bits, like hash tables do
+			for(size_t i = 0; i != 2; ++i) {
+				memset(test2Buckets, 0, HASH_TEST_BUCKET_COUNT * sizeof(uint32_t));
+				memset(test2TopBuckets, 0, sizeof(test2TopBuckets));
+
+				char_t key[32];
+				for(uint32_t j = 0; j != HASH_TEST_BUCKET_COUNT; ++j) {
+					uint64_t hash;
+					if(i) {
+						FormatString(key, sizeof(key), "key%u", j);
+						hash = Hash<const char_t*>()(key);
+					} else {
+						hash = Hash<uint32_t>()(j);
+					}
+
+					++test2Buckets[hash & (HASH_TEST_BUCKET_COUNT - 1)];
+					++test2TopBuckets[hash >> 57];
+				}
+
+				test2MaxLoads[i] = 0;
+				for(size_t j = 0; j != HASH_TEST_BUCKET_COUNT; ++j)
+					if(test2Buckets[j] > test2MaxLoads[i])
+						test2MaxLoads[i] = test2Buckets[j];
+
+				test2MaxTopLoads[i] = 0;
+				for(size_t j = 0; j != 128; ++j)
+					if(test2TopBuckets[j] > test2MaxTopLoads[i])
+						test2MaxTopLoads[i] = test2TopBuckets[j];
+			}
+
+			FreeMemory(test2Buckets);
+
+			// A uniform hash puts at most about 10 keys in a bucket and 512 + 4 standard deviations in a top bucket
+			UnitTest& unitTest2 = unitTestList.unitTests[unitTestList.unitTestCount++];
+
+			unitTest2.name = "Hash 2";
+			unitTest2.FormatResult("%u %u %u %u", test2MaxLoads[0] <= 12, test2MaxLoads[1] <= 12, test2MaxTopLoads[0] <= 604, test2MaxTopLoads[1] <= 604);
+			unitTest2.wantedResult = "1 1 1 1";
+
+			// Test 3
+			// Integers are hashed with the SplitMix64 finalizer, whose outputs are known
+			UnitTest& unitTest3 = unitTestList.unitTests[unitTestList.unitTestCount++];
+
+			unitTest3.name = "Hash 3";
+			unitTest3.FormatResult("%llx %llx", (unsigned long long)Hash<uint64_t>()(0), (unsigned long long)Hash<uint64_t>()(0x9e3779b97f4a7c15));
+			unitTest3.wantedResult = "e220a8397b1dcdaf 6e789e6aa1b965f4";
+		}
+	}
+
+	WFE_ADD_UNIT_TEST_CALLBACK(HashUnitTestCallback)
+}
\ No newline at end of file
@@ -0,0 +1,257 @@
+#include "UnitTests.hpp"
+
+namespace wfe {
+	static void* JobTestSquare(void* args) {
+		size_t val = (size_t)args;
+		return (void*)(val * val);
+	}
+
+	struct JobTestNestedArgs {
+		JobManager* manager;
+		JobManager::Result results[8];
+	};
+
+	static void* JobTestNested(void* args) {
+		// Submit multiple jobs from inside the current job and sum their results
+		JobTestNestedArgs* nestedArgs = (JobTestNestedArgs*)args;
+
+		for(size_t i = 0; i != 8; ++i)
+			nestedArgs->manager->SubmitJob(JobTestSquare, (void*)(i + 1), nestedArgs->results[i]);
+
+		size_t sum = 0;
+		for(size_t i = 0; i != 8; ++i) {
+			void* result;
+			nestedArgs->results[i].WaitForResult(&result);
+			sum += (size_t)result;
+		}
+
+		return (void*)sum;
+	}
+
+	struct JobTestGraphArgs {
+		atomic_size_t* counter;
+		size_t order;
+	};
+
+	static void* JobTestGraphNode(void* args) {
+		// Return the order in which the node was run
+		JobTestGraphArgs* graphArgs = (JobTestGraphArgs*)args;
+		graphArgs->order = graphArgs->counter->fetch_add(1);
+
+		return nullptr;
+	}
+
+	static void* JobTestIncrement(void* args) {
+		((atomic_size_t*)args)->fetch_add(1);
+		return nullptr;
+	}
+
+	void JobUnitTestCallback(UnitTestList& unitTestList) {
+		unitTestList.name = "Job";
+
+		/* Test SubmitJob */ {
+			// Test 1
+			JobManager test1Manager(4);
+			JobManager::Result test1Results[256];
+
+			for(size_t i = 0; i != 256; ++i)
+				test1Manager.SubmitJob(JobTestSquare, (void*)i, test1Results[i]);
+
+			size_t test1Sum = 0;
+			for(size_t i = 0; i != 256; ++i) {
+				void* result;
+				test1Results[i].WaitForResult(&result);
+				test1Sum += (size_t)result;
+			}
+
+			UnitTest& unitTest1 = unitTestList.unitTests[unitTestList.unitTestCount++];
+
+			unitTest1.name = "SubmitJob 1";
+			unitTest1.FormatResult("%llu", (unsigned long long)test1Sum);
+			unitTest1.wantedResult = "5559680";
+
+			// Test 2
+			JobManager test2Manager(2);
+			JobTestNestedArgs test2Args;
+			test2Args.manager = &test2Manager;
+			JobManager::Result test2Result;
+
+			test2Manager.SubmitJob(JobTestNested, &test2Args, test2Result);
+
+			void* test2Sum;
+			test2Result.WaitForResult(&test2Sum);
+
+			UnitTest& unitTest2 = unitTestList.unitTests[unitTestList.unitTestCount++];
+
+			unitTest2.name = "SubmitJob 2";
+			unitTest2.FormatResult("%llu", (unsigned long long)(size_t)test2Sum);
+			unitTest2.wantedResult = "204";
+
+			// Test 3
+			JobManager test3Manager(1, true);
+			JobManager::Result test3Result;
+
+			test3Manager.SubmitJob(JobTestSquare, (void*)9, test3Result);
+
+			void* test3Value;
+			test3Result.WaitForResult(&test3Value);
+
+			UnitTest& unitTest3 = unitTestList.unitTests[unitTestList.unitTestCount++];
+
+			unitTest3.name = "SubmitJob 3";
+			unitTest3.FormatResult("%llu", (unsigned long long)(size_t)test3Value);
+			unitTest3.wantedResult = "81";
+		}
+		/* Test SubmitJobs */ {
+			// Test 1
+			JobManager test1Manager(4);
+			JobManager::JobFunction test1Funcs[100];
+			void* test1Args[100];
+			JobManager::Result test1Results[100];
+
+			for(size_t i = 0; i != 100; ++i) {
+				test1Funcs[i] = JobTestSquare;
+				test1Args[i] = (void*)i;
+			}
+
+			test1Manager.SubmitJobs(100, test1Funcs, test1Args, test1Results);
+
+			size_t test1Sum = 0;
+			for(size_t i = 0; i != 100; ++i) {
+				void* result;
+				test1Results[i].WaitForResult(&result);
+				test1Sum += (size_t)result;
+			}
+
+			UnitTest& unitTest1 = unitTestList.unitTests[unitTestList.unitTestCount++];
+
+			unitTest1.name = "SubmitJobs 1";
+			unitTest1.FormatResult("%llu", (unsigned long long)test1Sum);
+			unitTest1.wantedResult = "328350";
+		}
+		/* Test SubmitJob with dependencies */ {
+			// Test 1
+			JobManager test1Manager(4);
+			atomic_size_t test1Counter = 0;
+			JobTestGraphArgs test1Args[4];
+			JobManager::Result test1Results[4];
+
+			for(size_t i = 0; i != 4; ++i)
+				test1Args[i].counter = &test1Counter;
+
+			JobManager::Result* test1MiddleDependencies[] { test1Results };
+			JobManager::Result* test1LastDependencies[] { test1Results + 1, test1Results + 2 };
+
+			test1Manager.SubmitJob(JobTestGraphNode, test1Args, test1Results[0]);
+			test1Manager.SubmitJob(JobTestGraphNode, test1Args + 1, test1Results[1], 1, test1MiddleDependencies);
+			test1Manager.SubmitJob(JobTestGraphNode, test1Args + 2, test1Results[2], 1, test1MiddleDependencies);
+			test1Manager.SubmitJob(JobTestGraphNode, test1Args + 3, test1Results[3], 2, test1LastDependencies);
+
+			test1Results[3].WaitForResult();
+
+			bool8_t test1Ordered = test1Args[0].order == 0 && test1Args[1].order < 3 && test1Args[2].order < 3 && test1Args[3].order == 3;
+
+			UnitTest& unitTest1 = unitTestList.unitTests[unitTestList.unitTestCount++];
+
+			unitTest1.name = "SubmitJob with dependencies 1";
+			unitTest1.FormatResult("%i", (int32_t)test1Ordered);
+			unitTest1.wantedResult = "1";
+		}
+		/* Test SubmitContinuation */ {
+			// Test 1
+			JobManager test1Manager(2);
+			JobManager::Result test1First, test1Continuation;
+
+			test1Manager.SubmitJob(JobTestSquare, (void*)3, test1First);
+
+			void* test1FirstValue;
+			test1First.WaitForResult(&test1FirstValue);
+
+			test1Manager.SubmitContinuation(test1First, JobTestSquare, test1FirstValue, test1Continuation);
+
+			void* test1Value;
+			test1Continuation.WaitForResult(&test1Value);
+
+			UnitTest& unitTest1 = unitTestList.unitTests[unitTestList.unitTestCount++];
+
+			unitTest1.name = "SubmitContinuation 1";
+			unitTest1.FormatResult("%llu", (unsigned long long)(size_t)test1Value);
+			unitTest1.wantedResult = "81";
+		}
+		/* Test ParallelFor */ {
+			// Test 1
+			JobManager test1Manager(4);
+			vector<uint32_t> test1Values(10000);
+
+			test1Manager.ParallelFor(0, test1Values.size(), 0, [&](size_t i) {
+				test1Values[i] = (uint32_t)(i * 3);
+			});
+
+			size_t test1Correct = 0;
+			for(size_t i = 0; i != test1Values.size(); ++i)
+				test1Correct += test1Values[i] == i * 3;
+
+			UnitTest& unitTest1 = unitTestList.unitTests[unitTestList.unitTestCount++];
+
+			unitTest1.name = "ParallelFor 1";
+			unitTest1.FormatResult("%llu", (unsigned long long)test1Correct);
+			unitTest1.wantedResult = "10000";
+		}
+		/* Test ParallelReduce */ {
+			// Test 1
+			JobManager test1Manager(4);
+
+			uint64_t test1Sum = test1Manager.ParallelReduce<uint64_t>(1, 100001, 64, 0, [](size_t i) {
+				return (uint64_t)i;
+			}, [](uint64_t a, uint64_t b) {
+				return a + b;
+			});
+
+			UnitTest& unitTest1 = unitTestList.unitTests[unitTestList.unitTestCount++];
+
+			unitTest1.name = "ParallelReduce 1";
+			unitTest1.FormatResult("%llu", (unsigned long long)test1Sum);
+			unitTest1.wantedResult = "5000050000";
+		}
+		/* Test GetResult */ {
+			// Test 1
+			JobManager test1Manager(1);
+			JobManager::Result test1Result;
+
+			test1Manager.SubmitJob(JobTestSquare, (void*)7, test1Result);
+
+			void* test1Value;
+			while(!test1Result.GetResult(&test1Value));
+
+			bool8_t test1Retrieved = test1Result.GetResult();
+
+			UnitTest& unitTest1 = unitTestList.unitTests[unitTestList.unitTestCount++];
+
+			unitTest1.name = "GetResult 1";
+			unitTest1.FormatResult("%llu %i", (unsigned long long)(size_t)test1Value, (int32_t)test1Retrieved);
+			unitTest1.wantedResult = "49 0";
+		}
+		/* Test ~JobManager */ {
+			// Test 1
+			atomic_size_t test1Counter = 0;
+			JobManager::Result* test1Results = NewArray<JobManager::Result>(1024);
+
+			{
+				// Destroy the manager right after submitting the jobs, which must all run before the workers exit
+				JobManager test1Manager(4);
+				for(size_t i = 0; i != 1024; ++i)
+					test1Manager.SubmitJob(JobTestIncrement, &test1Counter, test1Results[i]);
+			}
+
+			DestroyArray(test1Results, 1024);
+
+			UnitTest& unitTest1 = unitTestList.unitTests[unitTestList.unitTestCount++];
+
+			unitTest1.name = "~JobManager 1";
+			unitTest1.FormatResult("%llu", (unsigned long long)test1Counter.load());
+			unitTest1.wantedResult = "1024";
+		}
+	}
+
+	WFE_ADD_UNIT_TEST_CALLBACK(JobUnitTestCallback)
+}
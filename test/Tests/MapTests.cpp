@@ -140,6 +140,73 @@ namespace wfe {
 			unitTest1.FormatResult("%llu %llu", (unsigned long long)test1Result1, (unsigned long long)test1Result2);
 			unitTest1.wantedResult = "2 3";
 		}
+		/* Test assign_unsorted */ {
+			// Test 1
+			pair<int32_t, const char_t*> test1Pairs[] { { 3, "three" }, { 1, "one" }, { 2, "two" }, { 3, "other three" }, { 0, "zero" }, { 1, "other one" } };
+			map<int32_t, const char_t*> test1 = { { 7, "seven" } };
+
+			test1.assign_unsorted(test1Pairs, test1Pairs + 6);
+
+			UnitTest& unitTest1 = unitTestList.unitTests[unitTestList.unitTestCount++];
+
+			unitTest1.name = "assign_unsorted 1";
+			unitTest1.FormatResult("%llu %s %s %s %s", (unsigned long long)test1.size(), test1.begin()->second, (test1.begin() + 1)->second, (test1.begin() + 2)->second, (test1.begin() + 3)->second);
+			unitTest1.wantedResult = "4 zero one two three";
+		}
+		/* Test insert_range */ {
+			// Test 1
+			pair<int32_t, const char_t*> test1Pairs[] { { 6, "six" }, { 2, "other two" }, { 4, "four" }, { 6, "other six" }, { 0, "zero" } };
+			map<int32_t, const char_t*> test1 = { { 1, "one" }, { 2, "two" }, { 5, "five" } };
+
+			test1.insert_range(test1Pairs, test1Pairs + 5);
+
+			UnitTest& unitTest1 = unitTestList.unitTests[unitTestList.unitTestCount++];
+
+			unitTest1.name = "insert_range 1";
+			unitTest1.FormatResult("%llu %s %s %s %s %s %s", (unsigned long long)test1.size(), test1.begin()->second, (test1.begin() + 1)->second, (test1.begin() + 2)->second, (test1.begin() + 3)->second, (test1.begin() + 4)->second, (test1.begin() + 5)->second);
+			unitTest1.wantedResult = "6 zero one two four five six";
+		}
+		/* Test merge */ {
+			// Test 1
+			map<int32_t, const char_t*> test1Map1 = { { 1, "one" }, { 3, "three" }, { 5, "five" } };
+			map<int32_t, const char_t*> test1Map2 = { { 2, "two" }, { 3, "other three" }, { 4, "four" } };
+
+			test1Map1.merge(test1Map2);
+
+			UnitTest& unitTest1 = unitTestList.unitTests[unitTestList.unitTestCount++];
+
+			unitTest1.name = "merge 1";
+			unitTest1.FormatResult("%llu %s %s %s %s %s %llu %s", (unsigned long long)test1Map1.size(), test1Map1.begin()->second, (test1Map1.begin() + 1)->second, (test1Map1.begin() + 2)->second, (test1Map1.begin() + 3)->second, (test1Map1.begin() + 4)->second, (unsigned long long)test1Map2.size(), test1Map2.begin()->second);
+			unitTest1.wantedResult = "5 one two three four five 1 other three";
+		}
+		/* Test freeze */ {
+			// Test 1
+			map<int32_t, int32_t> test1;
+			for(int32_t i = 0; i != 1000; ++i)
+				test1.insert({ i * 2, i });
+			
+			test1.freeze();
+
+			bool8_t test1Frozen = test1.is_frozen();
+			size_t test1Result1 = test1.lower_bound(501) - test1.begin();
+			size_t test1Result2 = test1.upper_bound(502) - test1.begin();
+			size_t test1Result3 = test1.lower_bound(1999) - test1.begin();
+			int32_t test1Result4 = test1.find(1234)->second;
+			bool8_t test1Result5 = test1.find(1235) == test1.end();
+
+			test1.erase(0);
+			test1[-1] = -1;
+
+			bool8_t test1Thawed = !test1.is_frozen();
+			int32_t test1Result6 = test1.begin()->second;
+			size_t test1Result7 = test1.lower_bound(501) - test1.begin();
+
+			UnitTest& unitTest1 = unitTestList.unitTests[unitTestList.unitTestCount++];
+
+			unitTest1.name = "freeze 1";
+			unitTest1.FormatResult("%i %llu %llu %llu %i %i %i %i %llu", (int32_t)test1Frozen, (unsigned long long)test1Result1, (unsigned long long)test1Result2, (unsigned long long)test1Result3, test1Result4, (int32_t)test1Result5, (int32_t)test1Thawed, test1Result6, (unsigned long long)test1Result7);
+			unitTest1.wantedResult = "1 251 252 1000 617 1 1 -1 251";
+		}
 	}
 
 	WFE_ADD_UNIT_TEST_CALLBACK(MapUnitTestCallback)
@@ -0,0 +1,16 @@
+#include "UnitTests.hpp"
+
+namespace wfe {
+	void MemoryUnitTestCallback(UnitTestList& unitTestList);
+
+	void MemorySSE2UnitTestCallback(UnitTestList& unitTestList) {
+		// Run the memory tests again with the SSE2 kernels, which CPUs that support AVX2 never select on their own
+		SetSSE2MemoryKernelsForced(true);
+		MemoryUnitTestCallback(unitTestList);
+		SetSSE2MemoryKernelsForced(false);
+
+		unitTestList.name = "Memory (SSE2 kernels)";
+	}
+
+	WFE_ADD_UNIT_TEST_CALLBACK(MemorySSE2UnitTestCallback)
+}
\ No newline at end of file
@@ -1,6 +1,32 @@
 #include "UnitTests.hpp"
 
 namespace wfe {
+	static const size_t MEMORY_TEST_BUFFER_SIZE = 1024;
+	static const size_t MEMORY_TEST_LARGE_SIZE = 8388608;
+
+	static void MemoryTestFill(uint8_t* buffer, size_t size, uint32_t seed) {
+		// Fill the buffer with pseudo-random bytes
+		for(size_t i = 0; i != size; ++i) {
+			seed = seed * 1664525u + 1013904223u;
+			buffer[i] = (uint8_t)(seed >> 24);
+		}
+	}
+	static void MemoryTestFillText(char_t* buffer, size_t size, uint32_t seed, uint32_t letterCount) {
+		// Fill the buffer with pseudo-random lowercase letters from a small alphabet, so that matches are frequent
+		for(size_t i = 0; i != size; ++i) {
+			seed = seed * 1664525u + 1013904223u;
+			buffer[i] = (char_t)('a' + (seed >> 24) % letterCount);
+		}
+	}
+	static size_t MemoryTestCompare(const uint8_t* buffer1, const uint8_t* buffer2, size_t size) {
+		// Count every mismatched byte
+		size_t mismatchCount = 0;
+		for(size_t i = 0; i != size; ++i)
+			mismatchCount += buffer1[i] != buffer2[i];
+
+		return mismatchCount;
+	}
+
 	void MemoryUnitTestCallback(UnitTestList& unitTestList) {
 		unitTestList.name = "Memory";
 
@@ -16,6 +42,55 @@ namespace wfe {
 			unitTest1.name = "memcpy 1";
 			unitTest1.FormatResult("%s", test1Dst);
 			unitTest1.wantedResult = "memcpy";
+
+			// Test 2
+			uint8_t* test2Src = (uint8_t*)AllocMemory(MEMORY_TEST_BUFFER_SIZE);
+			uint8_t* test2Dst = (uint8_t*)AllocMemory(MEMORY_TEST_BUFFER_SIZE);
+			uint8_t* test2Ref = (uint8_t*)AllocMemory(MEMORY_TEST_BUFFER_SIZE);
+			size_t test2Mismatches = 0;
+
+			// Copy every size up to a few hundred bytes between differently aligned blocks
+			for(size_t size = 0; size != 300; ++size) {
+				for(size_t offset = 0; offset < 32; offset += 3) {
+					MemoryTestFill(test2Src, MEMORY_TEST_BUFFER_SIZE, (uint32_t)size);
+					MemoryTestFill(test2Dst, MEMORY_TEST_BUFFER_SIZE, (uint32_t)offset);
+					for(size_t i = 0; i != MEMORY_TEST_BUFFER_SIZE; ++i)
+						test2Ref[i] = test2Dst[i];
+					for(size_t i = 0; i != size; ++i)
+						test2Ref[offset + 7 + i] = test2Src[31 - offset + i];
+
+					memcpy(test2Dst + offset + 7, test2Src + 31 - offset, size);
+					test2Mismatches += MemoryTestCompare(test2Dst, test2Ref, MEMORY_TEST_BUFFER_SIZE);
+				}
+			}
+
+			FreeMemory(test2Src);
+			FreeMemory(test2Dst);
+			FreeMemory(test2Ref);
+
+			UnitTest& unitTest2 = unitTestList.unitTests[unitTestList.unitTestCount++];
+
+			unitTest2.name = "memcpy 2";
+			unitTest2.FormatResult("%llu", (unsigned long long)test2Mismatches);
+			unitTest2.wantedResult = "0";
+
+			// Test 3
+			uint8_t* test3Src = (uint8_t*)AllocMemory(MEMORY_TEST_LARGE_SIZE);
+			uint8_t* test3Dst = (uint8_t*)AllocMemory(MEMORY_TEST_LARGE_SIZE);
+
+			// Copy a block large enough to be streamed past the cache
+			MemoryTestFill(test3Src, MEMORY_TEST_LARGE_SIZE, 3);
+			memcpy(test3Dst + 5, test3Src + 3, MEMORY_TEST_LARGE_SIZE - 5);
+			size_t test3Mismatches = MemoryTestCompare(test3Dst + 5, test3Src + 3, MEMORY_TEST_LARGE_SIZE - 5);
+
+			FreeMemory(test3Src);
+			FreeMemory(test3Dst);
+
+			UnitTest& unitTest3 = unitTestList.unitTests[unitTestList.unitTestCount++];
+
+			unitTest3.name = "memcpy 3";
+			unitTest3.FormatResult("%llu", (unsigned long long)test3Mismatches);
+			unitTest3.wantedResult = "0";
 		}
 		/* Test memmove */ {
 			// Test 1
@@ -28,6 +103,44 @@ namespace wfe {
 			unitTest1.name = "memmove 1";
 			unitTest1.FormatResult("%s", test1);
 			unitTest1.wantedResult = "mmemove";
+
+			// Test 2
+			uint8_t* test2Buffer = (uint8_t*)AllocMemory(MEMORY_TEST_BUFFER_SIZE);
+			uint8_t* test2Ref = (uint8_t*)AllocMemory(MEMORY_TEST_BUFFER_SIZE);
+			size_t test2Mismatches = 0;
+
+			// Move every size up to a few hundred bytes within the same buffer, both forwards and backwards
+			for(size_t size = 0; size != 300; ++size) {
+				for(size_t distance = 1; distance < 100; distance += 7) {
+					for(size_t backwards = 0; backwards != 2; ++backwards) {
+						size_t srcOffset = backwards ? 100 + (size & 7) : 100 + distance + (size & 7);
+						size_t dstOffset = backwards ? srcOffset + distance : srcOffset - distance;
+
+						MemoryTestFill(test2Buffer, MEMORY_TEST_BUFFER_SIZE, (uint32_t)(size + distance));
+						for(size_t i = 0; i != MEMORY_TEST_BUFFER_SIZE; ++i)
+							test2Ref[i] = test2Buffer[i];
+						if(backwards) {
+							for(size_t i = size; i; --i)
+								test2Ref[dstOffset + i - 1] = test2Ref[srcOffset + i - 1];
+						} else {
+							for(size_t i = 0; i != size; ++i)
+								test2Ref[dstOffset + i] = test2Ref[srcOffset + i];
+						}
+
+						memmove(test2Buffer + dstOffset, test2Buffer + srcOffset, size);
+						test2Mismatches += MemoryTestCompare(test2Buffer, test2Ref, MEMORY_TEST_BUFFER_SIZE);
+					}
+				}
+			}
+
+			FreeMemory(test2Buffer);
+			FreeMemory(test2Ref);
+
+			UnitTest& unitTest2 = unitTestList.unitTests[unitTestList.unitTestCount++];
+
+			unitTest2.name = "memmove 2";
+			unitTest2.FormatResult("%llu", (unsigned long long)test2Mismatches);
+			unitTest2.wantedResult = "0";
 		}
 		/* Test memccpy */ {
 			// Test 1
@@ -53,6 +166,34 @@ namespace wfe {
 			unitTest1.name = "memset 1";
 			unitTest1.FormatResult("%s", test1);
 			unitTest1.wantedResult = "eeeset";
+
+			// Test 2
+			uint8_t* test2Buffer = (uint8_t*)AllocMemory(MEMORY_TEST_BUFFER_SIZE);
+			uint8_t* test2Ref = (uint8_t*)AllocMemory(MEMORY_TEST_BUFFER_SIZE);
+			size_t test2Mismatches = 0;
+
+			// Set every size up to a few hundred bytes at different alignments
+			for(size_t size = 0; size != 300; ++size) {
+				for(size_t offset = 0; offset < 32; offset += 3) {
+					MemoryTestFill(test2Buffer, MEMORY_TEST_BUFFER_SIZE, (uint32_t)size);
+					for(size_t i = 0; i != MEMORY_TEST_BUFFER_SIZE; ++i)
+						test2Ref[i] = test2Buffer[i];
+					for(size_t i = 0; i != size; ++i)
+						test2Ref[offset + i] = (uint8_t)(size + 0x80);
+
+					memset(test2Buffer + offset, (int32_t)(size + 0x80), size);
+					test2Mismatches += MemoryTestCompare(test2Buffer, test2Ref, MEMORY_TEST_BUFFER_SIZE);
+				}
+			}
+
+			FreeMemory(test2Buffer);
+			FreeMemory(test2Ref);
+
+			UnitTest& unitTest2 = unitTestList.unitTests[unitTestList.unitTestCount++];
+
+			unitTest2.name = "memset 2";
+			unitTest2.FormatResult("%llu", (unsigned long long)test2Mismatches);
+			unitTest2.wantedResult = "0";
 		}
 		/* Test memcmp */ {
 			// Test 1
@@ -78,6 +219,33 @@ namespace wfe {
 			unitTest1.name = "memchr 1";
 			unitTest1.FormatResult("%s", test1Result);
 			unitTest1.wantedResult = "chr";
+
+			// Test 2
+			char_t* test2Buffer = (char_t*)AllocMemory(MEMORY_TEST_BUFFER_SIZE);
+			size_t test2Mismatches = 0;
+
+			// Search blocks of every size up to a few hundred bytes at different alignments
+			for(size_t size = 0; size != 300; ++size) {
+				for(size_t offset = 0; offset < 64; offset += 5) {
+					MemoryTestFillText(test2Buffer, MEMORY_TEST_BUFFER_SIZE, (uint32_t)(size + offset), 26);
+					char_t wanted = (char_t)('a' + (size + offset) % 27);
+
+					const char_t* expected = nullptr;
+					for(size_t i = 0; i != size && !expected; ++i)
+						if(test2Buffer[offset + i] == wanted)
+							expected = test2Buffer + offset + i;
+
+					test2Mismatches += memchr(test2Buffer + offset, wanted, size) != expected;
+				}
+			}
+
+			FreeMemory(test2Buffer);
+
+			UnitTest& unitTest2 = unitTestList.unitTests[unitTestList.unitTestCount++];
+
+			unitTest2.name = "memchr 2";
+			unitTest2.FormatResult("%llu", (unsigned long long)test2Mismatches);
+			unitTest2.wantedResult = "0";
 		}
 		/* Test rawmemchr */ {
 			// Test 1
@@ -192,6 +360,35 @@ namespace wfe {
 			unitTest1.name = "strchr 1";
 			unitTest1.FormatResult("%s", test1Result);
 			unitTest1.wantedResult = "hr";
+
+			// Test 2
+			char_t* test2Buffer = (char_t*)AllocMemory(MEMORY_TEST_BUFFER_SIZE);
+			size_t test2Mismatches = 0;
+
+			// Search strings of every length up to a few hundred characters at different alignments, including for missing and null characters
+			for(size_t length = 0; length != 300; ++length) {
+				for(size_t offset = 0; offset < 64; offset += 5) {
+					MemoryTestFillText(test2Buffer, MEMORY_TEST_BUFFER_SIZE, (uint32_t)(length + offset), 26);
+					test2Buffer[offset + length] = 0;
+					size_t wantedIndex = (length + offset) % 28;
+					char_t wanted = wantedIndex == 27 ? 0 : (char_t)('a' + wantedIndex);
+
+					const char_t* expected = nullptr;
+					for(size_t i = 0; i <= length && !expected; ++i)
+						if(test2Buffer[offset + i] == wanted)
+							expected = test2Buffer + offset + i;
+
+					test2Mismatches += strchr((const char_t*)test2Buffer + offset, wanted) != expected;
+				}
+			}
+
+			FreeMemory(test2Buffer);
+
+			UnitTest& unitTest2 = unitTestList.unitTests[unitTestList.unitTestCount++];
+
+			unitTest2.name = "strchr 2";
+			unitTest2.FormatResult("%llu", (unsigned long long)test2Mismatches);
+			unitTest2.wantedResult = "0";
 		}
 		/* Test strrchr */ {
 			// Test 1
@@ -216,6 +413,36 @@ namespace wfe {
 			unitTest1.name = "strcspn 1";
 			unitTest1.FormatResult("%llu", (unsigned long long)test1Result);
 			unitTest1.wantedResult = "2";
+
+			// Test 2
+			const char_t* test2Sets[] { "", "d", "ab", "xyz", "abcdefghijklmnop", "abcdefghijklmnopqr" };
+			char_t* test2Buffer = (char_t*)AllocMemory(MEMORY_TEST_BUFFER_SIZE);
+			size_t test2Mismatches = 0;
+
+			// Measure spans of strings of every length up to a few hundred characters at different alignments, with sets of different sizes
+			for(size_t length = 0; length != 300; ++length) {
+				for(size_t offset = 0; offset < 64; offset += 5) {
+					for(size_t set = 0; set != sizeof(test2Sets) / sizeof(const char_t*); ++set) {
+						MemoryTestFillText(test2Buffer, MEMORY_TEST_BUFFER_SIZE, (uint32_t)(length + offset), 24);
+						test2Buffer[offset + length] = 0;
+						const char_t* str = test2Buffer + offset;
+
+						size_t expected = 0;
+						while(str[expected] && !strchr(test2Sets[set], str[expected]))
+							++expected;
+
+						test2Mismatches += strcspn(str, test2Sets[set]) != expected;
+					}
+				}
+			}
+
+			FreeMemory(test2Buffer);
+
+			UnitTest& unitTest2 = unitTestList.unitTests[unitTestList.unitTestCount++];
+
+			unitTest2.name = "strcspn 2";
+			unitTest2.FormatResult("%llu", (unsigned long long)test2Mismatches);
+			unitTest2.wantedResult = "0";
 		}
 		/* Test strspn */ {
 			// Test 1
@@ -228,6 +455,36 @@ namespace wfe {
 			unitTest1.name = "strspn 1";
 			unitTest1.FormatResult("%llu", (unsigned long long)test1Result);
 			unitTest1.wantedResult = "4";
+
+			// Test 2
+			const char_t* test2Sets[] { "", "d", "ab", "xyz", "abcdefghijklmnop", "abcdefghijklmnopqr" };
+			char_t* test2Buffer = (char_t*)AllocMemory(MEMORY_TEST_BUFFER_SIZE);
+			size_t test2Mismatches = 0;
+
+			// Measure spans of strings of every length up to a few hundred characters at different alignments, with sets of different sizes
+			for(size_t length = 0; length != 300; ++length) {
+				for(size_t offset = 0; offset < 64; offset += 5) {
+					for(size_t set = 0; set != sizeof(test2Sets) / sizeof(const char_t*); ++set) {
+						MemoryTestFillText(test2Buffer, MEMORY_TEST_BUFFER_SIZE, (uint32_t)(length + offset), 5);
+						test2Buffer[offset + length] = 0;
+						const char_t* str = test2Buffer + offset;
+
+						size_t expected = 0;
+						while(str[expected] && strchr(test2Sets[set], str[expected]))
+							++expected;
+
+						test2Mismatches += strspn(str, test2Sets[set]) != expected;
+					}
+				}
+			}
+
+			FreeMemory(test2Buffer);
+
+			UnitTest& unitTest2 = unitTestList.unitTests[unitTestList.unitTestCount++];
+
+			unitTest2.name = "strspn 2";
+			unitTest2.FormatResult("%llu", (unsigned long long)test2Mismatches);
+			unitTest2.wantedResult = "0";
 		}
 		/* Test strpbrk */ {
 			// Test 1
@@ -252,6 +509,67 @@ namespace wfe {
 			unitTest1.name = "strstr 1";
 			unitTest1.FormatResult("%s", test1Result);
 			unitTest1.wantedResult = "trstr";
+
+			// Test 2
+			char_t* test2Buffer = (char_t*)AllocMemory(MEMORY_TEST_BUFFER_SIZE);
+			char_t test2Wanted[16];
+			size_t test2Mismatches = 0;
+
+			// Search strings of every length up to a few hundred characters over a two letter alphabet, for many short strings
+			for(size_t length = 0; length != 300; ++length) {
+				for(size_t wantedLength = 0; wantedLength != 12; ++wantedLength) {
+					size_t offset = (length * 7 + wantedLength) & 63;
+					MemoryTestFillText(test2Buffer, MEMORY_TEST_BUFFER_SIZE, (uint32_t)(length + wantedLength), 2);
+					test2Buffer[offset + length] = 0;
+					MemoryTestFillText(test2Wanted, wantedLength, (uint32_t)length * 31, 2);
+					test2Wanted[wantedLength] = 0;
+					const char_t* str = test2Buffer + offset;
+
+					const char_t* expected = nullptr;
+					for(size_t i = 0; i + wantedLength <= length && !expected; ++i) {
+						size_t matchLength = 0;
+						while(matchLength != wantedLength && str[i + matchLength] == test2Wanted[matchLength])
+							++matchLength;
+						if(matchLength == wantedLength)
+							expected = str + i;
+					}
+
+					test2Mismatches += strstr(str, test2Wanted) != expected;
+				}
+			}
+
+			FreeMemory(test2Buffer);
+
+			UnitTest& unitTest2 = unitTestList.unitTests[unitTestList.unitTestCount++];
+
+			unitTest2.name = "strstr 2";
+			unitTest2.FormatResult("%llu", (unsigned long long)test2Mismatches);
+			unitTest2.wantedResult = "0";
+
+			// Test 3
+			char_t* test3Str = (char_t*)AllocMemory(20102);
+			char_t test3Wanted[102];
+
+			// Search for a string whose first and last characters match almost everywhere
+			for(size_t i = 0; i != 20101; ++i)
+				test3Str[i] = 'a';
+			test3Str[20101] = 0;
+			for(size_t i = 0; i != 101; ++i)
+				test3Wanted[i] = 'a';
+			test3Wanted[50] = 'b';
+			test3Wanted[101] = 0;
+
+			const char_t* test3Missing = strstr((const char_t*)test3Str, test3Wanted);
+			test3Str[20050] = 'b';
+			const char_t* test3Found = strstr((const char_t*)test3Str, test3Wanted);
+
+			FreeMemory(test3Str);
+
+			UnitTest& unitTest3 = unitTestList.unitTests[unitTestList.unitTestCount++];
+
+			unitTest3.name = "strstr 3";
+			unitTest3.FormatResult("%i %lli", (int32_t)(test3Missing == nullptr), (long long)(test3Found - test3Str));
+			unitTest3.wantedResult = "1 20000";
 		}
 		/* Test strtok */ {
 			// Test 1
@@ -277,6 +595,29 @@ namespace wfe {
 			unitTest1.name = "strlen 1";
 			unitTest1.FormatResult("%llu", (unsigned long long)test1Result);
 			unitTest1.wantedResult = "6";
+
+			// Test 2
+			char_t* test2Buffer = (char_t*)AllocMemory(MEMORY_TEST_BUFFER_SIZE);
+			size_t test2Mismatches = 0;
+
+			// Measure strings of every length up to a few hundred characters at different alignments
+			for(size_t length = 0; length != 300; ++length) {
+				for(size_t offset = 0; offset < 64; offset += 5) {
+					MemoryTestFillText(test2Buffer, MEMORY_TEST_BUFFER_SIZE, (uint32_t)(length + offset), 26);
+					test2Buffer[offset + length] = 0;
+
+					test2Mismatches += strlen(test2Buffer + offset) != length;
+					test2Mismatches += strnlen(test2Buffer + offset, 150) != (length < 150 ? length : 150);
+				}
+			}
+
+			FreeMemory(test2Buffer);
+
+			UnitTest& unitTest2 = unitTestList.unitTests[unitTestList.unitTestCount++];
+
+			unitTest2.name = "strlen 2";
+			unitTest2.FormatResult("%llu", (unsigned long long)test2Mismatches);
+			unitTest2.wantedResult = "0";
 		}
 		/* Test strnlen */ {
 			// Test 1
@@ -0,0 +1,223 @@
+#include "UnitTests.hpp"
+
+namespace wfe {
+	struct MutexTestArgs {
+		AtomicMutex* mutex;
+		size_t* counter;
+	};
+
+	static void* MutexTestIncrement(void* args) {
+		// Increment the shared counter while holding the mutex
+		MutexTestArgs* testArgs = (MutexTestArgs*)args;
+		for(size_t i = 0; i != 20000; ++i) {
+			testArgs->mutex->Lock();
+			++*testArgs->counter;
+			testArgs->mutex->Unlock();
+		}
+
+		return nullptr;
+	}
+
+	struct SharedMutexTestArgs {
+		SharedMutex* mutex;
+		size_t* values;
+		atomic_size_t* mismatchCount;
+	};
+
+	static void* SharedMutexTestWrite(void* args) {
+		// Increment both shared values while holding the mutex exclusively
+		SharedMutexTestArgs* testArgs = (SharedMutexTestArgs*)args;
+		for(size_t i = 0; i != 10000; ++i) {
+			testArgs->mutex->Lock();
+			++testArgs->values[0];
+			++testArgs->values[1];
+			testArgs->mutex->Unlock();
+		}
+
+		return nullptr;
+	}
+	static void* SharedMutexTestRead(void* args) {
+		// Check that both shared values are equal while holding the mutex for shared access
+		SharedMutexTestArgs* testArgs = (SharedMutexTestArgs*)args;
+		for(size_t i = 0; i != 10000; ++i) {
+			testArgs->mutex->LockShared();
+			if(testArgs->values[0] != testArgs->values[1])
+				testArgs->mismatchCount->fetch_add(1, std::memory_order_relaxed);
+			testArgs->mutex->UnlockShared();
+		}
+
+		return nullptr;
+	}
+
+	struct SharedMutexTestWaitArgs {
+		SharedMutex* mutex;
+		atomic_size_t* locked;
+	};
+
+	static void* SharedMutexTestWaitWrite(void* args) {
+		// Lock the mutex exclusively and mark it as locked
+		SharedMutexTestWaitArgs* testArgs = (SharedMutexTestWaitArgs*)args;
+		testArgs->mutex->Lock();
+		testArgs->locked->store(1);
+		testArgs->mutex->Unlock();
+
+		return nullptr;
+	}
+
+	struct SeqLockTestValue {
+		uint64_t first;
+		uint64_t second;
+	};
+	struct SeqLockTestArgs {
+		SeqLock* lock;
+		SeqLockTestValue* value;
+		atomic_size_t* mismatchCount;
+	};
+
+	static void* SeqLockTestWrite(void* args) {
+		// Write matching values to the protected value
+		SeqLockTestArgs* testArgs = (SeqLockTestArgs*)args;
+		for(uint64_t i = 1; i <= 10000; ++i)
+			testArgs->lock->Store(*testArgs->value, SeqLockTestValue{ i, i });
+
+		return nullptr;
+	}
+	static void* SeqLockTestRead(void* args) {
+		// Check that every read copy of the protected value is consistent
+		SeqLockTestArgs* testArgs = (SeqLockTestArgs*)args;
+		for(size_t i = 0; i != 10000; ++i) {
+			SeqLockTestValue value = testArgs->lock->Load(*testArgs->value);
+			if(value.first != value.second)
+				testArgs->mismatchCount->fetch_add(1, std::memory_order_relaxed);
+		}
+
+		return nullptr;
+	}
+
+	void MutexUnitTestCallback(UnitTestList& unitTestList) {
+		unitTestList.name = "Mutex";
+
+		/* Test AtomicMutex::TryLock */ {
+			// Test 1
+			AtomicMutex test1;
+
+			bool8_t test1Result1 = test1.TryLock();
+			bool8_t test1Result2 = test1.TryLock();
+			test1.Unlock();
+			bool8_t test1Result3 = test1.TryLock();
+			test1.Unlock();
+
+			UnitTest& unitTest1 = unitTestList.unitTests[unitTestList.unitTestCount++];
+
+			unitTest1.name = "AtomicMutex::TryLock 1";
+			unitTest1.FormatResult("%i %i %i", (int32_t)test1Result1, (int32_t)test1Result2, (int32_t)test1Result3);
+			unitTest1.wantedResult = "1 0 1";
+		}
+		/* Test AtomicMutex::Lock */ {
+			// Test 1
+			AtomicMutex test1Mutex;
+			size_t test1Counter = 0;
+			MutexTestArgs test1Args { &test1Mutex, &test1Counter };
+			Thread test1Threads[4];
+
+			for(size_t i = 0; i != 4; ++i)
+				test1Threads[i].Begin(MutexTestIncrement, &test1Args);
+			for(size_t i = 0; i != 4; ++i)
+				test1Threads[i].Join();
+
+			UnitTest& unitTest1 = unitTestList.unitTests[unitTestList.unitTestCount++];
+
+			unitTest1.name = "AtomicMutex::Lock 1";
+			unitTest1.FormatResult("%llu", (unsigned long long)test1Counter);
+			unitTest1.wantedResult = "80000";
+		}
+		/* Test SharedMutex::TryLock and SharedMutex::TryLockShared */ {
+			// Test 1
+			SharedMutex test1;
+
+			bool8_t test1Result1 = test1.TryLockShared();
+			bool8_t test1Result2 = test1.TryLockShared();
+			bool8_t test1Result3 = test1.TryLock();
+			test1.UnlockShared();
+			test1.UnlockShared();
+			bool8_t test1Result4 = test1.TryLock();
+			bool8_t test1Result5 = test1.TryLockShared();
+			test1.Unlock();
+			bool8_t test1Result6 = test1.TryLockShared();
+			test1.UnlockShared();
+
+			UnitTest& unitTest1 = unitTestList.unitTests[unitTestList.unitTestCount++];
+
+			unitTest1.name = "SharedMutex::TryLock 1";
+			unitTest1.FormatResult("%i %i %i %i %i %i", (int32_t)test1Result1, (int32_t)test1Result2, (int32_t)test1Result3, (int32_t)test1Result4, (int32_t)test1Result5, (int32_t)test1Result6);
+			unitTest1.wantedResult = "1 1 0 1 0 1";
+		}
+		/* Test SharedMutex::Lock and SharedMutex::LockShared */ {
+			// Test 1
+			SharedMutex test1Mutex;
+			size_t test1Values[2] = { 0, 0 };
+			atomic_size_t test1MismatchCount = 0;
+			SharedMutexTestArgs test1Args { &test1Mutex, test1Values, &test1MismatchCount };
+			Thread test1Threads[4];
+
+			test1Threads[0].Begin(SharedMutexTestWrite, &test1Args);
+			test1Threads[1].Begin(SharedMutexTestWrite, &test1Args);
+			test1Threads[2].Begin(SharedMutexTestRead, &test1Args);
+			test1Threads[3].Begin(SharedMutexTestRead, &test1Args);
+			for(size_t i = 0; i != 4; ++i)
+				test1Threads[i].Join();
+
+			UnitTest& unitTest1 = unitTestList.unitTests[unitTestList.unitTestCount++];
+
+			unitTest1.name = "SharedMutex::Lock 1";
+			unitTest1.FormatResult("%llu %llu %llu", (unsigned long long)test1Values[0], (unsigned long long)test1Values[1], (unsigned long long)test1MismatchCount.load());
+			unitTest1.wantedResult = "20000 20000 0";
+
+			// Test 2
+			SharedMutex test2Mutex;
+			atomic_size_t test2Locked = 0;
+			SharedMutexTestWaitArgs test2Args { &test2Mutex, &test2Locked };
+			Thread test2Thread;
+
+			// Hold a read lock long enough for the writer to stop spinning and park
+			test2Mutex.LockShared();
+			test2Thread.Begin(SharedMutexTestWaitWrite, &test2Args);
+			for(size_t i = 0; i != 1000; ++i)
+				YieldCurrentThread();
+
+			size_t test2LockedEarly = test2Locked.load();
+			test2Mutex.UnlockShared();
+			test2Thread.Join();
+
+			UnitTest& unitTest2 = unitTestList.unitTests[unitTestList.unitTestCount++];
+
+			unitTest2.name = "SharedMutex::Lock 2";
+			unitTest2.FormatResult("%llu %llu", (unsigned long long)test2LockedEarly, (unsigned long long)test2Locked.load());
+			unitTest2.wantedResult = "0 1";
+		}
+		/* Test SeqLock::Load and SeqLock::Store */ {
+			// Test 1
+			SeqLock test1Lock;
+			SeqLockTestValue test1Value { 0, 0 };
+			atomic_size_t test1MismatchCount = 0;
+			SeqLockTestArgs test1Args { &test1Lock, &test1Value, &test1MismatchCount };
+			Thread test1Threads[3];
+
+			test1Threads[0].Begin(SeqLockTestWrite, &test1Args);
+			test1Threads[1].Begin(SeqLockTestRead, &test1Args);
+			test1Threads[2].Begin(SeqLockTestRead, &test1Args);
+			for(size_t i = 0; i != 3; ++i)
+				test1Threads[i].Join();
+
+			SeqLockTestValue test1Result = test1Lock.Load(test1Value);
+
+			UnitTest& unitTest1 = unitTestList.unitTests[unitTestList.unitTestCount++];
+
+			unitTest1.name = "SeqLock::Load 1";
+			unitTest1.FormatResult("%llu %llu %llu", (unsigned long long)test1Result.first, (unsigned long long)test1Result.second, (unsigned long long)test1MismatchCount.load());
+			unitTest1.wantedResult = "10000 10000 0";
+		}
+	}
+
+	WFE_ADD_UNIT_TEST_CALLBACK(MutexUnitTestCallback)
+}
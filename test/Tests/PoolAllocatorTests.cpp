@@ -0,0 +1,214 @@
+#include "UnitTests.hpp"
+
+namespace wfe {
+	struct PoolAllocatorTestObject {
+		uint64_t value;
+		size_t* destroyCount;
+
+		PoolAllocatorTestObject(uint64_t value, size_t* destroyCount) : value(value), destroyCount(destroyCount) { }
+		~PoolAllocatorTestObject() {
+			++*destroyCount;
+		}
+	};
+
+	struct PoolAllocatorTestMoveObject {
+		vector<uint32_t> values;
+
+		PoolAllocatorTestMoveObject(vector<uint32_t>&& values) : values(std::move(values)) { }
+	};
+
+	struct alignas(64) PoolAllocatorTestAlignedObject {
+		uint64_t value;
+	};
+
+	static void* PoolAllocatorTestChurn(void* args) {
+		// Allocate and free batches of objects, checking that no two live objects share memory
+		PoolAllocator<uint64_t>* pool = (PoolAllocator<uint64_t>*)args;
+		uint64_t* objects[64];
+		size_t mismatchCount = 0;
+
+		for(size_t i = 0; i != 1000; ++i) {
+			for(size_t j = 0; j != 64; ++j)
+				objects[j] = pool->New(i * 64 + j);
+			for(size_t j = 0; j != 64; ++j) {
+				if(*objects[j] != i * 64 + j)
+					++mismatchCount;
+				pool->Delete(objects[j]);
+			}
+		}
+
+		return (void*)mismatchCount;
+	}
+
+	struct PoolAllocatorTestExitArgs {
+		PoolAllocator<uint64_t>* pool;
+		uint64_t* objects[4];
+	};
+
+	static void* PoolAllocatorTestExit(void* args) {
+		// Allocate and free objects, leaving them in the thread's own list when the thread exits
+		PoolAllocatorTestExitArgs* testArgs = (PoolAllocatorTestExitArgs*)args;
+		for(size_t i = 0; i != 4; ++i)
+			testArgs->objects[i] = testArgs->pool->Alloc();
+		for(size_t i = 0; i != 4; ++i)
+			testArgs->pool->Free(testArgs->objects[i]);
+
+		return nullptr;
+	}
+
+	void PoolAllocatorUnitTestCallback(UnitTestList& unitTestList) {
+		unitTestList.name = "Pool allocator";
+
+		/* Test Alloc and Free */ {
+			// Test 1
+			PoolAllocator<uint32_t> test1(4);
+
+			uint32_t* test1Objects[10];
+			for(size_t i = 0; i != 10; ++i)
+				test1Objects[i] = test1.Alloc();
+
+			size_t test1DistinctCount = 0;
+			for(size_t i = 0; i != 10; ++i) {
+				bool8_t distinct = true;
+				for(size_t j = 0; j != i; ++j)
+					distinct &= test1Objects[i] != test1Objects[j];
+				test1DistinctCount += distinct;
+			}
+
+			test1.Free(test1Objects[3]);
+			uint32_t* test1Reused = test1.Alloc();
+
+			UnitTest& unitTest1 = unitTestList.unitTests[unitTestList.unitTestCount++];
+
+			unitTest1.name = "PoolAllocator::Alloc 1";
+			unitTest1.FormatResult("%llu %i", (unsigned long long)test1DistinctCount, (int32_t)(test1Reused == test1Objects[3]));
+			unitTest1.wantedResult = "10 1";
+
+			// Test 2
+			PoolAllocator<uint64_t> test2(4);
+			PoolAllocatorTestExitArgs test2Args;
+			test2Args.pool = &test2;
+
+			Thread test2Thread;
+			test2Thread.Begin(PoolAllocatorTestExit, &test2Args);
+			test2Thread.Join();
+
+			// The exited thread's objects must have been moved back to the central list, instead of a new slab being allocated
+			uint64_t* test2Reused = test2.Alloc();
+
+			bool8_t test2Found = false;
+			for(size_t i = 0; i != 4; ++i)
+				test2Found |= test2Reused == test2Args.objects[i];
+
+			UnitTest& unitTest2 = unitTestList.unitTests[unitTestList.unitTestCount++];
+
+			unitTest2.name = "PoolAllocator::Alloc 2";
+			unitTest2.FormatResult("%i", (int32_t)test2Found);
+			unitTest2.wantedResult = "1";
+
+			// Test 3
+			SetCommandArenaEnabled(true);
+
+			// Slabs of a command pool must stay out of the command arena, which would reuse them after being reset
+			PoolAllocator<uint64_t> test3(0, MEMORY_USAGE_TYPE_COMMAND);
+			uint64_t* test3Object1 = test3.Alloc();
+			*test3Object1 = 42;
+			bool8_t test3InArena = GetCommandArena()->Contains(test3Object1);
+
+			ResetCommandArena();
+			PushMemoryUsageType(MEMORY_USAGE_TYPE_COMMAND);
+			uint64_t* test3Overwrite = (uint64_t*)AllocMemory(test3.GetSlabObjectCount() * 2 * sizeof(uint64_t));
+			memset(test3Overwrite, 0, test3.GetSlabObjectCount() * 2 * sizeof(uint64_t));
+			PopMemoryUsageType();
+
+			uint64_t* test3Object2 = test3.Alloc();
+			*test3Object2 = 7;
+
+			ResetCommandArena();
+			SetCommandArenaEnabled(false);
+
+			UnitTest& unitTest3 = unitTestList.unitTests[unitTestList.unitTestCount++];
+
+			unitTest3.name = "PoolAllocator::Alloc 3";
+			unitTest3.FormatResult("%llu %i %llu %llu", (unsigned long long)test3.GetSlabObjectCount(), (int32_t)test3InArena, (unsigned long long)*test3Object1, (unsigned long long)*test3Object2);
+			unitTest3.wantedResult = "1 0 42 7";
+
+			// Test 4
+			PoolAllocator<PoolAllocatorTestAlignedObject> test4(100);
+
+			// Objects aligned past the default memory alignment must keep their alignment in every slab
+			size_t test4MisalignedCount = 0;
+			PoolAllocatorTestAlignedObject* test4Objects[10];
+			for(size_t i = 0; i != 10; ++i) {
+				test4Objects[i] = test4.Alloc();
+				test4MisalignedCount += ((uintptr_t)test4Objects[i] & (alignof(PoolAllocatorTestAlignedObject) - 1)) != 0;
+			}
+			for(size_t i = 0; i != 10; ++i)
+				test4.Free(test4Objects[i]);
+
+			UnitTest& unitTest4 = unitTestList.unitTests[unitTestList.unitTestCount++];
+
+			unitTest4.name = "PoolAllocator::Alloc 4";
+			unitTest4.FormatResult("%llu", (unsigned long long)test4MisalignedCount);
+			unitTest4.wantedResult = "0";
+		}
+		/* Test New and Delete */ {
+			// Test 1
+			size_t test1DestroyCount = 0;
+			PoolAllocator<PoolAllocatorTestObject> test1;
+
+			PoolAllocatorTestObject* test1Object1 = test1.New(5, &test1DestroyCount);
+			PoolAllocatorTestObject* test1Object2 = test1.New(7, &test1DestroyCount);
+			uint64_t test1Sum = test1Object1->value + test1Object2->value;
+			test1.Delete(test1Object1);
+			test1.Delete(test1Object2);
+
+			UnitTest& unitTest1 = unitTestList.unitTests[unitTestList.unitTestCount++];
+
+			unitTest1.name = "PoolAllocator::New 1";
+			unitTest1.FormatResult("%llu %llu", (unsigned long long)test1Sum, (unsigned long long)test1DestroyCount);
+			unitTest1.wantedResult = "12 2";
+
+			// Test 2
+			PoolAllocator<uint64_t> test2(32);
+			Thread test2Threads[4];
+			size_t test2MismatchCount = 0;
+
+			for(size_t i = 0; i != 4; ++i)
+				test2Threads[i].Begin(PoolAllocatorTestChurn, &test2);
+			for(size_t i = 0; i != 4; ++i) {
+				void* mismatchCount;
+				test2Threads[i].Join(&mismatchCount);
+				test2MismatchCount += (size_t)mismatchCount;
+			}
+
+			UnitTest& unitTest2 = unitTestList.unitTests[unitTestList.unitTestCount++];
+
+			unitTest2.name = "PoolAllocator::New 2";
+			unitTest2.FormatResult("%llu", (unsigned long long)test2MismatchCount);
+			unitTest2.wantedResult = "0";
+
+			// Test 3
+			PoolAllocator<PoolAllocatorTestMoveObject> test3;
+
+			// The args must be forwarded to the object's constructor, moving the vector instead of copying it
+			vector<uint32_t> test3Values;
+			for(uint32_t i = 0; i != 10; ++i)
+				test3Values.push_back(i);
+			uint32_t* test3Data = test3Values.data();
+
+			PoolAllocatorTestMoveObject* test3Object = test3.New(std::move(test3Values));
+			int32_t test3Moved = test3Object->values.data() == test3Data;
+			size_t test3Size = test3Object->values.size();
+			test3.Delete(test3Object);
+
+			UnitTest& unitTest3 = unitTestList.unitTests[unitTestList.unitTestCount++];
+
+			unitTest3.name = "PoolAllocator::New 3";
+			unitTest3.FormatResult("%i %llu", test3Moved, (unsigned long long)test3Size);
+			unitTest3.wantedResult = "1 10";
+		}
+	}
+
+	WFE_ADD_UNIT_TEST_CALLBACK(PoolAllocatorUnitTestCallback)
+}
@@ -0,0 +1,69 @@
+#include "UnitTests.hpp"
+
+namespace wfe {
+	struct SemaphoreTestArgs {
+		Semaphore* request;
+		Semaphore* response;
+		size_t* counter;
+	};
+
+	static void* SemaphoreTestPingPong(void* args) {
+		// Answer every request with a response
+		SemaphoreTestArgs* testArgs = (SemaphoreTestArgs*)args;
+		for(size_t i = 0; i != 1000; ++i) {
+			testArgs->request->Wait();
+			++*testArgs->counter;
+			testArgs->response->Signal();
+		}
+
+		return nullptr;
+	}
+
+	void SemaphoreUnitTestCallback(UnitTestList& unitTestList) {
+		unitTestList.name = "Semaphore";
+
+		/* Test TryWait */ {
+			// Test 1
+			Semaphore test1(1);
+
+			auto test1Result1 = test1.TryWait();
+			auto test1Result2 = test1.TryWait();
+			test1.Signal(2);
+			auto test1Result3 = test1.TryWait();
+			auto test1Result4 = test1.TryWait();
+			auto test1Result5 = test1.TryWait();
+
+			UnitTest& unitTest1 = unitTestList.unitTests[unitTestList.unitTestCount++];
+
+			unitTest1.name = "TryWait 1";
+			unitTest1.FormatResult("%s %s %s %s %s", Semaphore::SemaphoreResultToString(test1Result1), Semaphore::SemaphoreResultToString(test1Result2), Semaphore::SemaphoreResultToString(test1Result3), Semaphore::SemaphoreResultToString(test1Result4), Semaphore::SemaphoreResultToString(test1Result5));
+			unitTest1.wantedResult = "SUCCESS ERROR_ALREADY_LOCKED SUCCESS SUCCESS ERROR_ALREADY_LOCKED";
+		}
+		/* Test Wait */ {
+			// Test 1
+			Semaphore test1Request, test1Response;
+			size_t test1Counter = 0;
+			SemaphoreTestArgs test1Args { &test1Request, &test1Response, &test1Counter };
+			Thread test1Thread;
+
+			test1Thread.Begin(SemaphoreTestPingPong, &test1Args);
+
+			size_t test1Correct = 0;
+			for(size_t i = 0; i != 1000; ++i) {
+				test1Request.Signal();
+				test1Response.Wait();
+				test1Correct += test1Counter == i + 1;
+			}
+
+			test1Thread.Join();
+
+			UnitTest& unitTest1 = unitTestList.unitTests[unitTestList.unitTestCount++];
+
+			unitTest1.name = "Wait 1";
+			unitTest1.FormatResult("%llu", (unsigned long long)test1Correct);
+			unitTest1.wantedResult = "1000";
+		}
+	}
+
+	WFE_ADD_UNIT_TEST_CALLBACK(SemaphoreUnitTestCallback)
+}
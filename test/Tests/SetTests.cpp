@@ -112,6 +112,72 @@ namespace wfe {
 			unitTest1.FormatResult("%llu %llu", (unsigned long long)test1Result1, (unsigned long long)test1Result2);
 			unitTest1.wantedResult = "2 3";
 		}
+		/* Test assign_unsorted */ {
+			// Test 1
+			int32_t test1Values[] { 5, 1, 4, 1, 3, 5, 2 };
+			set<int32_t> test1 = { 9 };
+
+			test1.assign_unsorted(test1Values, test1Values + 7);
+
+			UnitTest& unitTest1 = unitTestList.unitTests[unitTestList.unitTestCount++];
+
+			unitTest1.name = "assign_unsorted 1";
+			unitTest1.FormatResult("%llu %i %i %i %i %i", (unsigned long long)test1.size(), test1.begin()[0], test1.begin()[1], test1.begin()[2], test1.begin()[3], test1.begin()[4]);
+			unitTest1.wantedResult = "5 1 2 3 4 5";
+		}
+		/* Test insert_range */ {
+			// Test 1
+			int32_t test1Values[] { 6, 2, 0, 6, 4 };
+			set<int32_t> test1 = { 1, 2, 5 };
+
+			test1.insert_range(test1Values, test1Values + 5);
+
+			UnitTest& unitTest1 = unitTestList.unitTests[unitTestList.unitTestCount++];
+
+			unitTest1.name = "insert_range 1";
+			unitTest1.FormatResult("%llu %i %i %i %i %i %i", (unsigned long long)test1.size(), test1.begin()[0], test1.begin()[1], test1.begin()[2], test1.begin()[3], test1.begin()[4], test1.begin()[5]);
+			unitTest1.wantedResult = "6 0 1 2 4 5 6";
+		}
+		/* Test merge */ {
+			// Test 1
+			set<int32_t> test1Set1 = { 1, 3, 5 };
+			set<int32_t> test1Set2 = { 2, 3, 4 };
+
+			test1Set1.merge(test1Set2);
+
+			UnitTest& unitTest1 = unitTestList.unitTests[unitTestList.unitTestCount++];
+
+			unitTest1.name = "merge 1";
+			unitTest1.FormatResult("%llu %i %i %i %i %i %llu %i", (unsigned long long)test1Set1.size(), test1Set1.begin()[0], test1Set1.begin()[1], test1Set1.begin()[2], test1Set1.begin()[3], test1Set1.begin()[4], (unsigned long long)test1Set2.size(), *test1Set2.begin());
+			unitTest1.wantedResult = "5 1 2 3 4 5 1 3";
+		}
+		/* Test freeze */ {
+			// Test 1
+			set<int32_t> test1;
+			for(int32_t i = 0; i != 1000; ++i)
+				test1.insert(i * 2);
+			
+			test1.freeze();
+
+			bool8_t test1Frozen = test1.is_frozen();
+			size_t test1Result1 = test1.lower_bound(501) - test1.begin();
+			size_t test1Result2 = test1.upper_bound(502) - test1.begin();
+			size_t test1Result3 = test1.lower_bound(1999) - test1.begin();
+			size_t test1Result4 = test1.count(1234) + test1.count(1235);
+
+			test1.erase(0);
+			test1.insert(-1);
+
+			bool8_t test1Thawed = !test1.is_frozen();
+			int32_t test1Result5 = *test1.begin();
+			size_t test1Result6 = test1.lower_bound(501) - test1.begin();
+
+			UnitTest& unitTest1 = unitTestList.unitTests[unitTestList.unitTestCount++];
+
+			unitTest1.name = "freeze 1";
+			unitTest1.FormatResult("%i %llu %llu %llu %llu %i %i %llu", (int32_t)test1Frozen, (unsigned long long)test1Result1, (unsigned long long)test1Result2, (unsigned long long)test1Result3, (unsigned long long)test1Result4, (int32_t)test1Thawed, test1Result5, (unsigned long long)test1Result6);
+			unitTest1.wantedResult = "1 251 252 1000 1 1 -1 251";
+		}
 	}
 
 	WFE_ADD_UNIT_TEST_CALLBACK(SetUnitTestCallback)
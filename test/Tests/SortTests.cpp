@@ -0,0 +1,79 @@
+#include "UnitTests.hpp"
+
+namespace wfe {
+	static const size_t SORT_TEST_VALUE_COUNT = 100000;
+
+	struct SortTestLower {
+		bool8_t operator()(const pair<uint32_t, uint32_t>& pair1, const pair<uint32_t, uint32_t>& pair2) const {
+			return pair1.first < pair2.first;
+		}
+	};
+
+	static void SortTestFill(pair<uint32_t, uint32_t>* values, size_t count) {
+		// Fill the values with pseudo-random keys, numbering them in their original order
+		uint32_t seed = 1;
+		for(size_t i = 0; i != count; ++i) {
+			seed = seed * 1664525u + 1013904223u;
+			new(values + i) pair<uint32_t, uint32_t>(seed >> 22, (uint32_t)i);
+		}
+	}
+	static size_t SortTestCountSorted(const pair<uint32_t, uint32_t>* values, size_t count) {
+		// Count the values that are in order with the previous value, with equal keys kept in their original order
+		size_t sorted = 1;
+		for(size_t i = 1; i != count; ++i)
+			sorted += values[i - 1].first < values[i].first || (values[i - 1].first == values[i].first && values[i - 1].second < values[i].second);
+
+		return sorted;
+	}
+
+	void SortUnitTestCallback(UnitTestList& unitTestList) {
+		unitTestList.name = "Sort";
+
+		/* Test Sort */ {
+			// Test 1
+			string test1Values[] { "delta", "alpha", "echo", "charlie", "bravo" };
+
+			Sort(test1Values, 5);
+
+			UnitTest& unitTest1 = unitTestList.unitTests[unitTestList.unitTestCount++];
+
+			unitTest1.name = "Sort 1";
+			unitTest1.FormatResult("%s %s %s %s %s", test1Values[0].c_str(), test1Values[1].c_str(), test1Values[2].c_str(), test1Values[3].c_str(), test1Values[4].c_str());
+			unitTest1.wantedResult = "alpha bravo charlie delta echo";
+
+			// Test 2
+			pair<uint32_t, uint32_t>* test2Values = (pair<uint32_t, uint32_t>*)AllocMemory(SORT_TEST_VALUE_COUNT * sizeof(pair<uint32_t, uint32_t>));
+			SortTestFill(test2Values, SORT_TEST_VALUE_COUNT);
+
+			Sort<pair<uint32_t, uint32_t>, SortTestLower>(test2Values, SORT_TEST_VALUE_COUNT);
+
+			size_t test2Sorted = SortTestCountSorted(test2Values, SORT_TEST_VALUE_COUNT);
+			FreeMemory(test2Values);
+
+			UnitTest& unitTest2 = unitTestList.unitTests[unitTestList.unitTestCount++];
+
+			unitTest2.name = "Sort 2";
+			unitTest2.FormatResult("%llu", (unsigned long long)test2Sorted);
+			unitTest2.wantedResult = "100000";
+		}
+		/* Test ParallelSort */ {
+			// Test 1
+			JobManager test1Manager(4);
+			pair<uint32_t, uint32_t>* test1Values = (pair<uint32_t, uint32_t>*)AllocMemory(SORT_TEST_VALUE_COUNT * sizeof(pair<uint32_t, uint32_t>));
+			SortTestFill(test1Values, SORT_TEST_VALUE_COUNT);
+
+			ParallelSort<pair<uint32_t, uint32_t>, SortTestLower>(test1Manager, test1Values, SORT_TEST_VALUE_COUNT);
+
+			size_t test1Sorted = SortTestCountSorted(test1Values, SORT_TEST_VALUE_COUNT);
+			FreeMemory(test1Values);
+
+			UnitTest& unitTest1 = unitTestList.unitTests[unitTestList.unitTestCount++];
+
+			unitTest1.name = "ParallelSort 1";
+			unitTest1.FormatResult("%llu", (unsigned long long)test1Sorted);
+			unitTest1.wantedResult = "100000";
+		}
+	}
+
+	WFE_ADD_UNIT_TEST_CALLBACK(SortUnitTestCallback)
+}
\ No newline at end of file
@@ -300,6 +300,23 @@ namespace wfe {
 			unitTest1.FormatResult("%i %i %i %i %i %i", test1Result1, test1Result2, test1Result3, test1Result4, test1Result5, test1Result6);
 			unitTest1.wantedResult = "1 -1 1 1 -1 0";
 		}
+		/* Test string_view */ {
+			// Test 1
+			string test1Str = "assets/textures/albedo.png";
+			string_view test1(test1Str);
+
+			string_view test1Result1 = test1.substr(16, 6);
+			string test1Result2 = (string)test1.substr(7, 8);
+			int32_t test1Result3 = test1Result1 == "albedo";
+			int32_t test1Result4 = test1Result1.compare("albedos") < 0;
+			int32_t test1Result5 = string_view() == string();
+
+			UnitTest& unitTest1 = unitTestList.unitTests[unitTestList.unitTestCount++];
+
+			unitTest1.name = "string_view 1";
+			unitTest1.FormatResult("%s %i %i %i", test1Result2.c_str(), test1Result3, test1Result4, test1Result5);
+			unitTest1.wantedResult = "textures 1 1 1";
+		}
 	}
 
 	WFE_ADD_UNIT_TEST_CALLBACK(StringUnitTestCallback)
@@ -0,0 +1,88 @@
+#include "UnitTests.hpp"
+
+namespace wfe {
+	static void* ThreadTestSum(void* args) {
+		// Sum a large local array, making sure the requested stack size is usable
+		volatile uint64_t values[16384];
+		for(size_t i = 0; i != 16384; ++i)
+			values[i] = i;
+
+		uint64_t sum = 0;
+		for(size_t i = 0; i != 16384; ++i)
+			sum += values[i];
+
+		*(uint64_t*)args = sum;
+
+		return args;
+	}
+
+	static void* ThreadTestIndex(void*) {
+		return (void*)GetCurrentThreadIndex();
+	}
+
+	void ThreadUnitTestCallback(UnitTestList& unitTestList) {
+		unitTestList.name = "Thread";
+
+		/* Test Begin */ {
+			// Test 1
+			Thread test1;
+			uint64_t test1Sum = 0;
+			void* test1Return = nullptr;
+
+			auto test1Result1 = test1.Begin(ThreadTestSum, &test1Sum);
+			auto test1Result2 = test1.Join(&test1Return);
+
+			UnitTest& unitTest1 = unitTestList.unitTests[unitTestList.unitTestCount++];
+
+			unitTest1.name = "Thread::Begin 1";
+			unitTest1.FormatResult("%s %s %llu %i", Thread::ThreadResultToString(test1Result1), Thread::ThreadResultToString(test1Result2), (unsigned long long)test1Sum, (int32_t)(test1Return == &test1Sum));
+			unitTest1.wantedResult = "SUCCESS SUCCESS 134209536 1";
+
+			// Test 2
+			Thread test2;
+			uint64_t test2Sum = 0;
+			void* test2Return = nullptr;
+
+			// Pin the thread to the first processor the current thread may run on
+			uint64_t test2AffinityMask = GetCurrentThreadAffinityMask();
+
+			Thread::ThreadOptions test2Options;
+			test2Options.affinityMask = test2AffinityMask & (~test2AffinityMask + 1);
+			test2Options.stackSize = 1 << 20;
+			test2Options.priority = Thread::PRIORITY_LOW;
+			test2Options.name = "WFE Test Thread With A Long Name";
+
+			auto test2Result1 = test2.Begin(ThreadTestSum, &test2Sum, test2Options);
+			auto test2Result2 = test2.Join(&test2Return);
+
+			UnitTest& unitTest2 = unitTestList.unitTests[unitTestList.unitTestCount++];
+
+			unitTest2.name = "Thread::Begin 2";
+			unitTest2.FormatResult("%s %s %llu %i", Thread::ThreadResultToString(test2Result1), Thread::ThreadResultToString(test2Result2), (unsigned long long)test2Sum, (int32_t)(test2Return == &test2Sum));
+			unitTest2.wantedResult = "SUCCESS SUCCESS 134209536 1";
+		}
+		/* Test GetCurrentThreadIndex */ {
+			// Test 1
+			size_t test1MaxIndex = 0;
+
+			// Start and join many threads one after another, which must reuse the indices of the exited threads
+			for(size_t i = 0; i != 256; ++i) {
+				Thread thread;
+				thread.Begin(ThreadTestIndex, nullptr);
+
+				void* index;
+				thread.Join(&index);
+				if((size_t)index > test1MaxIndex)
+					test1MaxIndex = (size_t)index;
+			}
+
+			UnitTest& unitTest1 = unitTestList.unitTests[unitTestList.unitTestCount++];
+
+			unitTest1.name = "GetCurrentThreadIndex 1";
+			unitTest1.FormatResult("%i", (int32_t)(test1MaxIndex < 64));
+			unitTest1.wantedResult = "1";
+		}
+	}
+
+	WFE_ADD_UNIT_TEST_CALLBACK(ThreadUnitTestCallback)
+}
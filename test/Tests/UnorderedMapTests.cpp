@@ -131,6 +131,49 @@ namespace wfe {
 			unitTest1.FormatResult("%s %s %s %s %s", test1Result1, test1Result2, test1Result3, test1Result4, test1Result5);
 			unitTest1.wantedResult = "one two three four five";
 		}
+		/* Test heterogeneous lookup */ {
+			// Test 1
+			unordered_map<string, uint32_t> test1 { { "albedo", 1 }, { "normal", 2 }, { "roughness", 3 } };
+			const char_t* test1Path = "textures/normal.png";
+			string_view test1View(test1Path + 9, 6);
+
+			// Look for keys given as C strings and views into other strings, none of which are converted to strings
+			uint32_t test1Result1 = test1.find(test1View)->second;
+			size_t test1Result2 = test1.count("roughness") + test1.count(string_view("rough"));
+			uint32_t test1Result3 = test1.at(string_view(test1Path + 9, 6));
+			uint32_t test1Result4 = test1.equal_range("roughness").first->second;
+			size_t test1Result5 = test1.erase("albedo") + test1.erase(string_view("albedo"));
+
+			UnitTest& unitTest1 = unitTestList.unitTests[unitTestList.unitTestCount++];
+
+			unitTest1.name = "heterogeneous lookup 1";
+			unitTest1.FormatResult("%u %llu %u %u %llu %llu", test1Result1, (unsigned long long)test1Result2, test1Result3, test1Result4, (unsigned long long)test1Result5, (unsigned long long)test1.size());
+			unitTest1.wantedResult = "2 1 2 3 1 2";
+		}
+		/* Test find_with_hash */ {
+			// Test 1
+			unordered_map<string, uint32_t> test1Engine { { "Transform", 1 }, { "Mesh", 2 } };
+			unordered_map<string, uint32_t> test1Game;
+			const char_t* test1Keys[] { "Transform", "Mesh", "Player", "Enemy" };
+
+			// Hash every key once, then use the same hash to probe both maps and insert into one of them
+			size_t test1EngineHits = 0, test1Inserted = 0;
+			for(uint32_t i = 0; i != 4; ++i) {
+				uint64_t hash = Hash<string>()(test1Keys[i]);
+				if(test1Engine.find_with_hash(test1Keys[i], hash) != test1Engine.end())
+					++test1EngineHits;
+				else
+					test1Inserted += test1Game.insert_with_hash({ test1Keys[i], i }, hash).second;
+			}
+
+			uint32_t test1Result = test1Game.find_with_hash(string("Enemy"), Hash<string>()("Enemy"))->second;
+
+			UnitTest& unitTest1 = unitTestList.unitTests[unitTestList.unitTestCount++];
+
+			unitTest1.name = "find_with_hash 1";
+			unitTest1.FormatResult("%llu %llu %u %u", (unsigned long long)test1EngineHits, (unsigned long long)test1Inserted, test1Result, test1Game.at("Player"));
+			unitTest1.wantedResult = "2 2 3 2";
+		}
 	}
 
 	WFE_ADD_UNIT_TEST_CALLBACK(UnorderedMapUnitTestCallback)
@@ -105,6 +105,24 @@ namespace wfe {
 			unitTest1.FormatResult("%i %i %i %i %i", test1Result1, test1Result2, test1Result3, test1Result4, test1Result5);
 			unitTest1.wantedResult = "1 1 1 1 1";
 		}
+		/* Test heterogeneous lookup */ {
+			// Test 1
+			unordered_set<string> test1 { "albedo", "normal", "roughness" };
+			const char_t* test1Path = "textures/normal.png";
+
+			// Look for values given as C strings and views into other strings, then probe with a precomputed hash
+			size_t test1Result1 = test1.count(string_view(test1Path + 9, 6)) + test1.count("roughness") + test1.count(string_view(test1Path, 8));
+			uint64_t test1Hash = Hash<string>()("metallic");
+			size_t test1Result2 = test1.insert_with_hash("metallic", test1Hash).second + (test1.find_with_hash("metallic", test1Hash) != test1.end());
+			size_t test1Result3 = test1.erase("albedo") + test1.erase(string_view("albedo"));
+			size_t test1Result4 = test1.count("normal") + test1.count("roughness") + test1.count("metallic");
+
+			UnitTest& unitTest1 = unitTestList.unitTests[unitTestList.unitTestCount++];
+
+			unitTest1.name = "heterogeneous lookup 1";
+			unitTest1.FormatResult("%llu %llu %llu %llu %llu", (unsigned long long)test1Result1, (unsigned long long)test1Result2, (unsigned long long)test1Result3, (unsigned long long)test1Result4, (unsigned long long)test1.size());
+			unitTest1.wantedResult = "2 2 1 3 3";
+		}
 	}
 
 	WFE_ADD_UNIT_TEST_CALLBACK(UnorderedSetUnitTestCallback)